@@ -421,13 +421,15 @@ void HashClearInt3(benchmark::State& state,
     ENUM_BM_CAPACITY(FN, 32, DEVICE, BACKEND)
 
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_BM_BACKEND(FN)                                    \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB)   \
-    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashmapBackend::Slab) \
+#define ENUM_BM_BACKEND(FN)                                             \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB)            \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::OpenAddressing) \
+    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashmapBackend::Slab)          \
     ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashmapBackend::StdGPU)
 #else
-#define ENUM_BM_BACKEND(FN) \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB)
+#define ENUM_BM_BACKEND(FN)                                             \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB)            \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::OpenAddressing)
 #endif
 
 ENUM_BM_BACKEND(HashInsertInt)
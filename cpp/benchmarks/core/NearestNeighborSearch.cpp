@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+
+namespace open3d {
+namespace core {
+
+// Uniformly distributed points in the unit cube.
+static Tensor RandomPoints(int64_t num_points, int seed) {
+    std::vector<float> points(num_points * 3);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    for (float& v : points) {
+        v = uniform(rng);
+    }
+    return Tensor(points, {num_points, 3}, Dtype::Float32);
+}
+
+// Radius enclosing about num_neighbors points of RandomPoints(num_points).
+static double RadiusForNeighbors(int64_t num_points, int num_neighbors) {
+    return std::cbrt(3.0 * num_neighbors / (4.0 * M_PI * num_points));
+}
+
+// All benchmarks query every dataset point, as normal and feature
+// estimation do, and report throughput in queries per second.
+void NanoFlannKnn(benchmark::State& state, int knn) {
+    int64_t num_points = state.range(0);
+    Tensor points = RandomPoints(num_points, 0);
+    Tensor queries = RandomPoints(num_points, 1);
+    nns::NanoFlannIndex index(points);
+
+    for (auto _ : state) {
+        std::pair<Tensor, Tensor> result = index.SearchKnn(queries, knn);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
+void NanoFlannRadius(benchmark::State& state, int num_neighbors) {
+    int64_t num_points = state.range(0);
+    Tensor points = RandomPoints(num_points, 0);
+    Tensor queries = RandomPoints(num_points, 1);
+    nns::NanoFlannIndex index(points);
+    double radius = RadiusForNeighbors(num_points, num_neighbors);
+
+    for (auto _ : state) {
+        std::tuple<Tensor, Tensor, Tensor> result =
+                index.SearchRadius(queries, radius);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
+void NanoFlannHybrid(benchmark::State& state, int max_knn) {
+    int64_t num_points = state.range(0);
+    Tensor points = RandomPoints(num_points, 0);
+    Tensor queries = RandomPoints(num_points, 1);
+    nns::NanoFlannIndex index(points);
+    double radius = RadiusForNeighbors(num_points, 2 * max_knn);
+
+    for (auto _ : state) {
+        std::pair<Tensor, Tensor> result =
+                index.SearchHybrid(queries, radius, max_knn);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
+void FixedRadiusRadius(benchmark::State& state, int num_neighbors) {
+    int64_t num_points = state.range(0);
+    Tensor points = RandomPoints(num_points, 0);
+    Tensor queries = RandomPoints(num_points, 1);
+    double radius = RadiusForNeighbors(num_points, num_neighbors);
+    nns::FixedRadiusIndex index(points, radius);
+
+    for (auto _ : state) {
+        std::tuple<Tensor, Tensor, Tensor> result =
+                index.SearchRadius(queries, radius);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
+void FixedRadiusHybrid(benchmark::State& state, int max_knn) {
+    int64_t num_points = state.range(0);
+    Tensor points = RandomPoints(num_points, 0);
+    Tensor queries = RandomPoints(num_points, 1);
+    double radius = RadiusForNeighbors(num_points, 2 * max_knn);
+    nns::FixedRadiusIndex index(points, radius);
+
+    for (auto _ : state) {
+        std::pair<Tensor, Tensor> result =
+                index.SearchHybrid(queries, radius, max_knn);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
+BENCHMARK_CAPTURE(NanoFlannKnn, K_1, 1)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NanoFlannKnn, K_30, 30)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NanoFlannRadius, Neighbors_30, 30)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(NanoFlannHybrid, MaxKnn_30, 30)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusRadius, Neighbors_30, 30)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(FixedRadiusHybrid, MaxKnn_30, 30)
+        ->Arg(1 << 14)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
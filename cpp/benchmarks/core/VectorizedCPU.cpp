@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/VectorizedCPU.h"
+
+namespace open3d {
+namespace core {
+
+using kernel::SIMDInstructionSet;
+
+static constexpr int64_t kNumElements = 1 << 24;
+
+/// Selects \p isa for the lifetime of the object, or reports an error to
+/// \p state if \p isa is not supported by the CPU.
+class ScopedSIMDInstructionSet {
+public:
+    ScopedSIMDInstructionSet(benchmark::State& state, SIMDInstructionSet isa)
+        : previous_isa_(kernel::GetSIMDInstructionSet()) {
+        if (static_cast<int>(isa) >
+            static_cast<int>(kernel::GetSupportedSIMDInstructionSet())) {
+            state.SkipWithError("Instruction set not supported.");
+            supported_ = false;
+        } else {
+            kernel::SetSIMDInstructionSet(isa);
+        }
+    }
+    ~ScopedSIMDInstructionSet() {
+        kernel::SetSIMDInstructionSet(previous_isa_);
+    }
+    bool IsSupported() const { return supported_; }
+
+private:
+    SIMDInstructionSet previous_isa_;
+    bool supported_ = true;
+};
+
+void BinaryEWAdd(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor lhs = Tensor::Ones({kNumElements}, Dtype::Float32, Device("CPU:0"));
+    Tensor rhs = Tensor::Ones({kNumElements}, Dtype::Float32, Device("CPU:0"));
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = lhs + rhs;
+    }
+    state.SetBytesProcessed(state.iterations() * kNumElements * 3 *
+                            sizeof(float));
+}
+
+void BinaryEWMulScalar(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor lhs = Tensor::Ones({kNumElements}, Dtype::Float64, Device("CPU:0"));
+    Tensor warm_up = lhs * 2.0;
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = lhs * 2.0;
+    }
+    state.SetBytesProcessed(state.iterations() * kNumElements * 2 *
+                            sizeof(double));
+}
+
+void BinaryEWGt(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor lhs = Tensor::Ones({kNumElements}, Dtype::Float32, Device("CPU:0"));
+    Tensor rhs = Tensor::Zeros({kNumElements}, Dtype::Float32, Device("CPU:0"));
+    Tensor warm_up = lhs.Gt(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = lhs.Gt(rhs);
+    }
+}
+
+void UnaryEWSqrt(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor src = Tensor::Ones({kNumElements}, Dtype::Float32, Device("CPU:0"));
+    Tensor warm_up = src.Sqrt();
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = src.Sqrt();
+    }
+}
+
+void UnaryEWAbs(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor src = Tensor::Ones({kNumElements}, Dtype::Int32, Device("CPU:0"));
+    Tensor warm_up = src.Abs();
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = src.Abs();
+    }
+}
+
+void ReductionSum(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor src = Tensor::Ones({kNumElements}, Dtype::Float32, Device("CPU:0"));
+    Tensor warm_up = src.Sum({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = src.Sum({0});
+    }
+    state.SetBytesProcessed(state.iterations() * kNumElements * sizeof(float));
+}
+
+void ReductionMaxRows(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor src = Tensor::Ones({1024, kNumElements / 1024}, Dtype::Float32,
+                              Device("CPU:0"));
+    Tensor warm_up = src.Max({1});
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = src.Max({1});
+    }
+    state.SetBytesProcessed(state.iterations() * kNumElements * sizeof(float));
+}
+
+void ReductionArgMax(benchmark::State& state, SIMDInstructionSet isa) {
+    ScopedSIMDInstructionSet scoped_isa(state, isa);
+    Tensor src = Tensor::Ones({kNumElements}, Dtype::Float32, Device("CPU:0"));
+    Tensor warm_up = src.ArgMax({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        if (!scoped_isa.IsSupported()) break;
+        Tensor dst = src.ArgMax({0});
+    }
+    state.SetBytesProcessed(state.iterations() * kNumElements * sizeof(float));
+}
+
+#define ENUM_VECTORIZED_CPU_BENCHMARKS(FUNC)                               \
+    BENCHMARK_CAPTURE(FUNC, Generic, SIMDInstructionSet::None)             \
+            ->Unit(benchmark::kMillisecond);                               \
+    BENCHMARK_CAPTURE(FUNC, Baseline, SIMDInstructionSet::Baseline)        \
+            ->Unit(benchmark::kMillisecond);                               \
+    BENCHMARK_CAPTURE(FUNC, AVX2, SIMDInstructionSet::AVX2)                \
+            ->Unit(benchmark::kMillisecond);                               \
+    BENCHMARK_CAPTURE(FUNC, AVX512, SIMDInstructionSet::AVX512)            \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_VECTORIZED_CPU_BENCHMARKS(BinaryEWAdd)
+ENUM_VECTORIZED_CPU_BENCHMARKS(BinaryEWMulScalar)
+ENUM_VECTORIZED_CPU_BENCHMARKS(BinaryEWGt)
+ENUM_VECTORIZED_CPU_BENCHMARKS(UnaryEWSqrt)
+ENUM_VECTORIZED_CPU_BENCHMARKS(UnaryEWAbs)
+ENUM_VECTORIZED_CPU_BENCHMARKS(ReductionSum)
+ENUM_VECTORIZED_CPU_BENCHMARKS(ReductionMaxRows)
+ENUM_VECTORIZED_CPU_BENCHMARKS(ReductionArgMax)
+
+#undef ENUM_VECTORIZED_CPU_BENCHMARKS
+
+}  // namespace core
+}  // namespace open3d
@@ -100,6 +100,20 @@ void VoxelDownSample(benchmark::State& state,
     }
 }
 
+void VoxelDownSampleReduction(benchmark::State& state,
+                              float voxel_size,
+                              open3d::geometry::VoxelReduction reduction) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(path, pcd, {"auto", false, false, false});
+
+    // Warp up
+    pcd.VoxelDownSample(voxel_size, reduction);
+
+    for (auto _ : state) {
+        pcd.VoxelDownSample(voxel_size, reduction);
+    }
+}
+
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
@@ -117,7 +131,7 @@ BENCHMARK_CAPTURE(ToLegacyPointCloud, CUDA, core::Device("CUDA:0"))
 #define ENUM_VOXELSIZE(DEVICE, BACKEND)                                       \
     BENCHMARK_CAPTURE(VoxelDownSample, BACKEND##_0_01, DEVICE, 0.01, BACKEND) \
             ->Unit(benchmark::kMillisecond);                                  \
-    BENCHMARK_CAPTURE(VoxelDownSample, BACKEND##_0_02, DEVICE, 0.08, BACKEND) \
+    BENCHMARK_CAPTURE(VoxelDownSample, BACKEND##_0_02, DEVICE, 0.02, BACKEND) \
             ->Unit(benchmark::kMillisecond);                                  \
     BENCHMARK_CAPTURE(VoxelDownSample, BACKEND##_0_04, DEVICE, 0.04, BACKEND) \
             ->Unit(benchmark::kMillisecond);                                  \
@@ -138,6 +152,17 @@ BENCHMARK_CAPTURE(ToLegacyPointCloud, CUDA, core::Device("CUDA:0"))
     ENUM_VOXELSIZE(core::Device("CPU:0"), core::HashmapBackend::TBB)
 #endif
 
+#define ENUM_VOXELDOWNSAMPLE_REDUCTION(NAME, REDUCTION)                  \
+    BENCHMARK_CAPTURE(VoxelDownSampleReduction, NAME##_0_01, 0.01,       \
+                      REDUCTION)                                         \
+            ->Unit(benchmark::kMillisecond);                             \
+    BENCHMARK_CAPTURE(VoxelDownSampleReduction, NAME##_0_04, 0.04,       \
+                      REDUCTION)                                         \
+            ->Unit(benchmark::kMillisecond);                             \
+    BENCHMARK_CAPTURE(VoxelDownSampleReduction, NAME##_0_16, 0.16,       \
+                      REDUCTION)                                         \
+            ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_01, 0.01)
         ->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_02, 0.02)
@@ -151,6 +176,9 @@ BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_16, 0.16)
 BENCHMARK_CAPTURE(LegacyVoxelDownSample, Legacy_0_32, 0.32)
         ->Unit(benchmark::kMillisecond);
 ENUM_VOXELDOWNSAMPLE_BACKEND()
+ENUM_VOXELDOWNSAMPLE_REDUCTION(Mean, open3d::geometry::VoxelReduction::Mean)
+ENUM_VOXELDOWNSAMPLE_REDUCTION(
+        ClosestToCenter, open3d::geometry::VoxelReduction::ClosestToCenter)
 
 }  // namespace geometry
 }  // namespace t
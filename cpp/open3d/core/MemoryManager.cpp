@@ -26,6 +26,7 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <cstdlib>
 #include <numeric>
 #include <unordered_map>
 
@@ -98,14 +99,31 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+/// Selects the CPU memory manager from the OPEN3D_CPU_MEMORY_MANAGER
+/// environment variable. This is evaluated only once, since blocks allocated by
+/// one manager cannot be freed by another.
+static std::shared_ptr<DeviceMemoryManager> CreateCPUMemoryManager() {
+    const char* env_p = std::getenv("OPEN3D_CPU_MEMORY_MANAGER");
+    std::string type = env_p ? utility::ToLower(env_p) : "simple";
+    if (type == "cached") {
+        utility::LogDebug("Using CPUCachedMemoryManager.");
+        return std::make_shared<CPUCachedMemoryManager>();
+    } else if (type != "simple") {
+        utility::LogWarning(
+                "Unknown OPEN3D_CPU_MEMORY_MANAGER '{}', expected 'simple' or "
+                "'cached'. Falling back to 'simple'.",
+                env_p);
+    }
+    return std::make_shared<CPUMemoryManager>();
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
                               std::shared_ptr<DeviceMemoryManager>,
                               utility::hash_enum_class>
             map_device_type_to_memory_manager = {
-                    {Device::DeviceType::CPU,
-                     std::make_shared<CPUMemoryManager>()},
+                    {Device::DeviceType::CPU, CreateCPUMemoryManager()},
 #ifdef BUILD_CUDA_MODULE
 #ifdef BUILD_CACHED_CUDA_MANAGER
                     {Device::DeviceType::CUDA,
@@ -0,0 +1,356 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+// All blocks returned to the user are aligned to a cache line.
+static constexpr size_t kAlignment = 64;
+// Every block is prefixed with a header of kAlignment bytes that records its
+// size class, so that Free does not need a global pointer lookup.
+static constexpr size_t kHeaderSize = kAlignment;
+// Blocks at least this large are aligned to and advised as huge pages.
+static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+// Blocks larger than this are not cached and go straight to the system.
+static constexpr size_t kMaxCachedSize = size_t(1) << 30;
+// Only blocks up to this size are kept in per-thread caches.
+static constexpr size_t kMaxThreadCachedSize = 1024 * 1024;
+// Upper bound of bytes held by a single per-thread cache.
+static constexpr size_t kMaxThreadCacheByteSize = 8 * 1024 * 1024;
+// Size class marker for blocks that bypass the cache.
+static constexpr size_t kUncachedClass = static_cast<size_t>(-1);
+
+struct BlockHeader {
+    size_t size_class_;
+    size_t alloc_size_;
+};
+static_assert(sizeof(BlockHeader) <= kHeaderSize,
+              "BlockHeader must fit in kHeaderSize.");
+
+static inline BlockHeader* GetHeader(void* ptr) {
+    return reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr) -
+                                          kHeaderSize);
+}
+
+static inline int FloorLog2(size_t x) {
+    int log2 = 0;
+    while (x >>= 1) {
+        ++log2;
+    }
+    return log2;
+}
+
+/// Size classes: multiples of 64 bytes up to 256 bytes, then four equally
+/// spaced classes per power of two, bounding internal fragmentation to 25%.
+static inline size_t SizeToClass(size_t byte_size) {
+    if (byte_size <= 256) {
+        return byte_size == 0 ? 0 : (byte_size - 1) / 64;
+    }
+    int p = FloorLog2(byte_size - 1);
+    size_t step = size_t(1) << (p - 2);
+    size_t sub = ((byte_size - (size_t(1) << p)) + step - 1) / step;
+    return 4 + 4 * (p - 8) + (sub - 1);
+}
+
+static inline size_t ClassToSize(size_t size_class) {
+    if (size_class < 4) {
+        return (size_class + 1) * 64;
+    }
+    int p = static_cast<int>((size_class - 4) / 4) + 8;
+    size_t sub = (size_class - 4) % 4 + 1;
+    return (size_t(1) << p) + sub * (size_t(1) << (p - 2));
+}
+
+static const size_t kNumSizeClasses = SizeToClass(kMaxCachedSize) + 1;
+
+/// Allocates \p alloc_size bytes (header included) from the system.
+static void* SystemMalloc(size_t alloc_size) {
+    size_t alignment = alloc_size >= kHugePageSize ? kHugePageSize : kAlignment;
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(alloc_size, alignment);
+#else
+    if (posix_memalign(&ptr, alignment, alloc_size) != 0) {
+        ptr = nullptr;
+    }
+#endif
+    if (!ptr) {
+        utility::LogError("CPU malloc of {} bytes failed.", alloc_size);
+    }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (alloc_size >= kHugePageSize) {
+        // Best effort, the kernel may not support transparent huge pages.
+        madvise(ptr, alloc_size, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+}
+
+static void SystemFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+/// Frees a list of user pointers and returns the number of bytes released.
+static size_t SystemFreeBlocks(std::vector<void*>& blocks) {
+    size_t byte_size = 0;
+    for (void* ptr : blocks) {
+        byte_size += GetHeader(ptr)->alloc_size_;
+        SystemFree(GetHeader(ptr));
+    }
+    blocks.clear();
+    return byte_size;
+}
+
+// Set once the calling thread's cache has been destroyed at thread exit.
+// Trivially destructible, so it remains valid for late Free calls.
+static thread_local bool tls_thread_cache_destroyed = false;
+
+/// Per-thread cache of small blocks. The mutex is only contended when
+/// ReleaseCache is called from another thread.
+struct ThreadCache {
+    std::mutex mutex_;
+    std::vector<std::vector<void*>> free_blocks_;
+    size_t cached_byte_size_ = 0;
+};
+
+// Singleton cacher shared by all CPUCachedMemoryManager instances.
+// Freed blocks are pushed to the calling thread's cache first and spill over to
+// a global size-class pool guarded by a mutex.
+class CPUCacher {
+public:
+    static CPUCacher& GetInstance() {
+        // Intentionally leaked: Tensors held by static objects may be freed
+        // after all static destructors have run.
+        static CPUCacher* instance = new CPUCacher();
+        return *instance;
+    }
+
+    CPUCacher() : free_blocks_(kNumSizeClasses) {}
+
+    void* Malloc(size_t byte_size, bool& cache_hit) {
+        cache_hit = false;
+        if (byte_size > kMaxCachedSize) {
+            return NewBlock(byte_size + kHeaderSize, kUncachedClass);
+        }
+
+        const size_t size_class = SizeToClass(byte_size);
+        const size_t alloc_size = ClassToSize(size_class) + kHeaderSize;
+        void* ptr = nullptr;
+
+        if (ThreadCache* cache = GetThreadCache()) {
+            if (alloc_size <= kMaxThreadCachedSize) {
+                std::lock_guard<std::mutex> lock(cache->mutex_);
+                std::vector<void*>& blocks = cache->free_blocks_[size_class];
+                if (!blocks.empty()) {
+                    ptr = blocks.back();
+                    blocks.pop_back();
+                    cache->cached_byte_size_ -= alloc_size;
+                }
+            }
+        }
+        if (!ptr) {
+            std::lock_guard<std::mutex> lock(global_mutex_);
+            std::vector<void*>& blocks = free_blocks_[size_class];
+            if (!blocks.empty()) {
+                ptr = blocks.back();
+                blocks.pop_back();
+            }
+        }
+
+        if (ptr) {
+            cache_hit = true;
+            return ptr;
+        }
+        return NewBlock(alloc_size, size_class);
+    }
+
+    void Free(void* ptr) {
+        const BlockHeader* header = GetHeader(ptr);
+        if (header->size_class_ == kUncachedClass) {
+            SystemFree(GetHeader(ptr));
+            return;
+        }
+
+        const size_t size_class = header->size_class_;
+        const size_t alloc_size = header->alloc_size_;
+        if (alloc_size <= kMaxThreadCachedSize) {
+            if (ThreadCache* cache = GetThreadCache()) {
+                std::lock_guard<std::mutex> lock(cache->mutex_);
+                if (cache->cached_byte_size_ + alloc_size <=
+                    kMaxThreadCacheByteSize) {
+                    cache->free_blocks_[size_class].push_back(ptr);
+                    cache->cached_byte_size_ += alloc_size;
+                    return;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(global_mutex_);
+        free_blocks_[size_class].push_back(ptr);
+    }
+
+    /// Returns the number of bytes released to the system.
+    size_t ReleaseCache() {
+        size_t total_bytes = 0;
+        {
+            std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+            for (ThreadCache* cache : thread_caches_) {
+                std::lock_guard<std::mutex> lock(cache->mutex_);
+                for (std::vector<void*>& blocks : cache->free_blocks_) {
+                    total_bytes += SystemFreeBlocks(blocks);
+                }
+                cache->cached_byte_size_ = 0;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(global_mutex_);
+            for (std::vector<void*>& blocks : free_blocks_) {
+                total_bytes += SystemFreeBlocks(blocks);
+            }
+        }
+        utility::LogDebug("[CPUCacher] {} bytes released.", total_bytes);
+        return total_bytes;
+    }
+
+private:
+    /// Owns the calling thread's cache and hands its blocks over to the global
+    /// pool when the thread exits.
+    struct ThreadCacheHolder {
+        ThreadCache* cache_ = nullptr;
+        ~ThreadCacheHolder() {
+            tls_thread_cache_destroyed = true;
+            if (cache_) {
+                GetInstance().UnregisterThreadCache(cache_);
+            }
+        }
+    };
+
+    static ThreadCache* GetThreadCache() {
+        if (tls_thread_cache_destroyed) {
+            return nullptr;
+        }
+        static thread_local ThreadCacheHolder holder;
+        if (!holder.cache_) {
+            holder.cache_ = GetInstance().RegisterThreadCache();
+        }
+        return holder.cache_;
+    }
+
+    ThreadCache* RegisterThreadCache() {
+        ThreadCache* cache = new ThreadCache();
+        cache->free_blocks_.resize(kNumSizeClasses);
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        thread_caches_.insert(cache);
+        return cache;
+    }
+
+    void UnregisterThreadCache(ThreadCache* cache) {
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex_);
+            thread_caches_.erase(cache);
+        }
+        {
+            std::lock_guard<std::mutex> lock(global_mutex_);
+            for (size_t i = 0; i < cache->free_blocks_.size(); ++i) {
+                free_blocks_[i].insert(free_blocks_[i].end(),
+                                       cache->free_blocks_[i].begin(),
+                                       cache->free_blocks_[i].end());
+            }
+        }
+        delete cache;
+    }
+
+    static void* NewBlock(size_t alloc_size, size_t size_class) {
+        void* base = SystemMalloc(alloc_size);
+        BlockHeader* header = static_cast<BlockHeader*>(base);
+        header->size_class_ = size_class;
+        header->alloc_size_ = alloc_size;
+        return static_cast<char*>(base) + kHeaderSize;
+    }
+
+private:
+    std::mutex global_mutex_;
+    std::vector<std::vector<void*>> free_blocks_;
+
+    std::mutex registry_mutex_;
+    std::unordered_set<ThreadCache*> thread_caches_;
+};
+
+CPUCachedMemoryManager::CPUCachedMemoryManager() {}
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (byte_size == 0) return nullptr;
+
+    bool cache_hit = false;
+    void* ptr = CPUCacher::GetInstance().Malloc(byte_size, cache_hit);
+    if (cache_hit) {
+        MemoryManagerStatistic::GetInstance().IncrementCountCacheHit(device);
+    }
+    return ptr;
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    if (ptr) {
+        CPUCacher::GetInstance().Free(ptr);
+    }
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    size_t byte_size = CPUCacher::GetInstance().ReleaseCache();
+    MemoryManagerStatistic::GetInstance().IncrementCacheReleasedByteSize(
+            byte_size, Device("CPU:0"));
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -104,6 +104,13 @@ void MemoryManagerStatistic::Print() const {
                              value_pair.second.count_malloc_,
                              value_pair.second.count_free_);
         }
+        if (value_pair.second.count_cache_hit_ > 0 ||
+            value_pair.second.cache_released_byte_size_ > 0) {
+            utility::LogInfo("{}: cache hits {}, released {} bytes",
+                             value_pair.first.ToString(),
+                             value_pair.second.count_cache_hit_,
+                             value_pair.second.cache_released_byte_size_);
+        }
     }
     utility::LogInfo("---------------------------------------------");
 }
@@ -123,5 +130,16 @@ void MemoryManagerStatistic::IncrementCountFree(void* ptr,
     statistics_[device].active_allocations_.erase(ptr);
 }
 
+void MemoryManagerStatistic::IncrementCountCacheHit(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_[device].count_cache_hit_++;
+}
+
+void MemoryManagerStatistic::IncrementCacheReleasedByteSize(
+        size_t byte_size, const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_[device].cache_released_byte_size_ += byte_size;
+}
+
 }  // namespace core
 }  // namespace open3d
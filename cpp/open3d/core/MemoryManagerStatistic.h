@@ -63,6 +63,11 @@ public:
                               size_t byte_size,
                               const Device& device);
     void IncrementCountFree(void* ptr, const Device& device);
+    /// Records a Malloc that was served from a memory manager's cache.
+    void IncrementCountCacheHit(const Device& device);
+    /// Records the number of bytes returned to the system by ReleaseCache.
+    void IncrementCacheReleasedByteSize(size_t byte_size,
+                                        const Device& device);
 
 private:
     MemoryManagerStatistic() = default;
@@ -70,6 +75,8 @@ private:
     struct MemoryStatistics {
         size_t count_malloc_ = 0;
         size_t count_free_ = 0;
+        size_t count_cache_hit_ = 0;
+        size_t cache_released_byte_size_ = 0;
         std::unordered_map<void*, size_t> active_allocations_;
     };
 
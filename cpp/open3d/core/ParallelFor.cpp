@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ParallelFor.h"
+
+#include <tbb/blocked_range.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Global thread limit. The tbb::global_control object must stay alive for
+/// the limit to be in effect.
+class ThreadLimit {
+public:
+    static ThreadLimit& GetInstance() {
+        static ThreadLimit instance;
+        return instance;
+    }
+
+    void Set(int num_threads) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (num_threads <= 0) {
+            num_threads = default_num_threads_;
+        }
+        if (num_threads <= 0) {
+            control_ = nullptr;
+        } else {
+            control_ = std::make_unique<tbb::global_control>(
+                    tbb::global_control::max_allowed_parallelism,
+                    static_cast<size_t>(num_threads));
+        }
+#ifdef _OPENMP
+        // Keep the kernels that still use OpenMP consistent.
+        omp_set_num_threads(num_threads > 0
+                                    ? num_threads
+                                    : tbb::this_task_arena::max_concurrency());
+#endif
+    }
+
+private:
+    ThreadLimit() {
+        if (const char* env = std::getenv("OPEN3D_NUM_THREADS")) {
+            try {
+                default_num_threads_ = std::stoi(env);
+            } catch (const std::exception&) {
+                utility::LogWarning(
+                        "Ignoring invalid OPEN3D_NUM_THREADS value \"{}\".",
+                        env);
+            }
+            Set(default_num_threads_);
+        }
+    }
+
+    std::mutex mutex_;
+    std::unique_ptr<tbb::global_control> control_;
+    int default_num_threads_ = 0;
+};
+
+int GetNumThreads() {
+    ThreadLimit::GetInstance();
+    return static_cast<int>(std::min<size_t>(
+            tbb::global_control::active_value(
+                    tbb::global_control::max_allowed_parallelism),
+            tbb::this_task_arena::max_concurrency()));
+}
+
+void SetNumThreads(int num_threads) {
+    ThreadLimit::GetInstance().Set(num_threads);
+}
+
+void ParallelForRange(int64_t n,
+                      const std::function<void(int64_t, int64_t)>& func,
+                      int64_t grain_size) {
+    if (n <= 0) {
+        return;
+    }
+    grain_size = std::max<int64_t>(grain_size, 1);
+    if (n <= grain_size || GetNumThreads() == 1) {
+        func(0, n);
+        return;
+    }
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, n, grain_size),
+                      [&func](const tbb::blocked_range<int64_t>& range) {
+                          func(range.begin(), range.end());
+                      });
+}
+
+void ParallelInvoke(const std::vector<std::function<void()>>& tasks) {
+    ParallelFor(static_cast<int64_t>(tasks.size()),
+                [&tasks](int64_t i) { tasks[i](); });
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace open3d {
+namespace core {
+
+/// Returns the maximum number of threads used by ParallelFor and
+/// ParallelInvoke.
+int GetNumThreads();
+
+/// Sets the maximum number of threads used by ParallelFor and ParallelInvoke.
+/// The limit is global and also applies to ParallelFor called from any user
+/// thread. If \p num_threads <= 0, the limit is reset to the default, which is
+/// the number of hardware threads or the value of the environment variable
+/// OPEN3D_NUM_THREADS if it is set.
+void SetNumThreads(int num_threads);
+
+/// Runs \p func(begin, end) on disjoint sub-ranges covering [0, \p n).
+///
+/// Sub-ranges are scheduled on a shared work-stealing thread pool. It is safe
+/// to call ParallelFor from within another ParallelFor or from multiple user
+/// threads: nested calls reuse the pool instead of spawning new threads, so
+/// cores are not oversubscribed. Exceptions thrown by \p func are rethrown in
+/// the calling thread.
+///
+/// \param n Number of iterations.
+/// \param func Function called with the range [begin, end) of a sub-range.
+/// \param grain_size Sub-ranges are split in halves only while they are
+/// larger than this, so they hold at least \p grain_size / 2 iterations,
+/// but may be much larger. If \p n <= \p grain_size, \p func is called once
+/// in the calling thread. Increase it for cheap iterations to reduce
+/// scheduling overhead.
+void ParallelForRange(int64_t n,
+                      const std::function<void(int64_t, int64_t)>& func,
+                      int64_t grain_size = 1);
+
+/// Runs \p func(i) for each i in [0, \p n). See ParallelForRange.
+template <typename func_t>
+void ParallelFor(int64_t n, const func_t& func, int64_t grain_size = 1) {
+    ParallelForRange(
+            n,
+            [&func](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    func(i);
+                }
+            },
+            grain_size);
+}
+
+/// Adds \p func(i, sum) for each i in [0, \p n) to the \p size values at
+/// \p result. \p func adds its terms to \p sum, a zero-initialized partial
+/// sum of \p size values. There is one partial sum per thread-sized block of
+/// iterations, and the partial sums are added in a fixed order, so the
+/// result only depends on the number of threads.
+template <typename scalar_t, typename func_t>
+void ParallelReduceSum(int64_t n,
+                       int64_t size,
+                       const func_t& func,
+                       scalar_t* result) {
+    const int64_t num_blocks = std::min<int64_t>(n, GetNumThreads());
+    std::vector<std::vector<scalar_t>> partial_sums(
+            num_blocks, std::vector<scalar_t>(size, 0));
+    ParallelFor(num_blocks, [&](int64_t block_idx) {
+        const int64_t begin = n * block_idx / num_blocks;
+        const int64_t end = n * (block_idx + 1) / num_blocks;
+        scalar_t* sum = partial_sums[block_idx].data();
+        for (int64_t i = begin; i < end; ++i) {
+            func(i, sum);
+        }
+    });
+    for (const std::vector<scalar_t>& partial_sum : partial_sums) {
+        for (int64_t j = 0; j < size; ++j) {
+            result[j] += partial_sum[j];
+        }
+    }
+}
+
+/// Runs independent \p tasks concurrently on the thread pool and waits for
+/// all of them to finish.
+void ParallelInvoke(const std::vector<std::function<void()>>& tasks);
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,358 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpression.h"
+
+#include <algorithm>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+struct TensorExpression::Node {
+    enum class Type { Tensor, Scalar, UnaryEW, BinaryEW };
+
+    Type type_ = Type::Tensor;
+    Tensor tensor_;
+    Scalar scalar_ = Scalar(0.0);
+    kernel::UnaryEWOpCode unary_op_code_ = kernel::UnaryEWOpCode::Neg;
+    kernel::BinaryEWOpCode binary_op_code_ = kernel::BinaryEWOpCode::Add;
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+};
+
+using NodePtr = std::shared_ptr<const TensorExpression::Node>;
+using NodeType = TensorExpression::Node::Type;
+
+/// Appends all tensor leaves of \p node to \p leaves, in evaluation order.
+static void CollectTensorLeaves(const NodePtr& node,
+                                std::vector<Tensor>& leaves) {
+    if (node->type_ == NodeType::Tensor) {
+        leaves.push_back(node->tensor_);
+    }
+    if (node->lhs_) CollectTensorLeaves(node->lhs_, leaves);
+    if (node->rhs_) CollectTensorLeaves(node->rhs_, leaves);
+}
+
+/// Two leaves are merged into one Indexer input if they are the same view.
+static bool IsSameView(const Tensor& a, const Tensor& b) {
+    return a.GetDataPtr() == b.GetDataPtr() && a.GetShape() == b.GetShape() &&
+           a.GetStrides() == b.GetStrides();
+}
+
+static int64_t CountUniqueTensorLeaves(const NodePtr& node) {
+    std::vector<Tensor> leaves;
+    CollectTensorLeaves(node, leaves);
+    std::vector<Tensor> unique_leaves;
+    for (const Tensor& leaf : leaves) {
+        auto is_same_view = [&](const Tensor& t) {
+            return IsSameView(t, leaf);
+        };
+        if (std::none_of(unique_leaves.begin(), unique_leaves.end(),
+                         is_same_view)) {
+            unique_leaves.push_back(leaf);
+        }
+    }
+    return static_cast<int64_t>(unique_leaves.size());
+}
+
+static bool IsFloatOnlyUnaryOp(kernel::UnaryEWOpCode op_code) {
+    return op_code == kernel::UnaryEWOpCode::Sqrt ||
+           op_code == kernel::UnaryEWOpCode::Sin ||
+           op_code == kernel::UnaryEWOpCode::Cos ||
+           op_code == kernel::UnaryEWOpCode::Exp;
+}
+
+static void CheckUnaryOps(const NodePtr& node, Dtype dtype) {
+    if (node->type_ == NodeType::UnaryEW &&
+        IsFloatOnlyUnaryOp(node->unary_op_code_) && dtype != Dtype::Float32 &&
+        dtype != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          dtype.ToString());
+    }
+    if (node->lhs_) CheckUnaryOps(node->lhs_, dtype);
+    if (node->rhs_) CheckUnaryOps(node->rhs_, dtype);
+}
+
+/// Evaluates \p node op by op with regular Tensor operations.
+static Tensor EvalEager(const NodePtr& node,
+                        Dtype dtype,
+                        const Device& device) {
+    switch (node->type_) {
+        case NodeType::Tensor:
+            return node->tensor_;
+        case NodeType::Scalar: {
+            Tensor dst;
+            DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+                dst = Tensor::Full({}, node->scalar_.To<scalar_t>(), dtype,
+                                   device);
+            });
+            return dst;
+        }
+        case NodeType::UnaryEW: {
+            Tensor src = EvalEager(node->lhs_, dtype, device);
+            Tensor dst(src.GetShape(), dtype, device);
+            kernel::UnaryEW(src, dst, node->unary_op_code_);
+            return dst;
+        }
+        case NodeType::BinaryEW: {
+            Tensor lhs = EvalEager(node->lhs_, dtype, device);
+            Tensor rhs = EvalEager(node->rhs_, dtype, device);
+            Tensor dst(shape_util::BroadcastedShape(lhs.GetShape(),
+                                                    rhs.GetShape()),
+                       dtype, device);
+            kernel::BinaryEW(lhs, rhs, dst, node->binary_op_code_);
+            return dst;
+        }
+    }
+    utility::LogError("Internal error: unknown node type.");
+    return Tensor();
+}
+
+static NodePtr MakeTensorNode(const Tensor& tensor) {
+    auto node = std::make_shared<TensorExpression::Node>();
+    node->type_ = NodeType::Tensor;
+    node->tensor_ = tensor;
+    return node;
+}
+
+/// Materializes subtrees until the expression fits in one Indexer, which
+/// supports at most MAX_INPUTS inputs.
+static NodePtr LimitNumInputs(const NodePtr& node,
+                              Dtype dtype,
+                              const Device& device) {
+    if (CountUniqueTensorLeaves(node) <= MAX_INPUTS) {
+        return node;
+    }
+    if (node->type_ == NodeType::UnaryEW) {
+        auto limited = std::make_shared<TensorExpression::Node>(*node);
+        limited->lhs_ = LimitNumInputs(node->lhs_, dtype, device);
+        return limited;
+    }
+
+    // Binary node: limit both sides, then materialize the larger side.
+    auto limited = std::make_shared<TensorExpression::Node>(*node);
+    limited->lhs_ = LimitNumInputs(node->lhs_, dtype, device);
+    limited->rhs_ = LimitNumInputs(node->rhs_, dtype, device);
+    while (CountUniqueTensorLeaves(limited) > MAX_INPUTS) {
+        int64_t num_lhs_leaves = CountUniqueTensorLeaves(limited->lhs_);
+        int64_t num_rhs_leaves = CountUniqueTensorLeaves(limited->rhs_);
+        NodePtr& larger = num_lhs_leaves >= num_rhs_leaves ? limited->lhs_
+                                                           : limited->rhs_;
+        larger = MakeTensorNode(EvalEager(larger, dtype, device));
+    }
+    return limited;
+}
+
+/// Emits the postfix program of \p node and collects its unique inputs.
+static void Compile(const NodePtr& node,
+                    std::vector<Tensor>& inputs,
+                    std::vector<kernel::FusedEWInstruction>& program) {
+    kernel::FusedEWInstruction instruction;
+    switch (node->type_) {
+        case NodeType::Tensor: {
+            auto it = std::find_if(inputs.begin(), inputs.end(),
+                                   [&](const Tensor& t) {
+                                       return IsSameView(t, node->tensor_);
+                                   });
+            instruction.type_ = kernel::FusedEWInstructionType::Input;
+            instruction.input_idx_ = it - inputs.begin();
+            if (it == inputs.end()) {
+                inputs.push_back(node->tensor_);
+            }
+            break;
+        }
+        case NodeType::Scalar:
+            instruction.type_ = kernel::FusedEWInstructionType::Scalar;
+            instruction.scalar_ = node->scalar_;
+            break;
+        case NodeType::UnaryEW:
+            Compile(node->lhs_, inputs, program);
+            instruction.type_ = kernel::FusedEWInstructionType::UnaryEW;
+            instruction.unary_op_code_ = node->unary_op_code_;
+            break;
+        case NodeType::BinaryEW:
+            Compile(node->lhs_, inputs, program);
+            Compile(node->rhs_, inputs, program);
+            instruction.type_ = kernel::FusedEWInstructionType::BinaryEW;
+            instruction.binary_op_code_ = node->binary_op_code_;
+            break;
+    }
+    program.push_back(instruction);
+}
+
+TensorExpression::TensorExpression(const Tensor& tensor)
+    : node_(MakeTensorNode(tensor)) {}
+
+TensorExpression::TensorExpression(Scalar scalar) {
+    auto node = std::make_shared<Node>();
+    node->type_ = NodeType::Scalar;
+    node->scalar_ = scalar;
+    node_ = node;
+}
+
+TensorExpression::TensorExpression(const std::shared_ptr<const Node>& node)
+    : node_(node) {}
+
+SizeVector TensorExpression::GetShape() const {
+    std::vector<Tensor> leaves;
+    CollectTensorLeaves(node_, leaves);
+    SizeVector shape;
+    for (const Tensor& leaf : leaves) {
+        shape = shape_util::BroadcastedShape(shape, leaf.GetShape());
+    }
+    return shape;
+}
+
+Dtype TensorExpression::GetDtype() const {
+    std::vector<Tensor> leaves;
+    CollectTensorLeaves(node_, leaves);
+    if (leaves.empty()) {
+        utility::LogError("TensorExpression must contain at least one tensor.");
+    }
+    for (const Tensor& leaf : leaves) {
+        if (leaf.GetDtype() != leaves[0].GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              leaves[0].GetDtype().ToString(),
+                              leaf.GetDtype().ToString());
+        }
+    }
+    return leaves[0].GetDtype();
+}
+
+Device TensorExpression::GetDevice() const {
+    std::vector<Tensor> leaves;
+    CollectTensorLeaves(node_, leaves);
+    if (leaves.empty()) {
+        utility::LogError("TensorExpression must contain at least one tensor.");
+    }
+    for (const Tensor& leaf : leaves) {
+        if (leaf.GetDevice() != leaves[0].GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              leaves[0].GetDevice().ToString(),
+                              leaf.GetDevice().ToString());
+        }
+    }
+    return leaves[0].GetDevice();
+}
+
+Tensor TensorExpression::Eval() const {
+    Tensor dst(GetShape(), GetDtype(), GetDevice());
+    EvalInto(dst);
+    return dst;
+}
+
+void TensorExpression::EvalInto(Tensor& dst) const {
+    const Dtype dtype = GetDtype();
+    const Device device = GetDevice();
+    dst.AssertShape(GetShape());
+    dst.AssertDtype(dtype);
+    dst.AssertDevice(device);
+    CheckUnaryOps(node_, dtype);
+
+    if (node_->type_ == NodeType::Tensor) {
+        dst.AsRvalue() = node_->tensor_;
+    } else if (device.GetType() == Device::DeviceType::CPU) {
+        std::vector<Tensor> inputs;
+        std::vector<kernel::FusedEWInstruction> program;
+        Compile(LimitNumInputs(node_, dtype, device), inputs, program);
+        kernel::FusedEW(inputs, program, dst);
+    } else {
+        dst.AsRvalue() = EvalEager(node_, dtype, device);
+    }
+}
+
+TensorExpression TensorExpression::UnaryOp(
+        kernel::UnaryEWOpCode op_code) const {
+    auto node = std::make_shared<Node>();
+    node->type_ = NodeType::UnaryEW;
+    node->unary_op_code_ = op_code;
+    node->lhs_ = node_;
+    return TensorExpression(node);
+}
+
+TensorExpression TensorExpression::BinaryOp(const TensorExpression& lhs,
+                                            const TensorExpression& rhs,
+                                            kernel::BinaryEWOpCode op_code) {
+    if (kernel::s_boolean_binary_ew_op_codes.count(op_code)) {
+        utility::LogError(
+                "TensorExpression only supports arithmetic binary ops.");
+    }
+    auto node = std::make_shared<Node>();
+    node->type_ = NodeType::BinaryEW;
+    node->binary_op_code_ = op_code;
+    node->lhs_ = lhs.node_;
+    node->rhs_ = rhs.node_;
+    return TensorExpression(node);
+}
+
+TensorExpression TensorExpression::Sqrt() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Sqrt);
+}
+
+TensorExpression TensorExpression::Sin() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Sin);
+}
+
+TensorExpression TensorExpression::Cos() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Cos);
+}
+
+TensorExpression TensorExpression::Neg() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Neg);
+}
+
+TensorExpression TensorExpression::Exp() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Exp);
+}
+
+TensorExpression TensorExpression::Abs() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Abs);
+}
+
+TensorExpression TensorExpression::Floor() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Floor);
+}
+
+TensorExpression TensorExpression::Ceil() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Ceil);
+}
+
+TensorExpression TensorExpression::Round() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Round);
+}
+
+TensorExpression TensorExpression::Trunc() const {
+    return UnaryOp(kernel::UnaryEWOpCode::Trunc);
+}
+
+}  // namespace core
+}  // namespace open3d
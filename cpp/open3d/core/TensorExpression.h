@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+
+/// Lazily evaluated element-wise expression over Tensors.
+///
+/// Arithmetic on TensorExpression only records an expression graph. Eval()
+/// fuses the whole graph into a single pass over the broadcasted output, so
+/// that no full-size temporary is allocated per operation. This is opt-in:
+/// wrap any operand to switch a chain of element-wise ops to lazy mode, e.g.
+///
+///     Tensor dst = ((TensorExpression(a) - b) * c + d).Eval();
+///
+/// All tensor operands must have the same dtype and device; scalars are
+/// converted to the tensor dtype. Supported ops are Add, Sub, Mul, Div and the
+/// dtype-preserving unary ops. On devices without a fused kernel, Eval() falls
+/// back to evaluating the graph op by op.
+class TensorExpression {
+public:
+    /// Wraps \p tensor as a leaf of an expression. The tensor is referenced,
+    /// not copied, so in-place changes before Eval() are visible.
+    TensorExpression(const Tensor& tensor);
+
+    /// Wraps \p scalar as a constant leaf of an expression.
+    TensorExpression(Scalar scalar);
+
+    /// Evaluates the expression into a new contiguous tensor.
+    Tensor Eval() const;
+
+    /// Evaluates the expression into \p dst, whose shape must be the
+    /// broadcasted shape of the expression and whose dtype and device must
+    /// match the operands. \p dst may alias one of the operands.
+    void EvalInto(Tensor& dst) const;
+
+    /// Broadcasted shape of the expression.
+    SizeVector GetShape() const;
+    Dtype GetDtype() const;
+    Device GetDevice() const;
+
+    TensorExpression Sqrt() const;
+    TensorExpression Sin() const;
+    TensorExpression Cos() const;
+    TensorExpression Neg() const;
+    TensorExpression Exp() const;
+    TensorExpression Abs() const;
+    TensorExpression Floor() const;
+    TensorExpression Ceil() const;
+    TensorExpression Round() const;
+    TensorExpression Trunc() const;
+    TensorExpression operator-() const { return Neg(); }
+
+    /// Binary op between expressions, tensors or scalars. At least one of
+    /// \p lhs and \p rhs must contain a tensor.
+    static TensorExpression BinaryOp(const TensorExpression& lhs,
+                                     const TensorExpression& rhs,
+                                     kernel::BinaryEWOpCode op_code);
+
+    /// Expression graph node, defined in TensorExpression.cpp.
+    struct Node;
+
+private:
+    explicit TensorExpression(const std::shared_ptr<const Node>& node);
+    TensorExpression UnaryOp(kernel::UnaryEWOpCode op_code) const;
+
+    std::shared_ptr<const Node> node_;
+};
+
+// The overloads with Tensor operands are required to take precedence over the
+// templated scalar operators of Tensor.
+#define OPEN3D_TENSOR_EXPRESSION_BINARY_OP(OP, OP_CODE)                       \
+    inline TensorExpression operator OP(const TensorExpression& lhs,          \
+                                        const TensorExpression& rhs) {        \
+        return TensorExpression::BinaryOp(lhs, rhs,                           \
+                                          kernel::BinaryEWOpCode::OP_CODE);   \
+    }                                                                         \
+    inline TensorExpression operator OP(const TensorExpression& lhs,          \
+                                        const Tensor& rhs) {                  \
+        return TensorExpression::BinaryOp(lhs, rhs,                           \
+                                          kernel::BinaryEWOpCode::OP_CODE);   \
+    }                                                                         \
+    inline TensorExpression operator OP(const Tensor& lhs,                    \
+                                        const TensorExpression& rhs) {        \
+        return TensorExpression::BinaryOp(lhs, rhs,                           \
+                                          kernel::BinaryEWOpCode::OP_CODE);   \
+    }                                                                         \
+    inline TensorExpression operator OP(const TensorExpression& lhs,          \
+                                        Scalar rhs) {                         \
+        return TensorExpression::BinaryOp(lhs, rhs,                           \
+                                          kernel::BinaryEWOpCode::OP_CODE);   \
+    }                                                                         \
+    inline TensorExpression operator OP(Scalar lhs,                           \
+                                        const TensorExpression& rhs) {        \
+        return TensorExpression::BinaryOp(lhs, rhs,                           \
+                                          kernel::BinaryEWOpCode::OP_CODE);   \
+    }
+
+OPEN3D_TENSOR_EXPRESSION_BINARY_OP(+, Add)
+OPEN3D_TENSOR_EXPRESSION_BINARY_OP(-, Sub)
+OPEN3D_TENSOR_EXPRESSION_BINARY_OP(*, Mul)
+OPEN3D_TENSOR_EXPRESSION_BINARY_OP(/, Div)
+
+#undef OPEN3D_TENSOR_EXPRESSION_BINARY_OP
+
+}  // namespace core
+}  // namespace open3d
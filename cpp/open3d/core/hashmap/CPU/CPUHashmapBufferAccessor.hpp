@@ -32,6 +32,7 @@
 #include <memory>
 #include <vector>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
 
 namespace open3d {
@@ -46,21 +47,23 @@ public:
                              int64_t dsize_value,
                              Tensor &keys,
                              Tensor &values,
-                             Tensor &heap)
+                             Tensor &heap,
+                             bool reset_values = true)
         : capacity_(capacity),
           dsize_key_(dsize_key),
           dsize_value_(dsize_value),
           keys_(keys.GetDataPtr<uint8_t>()),
           values_(values.GetDataPtr<uint8_t>()),
           heap_(static_cast<addr_t *>(heap.GetDataPtr())) {
-        std::memset(values_, 0, capacity_ * dsize_value_);
+        if (reset_values) {
+            std::memset(values_, 0, capacity_ * dsize_value_);
+        }
     }
 
     void Reset() {
-#pragma omp parallel for
-        for (int i = 0; i < capacity_; ++i) {
+        core::ParallelFor(capacity_, [&](int i) {
             heap_[i] = i;
-        }
+        });
 
         heap_counter_ = 0;
     }
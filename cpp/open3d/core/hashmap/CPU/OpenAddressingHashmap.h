@@ -0,0 +1,614 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// A CPU hashmap with open addressing and linear probing.
+//
+// The table is a power-of-two array of 64-bit slots. Each slot is either
+// empty, busy (being written by an inserting thread), erased, or holds an
+// entry: the upper 32 bits store a tag taken from the hash and the lower 32
+// bits store the address of the key-value pair in the HashmapBuffer.
+// Comparing tags first means most probes don't touch the key buffer, and
+// consecutive probes stay in the same cache line.
+//
+// Batch operations run in parallel. Inserts claim empty slots with
+// compare-and-swap, so insertions don't need locks. Inserts, finds and erases
+// from different batches must not run concurrently, as with TBBHashmap.
+// Erased slots become tombstones. They are removed on the next rehash, which
+// is triggered once slots in use exceed kMaxLoadFactor.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/hashmap/CPU/CPUHashmapBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+
+namespace open3d {
+namespace core {
+namespace open_addressing {
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t),
+              "Slots are stored in plain uint64_t buffers.");
+
+constexpr uint64_t kEmptySlot = std::numeric_limits<uint64_t>::max();
+constexpr uint64_t kBusySlot = kEmptySlot - 1;
+constexpr uint64_t kErasedSlot = kEmptySlot - 2;
+constexpr uint64_t kTagMask = 0xFFFFFFFF00000000ULL;
+constexpr uint64_t kAddrMask = 0x00000000FFFFFFFFULL;
+
+/// Maximum ratio of used (occupied or erased) slots to all slots.
+constexpr double kMaxLoadFactor = 0.75;
+
+/// Number of keys whose hashes are computed and slots prefetched together.
+constexpr int64_t kBatchSize = 256;
+
+/// Finalizer of MurmurHash3. Spreads the user hash to all bits, since only the
+/// lower bits select the slot and only the upper bits form the tag.
+inline uint64_t MixHash(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+inline void PrefetchSlot(const std::atomic<uint64_t>* slot) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(slot);
+#else
+    (void)slot;
+#endif
+}
+
+inline bool IsEntry(uint64_t slot) {
+    return slot != kEmptySlot && slot != kBusySlot && slot != kErasedSlot;
+}
+
+}  // namespace open_addressing
+
+/// Read-only lookup into an OpenAddressingHashmap for CPU kernels. It mimics
+/// the find()/end() interface of map containers: find() returns an iterator
+/// whose `second` is the buffer address of the key.
+template <typename Key, typename Hash>
+class OpenAddressingHashmapImpl {
+public:
+    struct Iterator {
+        addr_t second;
+        bool valid;
+
+        const Iterator* operator->() const { return this; }
+        bool operator==(const Iterator& other) const {
+            return valid == other.valid && (!valid || second == other.second);
+        }
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    OpenAddressingHashmapImpl() = default;
+    OpenAddressingHashmapImpl(const std::atomic<uint64_t>* slots,
+                              int64_t bucket_count,
+                              const uint8_t* keys)
+        : slots_(slots), mask_(bucket_count - 1), keys_(keys) {}
+
+    /// Returns the slot index of \p key, or -1 if it is not in the map.
+    /// \p hash must be MixHash(Hash()(key)).
+    int64_t FindSlot(const Key& key, uint64_t hash) const {
+        using namespace open_addressing;
+        const uint64_t tag = hash & kTagMask;
+        for (uint64_t i = hash & mask_;; i = (i + 1) & mask_) {
+            uint64_t slot = slots_[i].load(std::memory_order_acquire);
+            if (slot == kEmptySlot) {
+                return -1;
+            }
+            if (IsEntry(slot) && (slot & kTagMask) == tag &&
+                GetKey(slot) == key) {
+                return static_cast<int64_t>(i);
+            }
+        }
+    }
+
+    Iterator find(const Key& key) const {
+        int64_t i = FindSlot(key, open_addressing::MixHash(Hash()(key)));
+        if (i < 0) {
+            return end();
+        }
+        return Iterator{GetAddr(slots_[i].load(std::memory_order_relaxed)),
+                        true};
+    }
+
+    Iterator end() const { return Iterator{0, false}; }
+
+    const Key& GetKey(uint64_t slot) const {
+        return *reinterpret_cast<const Key*>(keys_ +
+                                             GetAddr(slot) * sizeof(Key));
+    }
+
+    static addr_t GetAddr(uint64_t slot) {
+        return static_cast<addr_t>(slot & open_addressing::kAddrMask);
+    }
+
+private:
+    const std::atomic<uint64_t>* slots_ = nullptr;
+    uint64_t mask_ = 0;
+    const uint8_t* keys_ = nullptr;
+};
+
+template <typename Key, typename Hash>
+class OpenAddressingHashmap : public DeviceHashmap {
+public:
+    OpenAddressingHashmap(int64_t init_capacity,
+                          int64_t dsize_key,
+                          int64_t dsize_value,
+                          const Device& device);
+
+    /// Wraps existing buffers, e.g. memory-mapped from a file written by
+    /// Hashmap::Save. \p slots is a UInt64 tensor of bucket_count slots in
+    /// this class' layout, and the heap holds \p size allocated addresses.
+    OpenAddressingHashmap(const std::shared_ptr<HashmapBuffer>& buffer,
+                          const Tensor& slots,
+                          int64_t size,
+                          int64_t num_erased,
+                          int64_t dsize_key,
+                          int64_t dsize_value,
+                          const Device& device);
+    ~OpenAddressingHashmap();
+
+    void Rehash(int64_t buckets) override;
+
+    void Insert(const void* input_keys,
+                const void* input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    OpenAddressingHashmapImpl<Key, Hash> GetImpl() const {
+        return OpenAddressingHashmapImpl<Key, Hash>(
+                slots_, bucket_count_, buffer_ctx_->keys_);
+    }
+
+    Tensor& GetSlotBuffer() { return slots_buffer_; }
+    int64_t GetNumErased() const { return num_erased_; }
+
+protected:
+    Tensor slots_buffer_;
+    std::atomic<uint64_t>* slots_ = nullptr;
+    int64_t bucket_count_ = 0;
+    int64_t num_erased_ = 0;
+
+    std::shared_ptr<CPUHashmapBufferAccessor> buffer_ctx_;
+
+    void InsertImpl(const void* input_keys,
+                    const void* input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count);
+
+    /// Inserts a single key and returns whether it was newly inserted.
+    bool InsertKey(const Key& key,
+                   uint64_t hash,
+                   const void* input_value,
+                   addr_t& output_addr);
+
+    /// Runs \p func(i, hash) for each key in batches of kBatchSize. The
+    /// hashes of a batch are computed first and their slots prefetched, so
+    /// that the memory accesses of the following probes overlap.
+    template <typename func_t>
+    void ForEachKeyBatched(const Key* keys,
+                           int64_t count,
+                           const func_t& func) const;
+
+    void Allocate(int64_t capacity);
+};
+
+template <typename Key, typename Hash>
+OpenAddressingHashmap<Key, Hash>::OpenAddressingHashmap(
+        int64_t init_capacity,
+        int64_t dsize_key,
+        int64_t dsize_value,
+        const Device& device)
+    : DeviceHashmap(init_capacity, dsize_key, dsize_value, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash>
+OpenAddressingHashmap<Key, Hash>::OpenAddressingHashmap(
+        const std::shared_ptr<HashmapBuffer>& buffer,
+        const Tensor& slots,
+        int64_t size,
+        int64_t num_erased,
+        int64_t dsize_key,
+        int64_t dsize_value,
+        const Device& device)
+    : DeviceHashmap(buffer->GetKeyBuffer().GetLength(),
+                    dsize_key,
+                    dsize_value,
+                    device),
+      slots_buffer_(slots),
+      bucket_count_(slots.GetLength()),
+      num_erased_(num_erased) {
+    this->buffer_ = buffer;
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferAccessor>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap(), /*reset_values=*/false);
+    buffer_ctx_->heap_counter_ = static_cast<int>(size);
+    slots_ = reinterpret_cast<std::atomic<uint64_t>*>(
+            slots_buffer_.GetDataPtr());
+}
+
+template <typename Key, typename Hash>
+OpenAddressingHashmap<Key, Hash>::~OpenAddressingHashmap() {}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::Size() const {
+    return buffer_ctx_->HeapCounter();
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Insert(const void* input_keys,
+                                              const void* input_values,
+                                              addr_t* output_addrs,
+                                              bool* output_masks,
+                                              int64_t count) {
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        float avg_capacity_per_bucket =
+                float(this->capacity_) / float(bucket_count_);
+        int64_t expected_buckets = std::max(
+                bucket_count_ * 2,
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+        Rehash(expected_buckets);
+    } else if (new_size + num_erased_ >
+               open_addressing::kMaxLoadFactor * bucket_count_) {
+        // Drop tombstones left by Erase.
+        Rehash(bucket_count_);
+    }
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Activate(const void* input_keys,
+                                                addr_t* output_addrs,
+                                                bool* output_masks,
+                                                int64_t count) {
+    Insert(input_keys, nullptr, output_addrs, output_masks, count);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Find(const void* input_keys,
+                                            addr_t* output_addrs,
+                                            bool* output_masks,
+                                            int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    OpenAddressingHashmapImpl<Key, Hash> impl = GetImpl();
+
+    ForEachKeyBatched(
+            input_keys_templated, count, [&](int64_t i, uint64_t hash) {
+                int64_t slot_idx = impl.FindSlot(input_keys_templated[i], hash);
+                bool flag = slot_idx >= 0;
+                output_masks[i] = flag;
+                output_addrs[i] =
+                        flag ? impl.GetAddr(slots_[slot_idx].load(
+                                       std::memory_order_relaxed))
+                             : 0;
+            });
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Erase(const void* input_keys,
+                                             bool* output_masks,
+                                             int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    OpenAddressingHashmapImpl<Key, Hash> impl = GetImpl();
+    std::atomic<int64_t> num_erased(0);
+
+    ForEachKeyBatched(
+            input_keys_templated, count, [&](int64_t i, uint64_t hash) {
+                output_masks[i] = false;
+                int64_t slot_idx = impl.FindSlot(input_keys_templated[i], hash);
+                if (slot_idx < 0) {
+                    return;
+                }
+                // With duplicated keys in the batch, only one erase succeeds.
+                uint64_t slot =
+                        slots_[slot_idx].load(std::memory_order_acquire);
+                if (open_addressing::IsEntry(slot) &&
+                    slots_[slot_idx].compare_exchange_strong(
+                            slot, open_addressing::kErasedSlot,
+                            std::memory_order_acq_rel)) {
+                    buffer_ctx_->DeviceFree(impl.GetAddr(slot));
+                    output_masks[i] = true;
+                    num_erased.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+    num_erased_ += num_erased.load();
+}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::GetActiveIndices(
+        addr_t* output_indices) {
+    // Two passes over fixed chunks of slots: count the entries of each
+    // chunk, then write them at the chunk's offset.
+    const int64_t chunk_size = 1 << 16;
+    const int64_t num_chunks = (bucket_count_ + chunk_size - 1) / chunk_size;
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+
+    ParallelFor(num_chunks, [&](int64_t chunk_idx) {
+        int64_t end = std::min(bucket_count_, (chunk_idx + 1) * chunk_size);
+        int64_t chunk_count = 0;
+        for (int64_t i = chunk_idx * chunk_size; i < end; ++i) {
+            chunk_count += open_addressing::IsEntry(
+                    slots_[i].load(std::memory_order_relaxed));
+        }
+        chunk_offsets[chunk_idx + 1] = chunk_count;
+    });
+    for (int64_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+        chunk_offsets[chunk_idx + 1] += chunk_offsets[chunk_idx];
+    }
+
+    ParallelFor(num_chunks, [&](int64_t chunk_idx) {
+        int64_t end = std::min(bucket_count_, (chunk_idx + 1) * chunk_size);
+        int64_t offset = chunk_offsets[chunk_idx];
+        for (int64_t i = chunk_idx * chunk_size; i < end; ++i) {
+            uint64_t slot = slots_[i].load(std::memory_order_relaxed);
+            if (open_addressing::IsEntry(slot)) {
+                output_indices[offset++] =
+                        OpenAddressingHashmapImpl<Key, Hash>::GetAddr(slot);
+            }
+        }
+    });
+
+    return chunk_offsets[num_chunks];
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Clear() {
+    ParallelFor(
+            bucket_count_,
+            [&](int64_t i) {
+                slots_[i].store(open_addressing::kEmptySlot,
+                                std::memory_order_relaxed);
+            },
+            open_addressing::kBatchSize);
+    num_erased_ = 0;
+    buffer_ctx_->Reset();
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Rehash(int64_t buckets) {
+    int64_t iterator_count = Size();
+
+    Tensor active_keys;
+    Tensor active_values;
+
+    if (iterator_count > 0) {
+        Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
+        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
+
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        active_keys = this->GetKeyBuffer().IndexGet({active_indices});
+        active_values = this->GetValueBuffer().IndexGet({active_indices});
+    }
+
+    float avg_capacity_per_bucket =
+            float(this->capacity_) / float(bucket_count_);
+    int64_t new_capacity =
+            int64_t(std::ceil(buckets * avg_capacity_per_bucket));
+
+    Allocate(new_capacity);
+
+    if (iterator_count > 0) {
+        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
+        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+
+        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
+                   output_masks.GetDataPtr<bool>(), iterator_count);
+    }
+}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::GetBucketCount() const {
+    return bucket_count_;
+}
+
+template <typename Key, typename Hash>
+std::vector<int64_t> OpenAddressingHashmap<Key, Hash>::BucketSizes() const {
+    std::vector<int64_t> ret(bucket_count_);
+    for (int64_t i = 0; i < bucket_count_; ++i) {
+        ret[i] = open_addressing::IsEntry(
+                slots_[i].load(std::memory_order_relaxed));
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash>
+float OpenAddressingHashmap<Key, Hash>::LoadFactor() const {
+    return float(Size()) / float(bucket_count_);
+}
+
+template <typename Key, typename Hash>
+template <typename func_t>
+void OpenAddressingHashmap<Key, Hash>::ForEachKeyBatched(
+        const Key* keys, int64_t count, const func_t& func) const {
+    using namespace open_addressing;
+    const uint64_t mask = bucket_count_ - 1;
+    ParallelForRange(
+            count,
+            [&](int64_t begin, int64_t end) {
+                uint64_t hashes[kBatchSize];
+                for (int64_t batch_begin = begin; batch_begin < end;
+                     batch_begin += kBatchSize) {
+                    int64_t batch_size =
+                            std::min(kBatchSize, end - batch_begin);
+                    for (int64_t j = 0; j < batch_size; ++j) {
+                        hashes[j] = MixHash(Hash()(keys[batch_begin + j]));
+                        PrefetchSlot(&slots_[hashes[j] & mask]);
+                    }
+                    for (int64_t j = 0; j < batch_size; ++j) {
+                        func(batch_begin + j, hashes[j]);
+                    }
+                }
+            },
+            kBatchSize);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::InsertImpl(const void* input_keys,
+                                                  const void* input_values,
+                                                  addr_t* output_addrs,
+                                                  bool* output_masks,
+                                                  int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    ForEachKeyBatched(input_keys_templated, count,
+                      [&](int64_t i, uint64_t hash) {
+                          const void* input_value =
+                                  input_values == nullptr
+                                          ? nullptr
+                                          : static_cast<const uint8_t*>(
+                                                    input_values) +
+                                                    this->dsize_value_ * i;
+                          output_masks[i] =
+                                  InsertKey(input_keys_templated[i], hash,
+                                            input_value, output_addrs[i]);
+                      });
+}
+
+template <typename Key, typename Hash>
+bool OpenAddressingHashmap<Key, Hash>::InsertKey(const Key& key,
+                                                 uint64_t hash,
+                                                 const void* input_value,
+                                                 addr_t& output_addr) {
+    using namespace open_addressing;
+    const OpenAddressingHashmapImpl<Key, Hash> impl = GetImpl();
+    const uint64_t mask = bucket_count_ - 1;
+    const uint64_t tag = hash & kTagMask;
+
+    output_addr = 0;
+    for (uint64_t i = hash & mask;; i = (i + 1) & mask) {
+        std::atomic<uint64_t>& slot_ref = slots_[i];
+        uint64_t slot = slot_ref.load(std::memory_order_acquire);
+        while (slot == kBusySlot || slot == kEmptySlot) {
+            if (slot == kBusySlot) {
+                // Another thread is writing an entry here, which may be the
+                // same key.
+                slot = slot_ref.load(std::memory_order_acquire);
+                continue;
+            }
+            // On failure, slot is reloaded and re-examined.
+            if (!slot_ref.compare_exchange_weak(slot, kBusySlot,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire)) {
+                continue;
+            }
+
+            // Lazy copy key value pair to buffer only if succeeded
+            addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+            auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+
+            // Copy templated key to buffer
+            *static_cast<Key*>(dst_kv_iter.first) = key;
+
+            // Copy/reset non-templated value in buffer
+            if (input_value != nullptr) {
+                std::memcpy(dst_kv_iter.second, input_value,
+                            this->dsize_value_);
+            } else {
+                std::memset(dst_kv_iter.second, 0, this->dsize_value_);
+            }
+
+            // Publish the entry.
+            slot_ref.store(tag | dst_kv_addr, std::memory_order_release);
+
+            output_addr = dst_kv_addr;
+            return true;
+        }
+        if (IsEntry(slot) && (slot & kTagMask) == tag &&
+            impl.GetKey(slot) == key) {
+            // Key already exists.
+            return false;
+        }
+    }
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Allocate(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_value_, this->device_);
+
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferAccessor>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap());
+
+    // Keep the load factor <= 0.5 when the buffer is full.
+    bucket_count_ = 2;
+    while (bucket_count_ < 2 * capacity) {
+        bucket_count_ *= 2;
+    }
+    slots_buffer_ = Tensor({bucket_count_}, Dtype::UInt64, this->device_);
+    slots_ = reinterpret_cast<std::atomic<uint64_t>*>(
+            slots_buffer_.GetDataPtr());
+    Clear();
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -31,6 +31,7 @@
 #include <limits>
 #include <unordered_map>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/hashmap/CPU/CPUHashmapBufferAccessor.hpp"
 #include "open3d/core/hashmap/DeviceHashmap.h"
 
@@ -148,15 +149,14 @@ void TBBHashmap<Key, Hash>::Find(const void* input_keys,
                                  int64_t count) {
     const Key* input_keys_templated = static_cast<const Key*>(input_keys);
 
-#pragma omp parallel for
-    for (int64_t i = 0; i < count; ++i) {
+    ParallelFor(count, [&](int64_t i) {
         const Key& key = input_keys_templated[i];
 
         auto iter = impl_->find(key);
         bool flag = (iter != impl_->end());
         output_masks[i] = flag;
         output_addrs[i] = flag ? iter->second : 0;
-    }
+    });
 }
 
 template <typename Key, typename Hash>
@@ -258,8 +258,7 @@ void TBBHashmap<Key, Hash>::InsertImpl(const void* input_keys,
                                        int64_t count) {
     const Key* input_keys_templated = static_cast<const Key*>(input_keys);
 
-#pragma omp parallel for
-    for (int64_t i = 0; i < count; ++i) {
+    ParallelFor(count, [&](int64_t i) {
         output_addrs[i] = 0;
         output_masks[i] = false;
 
@@ -294,7 +293,7 @@ void TBBHashmap<Key, Hash>::InsertImpl(const void* input_keys,
             output_addrs[i] = dst_kv_addr;
             output_masks[i] = true;
         }
-    }
+    });
 }
 
 template <typename Key, typename Hash>
@@ -63,6 +63,17 @@ Hashmap::Hashmap(int64_t init_capacity,
                                           element_shape_value, device, backend);
 }
 
+Hashmap::Hashmap(const std::shared_ptr<DeviceHashmap>& device_hashmap,
+                 const Dtype& dtype_key,
+                 const Dtype& dtype_value,
+                 const SizeVector& element_shape_key,
+                 const SizeVector& element_shape_value)
+    : device_hashmap_(device_hashmap),
+      dtype_key_(dtype_key),
+      dtype_value_(dtype_value),
+      element_shape_key_(element_shape_key),
+      element_shape_value_(element_shape_value) {}
+
 void Hashmap::Rehash(int64_t buckets) {
     return device_hashmap_->Rehash(buckets);
 }
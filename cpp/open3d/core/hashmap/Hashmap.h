@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
@@ -35,7 +37,7 @@ namespace core {
 
 class DeviceHashmap;
 
-enum class HashmapBackend { Slab, StdGPU, TBB, Default };
+enum class HashmapBackend { Slab, StdGPU, TBB, OpenAddressing, Default };
 
 class Hashmap {
 public:
@@ -110,6 +112,24 @@ public:
     Hashmap CPU() const;
     Hashmap CUDA(int device_id = 0) const;
 
+    /// Save the hashmap to a binary file, including the key and value
+    /// buffers, the buffer heap, the active indices and, for the
+    /// OpenAddressing backend, the bucket layout of the table.
+    /// Sections are page-aligned so that Load() can map them in place.
+    void Save(const std::string& file_name) const;
+
+    /// Load a hashmap written by Save().
+    /// If the file was saved from an OpenAddressing hashmap and it is loaded
+    /// to CPU with the OpenAddressing or Default backend, the file is
+    /// memory-mapped and used as the hashmap's storage without copying. The
+    /// mapping is private, so later modifications are not written back.
+    /// Otherwise, the active key-value pairs are inserted into a new hashmap
+    /// of the same capacity on \p device with \p backend.
+    static Hashmap Load(
+            const std::string& file_name,
+            const Device& device = Device("CPU:0"),
+            const HashmapBackend& backend = HashmapBackend::Default);
+
     int64_t Size() const;
 
     int64_t GetCapacity() const;
@@ -136,6 +156,13 @@ public:
     }
 
 protected:
+    /// Wraps an existing device hashmap, used by Load().
+    Hashmap(const std::shared_ptr<DeviceHashmap>& device_hashmap,
+            const Dtype& dtype_key,
+            const Dtype& dtype_value,
+            const SizeVector& element_shape_key,
+            const SizeVector& element_shape_value);
+
     void AssertKeyDtype(const Dtype& dtype_key,
                         const SizeVector& elem_shape) const;
     void AssertValueDtype(const Dtype& dtype_val,
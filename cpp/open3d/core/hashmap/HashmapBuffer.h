@@ -78,6 +78,18 @@ public:
         heap_ = Tensor({capacity_}, Dtype::Int32, device_);
     }
 
+    /// Wrap existing key, value and heap buffers, e.g. loaded from a file.
+    HashmapBuffer(const Tensor &key_buffer,
+                  const Tensor &value_buffer,
+                  const Tensor &heap)
+        : capacity_(heap.GetLength()),
+          dsize_key_(key_buffer.GetDtype().ByteSize()),
+          dsize_value_(value_buffer.GetDtype().ByteSize()),
+          key_buffer_(key_buffer),
+          value_buffer_(value_buffer),
+          heap_(heap),
+          device_(heap.GetDevice()) {}
+
     Tensor &GetKeyBuffer() { return key_buffer_; }
     Tensor &GetValueBuffer() { return value_buffer_; }
     Tensor &GetHeap() { return heap_; }
@@ -0,0 +1,575 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Binary persistence of Hashmap.
+//
+// A file holds a fixed-size header followed by these sections, each starting
+// at a multiple of kSectionAlignment:
+// - key buffer    [capacity * dsize_key]
+// - value buffer  [capacity * dsize_value]
+// - heap          [capacity] Int32, the first `size` entries in use
+// - active index  [size] Int32
+// - slots         [bucket_count] UInt64, OpenAddressing bucket layout only
+// All values are stored in native byte order.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/hashmap/CPU/OpenAddressingHashmap.h"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/core/hashmap/Dispatch.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+constexpr char kHashmapFileMagic[8] = {'O', '3', 'D', 'H', 'M', 'A', 'P', 0};
+constexpr uint32_t kHashmapFileVersion = 1;
+constexpr int64_t kSectionAlignment = 4096;
+constexpr int64_t kMaxElementDims = 8;
+
+enum class BucketLayout : uint32_t { Generic = 0, OpenAddressing = 1 };
+
+struct DtypeRecord {
+    int64_t code;
+    int64_t byte_size;
+    char name[16];
+};
+
+struct ShapeRecord {
+    int64_t ndims;
+    int64_t dims[kMaxElementDims];
+};
+
+struct HashmapFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t bucket_layout;
+
+    DtypeRecord dtype_key;
+    DtypeRecord dtype_value;
+    ShapeRecord element_shape_key;
+    ShapeRecord element_shape_value;
+
+    int64_t capacity;
+    int64_t size;
+    int64_t bucket_count;
+    int64_t num_erased;
+    int64_t dsize_key;
+    int64_t dsize_value;
+
+    // Byte offsets of the sections from the beginning of the file.
+    int64_t key_offset;
+    int64_t value_offset;
+    int64_t heap_offset;
+    int64_t active_offset;
+    int64_t slot_offset;
+    int64_t file_size;
+};
+
+DtypeRecord ToDtypeRecord(const Dtype& dtype) {
+    DtypeRecord record = {};
+    record.code = static_cast<int64_t>(dtype.GetDtypeCode());
+    record.byte_size = dtype.ByteSize();
+    std::strncpy(record.name, dtype.ToString().c_str(),
+                 sizeof(record.name) - 1);
+    return record;
+}
+
+Dtype FromDtypeRecord(const DtypeRecord& record) {
+    char name[sizeof(record.name) + 1] = {};
+    std::memcpy(name, record.name, sizeof(record.name));
+    return Dtype(static_cast<Dtype::DtypeCode>(record.code), record.byte_size,
+                 name);
+}
+
+ShapeRecord ToShapeRecord(const SizeVector& shape) {
+    if (static_cast<int64_t>(shape.size()) > kMaxElementDims) {
+        utility::LogError(
+                "[Hashmap] Element shape {} has more than {} dimensions.",
+                shape.ToString(), kMaxElementDims);
+    }
+    ShapeRecord record = {};
+    record.ndims = static_cast<int64_t>(shape.size());
+    for (size_t i = 0; i < shape.size(); ++i) {
+        record.dims[i] = shape[i];
+    }
+    return record;
+}
+
+SizeVector FromShapeRecord(const ShapeRecord& record) {
+    return SizeVector(record.dims, record.dims + record.ndims);
+}
+
+int64_t AlignSection(int64_t offset) {
+    return (offset + kSectionAlignment - 1) / kSectionAlignment *
+           kSectionAlignment;
+}
+
+void WriteSection(FILE* fp, int64_t offset, const void* data, int64_t bytes) {
+    static const std::vector<char> zeros(kSectionAlignment, 0);
+    int64_t pos = static_cast<int64_t>(ftell(fp));
+    if (pos < 0) {
+        fclose(fp);
+        utility::LogError("[Hashmap] Failed to write hashmap file.");
+    }
+    while (pos < offset) {
+        int64_t pad = std::min(offset - pos, kSectionAlignment);
+        if (fwrite(zeros.data(), 1, static_cast<size_t>(pad), fp) !=
+            static_cast<size_t>(pad)) {
+            fclose(fp);
+            utility::LogError("[Hashmap] Failed to write hashmap file.");
+        }
+        pos += pad;
+    }
+    if (bytes > 0 &&
+        fwrite(data, 1, static_cast<size_t>(bytes), fp) !=
+                static_cast<size_t>(bytes)) {
+        fclose(fp);
+        utility::LogError("[Hashmap] Failed to write hashmap file.");
+    }
+}
+
+/// Computes a * b + c for non-negative operands. Returns false on overflow.
+bool MulAddChecked(int64_t a, int64_t b, int64_t c, int64_t& result) {
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    if (a < 0 || b < 0 || c < 0 || (b != 0 && a > kMax / b) ||
+        a * b > kMax - c) {
+        return false;
+    }
+    result = a * b + c;
+    return true;
+}
+
+/// Returns true if [offset, offset + count * elem_size) is an aligned range
+/// that ends within the first \p file_size bytes of the file.
+bool IsSectionInFile(int64_t offset,
+                     int64_t count,
+                     int64_t elem_size,
+                     int64_t file_size) {
+    int64_t end = 0;
+    return offset >= static_cast<int64_t>(sizeof(HashmapFileHeader)) &&
+           offset % kSectionAlignment == 0 &&
+           MulAddChecked(count, elem_size, offset, end) && end <= file_size;
+}
+
+/// Returns true if \p record is one of the built-in dtypes, or an Object
+/// dtype of any size.
+bool IsValidDtypeRecord(const DtypeRecord& record) {
+    if (record.code == static_cast<int64_t>(Dtype::DtypeCode::Object)) {
+        return record.byte_size > 0;
+    }
+    static const std::vector<Dtype> kDtypes = {
+            Dtype::Float32, Dtype::Float64, Dtype::Int8,   Dtype::Int16,
+            Dtype::Int32,   Dtype::Int64,   Dtype::UInt8,  Dtype::UInt16,
+            Dtype::UInt32,  Dtype::UInt64,  Dtype::Bool};
+    return std::any_of(kDtypes.begin(), kDtypes.end(),
+                       [&record](const Dtype& dtype) {
+                           return static_cast<int64_t>(dtype.GetDtypeCode()) ==
+                                          record.code &&
+                                  dtype.ByteSize() == record.byte_size;
+                       });
+}
+
+bool IsValidShapeRecord(const ShapeRecord& record) {
+    if (record.ndims < 0 || record.ndims > kMaxElementDims) {
+        return false;
+    }
+    return std::all_of(record.dims, record.dims + record.ndims,
+                       [](int64_t d) { return d > 0; });
+}
+
+/// Byte size of an element of \p dtype and \p shape. Returns false on
+/// overflow.
+bool ElementByteSize(const DtypeRecord& dtype,
+                     const ShapeRecord& shape,
+                     int64_t& byte_size) {
+    byte_size = dtype.byte_size;
+    for (int64_t i = 0; i < shape.ndims; ++i) {
+        if (!MulAddChecked(byte_size, shape.dims[i], 0, byte_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Checks that the dtypes, sizes and section offsets in \p header are
+/// consistent and that every section lies inside the file.
+void CheckHeader(const HashmapFileHeader& header,
+                 int64_t file_size,
+                 const std::string& file_name) {
+    auto fail = [&file_name](const char* reason) {
+        utility::LogError("[Hashmap] Invalid hashmap file {}: {}.", file_name,
+                          reason);
+    };
+    if (header.file_size < static_cast<int64_t>(sizeof(HashmapFileHeader))) {
+        fail("invalid file size");
+    }
+    if (header.file_size > file_size) {
+        utility::LogError("[Hashmap] File {} is truncated.", file_name);
+    }
+    if (header.bucket_layout != static_cast<uint32_t>(BucketLayout::Generic) &&
+        header.bucket_layout !=
+                static_cast<uint32_t>(BucketLayout::OpenAddressing)) {
+        fail("unknown bucket layout");
+    }
+    const bool open_addressing =
+            header.bucket_layout ==
+            static_cast<uint32_t>(BucketLayout::OpenAddressing);
+    if (!IsValidDtypeRecord(header.dtype_key) ||
+        !IsValidDtypeRecord(header.dtype_value) ||
+        !IsValidShapeRecord(header.element_shape_key) ||
+        !IsValidShapeRecord(header.element_shape_value)) {
+        fail("invalid dtype or element shape");
+    }
+    int64_t dsize_key = 0;
+    int64_t dsize_value = 0;
+    if (!ElementByteSize(header.dtype_key, header.element_shape_key,
+                         dsize_key) ||
+        !ElementByteSize(header.dtype_value, header.element_shape_value,
+                         dsize_value) ||
+        dsize_key != header.dsize_key || dsize_value != header.dsize_value) {
+        fail("element sizes do not match the dtypes and shapes");
+    }
+    if (header.capacity < 0 ||
+        header.capacity > std::numeric_limits<int32_t>::max() ||
+        header.size < 0 || header.size > header.capacity) {
+        fail("invalid size or capacity");
+    }
+    // Only the OpenAddressing slot table uses the bucket count, as a mask.
+    if (open_addressing &&
+        (header.bucket_count <= 0 ||
+         (header.bucket_count & (header.bucket_count - 1)) != 0)) {
+        fail("bucket count is not a power of two");
+    }
+    if (header.num_erased < 0 ||
+        (open_addressing && header.num_erased > header.bucket_count)) {
+        fail("invalid number of erased entries");
+    }
+    if (!IsSectionInFile(header.key_offset, header.capacity, header.dsize_key,
+                         header.file_size) ||
+        !IsSectionInFile(header.value_offset, header.capacity,
+                         header.dsize_value, header.file_size) ||
+        !IsSectionInFile(header.heap_offset, header.capacity, sizeof(addr_t),
+                         header.file_size) ||
+        !IsSectionInFile(header.active_offset, header.size, sizeof(addr_t),
+                         header.file_size) ||
+        !IsSectionInFile(header.slot_offset,
+                         open_addressing ? header.bucket_count : 0,
+                         sizeof(uint64_t), header.file_size)) {
+        fail("section out of bounds");
+    }
+}
+
+/// Checks the addresses stored in the mapped sections. They must all refer
+/// to distinct entries of the key and value buffers. An OpenAddressing map
+/// is used in place, so its heap must also be a permutation whose first
+/// `size` addresses are the active ones, and its slot table must hold
+/// exactly the active addresses and keep an empty slot to end probing.
+void CheckSections(const HashmapFileHeader& header,
+                   const uint8_t* data,
+                   const std::string& file_name) {
+    auto fail = [&file_name](const char* reason) {
+        utility::LogError("[Hashmap] Invalid hashmap file {}: {}.", file_name,
+                          reason);
+    };
+    auto in_range = [&header](addr_t addr) {
+        return static_cast<int64_t>(addr) < header.capacity;
+    };
+    const addr_t* heap =
+            reinterpret_cast<const addr_t*>(data + header.heap_offset);
+    const addr_t* active =
+            reinterpret_cast<const addr_t*>(data + header.active_offset);
+    if (!std::all_of(heap, heap + header.capacity, in_range) ||
+        !std::all_of(active, active + header.size, in_range)) {
+        fail("address out of range");
+    }
+    const bool open_addressing =
+            header.bucket_layout ==
+            static_cast<uint32_t>(BucketLayout::OpenAddressing);
+
+    // State of each address: first allocated or free according to the heap,
+    // then active, then found in the slot table.
+    enum AddrState : uint8_t { kUnseen, kFree, kAllocated, kActive, kInSlot };
+    std::vector<uint8_t> states(header.capacity,
+                                open_addressing ? kUnseen : kAllocated);
+    if (open_addressing) {
+        for (int64_t i = 0; i < header.capacity; ++i) {
+            if (states[heap[i]] != kUnseen) {
+                fail("duplicate heap address");
+            }
+            states[heap[i]] = i < header.size ? kAllocated : kFree;
+        }
+    }
+    for (int64_t i = 0; i < header.size; ++i) {
+        if (states[active[i]] != kAllocated) {
+            fail("duplicate or unallocated active address");
+        }
+        states[active[i]] = kActive;
+    }
+    if (!open_addressing) {
+        return;
+    }
+
+    const uint64_t* slots =
+            reinterpret_cast<const uint64_t*>(data + header.slot_offset);
+    int64_t num_entries = 0;
+    int64_t num_erased = 0;
+    int64_t num_empty = 0;
+    for (int64_t i = 0; i < header.bucket_count; ++i) {
+        const uint64_t slot = slots[i];
+        if (slot == open_addressing::kEmptySlot) {
+            ++num_empty;
+        } else if (slot == open_addressing::kErasedSlot) {
+            ++num_erased;
+        } else if (slot == open_addressing::kBusySlot ||
+                   (slot & open_addressing::kAddrMask) >=
+                           static_cast<uint64_t>(header.capacity) ||
+                   states[slot & open_addressing::kAddrMask] != kActive) {
+            num_entries = -1;
+            break;
+        } else {
+            states[slot & open_addressing::kAddrMask] = kInSlot;
+            ++num_entries;
+        }
+    }
+    if (num_entries != header.size || num_erased != header.num_erased ||
+        num_empty == 0) {
+        fail("inconsistent slot table");
+    }
+}
+
+/// Maps the whole file into memory. The mapping is private and writable, so
+/// that the hashmap can be modified without changing the file.
+std::shared_ptr<uint8_t> MapFile(const std::string& file_name,
+                                 int64_t file_size) {
+    size_t mapped_size = 0;
+    std::string error_str;
+    std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+            file_name, mapped_size, true, &error_str);
+    if (!mapping) {
+        utility::LogError("[Hashmap] Unable to map file {}: {}", file_name,
+                          error_str);
+    }
+    if (mapped_size < static_cast<size_t>(file_size)) {
+        utility::LogError("[Hashmap] File {} is truncated.", file_name);
+    }
+    return mapping;
+}
+
+/// Tensor viewing a section of the mapped file. The tensor keeps the mapping
+/// alive.
+Tensor SectionToTensor(const std::shared_ptr<uint8_t>& mapping,
+                       int64_t offset,
+                       const SizeVector& shape,
+                       const Dtype& dtype) {
+    void* data_ptr = mapping.get() + offset;
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), data_ptr,
+                                       [mapping](void*) {});
+    return Tensor(shape, shape_util::DefaultStrides(shape), data_ptr, dtype,
+                  blob);
+}
+
+}  // namespace
+
+void Hashmap::Save(const std::string& file_name) const {
+    const Device host("CPU:0");
+    const int64_t dim = element_shape_key_.NumElements();
+
+    HashmapFileHeader header = {};
+    std::memcpy(header.magic, kHashmapFileMagic, sizeof(header.magic));
+    header.version = kHashmapFileVersion;
+    header.bucket_layout = static_cast<uint32_t>(BucketLayout::Generic);
+    header.dtype_key = ToDtypeRecord(dtype_key_);
+    header.dtype_value = ToDtypeRecord(dtype_value_);
+    header.element_shape_key = ToShapeRecord(element_shape_key_);
+    header.element_shape_value = ToShapeRecord(element_shape_value_);
+    header.capacity = GetCapacity();
+    header.size = Size();
+    header.bucket_count = GetBucketCount();
+    header.dsize_key = GetKeyBytesize();
+    header.dsize_value = GetValueBytesize();
+
+    Tensor slots;
+    if (GetDevice().GetType() == Device::DeviceType::CPU) {
+        DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(dtype_key_, dim, [&] {
+            auto open_addressing_hashmap = std::dynamic_pointer_cast<
+                    OpenAddressingHashmap<key_t, hash_t>>(device_hashmap_);
+            if (open_addressing_hashmap != nullptr) {
+                header.bucket_layout =
+                        static_cast<uint32_t>(BucketLayout::OpenAddressing);
+                header.num_erased = open_addressing_hashmap->GetNumErased();
+                slots = open_addressing_hashmap->GetSlotBuffer();
+            }
+        });
+    }
+
+    Tensor active_addrs;
+    GetActiveIndices(active_addrs);
+    active_addrs = active_addrs.To(host);
+    Tensor key_buffer = GetKeyBuffer().To(host);
+    Tensor value_buffer = GetValueBuffer().To(host);
+    Tensor heap = device_hashmap_->buffer_->GetHeap().To(host);
+
+    header.key_offset = AlignSection(sizeof(HashmapFileHeader));
+    header.value_offset = AlignSection(header.key_offset +
+                                       header.capacity * header.dsize_key);
+    header.heap_offset = AlignSection(header.value_offset +
+                                      header.capacity * header.dsize_value);
+    header.active_offset = AlignSection(header.heap_offset +
+                                        header.capacity * sizeof(addr_t));
+    header.slot_offset = AlignSection(header.active_offset +
+                                      header.size * sizeof(addr_t));
+    header.file_size =
+            header.slot_offset + slots.NumElements() * sizeof(uint64_t);
+
+    FILE* fp = fopen(file_name.c_str(), "wb");
+    if (!fp) {
+        utility::LogError("[Hashmap] Unable to open file {} for writing.",
+                          file_name);
+    }
+    WriteSection(fp, 0, &header, sizeof(HashmapFileHeader));
+    WriteSection(fp, header.key_offset, key_buffer.GetDataPtr(),
+                 header.capacity * header.dsize_key);
+    WriteSection(fp, header.value_offset, value_buffer.GetDataPtr(),
+                 header.capacity * header.dsize_value);
+    WriteSection(fp, header.heap_offset, heap.GetDataPtr(),
+                 header.capacity * sizeof(addr_t));
+    WriteSection(fp, header.active_offset, active_addrs.GetDataPtr(),
+                 header.size * sizeof(addr_t));
+    WriteSection(fp, header.slot_offset,
+                 slots.NumElements() > 0 ? slots.GetDataPtr() : nullptr,
+                 slots.NumElements() * sizeof(uint64_t));
+    if (fclose(fp) != 0) {
+        utility::LogError("[Hashmap] Failed to write hashmap file {}.",
+                          file_name);
+    }
+}
+
+Hashmap Hashmap::Load(const std::string& file_name,
+                      const Device& device,
+                      const HashmapBackend& backend) {
+    HashmapFileHeader header;
+    FILE* fp = fopen(file_name.c_str(), "rb");
+    if (!fp) {
+        utility::LogError("[Hashmap] Unable to open file {}.", file_name);
+    }
+    size_t nread = fread(&header, sizeof(HashmapFileHeader), 1, fp);
+    fseek(fp, 0, SEEK_END);
+    int64_t file_size = static_cast<int64_t>(ftell(fp));
+    fclose(fp);
+    if (nread != 1 || std::memcmp(header.magic, kHashmapFileMagic,
+                                  sizeof(kHashmapFileMagic)) != 0) {
+        utility::LogError("[Hashmap] {} is not a hashmap file.", file_name);
+    }
+    if (header.version != kHashmapFileVersion) {
+        utility::LogError("[Hashmap] Unsupported hashmap file version {}.",
+                          header.version);
+    }
+    CheckHeader(header, file_size, file_name);
+
+    const Dtype dtype_key = FromDtypeRecord(header.dtype_key);
+    const Dtype dtype_value = FromDtypeRecord(header.dtype_value);
+    const SizeVector element_shape_key =
+            FromShapeRecord(header.element_shape_key);
+    const SizeVector element_shape_value =
+            FromShapeRecord(header.element_shape_value);
+    const int64_t capacity = header.capacity;
+    const int64_t size = header.size;
+
+    std::shared_ptr<uint8_t> mapping = MapFile(file_name, header.file_size);
+    CheckSections(header, mapping.get(), file_name);
+
+    // Zero-copy: the mapped sections become the hashmap's buffers.
+    if (device.GetType() == Device::DeviceType::CPU &&
+        header.bucket_layout ==
+                static_cast<uint32_t>(BucketLayout::OpenAddressing) &&
+        (backend == HashmapBackend::Default ||
+         backend == HashmapBackend::OpenAddressing)) {
+        Tensor key_buffer = SectionToTensor(
+                mapping, header.key_offset, {capacity},
+                Dtype(Dtype::DtypeCode::Object, header.dsize_key, "_hash_k"));
+        Tensor value_buffer = SectionToTensor(
+                mapping, header.value_offset, {capacity},
+                Dtype(Dtype::DtypeCode::Object, header.dsize_value,
+                      "_hash_v"));
+        Tensor heap = SectionToTensor(mapping, header.heap_offset, {capacity},
+                                      Dtype::Int32);
+        Tensor slots = SectionToTensor(mapping, header.slot_offset,
+                                       {header.bucket_count}, Dtype::UInt64);
+        auto buffer =
+                std::make_shared<HashmapBuffer>(key_buffer, value_buffer, heap);
+
+        std::shared_ptr<DeviceHashmap> device_hashmap;
+        DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(
+                dtype_key, element_shape_key.NumElements(), [&] {
+                    device_hashmap = std::make_shared<
+                            OpenAddressingHashmap<key_t, hash_t>>(
+                            buffer, slots, size, header.num_erased,
+                            header.dsize_key, header.dsize_value, device);
+                });
+        return Hashmap(device_hashmap, dtype_key, dtype_value,
+                       element_shape_key, element_shape_value);
+    }
+
+    Hashmap hashmap(capacity, dtype_key, dtype_value, element_shape_key,
+                    element_shape_value, device, backend);
+    if (size > 0) {
+        SizeVector key_shape = element_shape_key;
+        key_shape.insert(key_shape.begin(), capacity);
+        SizeVector value_shape = element_shape_value;
+        value_shape.insert(value_shape.begin(), capacity);
+
+        Tensor active_indices =
+                SectionToTensor(mapping, header.active_offset, {size},
+                                Dtype::Int32)
+                        .To(Dtype::Int64);
+        Tensor keys = SectionToTensor(mapping, header.key_offset, key_shape,
+                                      dtype_key)
+                              .IndexGet({active_indices})
+                              .To(device);
+        Tensor values = SectionToTensor(mapping, header.value_offset,
+                                        value_shape, dtype_value)
+                                .IndexGet({active_indices})
+                                .To(device);
+
+        Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+    return hashmap;
+}
+
+}  // namespace core
+}  // namespace open3d
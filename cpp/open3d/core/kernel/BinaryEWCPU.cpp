@@ -31,6 +31,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/BinaryEW.h"
 #include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/VectorizedCPU.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -176,6 +177,10 @@ void BinaryEWCPU(const Tensor& lhs,
                  const Tensor& rhs,
                  Tensor& dst,
                  BinaryEWOpCode op_code) {
+    if (BinaryEWVectorizedCPU(lhs, rhs, dst, op_code)) {
+        return;
+    }
+
     Dtype src_dtype = lhs.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
 
@@ -30,8 +30,8 @@
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
-#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -40,6 +40,10 @@ namespace kernel {
 
 class CPULauncher {
 public:
+    /// Minimum number of workloads per task for element-wise kernels. Smaller
+    /// tensors are processed in the calling thread.
+    static constexpr int64_t kElementWiseGrainSize = 1024;
+
     /// Fills tensor[:][i] with element_kernel(i).
     ///
     /// \param indexer The input tensor and output tensor to the indexer are the
@@ -50,45 +54,50 @@ public:
     template <typename func_t>
     static void LaunchIndexFillKernel(const Indexer& indexer,
                                       func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx), workload_idx);
-        }
+        ParallelFor(
+                indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   workload_idx);
+                },
+                kElementWiseGrainSize);
     }
 
     template <typename func_t>
     static void LaunchUnaryEWKernel(const Indexer& indexer,
                                     func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        ParallelFor(
+                indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                kElementWiseGrainSize);
     }
 
     template <typename func_t>
     static void LaunchBinaryEWKernel(const Indexer& indexer,
                                      func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(0, workload_idx),
-                           indexer.GetInputPtr(1, workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        ParallelFor(
+                indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(0, workload_idx),
+                                   indexer.GetInputPtr(1, workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                kElementWiseGrainSize);
     }
 
     template <typename func_t>
     static void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                             func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
-             ++workload_idx) {
-            element_kernel(indexer.GetInputPtr(workload_idx),
-                           indexer.GetOutputPtr(workload_idx));
-        }
+        ParallelFor(
+                indexer.NumWorkloads(),
+                [&](int64_t workload_idx) {
+                    element_kernel(indexer.GetInputPtr(workload_idx),
+                                   indexer.GetOutputPtr(workload_idx));
+                },
+                kElementWiseGrainSize);
     }
 
     template <typename scalar_t, typename func_t>
@@ -113,13 +122,12 @@ public:
                     "single-output reduction ops.");
         }
         int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads = GetNumThreads();
         int64_t workload_per_thread =
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        ParallelFor(num_threads, [&](int64_t thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
             for (int64_t workload_idx = start; workload_idx < end;
@@ -127,7 +135,7 @@ public:
                 element_kernel(indexer.GetInputPtr(0, workload_idx),
                                &thread_results[thread_idx]);
             }
-        }
+        });
         void* output_ptr = indexer.GetOutputPtr(0);
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             element_kernel(&thread_results[thread_idx], output_ptr);
@@ -140,7 +148,7 @@ public:
         // Prefers outer dimension >= num_threads.
         const int64_t* indexer_shape = indexer.GetMasterShape();
         const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads = GetNumThreads();
 
         // Init best_dim as the outer-most non-reduction dim.
         int64_t best_dim = num_dims - 1;
@@ -162,21 +170,17 @@ public:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+        ParallelFor(indexer_shape[best_dim], [&](int64_t i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
             LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        });
     }
 
     /// General kernels with non-conventional indexers
     template <typename func_t>
     static void LaunchGeneralKernel(int64_t n, func_t element_kernel) {
-#pragma omp parallel for schedule(static)
-        for (int64_t workload_idx = 0; workload_idx < n; ++workload_idx) {
-            element_kernel(workload_idx);
-        }
+        ParallelFor(n, element_kernel);
     }
 };
 
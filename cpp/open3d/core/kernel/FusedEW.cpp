@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include <algorithm>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+int64_t FusedEWStackDepth(const std::vector<FusedEWInstruction>& program) {
+    int64_t depth = 0;
+    int64_t max_depth = 0;
+    for (const FusedEWInstruction& instruction : program) {
+        switch (instruction.type_) {
+            case FusedEWInstructionType::Input:
+            case FusedEWInstructionType::Scalar:
+                depth++;
+                break;
+            case FusedEWInstructionType::UnaryEW:
+                if (depth < 1) {
+                    utility::LogError("FusedEW: stack underflow in unary op.");
+                }
+                break;
+            case FusedEWInstructionType::BinaryEW:
+                if (depth < 2) {
+                    utility::LogError("FusedEW: stack underflow in binary op.");
+                }
+                depth--;
+                break;
+        }
+        max_depth = std::max(max_depth, depth);
+    }
+    if (depth != 1) {
+        utility::LogError("FusedEW: program must leave exactly one value, but "
+                          "{} are left.",
+                          depth);
+    }
+    return max_depth;
+}
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    if (inputs.empty()) {
+        utility::LogError("FusedEW: at least one input tensor is required.");
+    }
+    if (static_cast<int64_t>(inputs.size()) > MAX_INPUTS) {
+        utility::LogError("FusedEW: too many inputs {} > {}.", inputs.size(),
+                          MAX_INPUTS);
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (input.GetDtype() != dst.GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              input.GetDtype().ToString(),
+                              dst.GetDtype().ToString());
+        }
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+    for (const FusedEWInstruction& instruction : program) {
+        if (instruction.type_ == FusedEWInstructionType::Input &&
+            (instruction.input_idx_ < 0 ||
+             instruction.input_idx_ >= static_cast<int64_t>(inputs.size()))) {
+            utility::LogError("FusedEW: invalid input index {}.",
+                              instruction.input_idx_);
+        }
+        if (instruction.type_ == FusedEWInstructionType::BinaryEW &&
+            s_boolean_binary_ew_op_codes.count(instruction.binary_op_code_)) {
+            utility::LogError("FusedEW: boolean binary ops are not supported.");
+        }
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else {
+        utility::LogError("FusedEW: Unimplemented device {}.",
+                          dst.GetDevice().ToString());
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWInstructionType {
+    Input,   // Push the element of an input tensor.
+    Scalar,  // Push a scalar constant.
+    UnaryEW,
+    BinaryEW,
+};
+
+/// One instruction of a fused element-wise program. A program is a postfix
+/// (stack machine) representation of an expression tree: Input and Scalar
+/// push one value, UnaryEW replaces the top value and BinaryEW pops two values
+/// (lhs below rhs) and pushes the result.
+struct FusedEWInstruction {
+    FusedEWInstructionType type_ = FusedEWInstructionType::Input;
+    int64_t input_idx_ = 0;
+    Scalar scalar_ = Scalar(0.0);
+    UnaryEWOpCode unary_op_code_ = UnaryEWOpCode::Neg;
+    BinaryEWOpCode binary_op_code_ = BinaryEWOpCode::Add;
+};
+
+/// Returns the maximum stack depth required to run \p program. Raises an error
+/// if the program is not well-formed.
+int64_t FusedEWStackDepth(const std::vector<FusedEWInstruction>& program);
+
+/// Evaluates \p program for every element of \p dst in a single pass, without
+/// materializing intermediate tensors. \p inputs are broadcasted to the shape
+/// of \p dst and must share its dtype and device. Only arithmetic binary ops
+/// (Add, Sub, Mul, Div) and dtype-preserving unary ops are supported.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,221 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Number of workloads evaluated together. Each stack slot holds one tile, so
+// intermediate values stay in the L1 cache instead of full-size tensors.
+static constexpr int64_t kFusedEWTileSize = 256;
+
+template <typename scalar_t>
+static void CPUFusedUnaryTile(scalar_t* vals,
+                              int64_t n,
+                              UnaryEWOpCode op_code) {
+    switch (op_code) {
+        case UnaryEWOpCode::Sqrt:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(std::sqrt(vals[i]));
+            }
+            break;
+        case UnaryEWOpCode::Sin:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(std::sin(vals[i]));
+            }
+            break;
+        case UnaryEWOpCode::Cos:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(std::cos(vals[i]));
+            }
+            break;
+        case UnaryEWOpCode::Neg:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(-vals[i]);
+            }
+            break;
+        case UnaryEWOpCode::Exp:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(std::exp(vals[i]));
+            }
+            break;
+        case UnaryEWOpCode::Abs:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(
+                        std::abs(static_cast<double>(vals[i])));
+            }
+            break;
+        case UnaryEWOpCode::Floor:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(
+                        std::floor(static_cast<double>(vals[i])));
+            }
+            break;
+        case UnaryEWOpCode::Ceil:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(
+                        std::ceil(static_cast<double>(vals[i])));
+            }
+            break;
+        case UnaryEWOpCode::Round:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(
+                        std::round(static_cast<double>(vals[i])));
+            }
+            break;
+        case UnaryEWOpCode::Trunc:
+            for (int64_t i = 0; i < n; ++i) {
+                vals[i] = static_cast<scalar_t>(
+                        std::trunc(static_cast<double>(vals[i])));
+            }
+            break;
+        default:
+            utility::LogError("FusedEW: unsupported unary op.");
+    }
+}
+
+template <typename scalar_t>
+static void CPUFusedBinaryTile(scalar_t* lhs,
+                               const scalar_t* rhs,
+                               int64_t n,
+                               BinaryEWOpCode op_code) {
+    switch (op_code) {
+        case BinaryEWOpCode::Add:
+            for (int64_t i = 0; i < n; ++i) {
+                lhs[i] = lhs[i] + rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Sub:
+            for (int64_t i = 0; i < n; ++i) {
+                lhs[i] = lhs[i] - rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Mul:
+            for (int64_t i = 0; i < n; ++i) {
+                lhs[i] = lhs[i] * rhs[i];
+            }
+            break;
+        case BinaryEWOpCode::Div:
+            for (int64_t i = 0; i < n; ++i) {
+                lhs[i] = lhs[i] / rhs[i];
+            }
+            break;
+        default:
+            utility::LogError("FusedEW: unsupported binary op.");
+    }
+}
+
+template <typename scalar_t>
+static void LaunchFusedEWCPUKernel(
+        const Indexer& indexer,
+        const std::vector<FusedEWInstruction>& program,
+        int64_t stack_depth) {
+    // Convert scalar constants once instead of once per tile.
+    std::vector<scalar_t> scalars(program.size());
+    for (size_t i = 0; i < program.size(); ++i) {
+        if (program[i].type_ == FusedEWInstructionType::Scalar) {
+            scalars[i] = program[i].scalar_.To<scalar_t>();
+        }
+    }
+
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t num_tiles =
+            (num_workloads + kFusedEWTileSize - 1) / kFusedEWTileSize;
+
+    // Each worker range evaluates its tiles on one operand stack of
+    // stack_depth tiles, allocated once per range.
+    ParallelForRange(num_tiles, [&](int64_t tile_begin, int64_t tile_end) {
+        std::vector<scalar_t> stack(stack_depth * kFusedEWTileSize);
+        for (int64_t tile_idx = tile_begin; tile_idx < tile_end; ++tile_idx) {
+            const int64_t start = tile_idx * kFusedEWTileSize;
+            const int64_t n = std::min(kFusedEWTileSize, num_workloads - start);
+
+            int64_t top = 0;
+            for (size_t pc = 0; pc < program.size(); ++pc) {
+                const FusedEWInstruction& instruction = program[pc];
+                switch (instruction.type_) {
+                    case FusedEWInstructionType::Input: {
+                        scalar_t* vals = &stack[top * kFusedEWTileSize];
+                        for (int64_t i = 0; i < n; ++i) {
+                            vals[i] = *reinterpret_cast<const scalar_t*>(
+                                    indexer.GetInputPtr(instruction.input_idx_,
+                                                        start + i));
+                        }
+                        top++;
+                        break;
+                    }
+                    case FusedEWInstructionType::Scalar: {
+                        scalar_t* vals = &stack[top * kFusedEWTileSize];
+                        std::fill(vals, vals + n, scalars[pc]);
+                        top++;
+                        break;
+                    }
+                    case FusedEWInstructionType::UnaryEW:
+                        CPUFusedUnaryTile(
+                                &stack[(top - 1) * kFusedEWTileSize], n,
+                                instruction.unary_op_code_);
+                        break;
+                    case FusedEWInstructionType::BinaryEW:
+                        CPUFusedBinaryTile(
+                                &stack[(top - 2) * kFusedEWTileSize],
+                                &stack[(top - 1) * kFusedEWTileSize], n,
+                                instruction.binary_op_code_);
+                        top--;
+                        break;
+                }
+            }
+
+            for (int64_t i = 0; i < n; ++i) {
+                *reinterpret_cast<scalar_t*>(
+                        indexer.GetOutputPtr(start + i)) = stack[i];
+            }
+        }
+    });
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    const int64_t stack_depth = FusedEWStackDepth(program);
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        LaunchFusedEWCPUKernel<scalar_t>(indexer, program, stack_depth);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/kernel/NonZero.h"
 #include "open3d/utility/Logging.h"
 
@@ -62,8 +63,7 @@ Tensor NonZeroCPU(const Tensor& src) {
 
     std::vector<std::vector<int64_t>> non_zero_indices_by_dimensions(
             num_dims, std::vector<int64_t>(num_non_zeros, 0));
-#pragma omp parallel for schedule(static)
-    for (int64_t i = 0; i < static_cast<int64_t>(num_non_zeros); i++) {
+    ParallelFor(static_cast<int64_t>(num_non_zeros), [&](int64_t i) {
         int64_t non_zero_index = non_zero_indices[i];
         for (int64_t dim = num_dims - 1; dim >= 0; dim--) {
             void* result_ptr = result_iter.GetPtr(dim * num_non_zeros + i);
@@ -71,7 +71,7 @@ Tensor NonZeroCPU(const Tensor& src) {
             *static_cast<int64_t*>(result_ptr) = non_zero_index % shape[dim];
             non_zero_index = non_zero_index / shape[dim];
         }
-    }
+    });
 
     return result;
 }
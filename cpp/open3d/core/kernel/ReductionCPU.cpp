@@ -24,13 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
-#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/VectorizedCPU.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -95,11 +98,14 @@ public:
     void Run(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
-        if (GetMaxThreads() == 1 || InParallel()) {
+        if (GetNumThreads() == 1) {
             LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
         } else if (indexer_.NumOutputElements() <= 1) {
             LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
                                                    identity);
+        } else if (ShouldSplitReductionDim(indexer_)) {
+            LaunchReductionKernelTwoPassMultiOutput<scalar_t>(
+                    indexer_, reduce_func, identity);
         } else {
             LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
         }
@@ -131,13 +137,12 @@ private:
                     "single-output reduction ops.");
         }
         int64_t num_workloads = indexer.NumWorkloads();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads = GetNumThreads();
         int64_t workload_per_thread =
                 (num_workloads + num_threads - 1) / num_threads;
         std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
-        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+        ParallelFor(num_threads, [&](int64_t thread_idx) {
             int64_t start = thread_idx * workload_per_thread;
             int64_t end = std::min(start + workload_per_thread, num_workloads);
             for (int64_t workload_idx = start; workload_idx < end;
@@ -147,20 +152,124 @@ private:
                 thread_results[thread_idx] =
                         element_kernel(*src, thread_results[thread_idx]);
             }
-        }
+        });
         scalar_t* dst = reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0));
         for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
             *dst = element_kernel(thread_results[thread_idx], *dst);
         }
     }
 
+    /// Returns true if the multi-output reduction is better parallelized by
+    /// splitting a reduction dimension than by splitting the outputs. This is
+    /// the case when no output dimension is large enough to keep all threads
+    /// busy, e.g. reducing an (N, 3) tensor along dim 0.
+    static bool ShouldSplitReductionDim(const Indexer& indexer) {
+        const int64_t* indexer_shape = indexer.GetMasterShape();
+        const int64_t num_threads = GetNumThreads();
+        int64_t max_output_dim_size = 0;
+        int64_t max_reduction_dim_size = 0;
+        for (int64_t dim = 0; dim < indexer.NumDims(); ++dim) {
+            if (indexer.IsReductionDim(dim)) {
+                max_reduction_dim_size =
+                        std::max(max_reduction_dim_size, indexer_shape[dim]);
+            } else {
+                max_output_dim_size =
+                        std::max(max_output_dim_size, indexer_shape[dim]);
+            }
+        }
+        return max_output_dim_size < num_threads &&
+               max_reduction_dim_size > max_output_dim_size &&
+               indexer.NumWorkloads() >= kMinWorkloadsToSplitReductionDim;
+    }
+
+    /// Split the largest reduction dimension into num_threads parts. Each part
+    /// reduces into its own contiguous buffer holding all output elements, and
+    /// the partial results are then combined into the outputs.
+    template <typename scalar_t, typename func_t>
+    static void LaunchReductionKernelTwoPassMultiOutput(const Indexer& indexer,
+                                                        func_t element_kernel,
+                                                        scalar_t identity) {
+        const int64_t* indexer_shape = indexer.GetMasterShape();
+        const int64_t num_dims = indexer.NumDims();
+        const int64_t num_outputs = indexer.NumOutputElements();
+
+        int64_t split_dim = -1;
+        for (int64_t dim = 0; dim < num_dims; ++dim) {
+            if (indexer.IsReductionDim(dim) &&
+                (split_dim == -1 ||
+                 indexer_shape[dim] > indexer_shape[split_dim])) {
+                split_dim = dim;
+            }
+        }
+        if (split_dim == -1) {
+            utility::LogError(
+                    "Internal error: no reduction dim to split, use "
+                    "LaunchReductionParallelDim instead.");
+        }
+
+        // Contiguous byte strides of the partial result buffers. Reduction
+        // dims have stride 0, the same as in the real output.
+        const TensorRef& dst_ref = indexer.GetOutput();
+        int64_t buffer_byte_strides[MAX_DIMS] = {0};
+        int64_t output_default_strides[MAX_DIMS] = {0};
+        int64_t stride = 1;
+        for (int64_t dim = num_dims - 1; dim >= 0; --dim) {
+            if (dst_ref.byte_strides_[dim] != 0) {
+                output_default_strides[dim] = stride;
+                buffer_byte_strides[dim] = stride * sizeof(scalar_t);
+                stride *= indexer_shape[dim];
+            }
+        }
+
+        const int64_t split_size = indexer_shape[split_dim];
+        const int64_t num_parts =
+                std::min(static_cast<int64_t>(GetNumThreads()), split_size);
+        const int64_t part_size = (split_size + num_parts - 1) / num_parts;
+        std::vector<scalar_t> part_results(num_parts * num_outputs, identity);
+
+        ParallelFor(num_parts, [&](int64_t part_idx) {
+            int64_t start = part_idx * part_size;
+            int64_t size = std::min(part_size, split_size - start);
+            if (size <= 0) {
+                return;
+            }
+            Indexer sub_indexer(indexer);
+            TensorRef& part_ref = sub_indexer.GetOutput();
+            part_ref.data_ptr_ = part_results.data() + part_idx * num_outputs;
+            for (int64_t dim = 0; dim < num_dims; ++dim) {
+                part_ref.byte_strides_[dim] = buffer_byte_strides[dim];
+            }
+            sub_indexer.ShrinkDim(split_dim, start, size);
+            LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
+        });
+
+        ParallelFor(num_outputs, [&](int64_t output_idx) {
+            int64_t byte_offset = 0;
+            int64_t remainder = output_idx;
+            for (int64_t dim = 0; dim < num_dims; ++dim) {
+                if (output_default_strides[dim] != 0) {
+                    byte_offset += remainder / output_default_strides[dim] *
+                                   dst_ref.byte_strides_[dim];
+                    remainder = remainder % output_default_strides[dim];
+                }
+            }
+            scalar_t* dst = reinterpret_cast<scalar_t*>(
+                    static_cast<char*>(dst_ref.data_ptr_) + byte_offset);
+            for (int64_t part_idx = 0; part_idx < num_parts; ++part_idx) {
+                *dst = element_kernel(
+                        part_results[part_idx * num_outputs + output_idx],
+                        *dst);
+            }
+        });
+    }
+
     template <typename scalar_t, typename func_t>
     static void LaunchReductionParallelDim(const Indexer& indexer,
                                            func_t element_kernel) {
         // Prefers outer dimension >= num_threads.
         const int64_t* indexer_shape = indexer.GetMasterShape();
         const int64_t num_dims = indexer.NumDims();
-        int64_t num_threads = GetMaxThreads();
+        int64_t num_threads = GetNumThreads();
 
         // Init best_dim as the outer-most non-reduction dim.
         int64_t best_dim = num_dims - 1;
@@ -182,15 +291,18 @@ private:
                     "LaunchReductionKernelTwoPass instead.");
         }
 
-#pragma omp parallel for schedule(static)
-        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+        ParallelFor(indexer_shape[best_dim], [&](int64_t i) {
             Indexer sub_indexer(indexer);
             sub_indexer.ShrinkDim(best_dim, i, 1);
             LaunchReductionKernelSerial<scalar_t>(sub_indexer, element_kernel);
-        }
+        });
     }
 
 private:
+    /// Below this number of workloads, the overhead of the partial result
+    /// buffers outweighs the gain from splitting the reduction dim.
+    static constexpr int64_t kMinWorkloadsToSplitReductionDim = 1 << 15;
+
     Indexer indexer_;
 };
 
@@ -208,9 +320,7 @@ public:
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
 
-#pragma omp parallel for schedule(static)
-        for (int64_t output_idx = 0; output_idx < num_output_elements;
-             output_idx++) {
+        ParallelFor(num_output_elements, [&](int64_t output_idx) {
             // sub_indexer.NumWorkloads() == ipo.
             // sub_indexer's workload_idx is indexer_'s ipo_idx.
             Indexer sub_indexer = indexer_.GetPerOutputIndexer(output_idx);
@@ -225,7 +335,7 @@ public:
                 std::tie(*dst_idx, dst_val) =
                         reduce_func(src_idx, *src_val, *dst_idx, dst_val);
             }
-        }
+        });
     }
 
 private:
@@ -237,6 +347,10 @@ void ReductionCPU(const Tensor& src,
                   const SizeVector& dims,
                   bool keepdim,
                   ReductionOpCode op_code) {
+    if (ReductionVectorizedCPU(src, dst, dims, op_code)) {
+        return;
+    }
+
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
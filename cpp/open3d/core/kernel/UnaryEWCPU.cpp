@@ -34,6 +34,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/UnaryEW.h"
+#include "open3d/core/kernel/VectorizedCPU.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -183,6 +184,10 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
 }
 
 void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    if (UnaryEWVectorizedCPU(src, dst, op_code)) {
+        return;
+    }
+
     // src and dst have been chaged to have the same shape, device
     Dtype src_dtype = src.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
@@ -0,0 +1,376 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/VectorizedCPU.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/utility/Logging.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+        (defined(__x86_64__) || defined(__i386__))
+#define OPEN3D_SIMD_X86
+#endif
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+#define OPEN3D_SIMD_NAMESPACE baseline
+#define OPEN3D_SIMD_TARGET
+#include "open3d/core/kernel/VectorizedCPUImpl.h"
+#undef OPEN3D_SIMD_NAMESPACE
+#undef OPEN3D_SIMD_TARGET
+
+#ifdef OPEN3D_SIMD_X86
+#define OPEN3D_SIMD_NAMESPACE avx2
+#define OPEN3D_SIMD_TARGET __attribute__((target("avx2,fma")))
+#include "open3d/core/kernel/VectorizedCPUImpl.h"
+#undef OPEN3D_SIMD_NAMESPACE
+#undef OPEN3D_SIMD_TARGET
+
+#define OPEN3D_SIMD_NAMESPACE avx512
+#define OPEN3D_SIMD_TARGET \
+    __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma")))
+#include "open3d/core/kernel/VectorizedCPUImpl.h"
+#undef OPEN3D_SIMD_NAMESPACE
+#undef OPEN3D_SIMD_TARGET
+#endif
+
+/// Kernels compiled for one instruction set. Each call processes one chunk.
+struct SIMDKernels {
+    bool (*binary_ew_)(BinaryEWOpCode op_code,
+                       Dtype dtype,
+                       const void* lhs,
+                       bool lhs_is_scalar,
+                       const void* rhs,
+                       bool rhs_is_scalar,
+                       void* dst,
+                       int64_t n);
+    bool (*unary_ew_)(UnaryEWOpCode op_code,
+                      Dtype dtype,
+                      const void* src,
+                      void* dst,
+                      int64_t n);
+    bool (*reduction_)(ReductionOpCode op_code,
+                       Dtype dtype,
+                       const void* src,
+                       int64_t n,
+                       void* dst_val,
+                       int64_t* dst_idx);
+};
+
+SIMDKernels GetSIMDKernels(SIMDInstructionSet isa) {
+    switch (isa) {
+#ifdef OPEN3D_SIMD_X86
+        case SIMDInstructionSet::AVX512:
+            return {avx512::BinaryEW, avx512::UnaryEW, avx512::Reduction};
+        case SIMDInstructionSet::AVX2:
+            return {avx2::BinaryEW, avx2::UnaryEW, avx2::Reduction};
+#endif
+        default:
+            return {baseline::BinaryEW, baseline::UnaryEW, baseline::Reduction};
+    }
+}
+
+// Number of elements processed by one task. Large enough to amortize the
+// scheduling overhead, small enough to balance work across threads.
+constexpr int64_t kChunkSize = 1 << 16;
+
+std::atomic<SIMDInstructionSet>& GlobalSIMDInstructionSet() {
+    static std::atomic<SIMDInstructionSet> isa(
+            GetSupportedSIMDInstructionSet());
+    return isa;
+}
+
+bool IsTrailingDims(const SizeVector& dims, int64_t ndims) {
+    if (dims.empty() || static_cast<int64_t>(dims.size()) > ndims) {
+        return false;
+    }
+    SizeVector sorted_dims = dims;
+    std::sort(sorted_dims.begin(), sorted_dims.end());
+    for (size_t i = 0; i < sorted_dims.size(); ++i) {
+        if (sorted_dims[i] != ndims - static_cast<int64_t>(dims.size() - i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+SIMDInstructionSet GetSupportedSIMDInstructionSet() {
+#ifdef OPEN3D_SIMD_X86
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) {
+        return SIMDInstructionSet::AVX512;
+    } else if (__builtin_cpu_supports("avx2") &&
+               __builtin_cpu_supports("fma")) {
+        return SIMDInstructionSet::AVX2;
+    }
+#endif
+    return SIMDInstructionSet::Baseline;
+}
+
+SIMDInstructionSet GetSIMDInstructionSet() {
+    return GlobalSIMDInstructionSet().load();
+}
+
+void SetSIMDInstructionSet(SIMDInstructionSet isa) {
+    if (static_cast<int>(isa) >
+        static_cast<int>(GetSupportedSIMDInstructionSet())) {
+        utility::LogError("Instruction set {} is not supported by this CPU.",
+                          ToString(isa));
+    }
+    GlobalSIMDInstructionSet().store(isa);
+}
+
+std::string ToString(SIMDInstructionSet isa) {
+    switch (isa) {
+        case SIMDInstructionSet::None:
+            return "None";
+        case SIMDInstructionSet::Baseline:
+            return "Baseline";
+        case SIMDInstructionSet::AVX2:
+            return "AVX2";
+        case SIMDInstructionSet::AVX512:
+            return "AVX512";
+    }
+    return "Unknown";
+}
+
+bool BinaryEWVectorizedCPU(const Tensor& lhs,
+                           const Tensor& rhs,
+                           Tensor& dst,
+                           BinaryEWOpCode op_code) {
+    const SIMDInstructionSet isa = GetSIMDInstructionSet();
+    const Dtype dtype = lhs.GetDtype();
+    const int64_t n = dst.NumElements();
+    if (isa == SIMDInstructionSet::None || n == 0 || dtype == Dtype::Bool ||
+        dtype.IsObject() || rhs.GetDtype() != dtype) {
+        return false;
+    }
+
+    const bool is_bool_op = s_boolean_binary_ew_op_codes.count(op_code) > 0;
+    const bool is_logical_op = op_code == BinaryEWOpCode::LogicalAnd ||
+                               op_code == BinaryEWOpCode::LogicalOr ||
+                               op_code == BinaryEWOpCode::LogicalXor;
+    if (is_logical_op ||
+        dst.GetDtype() != (is_bool_op ? Dtype::Bool : dtype)) {
+        return false;
+    }
+
+    const bool lhs_is_scalar = lhs.NumElements() == 1;
+    const bool rhs_is_scalar = rhs.NumElements() == 1;
+    if (!dst.IsContiguous() || (lhs_is_scalar && rhs_is_scalar) ||
+        (!lhs_is_scalar &&
+         (!lhs.IsContiguous() || lhs.GetShape() != dst.GetShape())) ||
+        (!rhs_is_scalar &&
+         (!rhs.IsContiguous() || rhs.GetShape() != dst.GetShape()))) {
+        return false;
+    }
+
+    const SIMDKernels kernels = GetSIMDKernels(isa);
+    const char* lhs_ptr = static_cast<const char*>(lhs.GetDataPtr());
+    const char* rhs_ptr = static_cast<const char*>(rhs.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    const int64_t src_byte_size = dtype.ByteSize();
+    const int64_t dst_byte_size = dst.GetDtype().ByteSize();
+    const int64_t num_chunks = (n + kChunkSize - 1) / kChunkSize;
+
+    CPULauncher::LaunchGeneralKernel(num_chunks, [&](int64_t chunk_idx) {
+        const int64_t start = chunk_idx * kChunkSize;
+        const int64_t len = std::min(kChunkSize, n - start);
+        kernels.binary_ew_(
+                op_code, dtype,
+                lhs_is_scalar ? lhs_ptr : lhs_ptr + start * src_byte_size,
+                lhs_is_scalar,
+                rhs_is_scalar ? rhs_ptr : rhs_ptr + start * src_byte_size,
+                rhs_is_scalar, dst_ptr + start * dst_byte_size, len);
+    });
+    return true;
+}
+
+bool UnaryEWVectorizedCPU(const Tensor& src,
+                          Tensor& dst,
+                          UnaryEWOpCode op_code) {
+    const SIMDInstructionSet isa = GetSIMDInstructionSet();
+    const Dtype dtype = src.GetDtype();
+    const int64_t n = dst.NumElements();
+    if (isa == SIMDInstructionSet::None || n == 0 || dtype == Dtype::Bool ||
+        dtype.IsObject() || dst.GetDtype() != dtype ||
+        src.GetShape() != dst.GetShape() || !src.IsContiguous() ||
+        !dst.IsContiguous()) {
+        return false;
+    }
+
+    const bool is_float = dtype == Dtype::Float32 || dtype == Dtype::Float64;
+    const bool supported = op_code == UnaryEWOpCode::Abs ||
+                           op_code == UnaryEWOpCode::Neg ||
+                           (is_float && (op_code == UnaryEWOpCode::Sqrt ||
+                                         op_code == UnaryEWOpCode::Exp));
+    if (!supported) {
+        return false;
+    }
+
+    const SIMDKernels kernels = GetSIMDKernels(isa);
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    const int64_t byte_size = dtype.ByteSize();
+    const int64_t num_chunks = (n + kChunkSize - 1) / kChunkSize;
+
+    CPULauncher::LaunchGeneralKernel(num_chunks, [&](int64_t chunk_idx) {
+        const int64_t start = chunk_idx * kChunkSize;
+        const int64_t len = std::min(kChunkSize, n - start);
+        kernels.unary_ew_(op_code, dtype, src_ptr + start * byte_size,
+                          dst_ptr + start * byte_size, len);
+    });
+    return true;
+}
+
+bool ReductionVectorizedCPU(const Tensor& src,
+                            Tensor& dst,
+                            const SizeVector& dims,
+                            ReductionOpCode op_code) {
+    const SIMDInstructionSet isa = GetSIMDInstructionSet();
+    const Dtype dtype = src.GetDtype();
+    const bool is_arg_op = op_code == ReductionOpCode::ArgMin ||
+                           op_code == ReductionOpCode::ArgMax;
+    const bool supported = is_arg_op || op_code == ReductionOpCode::Sum ||
+                           op_code == ReductionOpCode::Min ||
+                           op_code == ReductionOpCode::Max;
+    if (isa == SIMDInstructionSet::None || !supported ||
+        dtype == Dtype::Bool || dtype.IsObject() ||
+        dst.GetDtype() != (is_arg_op ? Dtype::Int64 : dtype) ||
+        src.NumElements() == 0 || !src.IsContiguous() ||
+        !dst.IsContiguous() || !IsTrailingDims(dims, src.NumDims())) {
+        return false;
+    }
+
+    // Every output element reduces one contiguous segment of src.
+    const int64_t num_outputs = dst.NumElements();
+    const int64_t segment_size = src.NumElements() / num_outputs;
+    if (num_outputs * segment_size != src.NumElements()) {
+        return false;
+    }
+
+    // Split segments into parts if there are fewer outputs than threads.
+    const int64_t num_threads = GetNumThreads();
+    int64_t num_parts = 1;
+    if (num_outputs < num_threads) {
+        num_parts = std::min((num_threads + num_outputs - 1) / num_outputs,
+                             (segment_size + kChunkSize - 1) / kChunkSize);
+        num_parts = std::max<int64_t>(num_parts, 1);
+    }
+    const int64_t part_size = (segment_size + num_parts - 1) / num_parts;
+    num_parts = (segment_size + part_size - 1) / part_size;
+
+    const SIMDKernels kernels = GetSIMDKernels(isa);
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    const int64_t byte_size = dtype.ByteSize();
+    std::vector<char> part_vals(num_outputs * num_parts * byte_size);
+    std::vector<int64_t> part_idxs(num_outputs * num_parts, 0);
+
+    CPULauncher::LaunchGeneralKernel(
+            num_outputs * num_parts, [&](int64_t task_idx) {
+                const int64_t output_idx = task_idx / num_parts;
+                const int64_t start = (task_idx % num_parts) * part_size;
+                const int64_t len = std::min(part_size, segment_size - start);
+                kernels.reduction_(
+                        op_code, dtype,
+                        src_ptr + (output_idx * segment_size + start) *
+                                          byte_size,
+                        len, part_vals.data() + task_idx * byte_size,
+                        &part_idxs[task_idx]);
+            });
+
+    // Arg-reductions fail if the extremum is not found, e.g. for NaN.
+    if (is_arg_op && std::any_of(part_idxs.begin(), part_idxs.end(),
+                                 [](int64_t idx) { return idx < 0; })) {
+        return false;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* vals = reinterpret_cast<const scalar_t*>(
+                part_vals.data());
+        CPULauncher::LaunchGeneralKernel(num_outputs, [&](int64_t output_idx) {
+            const int64_t begin = output_idx * num_parts;
+            scalar_t val = vals[begin];
+            int64_t idx = part_idxs[begin];
+            for (int64_t p = 1; p < num_parts; ++p) {
+                const scalar_t part_val = vals[begin + p];
+                const int64_t part_idx = part_idxs[begin + p] + p * part_size;
+                switch (op_code) {
+                    case ReductionOpCode::Sum:
+                        val += part_val;
+                        break;
+                    case ReductionOpCode::Min:
+                        val = std::min(val, part_val);
+                        break;
+                    case ReductionOpCode::Max:
+                        val = std::max(val, part_val);
+                        break;
+                    case ReductionOpCode::ArgMin:
+                        // Strict comparison keeps the first extremum.
+                        if (part_val < val) {
+                            val = part_val;
+                            idx = part_idx;
+                        }
+                        break;
+                    case ReductionOpCode::ArgMax:
+                        if (part_val > val) {
+                            val = part_val;
+                            idx = part_idx;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+            if (is_arg_op) {
+                static_cast<int64_t*>(dst.GetDataPtr())[output_idx] = idx;
+            } else {
+                static_cast<scalar_t*>(dst.GetDataPtr())[output_idx] = val;
+            }
+        });
+    });
+    return true;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file VectorizedCPU.h
+/// \brief Vectorized CPU fast paths for element-wise ops and reductions.
+///
+/// The generic CPU kernels visit every element through the Indexer, which
+/// prevents vectorization. For the common case of contiguous inputs with the
+/// same dtype, the functions below run plain loops over raw buffers that are
+/// compiled once per instruction set (baseline, AVX2, AVX-512). The best
+/// instruction set supported by the running CPU is selected at runtime. On
+/// ARM, the baseline build uses NEON.
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/BinaryEW.h"
+#include "open3d/core/kernel/Reduction.h"
+#include "open3d/core/kernel/UnaryEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class SIMDInstructionSet {
+    None,      // Vectorized fast paths disabled, use the generic kernels.
+    Baseline,  // Compiler default for the target, e.g. SSE2 or NEON.
+    AVX2,
+    AVX512,
+};
+
+/// Returns the best instruction set supported by the running CPU.
+SIMDInstructionSet GetSupportedSIMDInstructionSet();
+
+/// Returns the instruction set currently used by the vectorized fast paths.
+SIMDInstructionSet GetSIMDInstructionSet();
+
+/// Overrides the instruction set used by the vectorized fast paths, e.g. to
+/// benchmark against the generic kernels with SIMDInstructionSet::None. An
+/// instruction set that is not supported by the CPU raises an error.
+void SetSIMDInstructionSet(SIMDInstructionSet isa);
+
+std::string ToString(SIMDInstructionSet isa);
+
+/// Runs \p op_code with a vectorized kernel if the inputs are eligible:
+/// contiguous \p lhs, \p rhs and \p dst of the same dtype (Bool \p dst for
+/// comparisons), where each input either has the shape of \p dst or is a
+/// single element. Returns false, without side effects, if not eligible.
+bool BinaryEWVectorizedCPU(const Tensor& lhs,
+                           const Tensor& rhs,
+                           Tensor& dst,
+                           BinaryEWOpCode op_code);
+
+/// Runs \p op_code with a vectorized kernel if \p src and \p dst are
+/// contiguous with the same shape and dtype. Supports Sqrt, Exp, Abs and Neg.
+/// Returns false, without side effects, if not eligible.
+bool UnaryEWVectorizedCPU(const Tensor& src,
+                          Tensor& dst,
+                          UnaryEWOpCode op_code);
+
+/// Runs \p op_code with a vectorized kernel if \p src is contiguous and \p dims
+/// are its trailing dimensions, so that every output element reduces one
+/// contiguous segment. Supports Sum, Min, Max, ArgMin and ArgMax. Returns
+/// false, without side effects, if not eligible.
+bool ReductionVectorizedCPU(const Tensor& src,
+                            Tensor& dst,
+                            const SizeVector& dims,
+                            ReductionOpCode op_code);
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
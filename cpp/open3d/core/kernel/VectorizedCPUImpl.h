@@ -0,0 +1,388 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Vectorized CPU kernels over raw contiguous buffers.
+//
+// This file is included once per instruction set by VectorizedCPU.cpp, with
+// OPEN3D_SIMD_NAMESPACE set to a distinct namespace and OPEN3D_SIMD_TARGET set
+// to the matching function target attribute. Every function is therefore
+// compiled for that instruction set only and has internal linkage, so that no
+// instruction-set-specific code can leak into other translation units.
+//
+// Loops are annotated with `#pragma omp simd` so that they are vectorized at
+// -O2, including floating point reductions that need reassociation.
+
+#if !defined(OPEN3D_SIMD_NAMESPACE) || !defined(OPEN3D_SIMD_TARGET)
+#error "OPEN3D_SIMD_NAMESPACE and OPEN3D_SIMD_TARGET must be defined."
+#endif
+
+namespace OPEN3D_SIMD_NAMESPACE {
+
+// Binary ops.
+
+template <typename scalar_t>
+struct AddOp {
+    OPEN3D_SIMD_TARGET scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a + b;
+    }
+};
+
+template <typename scalar_t>
+struct SubOp {
+    OPEN3D_SIMD_TARGET scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a - b;
+    }
+};
+
+template <typename scalar_t>
+struct MulOp {
+    OPEN3D_SIMD_TARGET scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a * b;
+    }
+};
+
+template <typename scalar_t>
+struct DivOp {
+    OPEN3D_SIMD_TARGET scalar_t operator()(scalar_t a, scalar_t b) const {
+        return a / b;
+    }
+};
+
+template <typename scalar_t>
+struct GtOp {
+    OPEN3D_SIMD_TARGET bool operator()(scalar_t a, scalar_t b) const {
+        return a > b;
+    }
+};
+
+template <typename scalar_t>
+struct LtOp {
+    OPEN3D_SIMD_TARGET bool operator()(scalar_t a, scalar_t b) const {
+        return a < b;
+    }
+};
+
+template <typename scalar_t>
+struct GeOp {
+    OPEN3D_SIMD_TARGET bool operator()(scalar_t a, scalar_t b) const {
+        return a >= b;
+    }
+};
+
+template <typename scalar_t>
+struct LeOp {
+    OPEN3D_SIMD_TARGET bool operator()(scalar_t a, scalar_t b) const {
+        return a <= b;
+    }
+};
+
+template <typename scalar_t>
+struct EqOp {
+    OPEN3D_SIMD_TARGET bool operator()(scalar_t a, scalar_t b) const {
+        return a == b;
+    }
+};
+
+template <typename scalar_t>
+struct NeOp {
+    OPEN3D_SIMD_TARGET bool operator()(scalar_t a, scalar_t b) const {
+        return a != b;
+    }
+};
+
+// dst may alias lhs or rhs exactly (in-place ops), which is safe since each
+// element is read before it is written.
+template <typename src_t, typename dst_t, typename op_t>
+OPEN3D_SIMD_TARGET void BinaryArrayArray(const src_t* lhs,
+                                         const src_t* rhs,
+                                         dst_t* dst,
+                                         int64_t n) {
+    const op_t op;
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<dst_t>(op(lhs[i], rhs[i]));
+    }
+}
+
+template <typename src_t, typename dst_t, typename op_t>
+OPEN3D_SIMD_TARGET void BinaryArrayScalar(const src_t* lhs,
+                                          const src_t rhs,
+                                          dst_t* dst,
+                                          int64_t n) {
+    const op_t op;
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<dst_t>(op(lhs[i], rhs));
+    }
+}
+
+template <typename src_t, typename dst_t, typename op_t>
+OPEN3D_SIMD_TARGET void BinaryScalarArray(const src_t lhs,
+                                          const src_t* rhs,
+                                          dst_t* dst,
+                                          int64_t n) {
+    const op_t op;
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<dst_t>(op(lhs, rhs[i]));
+    }
+}
+
+/// \p lhs and \p rhs point to the first element of the chunk, or to the single
+/// element if \p lhs_is_scalar or \p rhs_is_scalar. They are not both scalars.
+template <typename src_t, typename dst_t, typename op_t>
+void Binary(const void* lhs,
+            bool lhs_is_scalar,
+            const void* rhs,
+            bool rhs_is_scalar,
+            void* dst,
+            int64_t n) {
+    const src_t* lhs_ptr = static_cast<const src_t*>(lhs);
+    const src_t* rhs_ptr = static_cast<const src_t*>(rhs);
+    dst_t* dst_ptr = static_cast<dst_t*>(dst);
+    if (lhs_is_scalar) {
+        BinaryScalarArray<src_t, dst_t, op_t>(*lhs_ptr, rhs_ptr, dst_ptr, n);
+    } else if (rhs_is_scalar) {
+        BinaryArrayScalar<src_t, dst_t, op_t>(lhs_ptr, *rhs_ptr, dst_ptr, n);
+    } else {
+        BinaryArrayArray<src_t, dst_t, op_t>(lhs_ptr, rhs_ptr, dst_ptr, n);
+    }
+}
+
+bool BinaryEW(BinaryEWOpCode op_code,
+              Dtype dtype,
+              const void* lhs,
+              bool lhs_is_scalar,
+              const void* rhs,
+              bool rhs_is_scalar,
+              void* dst,
+              int64_t n) {
+    bool supported = true;
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        using s = scalar_t;
+        switch (op_code) {
+            case BinaryEWOpCode::Add:
+                Binary<s, s, AddOp<s>>(lhs, lhs_is_scalar, rhs, rhs_is_scalar,
+                                       dst, n);
+                break;
+            case BinaryEWOpCode::Sub:
+                Binary<s, s, SubOp<s>>(lhs, lhs_is_scalar, rhs, rhs_is_scalar,
+                                       dst, n);
+                break;
+            case BinaryEWOpCode::Mul:
+                Binary<s, s, MulOp<s>>(lhs, lhs_is_scalar, rhs, rhs_is_scalar,
+                                       dst, n);
+                break;
+            case BinaryEWOpCode::Div:
+                Binary<s, s, DivOp<s>>(lhs, lhs_is_scalar, rhs, rhs_is_scalar,
+                                       dst, n);
+                break;
+            case BinaryEWOpCode::Gt:
+                Binary<s, bool, GtOp<s>>(lhs, lhs_is_scalar, rhs,
+                                         rhs_is_scalar, dst, n);
+                break;
+            case BinaryEWOpCode::Lt:
+                Binary<s, bool, LtOp<s>>(lhs, lhs_is_scalar, rhs,
+                                         rhs_is_scalar, dst, n);
+                break;
+            case BinaryEWOpCode::Ge:
+                Binary<s, bool, GeOp<s>>(lhs, lhs_is_scalar, rhs,
+                                         rhs_is_scalar, dst, n);
+                break;
+            case BinaryEWOpCode::Le:
+                Binary<s, bool, LeOp<s>>(lhs, lhs_is_scalar, rhs,
+                                         rhs_is_scalar, dst, n);
+                break;
+            case BinaryEWOpCode::Eq:
+                Binary<s, bool, EqOp<s>>(lhs, lhs_is_scalar, rhs,
+                                         rhs_is_scalar, dst, n);
+                break;
+            case BinaryEWOpCode::Ne:
+                Binary<s, bool, NeOp<s>>(lhs, lhs_is_scalar, rhs,
+                                         rhs_is_scalar, dst, n);
+                break;
+            default:
+                supported = false;
+                break;
+        }
+    });
+    return supported;
+}
+
+// Unary ops.
+
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET void SqrtKernel(const scalar_t* src,
+                                   scalar_t* dst,
+                                   int64_t n) {
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = std::sqrt(src[i]);
+    }
+}
+
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET void ExpKernel(const scalar_t* src,
+                                  scalar_t* dst,
+                                  int64_t n) {
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = std::exp(src[i]);
+    }
+}
+
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET void AbsKernel(const scalar_t* src,
+                                  scalar_t* dst,
+                                  int64_t n) {
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        // Written as a select, which vectorizes for all signed and unsigned
+        // types. Adding zero maps -0.0 to +0.0, as std::abs does.
+        dst[i] = src[i] < 0 ? static_cast<scalar_t>(-src[i])
+                            : static_cast<scalar_t>(src[i] + scalar_t(0));
+    }
+}
+
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET void NegKernel(const scalar_t* src,
+                                  scalar_t* dst,
+                                  int64_t n) {
+#pragma omp simd
+    for (int64_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<scalar_t>(-src[i]);
+    }
+}
+
+bool UnaryEW(UnaryEWOpCode op_code,
+             Dtype dtype,
+             const void* src,
+             void* dst,
+             int64_t n) {
+    bool supported = true;
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* src_ptr = static_cast<const scalar_t*>(src);
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst);
+        const bool is_float = std::is_floating_point<scalar_t>::value;
+        if (op_code == UnaryEWOpCode::Sqrt && is_float) {
+            SqrtKernel<scalar_t>(src_ptr, dst_ptr, n);
+        } else if (op_code == UnaryEWOpCode::Exp && is_float) {
+            ExpKernel<scalar_t>(src_ptr, dst_ptr, n);
+        } else if (op_code == UnaryEWOpCode::Abs) {
+            AbsKernel<scalar_t>(src_ptr, dst_ptr, n);
+        } else if (op_code == UnaryEWOpCode::Neg) {
+            NegKernel<scalar_t>(src_ptr, dst_ptr, n);
+        } else {
+            supported = false;
+        }
+    });
+    return supported;
+}
+
+// Reductions. Each function reduces src[0:n] with n >= 1.
+
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET scalar_t SumKernel(const scalar_t* src, int64_t n) {
+    scalar_t acc = 0;
+#pragma omp simd reduction(+ : acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc += src[i];
+    }
+    return acc;
+}
+
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET scalar_t MinKernel(const scalar_t* src, int64_t n) {
+    scalar_t acc = src[0];
+#pragma omp simd reduction(min : acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc = src[i] < acc ? src[i] : acc;
+    }
+    return acc;
+}
+
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET scalar_t MaxKernel(const scalar_t* src, int64_t n) {
+    scalar_t acc = src[0];
+#pragma omp simd reduction(max : acc)
+    for (int64_t i = 0; i < n; ++i) {
+        acc = src[i] > acc ? src[i] : acc;
+    }
+    return acc;
+}
+
+/// Index of the first element equal to \p val, or -1 (e.g. for NaN).
+template <typename scalar_t>
+OPEN3D_SIMD_TARGET int64_t FindFirstKernel(const scalar_t* src,
+                                           int64_t n,
+                                           scalar_t val) {
+    for (int64_t i = 0; i < n; ++i) {
+        if (src[i] == val) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/// Writes the reduced value to \p dst_val. For arg-reductions, writes the
+/// index of the first extremum to \p dst_idx, or -1 if it cannot be found.
+bool Reduction(ReductionOpCode op_code,
+               Dtype dtype,
+               const void* src,
+               int64_t n,
+               void* dst_val,
+               int64_t* dst_idx) {
+    bool supported = true;
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* src_ptr = static_cast<const scalar_t*>(src);
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst_val);
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                *dst_ptr = SumKernel<scalar_t>(src_ptr, n);
+                break;
+            case ReductionOpCode::Min:
+                *dst_ptr = MinKernel<scalar_t>(src_ptr, n);
+                break;
+            case ReductionOpCode::Max:
+                *dst_ptr = MaxKernel<scalar_t>(src_ptr, n);
+                break;
+            case ReductionOpCode::ArgMin:
+                *dst_ptr = MinKernel<scalar_t>(src_ptr, n);
+                *dst_idx = FindFirstKernel<scalar_t>(src_ptr, n, *dst_ptr);
+                break;
+            case ReductionOpCode::ArgMax:
+                *dst_ptr = MaxKernel<scalar_t>(src_ptr, n);
+                *dst_idx = FindFirstKernel<scalar_t>(src_ptr, n, *dst_ptr);
+                break;
+            default:
+                supported = false;
+                break;
+        }
+    });
+    return supported;
+}
+
+}  // namespace OPEN3D_SIMD_NAMESPACE
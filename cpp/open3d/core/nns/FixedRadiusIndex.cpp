@@ -26,11 +26,8 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
-#ifdef BUILD_CUDA_MODULE
-#include "open3d/core/nns/FixedRadiusSearch.h"
-#endif
-
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -48,17 +45,13 @@ FixedRadiusIndex::~FixedRadiusIndex(){};
 
 bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                                      double radius) {
-#ifdef BUILD_CUDA_MODULE
-    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CUDA) {
-        utility::LogError(
-                "[FixedRadiusIndex::SetTensorData] dataset_points should be "
-                "GPU Tensor.");
-    }
     if (radius <= 0) {
         utility::LogError(
                 "[FixedRadiusIndex::SetTensorData] radius should be positive.");
     }
+    dataset_points.AssertShapeCompatible({utility::nullopt, 3});
     dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
     Device device = GetDevice();
     Dtype dtype = GetDtype();
 
@@ -74,6 +67,18 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
     hash_table_cell_splits_ = Tensor::Empty({hash_table_splits_.back() + 1},
                                             Dtype::Int64, device);
 
+    if (device.GetType() == Device::DeviceType::CPU) {
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            BuildSpatialHashTableCPU(
+                    num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                    scalar_t(radius), hash_table_cell_splits_.GetShape()[0],
+                    hash_table_cell_splits_.GetDataPtr<int64_t>(),
+                    hash_table_index_.GetDataPtr<int64_t>());
+        });
+        return true;
+    }
+
+#ifdef BUILD_CUDA_MODULE
     void *temp_ptr = nullptr;
     size_t temp_size = 0;
 
@@ -111,7 +116,6 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius, bool sort) const {
-#ifdef BUILD_CUDA_MODULE
     Dtype dtype = GetDtype();
     Device device = GetDevice();
     int64_t num_dataset_points = GetDatasetSize();
@@ -132,16 +136,36 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
 
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
-    std::vector<int64_t> queries_row_splits({0, num_query_points});
-
-    void *temp_ptr = nullptr;
-    size_t temp_size = 0;
 
     Tensor neighbors_index;
     Tensor neighbors_distance;
     Tensor neighbors_row_splits =
             Tensor({num_query_points + 1}, Dtype::Int64, device);
 
+    if (device.GetType() == Device::DeviceType::CPU) {
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(device);
+            FixedRadiusSearchCPU(
+                    neighbors_row_splits.GetDataPtr<int64_t>(),
+                    num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                    num_query_points, query_points_.GetDataPtr<scalar_t>(),
+                    scalar_t(radius), scalar_t(radius_), sort,
+                    hash_table_cell_splits_.GetShape()[0],
+                    hash_table_cell_splits_.GetDataPtr<int64_t>(),
+                    hash_table_index_.GetDataPtr<int64_t>(), output_allocator);
+            neighbors_index = output_allocator.NeighborsIndex();
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+        return std::make_tuple(neighbors_index, neighbors_distance,
+                               neighbors_row_splits);
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    std::vector<int64_t> queries_row_splits({0, num_query_points});
+
+    void *temp_ptr = nullptr;
+    size_t temp_size = 0;
+
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         NeighborSearchAllocator<scalar_t> output_allocator(device);
         // Determine temp_size.
@@ -224,7 +248,6 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
 
 std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
         const Tensor &query_points, double radius, int max_knn) const {
-#ifdef BUILD_CUDA_MODULE
     Dtype dtype = GetDtype();
     Device device = GetDevice();
     int64_t num_dataset_points = GetDatasetSize();
@@ -243,12 +266,37 @@ std::pair<Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
                 "[FixedRadiusIndex::SearchRadius] radius should be positive.");
     }
 
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::SearchHybrid] max_knn should be positive.");
+    }
+
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
-    std::vector<int64_t> queries_row_splits({0, num_query_points});
 
     Tensor neighbors_index, neighbors_distance;
 
+    if (device.GetType() == Device::DeviceType::CPU) {
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+            NeighborSearchAllocator<scalar_t> output_allocator(device);
+            HybridSearchCPU(
+                    num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                    num_query_points, query_points_.GetDataPtr<scalar_t>(),
+                    scalar_t(radius), scalar_t(radius_), max_knn,
+                    hash_table_cell_splits_.GetShape()[0],
+                    hash_table_cell_splits_.GetDataPtr<int64_t>(),
+                    hash_table_index_.GetDataPtr<int64_t>(), output_allocator);
+            neighbors_index = output_allocator.NeighborsIndex();
+            neighbors_distance = output_allocator.NeighborsDistance();
+        });
+        return std::make_pair(
+                neighbors_index.View({num_query_points, max_knn}),
+                neighbors_distance.View({num_query_points, max_knn}));
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    std::vector<int64_t> queries_row_splits({0, num_query_points});
+
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         NeighborSearchAllocator<scalar_t> output_allocator(device);
         // Determine temp_size.
@@ -39,6 +39,9 @@ namespace nns {
 /// \class FixedRadiusIndex
 ///
 /// \brief FixedRadiusIndex for nearest neighbor range search.
+///
+/// The dataset points are binned into a spatial hash grid with a voxel size of
+/// twice the radius. CPU and CUDA tensors are supported.
 class FixedRadiusIndex : public NNSIndex {
 public:
     /// \brief Default Constructor.
@@ -89,6 +92,8 @@ public:
     const int64_t max_hash_tabls_size = 33554432;
 
 protected:
+    /// Radius the hash table was built with.
+    double radius_ = 0;
     std::vector<int64_t> points_row_splits_;
     std::vector<int64_t> hash_table_splits_;
     Tensor hash_table_cell_splits_;
@@ -310,6 +310,108 @@ void SortPairs(void* temp,
                int64_t* indices_sorted,
                T* distances_sorted);
 
+/// Builds the spatial hash table of BuildSpatialHashTableCUDA on the CPU for
+/// a single batch item. Unlike the CUDA version the points of each hash table
+/// entry are stored in ascending index order, which makes the search results
+/// deterministic.
+///
+/// All pointer arguments point to host memory.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    The array of 3D points.
+///
+/// \param radius    The radius that will be used for searching. The voxel
+///        size of the grid is 2 * \p radius.
+///
+/// \param hash_table_cell_splits_size    This is the length of the
+///        hash_table_cell_splits array.
+///
+/// \param hash_table_cell_splits    This is an output array storing the start
+///        of each hash table entry. The hash table size is
+///        hash_table_cell_splits_size - 1.
+///
+/// \param hash_table_index    This is an output array storing the values of the
+///        hash table, which are the indices to the points. The size of the
+///        array must be equal to the number of points.
+///
+template <class T>
+void BuildSpatialHashTableCPU(size_t num_points,
+                              const T* const points,
+                              const T radius,
+                              size_t hash_table_cell_splits_size,
+                              int64_t* hash_table_cell_splits,
+                              int64_t* hash_table_index);
+
+/// Fixed radius search on the CPU using the hash table built with
+/// BuildSpatialHashTableCPU. Returns squared L2 distances of all points with
+/// a distance <= \p radius to each query.
+///
+/// All pointer arguments point to host memory.
+///
+/// \param query_neighbors_row_splits    This is the output pointer for the
+///        prefix sum. The length of this array is \p num_queries + 1.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    Array with the 3D point positions.
+///
+/// \param num_queries    The number of query points.
+///
+/// \param queries    Array with the 3D query positions.
+///
+/// \param radius    The search radius. This may differ from the radius the
+///        hash table was built with.
+///
+/// \param build_radius    The radius passed to BuildSpatialHashTableCPU.
+///
+/// \param sort    If true the neighbors of each query are sorted by distance.
+///
+/// \param hash_table_cell_splits_size    This is the length of the
+///        hash_table_cell_splits array.
+///
+/// \param hash_table_cell_splits    This is an output of the function
+///        BuildSpatialHashTableCPU.
+///
+/// \param hash_table_index    This is an output of the function
+///        BuildSpatialHashTableCPU.
+///
+/// \param output_allocator    An object that implements functions for
+///         allocating the output arrays, see FixedRadiusSearchCUDA.
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T build_radius,
+                          const bool sort,
+                          size_t hash_table_cell_splits_size,
+                          const int64_t* const hash_table_cell_splits,
+                          const int64_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator);
+
+/// Hybrid search on the CPU using the hash table built with
+/// BuildSpatialHashTableCPU. For each query the \p max_knn nearest points
+/// within \p radius are returned sorted by distance. Missing neighbors are
+/// padded with index -1 and distance 0.
+///
+/// All pointer arguments point to host memory. The parameters are the same as
+/// for FixedRadiusSearchCPU.
+template <class T>
+void HybridSearchCPU(size_t num_points,
+                     const T* const points,
+                     size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const T build_radius,
+                     const int max_knn,
+                     size_t hash_table_cell_splits_size,
+                     const int64_t* const hash_table_cell_splits,
+                     const int64_t* const hash_table_index,
+                     NeighborSearchAllocator<T>& output_allocator);
+
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
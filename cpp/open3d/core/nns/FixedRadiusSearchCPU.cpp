@@ -0,0 +1,369 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/nns/FixedRadiusSearch.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+/// Number of queries handled by one task of the radius search. Each task
+/// collects its neighbors in a private arena before they are copied to the
+/// output arrays.
+constexpr int64_t kQueryBatchSize = 256;
+
+/// Grain size for the per point and per query loops.
+constexpr int64_t kGrainSize = 1024;
+
+template <class T>
+using Vec3 = utility::MiniVec<T, 3>;
+
+/// Collects the distinct hash table entries that may contain points within
+/// \p radius of \p pos into \p bins.
+template <class T>
+void GetCandidateBins(const Vec3<T>& pos,
+                      const T radius,
+                      const T inv_voxel_size,
+                      const size_t hash_table_size,
+                      std::vector<size_t>& bins) {
+    const Vec3<T> offset(radius, radius, radius);
+    const utility::MiniVec<int, 3> lo =
+            ComputeVoxelIndex(pos - offset, inv_voxel_size);
+    const utility::MiniVec<int, 3> hi =
+            ComputeVoxelIndex(pos + offset, inv_voxel_size);
+
+    bins.clear();
+    const size_t num_voxels = size_t(hi[0] - lo[0] + 1) *
+                              size_t(hi[1] - lo[1] + 1) *
+                              size_t(hi[2] - lo[2] + 1);
+    if (num_voxels >= hash_table_size) {
+        // The search radius is large compared to the voxel size.
+        for (size_t bin = 0; bin < hash_table_size; ++bin) bins.push_back(bin);
+        return;
+    }
+    for (int z = lo[2]; z <= hi[2]; ++z) {
+        for (int y = lo[1]; y <= hi[1]; ++y) {
+            for (int x = lo[0]; x <= hi[0]; ++x) {
+                bins.push_back(SpatialHash(x, y, z) % hash_table_size);
+            }
+        }
+    }
+    // Different voxels may share an entry, which must be visited only once.
+    std::sort(bins.begin(), bins.end());
+    bins.erase(std::unique(bins.begin(), bins.end()), bins.end());
+}
+
+/// Calls \p func(index, distance) for each point with a squared distance
+/// <= \p threshold to \p pos. Points are visited per hash table entry.
+template <class T, class Func>
+void ForEachNeighbor(const Vec3<T>& pos,
+                     const T threshold,
+                     const T* const points,
+                     const std::vector<size_t>& bins,
+                     const int64_t* const hash_table_cell_splits,
+                     const int64_t* const hash_table_index,
+                     const Func& func) {
+    for (size_t bin : bins) {
+        const int64_t begin = hash_table_cell_splits[bin];
+        const int64_t end = hash_table_cell_splits[bin + 1];
+        for (int64_t j = begin; j < end; ++j) {
+            const int64_t idx = hash_table_index[j];
+            const Vec3<T> diff = Vec3<T>(points + 3 * idx) - pos;
+            const T dist = diff.dot(diff);
+            if (dist <= threshold) func(idx, dist);
+        }
+    }
+}
+
+}  // namespace
+
+template <class T>
+void BuildSpatialHashTableCPU(size_t num_points,
+                              const T* const points,
+                              const T radius,
+                              size_t hash_table_cell_splits_size,
+                              int64_t* hash_table_cell_splits,
+                              int64_t* hash_table_index) {
+    const size_t hash_table_size = hash_table_cell_splits_size - 1;
+    const T inv_voxel_size = 1 / (2 * radius);
+
+    // Count the points per entry.
+    std::vector<size_t> point_bins(num_points);
+    std::unique_ptr<std::atomic<int64_t>[]> counts(
+            new std::atomic<int64_t>[hash_table_size]());
+    ParallelFor(
+            num_points,
+            [&](int64_t i) {
+                const Vec3<T> pos(points + 3 * i);
+                const size_t bin =
+                        SpatialHash(ComputeVoxelIndex(pos, inv_voxel_size)) %
+                        hash_table_size;
+                point_bins[i] = bin;
+                counts[bin].fetch_add(1, std::memory_order_relaxed);
+            },
+            kGrainSize);
+
+    hash_table_cell_splits[0] = 0;
+    ParallelFor(
+            hash_table_size,
+            [&](int64_t bin) {
+                hash_table_cell_splits[bin + 1] = counts[bin].load();
+                counts[bin].store(0);
+            },
+            kGrainSize);
+    utility::InclusivePrefixSum(hash_table_cell_splits + 1,
+                                hash_table_cell_splits + hash_table_size + 1,
+                                hash_table_cell_splits + 1);
+
+    // Scatter the point indices and restore the index order in each entry.
+    ParallelFor(
+            num_points,
+            [&](int64_t i) {
+                const size_t bin = point_bins[i];
+                hash_table_index[hash_table_cell_splits[bin] +
+                                 counts[bin].fetch_add(
+                                         1, std::memory_order_relaxed)] = i;
+            },
+            kGrainSize);
+    ParallelFor(
+            hash_table_size,
+            [&](int64_t bin) {
+                std::sort(hash_table_index + hash_table_cell_splits[bin],
+                          hash_table_index + hash_table_cell_splits[bin + 1]);
+            },
+            kGrainSize);
+}
+
+template <class T>
+void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
+                          size_t num_points,
+                          const T* const points,
+                          size_t num_queries,
+                          const T* const queries,
+                          const T radius,
+                          const T build_radius,
+                          const bool sort,
+                          size_t hash_table_cell_splits_size,
+                          const int64_t* const hash_table_cell_splits,
+                          const int64_t* const hash_table_index,
+                          NeighborSearchAllocator<T>& output_allocator) {
+    const size_t hash_table_size = hash_table_cell_splits_size - 1;
+    const T inv_voxel_size = 1 / (2 * build_radius);
+    const T threshold = radius * radius;
+    const int64_t num_batches =
+            (int64_t(num_queries) + kQueryBatchSize - 1) / kQueryBatchSize;
+
+    // Search each batch of queries into its arena and record the number of
+    // neighbors per query.
+    std::vector<std::vector<std::pair<int64_t, T>>> arenas(num_batches);
+    query_neighbors_row_splits[0] = 0;
+    ParallelFor(num_batches, [&](int64_t batch_idx) {
+        std::vector<std::pair<int64_t, T>>& arena = arenas[batch_idx];
+        std::vector<size_t> bins;
+        const int64_t end = std::min<int64_t>(
+                num_queries, (batch_idx + 1) * kQueryBatchSize);
+        for (int64_t i = batch_idx * kQueryBatchSize; i < end; ++i) {
+            const Vec3<T> pos(queries + 3 * i);
+            const size_t begin = arena.size();
+            GetCandidateBins(pos, radius, inv_voxel_size, hash_table_size,
+                             bins);
+            ForEachNeighbor(pos, threshold, points, bins,
+                            hash_table_cell_splits, hash_table_index,
+                            [&](int64_t idx, T dist) {
+                                arena.emplace_back(idx, dist);
+                            });
+            if (sort) {
+                std::sort(arena.begin() + begin, arena.end(),
+                          [](const std::pair<int64_t, T>& a,
+                             const std::pair<int64_t, T>& b) {
+                              return a.second < b.second ||
+                                     (a.second == b.second &&
+                                      a.first < b.first);
+                          });
+            }
+            query_neighbors_row_splits[i + 1] = arena.size() - begin;
+        }
+    });
+    utility::InclusivePrefixSum(query_neighbors_row_splits + 1,
+                                query_neighbors_row_splits + num_queries + 1,
+                                query_neighbors_row_splits + 1);
+
+    // Copy the arenas to the output arrays.
+    const size_t num_indices = query_neighbors_row_splits[num_queries];
+    int64_t* indices_ptr;
+    T* distances_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices);
+    output_allocator.AllocDistances(&distances_ptr, num_indices);
+    ParallelFor(num_batches, [&](int64_t batch_idx) {
+        const std::vector<std::pair<int64_t, T>>& arena = arenas[batch_idx];
+        const int64_t offset =
+                query_neighbors_row_splits[batch_idx * kQueryBatchSize];
+        for (size_t k = 0; k < arena.size(); ++k) {
+            indices_ptr[offset + k] = arena[k].first;
+            distances_ptr[offset + k] = arena[k].second;
+        }
+    });
+}
+
+template <class T>
+void HybridSearchCPU(size_t num_points,
+                     const T* const points,
+                     size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const T build_radius,
+                     const int max_knn,
+                     size_t hash_table_cell_splits_size,
+                     const int64_t* const hash_table_cell_splits,
+                     const int64_t* const hash_table_index,
+                     NeighborSearchAllocator<T>& output_allocator) {
+    const size_t hash_table_size = hash_table_cell_splits_size - 1;
+    const T inv_voxel_size = 1 / (2 * build_radius);
+    const T threshold = radius * radius;
+
+    int64_t* indices_ptr;
+    T* distances_ptr;
+    const size_t num_indices = num_queries * max_knn;
+    output_allocator.AllocIndices(&indices_ptr, num_indices, -1);
+    output_allocator.AllocDistances(&distances_ptr, num_indices, 0);
+
+    ParallelForRange(
+            num_queries,
+            [&](int64_t begin, int64_t end) {
+                std::vector<size_t> bins;
+                for (int64_t i = begin; i < end; ++i) {
+                    const Vec3<T> pos(queries + 3 * i);
+                    int64_t* const query_indices = indices_ptr + i * max_knn;
+                    T* const query_distances = distances_ptr + i * max_knn;
+                    int count = 0;
+                    GetCandidateBins(pos, radius, inv_voxel_size,
+                                     hash_table_size, bins);
+                    // Keep the max_knn nearest neighbors sorted by insertion.
+                    ForEachNeighbor(
+                            pos, threshold, points, bins,
+                            hash_table_cell_splits, hash_table_index,
+                            [&](int64_t idx, T dist) {
+                                if (count == max_knn &&
+                                    dist >= query_distances[max_knn - 1]) {
+                                    return;
+                                }
+                                int k = count < max_knn ? count++
+                                                        : max_knn - 1;
+                                for (; k > 0 && query_distances[k - 1] > dist;
+                                     --k) {
+                                    query_indices[k] = query_indices[k - 1];
+                                    query_distances[k] = query_distances[k - 1];
+                                }
+                                query_indices[k] = idx;
+                                query_distances[k] = dist;
+                            });
+                }
+            },
+            kGrainSize / 16);
+}
+
+template void BuildSpatialHashTableCPU(
+        size_t num_points,
+        const float* const points,
+        const float radius,
+        size_t hash_table_cell_splits_size,
+        int64_t* hash_table_cell_splits,
+        int64_t* hash_table_index);
+
+template void BuildSpatialHashTableCPU(
+        size_t num_points,
+        const double* const points,
+        const double radius,
+        size_t hash_table_cell_splits_size,
+        int64_t* hash_table_cell_splits,
+        int64_t* hash_table_index);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const float* const points,
+        size_t num_queries,
+        const float* const queries,
+        const float radius,
+        const float build_radius,
+        const bool sort,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        NeighborSearchAllocator<float>& output_allocator);
+
+template void FixedRadiusSearchCPU(
+        int64_t* query_neighbors_row_splits,
+        size_t num_points,
+        const double* const points,
+        size_t num_queries,
+        const double* const queries,
+        const double radius,
+        const double build_radius,
+        const bool sort,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        NeighborSearchAllocator<double>& output_allocator);
+
+template void HybridSearchCPU(
+        size_t num_points,
+        const float* const points,
+        size_t num_queries,
+        const float* const queries,
+        const float radius,
+        const float build_radius,
+        const int max_knn,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        NeighborSearchAllocator<float>& output_allocator);
+
+template void HybridSearchCPU(
+        size_t num_points,
+        const double* const points,
+        size_t num_queries,
+        const double* const queries,
+        const double radius,
+        const double build_radius,
+        const int max_knn,
+        size_t hash_table_cell_splits_size,
+        const int64_t* const hash_table_cell_splits,
+        const int64_t* const hash_table_index,
+        NeighborSearchAllocator<double>& output_allocator);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
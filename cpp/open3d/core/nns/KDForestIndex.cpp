@@ -0,0 +1,425 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KDForestIndex.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+namespace {
+
+/// Leaves hold at most this many points.
+constexpr int64_t kMaxLeafSize = 10;
+
+/// Number of points sampled to estimate the variance of a node.
+constexpr int64_t kVarianceSampleSize = 100;
+
+/// The split dimension is drawn among this many dimensions of highest
+/// variance.
+constexpr int kNumRandomDims = 5;
+
+/// Queries handled by one task of the parallel search.
+constexpr int64_t kQueryGrainSize = 64;
+
+template <typename scalar_t>
+struct KDForestHolder : KDForestHolderBase {
+    struct Node {
+        /// Split dimension, or -1 for a leaf.
+        int64_t dim;
+        scalar_t split;
+        /// Children of an inner node, or the [begin, end) range of a leaf in
+        /// the index array of its tree.
+        int64_t left;
+        int64_t right;
+    };
+
+    struct Tree {
+        std::vector<Node> nodes;
+        std::vector<int64_t> indices;
+    };
+
+    KDForestHolder(int64_t num_points,
+                   int64_t dimension,
+                   const scalar_t *points,
+                   int num_trees)
+        : num_points_(num_points),
+          dimension_(dimension),
+          points_(points),
+          trees_(num_trees) {
+        ParallelFor(num_trees, [&](int64_t tree_idx) {
+            Tree &tree = trees_[tree_idx];
+            std::mt19937 rng(static_cast<uint32_t>(tree_idx));
+            tree.indices.resize(num_points);
+            std::iota(tree.indices.begin(), tree.indices.end(), 0);
+            std::shuffle(tree.indices.begin(), tree.indices.end(), rng);
+            if (num_points > 0) {
+                BuildNode(tree, 0, num_points, rng);
+            }
+        });
+    }
+
+    const scalar_t *Point(int64_t idx) const {
+        return points_ + idx * dimension_;
+    }
+
+    /// Builds the subtree over tree.indices[begin, end) and returns the index
+    /// of its root node.
+    int64_t BuildNode(Tree &tree,
+                      int64_t begin,
+                      int64_t end,
+                      std::mt19937 &rng) {
+        const int64_t node_idx = static_cast<int64_t>(tree.nodes.size());
+        tree.nodes.push_back({-1, 0, begin, end});
+        if (end - begin <= kMaxLeafSize) {
+            return node_idx;
+        }
+
+        // Estimate mean and variance per dimension from a sample.
+        const int64_t step =
+                std::max<int64_t>(1, (end - begin) / kVarianceSampleSize);
+        std::vector<double> mean(dimension_, 0), var(dimension_, 0);
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; i += step, ++count) {
+            const scalar_t *p = Point(tree.indices[i]);
+            for (int64_t d = 0; d < dimension_; ++d) mean[d] += p[d];
+        }
+        for (int64_t d = 0; d < dimension_; ++d) mean[d] /= count;
+        for (int64_t i = begin; i < end; i += step) {
+            const scalar_t *p = Point(tree.indices[i]);
+            for (int64_t d = 0; d < dimension_; ++d) {
+                var[d] += (p[d] - mean[d]) * (p[d] - mean[d]);
+            }
+        }
+
+        // Draw the split dimension among those of highest variance.
+        std::vector<int64_t> dims(dimension_);
+        std::iota(dims.begin(), dims.end(), 0);
+        const int64_t num_candidates =
+                std::min<int64_t>(kNumRandomDims, dimension_);
+        std::partial_sort(
+                dims.begin(), dims.begin() + num_candidates, dims.end(),
+                [&](int64_t a, int64_t b) { return var[a] > var[b]; });
+        if (var[dims[0]] <= 0) {
+            // The sample holds duplicates only, keep them in one leaf.
+            return node_idx;
+        }
+        int64_t num_positive = 0;
+        while (num_positive < num_candidates && var[dims[num_positive]] > 0) {
+            ++num_positive;
+        }
+        const int64_t dim = dims[std::uniform_int_distribution<int64_t>(
+                0, num_positive - 1)(rng)];
+
+        // Split at the mean, or at the median if the mean leaves one side
+        // empty.
+        scalar_t split = static_cast<scalar_t>(mean[dim]);
+        int64_t *first = tree.indices.data() + begin;
+        int64_t *last = tree.indices.data() + end;
+        int64_t *middle = std::partition(first, last, [&](int64_t idx) {
+            return Point(idx)[dim] < split;
+        });
+        if (middle == first || middle == last) {
+            middle = first + (end - begin) / 2;
+            std::nth_element(first, middle, last, [&](int64_t a, int64_t b) {
+                return Point(a)[dim] < Point(b)[dim];
+            });
+            split = Point(*middle)[dim];
+        }
+
+        const int64_t mid = begin + (middle - first);
+        const int64_t left = BuildNode(tree, begin, mid, rng);
+        const int64_t right = BuildNode(tree, mid, end, rng);
+        tree.nodes[node_idx] = {dim, split, left, right};
+        return node_idx;
+    }
+
+    int64_t num_points_;
+    int64_t dimension_;
+    const scalar_t *points_;
+    std::vector<Tree> trees_;
+};
+
+/// Per task state of the forest search, reused across queries.
+template <typename scalar_t>
+class KDForestSearcher {
+public:
+    KDForestSearcher(const KDForestHolder<scalar_t> &holder,
+                     int knn,
+                     int max_checks)
+        : holder_(holder), knn_(knn), max_checks_(max_checks) {
+        // A query usually compares max_checks points plus one leaf per tree.
+        // The table grows if more are visited.
+        const int64_t max_visited =
+                max_checks + (holder.trees_.size() + 1) * kMaxLeafSize;
+        int64_t table_size = 1;
+        while (table_size < 2 * max_visited) table_size <<= 1;
+        visited_.assign(table_size, -1);
+    }
+
+    /// Writes the knn_ nearest points found for \p query to \p indices and
+    /// \p distances, sorted by distance.
+    void Search(const scalar_t *query, int64_t *indices, scalar_t *distances) {
+        query_ = query;
+        indices_ = indices;
+        distances_ = distances;
+        count_ = 0;
+        checks_ = 0;
+        branches_.clear();
+
+        for (size_t t = 0; t < holder_.trees_.size(); ++t) {
+            Descend(static_cast<int>(t), 0, 0);
+        }
+        // Keep exploring until max_checks_ points were compared, but at least
+        // until knn_ neighbors are found.
+        while (!branches_.empty() &&
+               (checks_ < max_checks_ || count_ < knn_)) {
+            std::pop_heap(branches_.begin(), branches_.end(), BranchGreater);
+            const Branch branch = branches_.back();
+            branches_.pop_back();
+            if (count_ == knn_ && branch.dist >= distances_[knn_ - 1]) {
+                break;
+            }
+            Descend(branch.tree, branch.node, branch.dist);
+        }
+
+        for (int64_t slot : used_slots_) visited_[slot] = -1;
+        used_slots_.clear();
+    }
+
+private:
+    struct Branch {
+        scalar_t dist;
+        int tree;
+        int64_t node;
+    };
+
+    static bool BranchGreater(const Branch &a, const Branch &b) {
+        return a.dist > b.dist;
+    }
+
+    /// Descends from \p node to a leaf, queueing the branches not taken with
+    /// a lower bound of their distance, and checks the points of the leaf.
+    void Descend(int tree_idx, int64_t node_idx, scalar_t min_dist) {
+        const typename KDForestHolder<scalar_t>::Tree &tree =
+                holder_.trees_[tree_idx];
+        const typename KDForestHolder<scalar_t>::Node *node =
+                &tree.nodes[node_idx];
+        while (node->dim >= 0) {
+            const scalar_t diff = query_[node->dim] - node->split;
+            const int64_t near_child = diff < 0 ? node->left : node->right;
+            const int64_t far_child = diff < 0 ? node->right : node->left;
+            const scalar_t far_dist = min_dist + diff * diff;
+            if (count_ < knn_ || far_dist < distances_[knn_ - 1]) {
+                branches_.push_back({far_dist, tree_idx, far_child});
+                std::push_heap(branches_.begin(), branches_.end(),
+                               BranchGreater);
+            }
+            node = &tree.nodes[near_child];
+        }
+        for (int64_t i = node->left; i < node->right; ++i) {
+            CheckPoint(tree.indices[i]);
+        }
+    }
+
+    /// Marks \p idx as visited and returns false if it already was. Points
+    /// are shared by all trees and each is compared only once per query.
+    bool Visit(int64_t idx) {
+        if (static_cast<int64_t>(used_slots_.size()) * 2 >=
+            static_cast<int64_t>(visited_.size())) {
+            std::vector<int64_t> visited_points;
+            for (int64_t slot : used_slots_) {
+                visited_points.push_back(visited_[slot]);
+            }
+            used_slots_.clear();
+            visited_.assign(visited_.size() * 2, -1);
+            for (int64_t visited_idx : visited_points) Visit(visited_idx);
+        }
+        const uint64_t mask = visited_.size() - 1;
+        uint64_t slot = (uint64_t(idx) * 0x9E3779B97F4A7C15ULL >> 20) & mask;
+        while (visited_[slot] >= 0) {
+            if (visited_[slot] == idx) return false;
+            slot = (slot + 1) & mask;
+        }
+        visited_[slot] = idx;
+        used_slots_.push_back(slot);
+        return true;
+    }
+
+    void CheckPoint(int64_t idx) {
+        if (!Visit(idx)) return;
+        ++checks_;
+
+        const scalar_t worst = count_ == knn_
+                                       ? distances_[knn_ - 1]
+                                       : std::numeric_limits<scalar_t>::max();
+        const scalar_t *p = holder_.Point(idx);
+        scalar_t dist = 0;
+        for (int64_t d = 0; d < holder_.dimension_; ++d) {
+            const scalar_t diff = query_[d] - p[d];
+            dist += diff * diff;
+        }
+        if (dist >= worst) return;
+
+        int k = count_ < knn_ ? count_++ : knn_ - 1;
+        for (; k > 0 && distances_[k - 1] > dist; --k) {
+            indices_[k] = indices_[k - 1];
+            distances_[k] = distances_[k - 1];
+        }
+        indices_[k] = idx;
+        distances_[k] = dist;
+    }
+
+    const KDForestHolder<scalar_t> &holder_;
+    const int knn_;
+    const int max_checks_;
+
+    std::vector<Branch> branches_;
+    std::vector<int64_t> visited_;
+    std::vector<int64_t> used_slots_;
+
+    const scalar_t *query_;
+    int64_t *indices_;
+    scalar_t *distances_;
+    int count_;
+    int checks_;
+};
+
+}  // namespace
+
+KDForestIndex::KDForestIndex(int num_trees, int max_checks)
+    : num_trees_(num_trees), max_checks_(max_checks) {
+    if (num_trees <= 0) {
+        utility::LogError(
+                "[KDForestIndex] num_trees should be positive, but got {}.",
+                num_trees);
+    }
+    SetMaxChecks(max_checks);
+}
+
+KDForestIndex::KDForestIndex(const Tensor &dataset_points,
+                             int num_trees,
+                             int max_checks)
+    : KDForestIndex(num_trees, max_checks) {
+    SetTensorData(dataset_points);
+}
+
+KDForestIndex::~KDForestIndex() {}
+
+bool KDForestIndex::SetTensorData(const Tensor &dataset_points) {
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[KDForestIndex::SetTensorData] dataset_points must be "
+                "2D matrix, with shape {n_dataset_points, d}.");
+    }
+    if (dataset_points.GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "[KDForestIndex::SetTensorData] dataset_points should be a "
+                "CPU Tensor.");
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    const int64_t num_points = GetDatasetSize();
+    const int64_t dimension = GetDimension();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        holder_.reset(new KDForestHolder<scalar_t>(
+                num_points, dimension, dataset_points_.GetDataPtr<scalar_t>(),
+                num_trees_));
+    });
+    return true;
+}
+
+std::pair<Tensor, Tensor> KDForestIndex::SearchKnn(const Tensor &query_points,
+                                                   int knn) const {
+    if (!holder_) {
+        utility::LogError("[KDForestIndex::SearchKnn] Index is not set.");
+    }
+    query_points.AssertDtype(GetDtype());
+    query_points.AssertDevice(GetDevice());
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    if (knn <= 0) {
+        utility::LogError(
+                "[KDForestIndex::SearchKnn] knn should be larger than 0.");
+    }
+
+    const int64_t num_query_points = query_points.GetShape()[0];
+    const int64_t num_neighbors =
+            std::min<int64_t>(knn, static_cast<int64_t>(GetDatasetSize()));
+    const int64_t dimension = GetDimension();
+
+    Tensor indices = Tensor::Full({num_query_points, num_neighbors}, -1,
+                                  Dtype::Int64);
+    Tensor distances =
+            Tensor::Zeros({num_query_points, num_neighbors}, GetDtype());
+    if (num_neighbors == 0) {
+        return std::make_pair(indices, distances);
+    }
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const KDForestHolder<scalar_t> &holder =
+                *static_cast<KDForestHolder<scalar_t> *>(holder_.get());
+        Tensor queries = query_points.Contiguous();
+        const scalar_t *query_ptr = queries.GetDataPtr<scalar_t>();
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+
+        ParallelForRange(
+                num_query_points,
+                [&](int64_t begin, int64_t end) {
+                    KDForestSearcher<scalar_t> searcher(
+                            holder, static_cast<int>(num_neighbors),
+                            max_checks_);
+                    for (int64_t i = begin; i < end; ++i) {
+                        searcher.Search(query_ptr + i * dimension,
+                                        indices_ptr + i * num_neighbors,
+                                        distances_ptr + i * num_neighbors);
+                    }
+                },
+                kQueryGrainSize);
+    });
+    return std::make_pair(indices, distances);
+}
+
+void KDForestIndex::SetMaxChecks(int max_checks) {
+    if (max_checks <= 0) {
+        utility::LogError(
+                "[KDForestIndex] max_checks should be positive, but got {}.",
+                max_checks);
+    }
+    max_checks_ = max_checks;
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
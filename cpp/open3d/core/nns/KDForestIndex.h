@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Base struct for the typed trees of KDForestIndex.
+struct KDForestHolderBase {
+    virtual ~KDForestHolderBase() {}
+};
+
+/// \class KDForestIndex
+///
+/// \brief Randomized k-d forest for approximate knn search.
+///
+/// Each tree splits on a dimension drawn at random among the dimensions of
+/// highest variance. A query descends all trees and then explores the closest
+/// unvisited branches of the forest through one priority queue, until
+/// max_checks points have been compared. This trades exactness for speed on
+/// high dimensional data such as feature descriptors, where an exact KDTree
+/// has to visit most of the leaves. Only CPU tensors are supported.
+class KDForestIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param num_trees Number of randomized trees. More trees give a higher
+    /// recall for the same number of checks, at the cost of build time and
+    /// memory.
+    /// \param max_checks Maximum number of points compared per query. Higher
+    /// values give a higher recall at the cost of query time.
+    KDForestIndex(int num_trees = 4, int max_checks = 128);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides a set of data points as Tensor for the
+    /// forest construction.
+    /// \param num_trees Number of randomized trees.
+    /// \param max_checks Maximum number of points compared per query.
+    KDForestIndex(const Tensor &dataset_points,
+                  int num_trees = 4,
+                  int max_checks = 128);
+    ~KDForestIndex();
+    KDForestIndex(const KDForestIndex &) = delete;
+    KDForestIndex &operator=(const KDForestIndex &) = delete;
+
+public:
+    bool SetTensorData(const Tensor &dataset_points) override;
+
+    bool SetTensorData(const Tensor &dataset_points, double radius) override {
+        utility::LogError(
+                "KDForestIndex::SetTensorData with radius not implemented.");
+    }
+
+    /// Approximate knn search. Returns the indices and squared L2 distances
+    /// of at most \p knn neighbors per query, sorted by distance. Rows with
+    /// fewer neighbors found are padded with index -1 and distance 0.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            const Tensor &radii,
+            bool sort = true) const override {
+        utility::LogError("KDForestIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            double radius,
+            bool sort = true) const override {
+        utility::LogError("KDForestIndex::SearchRadius not implemented.");
+    }
+
+    std::pair<Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                           double radius,
+                                           int max_knn) const override {
+        utility::LogError("KDForestIndex::SearchHybrid not implemented.");
+    }
+
+    /// Sets the maximum number of points compared per query. This can be
+    /// changed without rebuilding the forest.
+    void SetMaxChecks(int max_checks);
+
+    int GetMaxChecks() const { return max_checks_; }
+
+    int GetNumTrees() const { return num_trees_; }
+
+protected:
+    int num_trees_;
+    int max_checks_;
+    std::unique_ptr<KDForestHolderBase> holder_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -26,12 +26,14 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
-#include <tbb/blocked_range2d.h>
-#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
+#include <algorithm>
 #include <nanoflann.hpp>
+#include <numeric>
 
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ParallelScan.h"
 
@@ -39,6 +41,155 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+namespace {
+
+/// Queries are processed in batches of this size. A batch is the unit of
+/// parallel work and owns the arena its radius search results are written to.
+constexpr int64_t kQueryBatchSize = 256;
+
+/// Sorting fewer queries costs more than the improved locality saves.
+constexpr int64_t kMinQueriesToSort = 8192;
+
+/// Inserts two zero bits between each of the lower 21 bits of x.
+inline uint64_t SplitBy3(uint64_t x) {
+    x &= 0x1FFFFF;
+    x = (x | x << 32) & 0x1F00000000FFFFULL;
+    x = (x | x << 16) & 0x1F0000FF0000FFULL;
+    x = (x | x << 8) & 0x100F00F00F00F00FULL;
+    x = (x | x << 4) & 0x10C30C30C30C30C3ULL;
+    x = (x | x << 2) & 0x1249249249249249ULL;
+    return x;
+}
+
+/// Returns the order of the queries along a Z-order (Morton) curve over
+/// their first three coordinates. Consecutive queries then traverse mostly
+/// the same tree nodes, which stay in cache.
+template <typename scalar_t>
+std::vector<int64_t> SortQueriesSpatially(const Tensor &query_points) {
+    const int64_t num_queries = query_points.GetShape()[0];
+    std::vector<int64_t> order(num_queries);
+    std::iota(order.begin(), order.end(), 0);
+    if (num_queries < kMinQueriesToSort) {
+        return order;
+    }
+
+    const int64_t dimension = query_points.GetShape()[1];
+    const int64_t sort_dims = std::min<int64_t>(dimension, 3);
+    Tensor sort_points = query_points.Slice(1, 0, sort_dims);
+    std::vector<scalar_t> min_bound =
+            sort_points.Min({0}).ToFlatVector<scalar_t>();
+    std::vector<scalar_t> max_bound =
+            sort_points.Max({0}).ToFlatVector<scalar_t>();
+    std::vector<double> scale(sort_dims);
+    for (int64_t d = 0; d < sort_dims; ++d) {
+        double extent = double(max_bound[d]) - double(min_bound[d]);
+        scale[d] = extent > 0 ? double(0x1FFFFF) / extent : 0;
+    }
+
+    const scalar_t *query_ptr = query_points.GetDataPtr<scalar_t>();
+    std::vector<uint64_t> codes(num_queries);
+    ParallelFor(
+            num_queries,
+            [&](int64_t i) {
+                uint64_t code = 0;
+                for (int64_t d = 0; d < sort_dims; ++d) {
+                    double offset = query_ptr[i * dimension + d] - min_bound[d];
+                    code |= SplitBy3(uint64_t(offset * scale[d])) << d;
+                }
+                codes[i] = code;
+            },
+            kQueryBatchSize);
+    tbb::parallel_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return codes[a] < codes[b];
+    });
+    return order;
+}
+
+/// Runs \p func(batch_idx, query_idx) over all queries, in \p order, in
+/// parallel batches of kQueryBatchSize.
+template <typename func_t>
+void ForEachQueryBatch(const std::vector<int64_t> &order, const func_t &func) {
+    const int64_t num_queries = static_cast<int64_t>(order.size());
+    const int64_t num_batches =
+            (num_queries + kQueryBatchSize - 1) / kQueryBatchSize;
+    ParallelFor(num_batches, [&](int64_t batch_idx) {
+        const int64_t end =
+                std::min(num_queries, (batch_idx + 1) * kQueryBatchSize);
+        for (int64_t j = batch_idx * kQueryBatchSize; j < end; ++j) {
+            func(batch_idx, order[j]);
+        }
+    });
+}
+
+/// Nanoflann result set appending all neighbors within the radius to an
+/// arena shared by the queries of a batch.
+template <typename scalar_t>
+class ArenaRadiusResultSet {
+public:
+    ArenaRadiusResultSet(scalar_t radius,
+                         std::vector<std::pair<int64_t, scalar_t>> &arena)
+        : radius_(radius), arena_(arena), begin_(arena.size()) {}
+
+    size_t size() const { return arena_.size() - begin_; }
+    bool full() const { return true; }
+    bool addPoint(scalar_t dist, int64_t index) {
+        if (dist < radius_) {
+            arena_.emplace_back(index, dist);
+        }
+        return true;
+    }
+    scalar_t worstDist() const { return radius_; }
+
+private:
+    scalar_t radius_;
+    std::vector<std::pair<int64_t, scalar_t>> &arena_;
+    size_t begin_;
+};
+
+/// Nanoflann result set keeping the max_knn nearest neighbors within the
+/// radius, sorted by distance. It writes directly to the output rows and
+/// shrinks the search radius once it is full.
+template <typename scalar_t>
+class HybridResultSet {
+public:
+    HybridResultSet(scalar_t radius,
+                    int64_t capacity,
+                    int64_t *indices,
+                    scalar_t *distances)
+        : radius_(radius),
+          capacity_(capacity),
+          indices_(indices),
+          distances_(distances) {}
+
+    size_t size() const { return static_cast<size_t>(count_); }
+    bool full() const { return count_ == capacity_; }
+    bool addPoint(scalar_t dist, int64_t index) {
+        if (dist >= worstDist()) {
+            return true;
+        }
+        int64_t i = full() ? capacity_ - 1 : count_++;
+        for (; i > 0 && distances_[i - 1] > dist; --i) {
+            distances_[i] = distances_[i - 1];
+            indices_[i] = indices_[i - 1];
+        }
+        distances_[i] = dist;
+        indices_[i] = index;
+        return true;
+    }
+    scalar_t worstDist() const {
+        return full() ? distances_[capacity_ - 1] : radius_;
+    }
+
+private:
+    scalar_t radius_;
+    int64_t capacity_;
+    int64_t count_ = 0;
+    int64_t *indices_;
+    scalar_t *distances_;
+};
+
+}  // namespace
+
 NanoFlannIndex::NanoFlannIndex(){};
 
 NanoFlannIndex::NanoFlannIndex(const Tensor &dataset_points) {
@@ -60,7 +211,7 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
     Dtype dtype = GetDtype();
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        const scalar_t *data_ptr = dataset_points.GetDataPtr<scalar_t>();
+        const scalar_t *data_ptr = dataset_points_.GetDataPtr<scalar_t>();
         holder_.reset(new NanoFlannIndexHolder<L2, scalar_t>(
                 dataset_size, dimension, data_ptr));
     });
@@ -81,51 +232,34 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     }
 
     int64_t num_query_points = query_points.GetShape()[0];
+    int64_t num_neighbors = std::min<int64_t>(knn, GetDatasetSize());
+    int dimension = GetDimension();
     Dtype dtype = GetDtype();
 
     Tensor indices;
     Tensor distances;
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        Tensor batch_indices =
-                Tensor::Full({num_query_points, knn}, -1, Dtype::Int64);
-        Tensor batch_distances =
-                Tensor::Full({num_query_points, knn}, -1, dtype);
+        Tensor queries = query_points.Contiguous();
+        const scalar_t *query_ptr = queries.GetDataPtr<scalar_t>();
+        indices = Tensor::Empty({num_query_points, num_neighbors},
+                                Dtype::Int64);
+        distances = Tensor::Empty({num_query_points, num_neighbors}, dtype);
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
 
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
 
-        // Parallel search.
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        auto single_indices = static_cast<int64_t *>(
-                                batch_indices[i].GetDataPtr());
-                        auto single_distances = static_cast<scalar_t *>(
-                                batch_distances[i].GetDataPtr());
-
-                        // search
-                        holder->index_->knnSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                static_cast<size_t>(knn), single_indices,
-                                single_distances);
-                    }
+        // Results are written in place, so only the search order changes.
+        ForEachQueryBatch(
+                SortQueriesSpatially<scalar_t>(queries),
+                [&](int64_t batch_idx, int64_t i) {
+                    holder->index_->knnSearch(
+                            query_ptr + i * dimension,
+                            static_cast<size_t>(num_neighbors),
+                            indices_ptr + i * num_neighbors,
+                            distances_ptr + i * num_neighbors);
                 });
-        // Check if the number of neighbors are same.
-        Tensor check_valid =
-                batch_indices.Ge(0).To(Dtype::Int64).Sum({-1}, false);
-        int64_t num_neighbors = check_valid[0].Item<int64_t>();
-        if (check_valid.Ne(num_neighbors).Any()) {
-            utility::LogError(
-                    "[NanoFlannIndex::SearchKnn] The number of neighbors are "
-                    "different. Something went wrong.");
-        }
-        // Slice non-zero items.
-        indices = batch_indices.Slice(1, 0, num_neighbors)
-                          .View({num_query_points, num_neighbors});
-        distances = batch_distances.Slice(1, 0, num_neighbors)
-                            .View({num_query_points, num_neighbors});
     });
     return std::make_pair(indices, distances);
 };
@@ -141,22 +275,16 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
     query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
     radii.AssertShape({num_query_points});
 
+    int dimension = GetDimension();
     Dtype dtype = GetDtype();
     Tensor indices;
     Tensor distances;
     Tensor neighbors_row_splits;
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        std::vector<std::vector<size_t>> batch_indices(num_query_points);
-        std::vector<std::vector<scalar_t>> batch_distances(num_query_points);
-        std::vector<int64_t> batch_nums;
-
         auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
                 holder_.get());
 
-        nanoflann::SearchParams params;
-        params.sorted = sort;
-
         // Check if the raii has negative values.
         Tensor below_zero = radii.Le(0);
         if (below_zero.Any()) {
@@ -165,56 +293,65 @@ std::tuple<Tensor, Tensor, Tensor> NanoFlannIndex::SearchRadius(
                     "larger than 0.");
         }
 
-        // Parallel search.
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    std::vector<std::pair<int64_t, scalar_t>> ret_matches;
-                    for (size_t i = r.begin(); i != r.end(); ++i) {
-                        scalar_t radius = radii[i].Item<scalar_t>();
-                        scalar_t radius_squared = radius * radius;
-
-                        size_t num_results = holder->index_->radiusSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[i].GetDataPtr()),
-                                radius_squared, ret_matches, params);
-                        ret_matches.resize(num_results);
-                        std::vector<size_t> single_indices;
-                        std::vector<scalar_t> single_distances;
-                        for (auto it = ret_matches.begin();
-                             it < ret_matches.end(); it++) {
-                            single_indices.push_back(it->first);
-                            single_distances.push_back(it->second);
-                        }
-                        batch_indices[i] = single_indices;
-                        batch_distances[i] = single_distances;
-                    }
-                });
+        Tensor queries = query_points.Contiguous();
+        Tensor radii_contiguous = radii.Contiguous();
+        const scalar_t *query_ptr = queries.GetDataPtr<scalar_t>();
+        const scalar_t *radii_ptr = radii_contiguous.GetDataPtr<scalar_t>();
+
+        // Search in spatial order. The results of each batch are appended
+        // to the batch's arena, in the batch's query order.
+        const std::vector<int64_t> order =
+                SortQueriesSpatially<scalar_t>(queries);
+        const int64_t num_batches =
+                (num_query_points + kQueryBatchSize - 1) / kQueryBatchSize;
+        std::vector<std::vector<std::pair<int64_t, scalar_t>>> arenas(
+                num_batches);
+        std::vector<int64_t> batch_nums(num_query_points);
 
-        // Flatten.
-        std::vector<int64_t> batch_indices2;
-        std::vector<scalar_t> batch_distances2;
-        for (auto i = 0; i < num_query_points; i++) {
-            batch_indices2.insert(batch_indices2.end(),
-                                  batch_indices[i].begin(),
-                                  batch_indices[i].end());
-            batch_distances2.insert(batch_distances2.end(),
-                                    batch_distances[i].begin(),
-                                    batch_distances[i].end());
-            batch_nums.push_back(batch_indices[i].size());
-        }
-        std::vector<int64_t> batch_row_splits(num_query_points + 1, 0);
-        utility::InclusivePrefixSum(batch_nums.data(),
-                                    batch_nums.data() + batch_nums.size(),
-                                    &batch_row_splits[1]);
-
-        // Make result Tensors.
-        int64_t total_nums = batch_row_splits[num_query_points];
+        nanoflann::SearchParams params;
+        ForEachQueryBatch(order, [&](int64_t batch_idx, int64_t i) {
+            std::vector<std::pair<int64_t, scalar_t>> &arena =
+                    arenas[batch_idx];
+            size_t begin = arena.size();
+            ArenaRadiusResultSet<scalar_t> result_set(
+                    radii_ptr[i] * radii_ptr[i], arena);
+            holder->index_->radiusSearchCustomCallback(
+                    query_ptr + i * dimension, result_set, params);
+            if (sort) {
+                std::sort(arena.begin() + begin, arena.end(),
+                          [](const std::pair<int64_t, scalar_t> &a,
+                             const std::pair<int64_t, scalar_t> &b) {
+                              return a.second < b.second;
+                          });
+            }
+            batch_nums[i] = static_cast<int64_t>(arena.size() - begin);
+        });
 
-        indices = Tensor(batch_indices2, {total_nums}, Dtype::Int64);
-        distances = Tensor(batch_distances2, {total_nums}, dtype);
         neighbors_row_splits =
-                Tensor(batch_row_splits, {num_query_points + 1}, Dtype::Int64);
+                Tensor::Empty({num_query_points + 1}, Dtype::Int64);
+        int64_t *row_splits_ptr = neighbors_row_splits.GetDataPtr<int64_t>();
+        row_splits_ptr[0] = 0;
+        utility::InclusivePrefixSum(batch_nums.data(),
+                                    batch_nums.data() + num_query_points,
+                                    row_splits_ptr + 1);
+
+        // Make result Tensors, copying each arena to the rows of its queries.
+        int64_t total_nums = row_splits_ptr[num_query_points];
+        indices = Tensor::Empty({total_nums}, Dtype::Int64);
+        distances = Tensor::Empty({total_nums}, dtype);
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+
+        std::vector<size_t> arena_offsets(num_batches, 0);
+        ForEachQueryBatch(order, [&](int64_t batch_idx, int64_t i) {
+            const std::pair<int64_t, scalar_t> *src =
+                    arenas[batch_idx].data() + arena_offsets[batch_idx];
+            for (int64_t k = 0; k < batch_nums[i]; ++k) {
+                indices_ptr[row_splits_ptr[i] + k] = src[k].first;
+                distances_ptr[row_splits_ptr[i] + k] = src[k].second;
+            }
+            arena_offsets[batch_idx] += batch_nums[i];
+        });
     });
     return std::make_tuple(indices, distances, neighbors_row_splits);
 };
@@ -251,10 +388,13 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
 
     double radius_squared = radius * radius;
     int64_t num_query_points = query_points.GetShape()[0];
+    int dimension = GetDimension();
     Tensor indices, distances;
     Dtype dtype = GetDtype();
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        Tensor queries = query_points.Contiguous();
+        const scalar_t *query_ptr = queries.GetDataPtr<scalar_t>();
         indices = Tensor::Empty({num_query_points, max_knn}, Dtype::Int64);
         auto indices_ptr = indices.GetDataPtr<int64_t>();
         distances = Tensor::Empty({num_query_points, max_knn}, dtype);
@@ -264,37 +404,22 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchHybrid(
                 holder_.get());
 
         nanoflann::SearchParams params;
-
-        // Parallel search.
-        tbb::parallel_for(
-                tbb::blocked_range<size_t>(0, num_query_points),
-                [&](const tbb::blocked_range<size_t> &r) {
-                    std::vector<std::pair<int64_t, scalar_t>> ret_matches;
-                    for (size_t workload_idx = r.begin();
-                         workload_idx != r.end(); ++workload_idx) {
-                        int64_t result_idx = workload_idx * max_knn;
-
-                        size_t num_results = holder->index_->radiusSearch(
-                                static_cast<scalar_t *>(
-                                        query_points[workload_idx]
-                                                .GetDataPtr()),
-                                radius_squared, ret_matches, params);
-                        ret_matches.resize(num_results);
-
-                        int neighbour_idx = 0;
-                        for (auto it = ret_matches.begin();
-                             it < ret_matches.end() && neighbour_idx < max_knn;
-                             it++, neighbour_idx++) {
-                            indices_ptr[result_idx + neighbour_idx] = it->first;
-                            distances_ptr[result_idx + neighbour_idx] =
-                                    it->second;
-                        }
-
-                        while (neighbour_idx < max_knn) {
-                            indices_ptr[result_idx + neighbour_idx] = -1;
-                            distances_ptr[result_idx + neighbour_idx] = 0;
-                            neighbour_idx += 1;
-                        }
+        ForEachQueryBatch(
+                SortQueriesSpatially<scalar_t>(queries),
+                [&](int64_t batch_idx, int64_t workload_idx) {
+                    int64_t result_idx = workload_idx * max_knn;
+                    HybridResultSet<scalar_t> result_set(
+                            static_cast<scalar_t>(radius_squared), max_knn,
+                            indices_ptr + result_idx,
+                            distances_ptr + result_idx);
+                    holder->index_->radiusSearchCustomCallback(
+                            query_ptr + workload_idx * dimension, result_set,
+                            params);
+
+                    for (int64_t neighbour_idx = result_set.size();
+                         neighbour_idx < max_knn; ++neighbour_idx) {
+                        indices_ptr[result_idx + neighbour_idx] = -1;
+                        distances_ptr[result_idx + neighbour_idx] = 0;
                     }
                 });
     });
@@ -40,6 +40,7 @@ bool NearestNeighborSearch::SetIndex() {
 };
 
 bool NearestNeighborSearch::KnnIndex() {
+    kdforest_index_.reset();
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
 #ifdef WITH_FAISS
         faiss_index_.reset(new FaissIndex());
@@ -54,6 +55,11 @@ bool NearestNeighborSearch::KnnIndex() {
     }
 };
 
+bool NearestNeighborSearch::ApproxKnnIndex(int num_trees, int max_checks) {
+    kdforest_index_.reset(new KDForestIndex(num_trees, max_checks));
+    return kdforest_index_->SetTensorData(dataset_points_);
+};
+
 bool NearestNeighborSearch::MultiRadiusIndex() { return SetIndex(); };
 
 bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
@@ -73,7 +79,14 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
                 "Please recompile Open3D with BUILD_CUDA_MODULE=ON.");
 #endif
 
+    } else if (radius.has_value()) {
+        fixed_radius_index_.reset(new nns::FixedRadiusIndex());
+        return fixed_radius_index_->SetTensorData(dataset_points_,
+                                                  radius.value());
     } else {
+        // Without a radius the spatial hash grid cannot be built, fall back
+        // to the KDTree.
+        fixed_radius_index_.reset();
         return SetIndex();
     }
 }
@@ -102,6 +115,9 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    if (kdforest_index_) {
+        return kdforest_index_->SearchKnn(query_points, knn);
+    }
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchKnn(query_points, knn);
@@ -127,7 +143,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
                     "set.");
         }
     } else {
-        if (nanoflann_index_) {
+        if (fixed_radius_index_) {
+            return fixed_radius_index_->SearchRadius(query_points, radius,
+                                                     sort);
+        } else if (nanoflann_index_) {
             return nanoflann_index_->SearchRadius(query_points, radius);
         } else {
             utility::LogError(
@@ -31,6 +31,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FaissIndex.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/KDForestIndex.h"
 #include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Optional.h"
 
@@ -60,6 +61,15 @@ public:
     /// \return Returns true if building index success, otherwise false.
     bool KnnIndex();
 
+    /// Set index for approximate knn search, used by KnnSearch until KnnIndex
+    /// is called. Only CPU tensors are supported.
+    ///
+    /// \param num_trees Number of randomized k-d trees.
+    /// \param max_checks Maximum number of points compared per query. Higher
+    /// values give a higher recall at the cost of query time.
+    /// \return Returns true if building index success, otherwise false.
+    bool ApproxKnnIndex(int num_trees = 4, int max_checks = 128);
+
     /// Set index for multi-radius search.
     ///
     /// \return Returns true if building index success, otherwise false.
@@ -68,7 +78,9 @@ public:
     /// Set index for fixed-radius search.
     ///
     /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// index. On CPU a spatial hash grid is built if the radius is given,
+    /// otherwise a KDTree is used.
+    /// \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
@@ -138,6 +150,7 @@ protected:
     std::unique_ptr<NanoFlannIndex> nanoflann_index_;
     std::unique_ptr<FaissIndex> faiss_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
+    std::unique_ptr<KDForestIndex> kdforest_index_;
     const Tensor dataset_points_;
 };
 }  // namespace nns
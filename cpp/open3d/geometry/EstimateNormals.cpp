@@ -24,13 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Eigenvalues>
-#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <tuple>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/NeighborhoodCache.h"
 #include "open3d/geometry/PointCloud.h"
-#include "open3d/geometry/TetraMesh.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
 
@@ -135,82 +140,138 @@ Eigen::Vector3d ComputeEigenvector1(const Eigen::Matrix3d &A,
     }
 }
 
-Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
-    // Previous version based on:
-    // https://en.wikipedia.org/wiki/Eigenvalue_algorithm#3.C3.973_matrices
-    // Current version based on
-    // https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
-    // which handles edge cases like points on a plane
-
-    double max_coeff = A.maxCoeff();
-    if (max_coeff == 0) {
-        return Eigen::Vector3d::Zero();
+// Number of points whose covariances are accumulated and solved together.
+constexpr int64_t kNormalBatchSize = 64;
+
+// Symmetric 3x3 matrices of a batch of points, one array per coefficient, and
+// the closed-form eigenvalues computed by ComputeEigenvalues.
+struct CovarianceBatch {
+    double a00[kNormalBatchSize];
+    double a01[kNormalBatchSize];
+    double a02[kNormalBatchSize];
+    double a11[kNormalBatchSize];
+    double a12[kNormalBatchSize];
+    double a22[kNormalBatchSize];
+    double max_coeff[kNormalBatchSize];
+    double norm[kNormalBatchSize];
+    double half_det[kNormalBatchSize];
+    double eval0[kNormalBatchSize];
+    double eval1[kNormalBatchSize];
+    double eval2[kNormalBatchSize];
+
+    void Set(int64_t b, const Eigen::Matrix3d &A) {
+        a00[b] = A(0, 0);
+        a01[b] = A(0, 1);
+        a02[b] = A(0, 2);
+        a11[b] = A(1, 1);
+        a12[b] = A(1, 2);
+        a22[b] = A(2, 2);
     }
-    A /= max_coeff;
-
-    double norm = A(0, 1) * A(0, 1) + A(0, 2) * A(0, 2) + A(1, 2) * A(1, 2);
-    if (norm > 0) {
-        Eigen::Vector3d eval;
-        Eigen::Vector3d evec0;
-        Eigen::Vector3d evec1;
-        Eigen::Vector3d evec2;
 
-        double q = (A(0, 0) + A(1, 1) + A(2, 2)) / 3;
+    Eigen::Matrix3d Get(int64_t b) const {
+        Eigen::Matrix3d A;
+        A << a00[b], a01[b], a02[b], a01[b], a11[b], a12[b], a02[b], a12[b],
+                a22[b];
+        return A;
+    }
+};
 
-        double b00 = A(0, 0) - q;
-        double b11 = A(1, 1) - q;
-        double b22 = A(2, 2) - q;
+// Computes the eigenvalues of the first n matrices of the batch.
+// Previous version based on:
+// https://en.wikipedia.org/wiki/Eigenvalue_algorithm#3.C3.973_matrices
+// Current version based on
+// https://www.geometrictools.com/Documentation/RobustEigenSymmetric3x3.pdf
+// which handles edge cases like points on a plane.
+// The matrices are scaled in place by their largest coefficient. The loop has
+// no data-dependent branches, so that it is vectorized across the batch;
+// degenerate matrices are resolved afterwards by ComputeEigenvector.
+void ComputeEigenvalues(CovarianceBatch &batch, int64_t n) {
+#pragma omp simd
+    for (int64_t b = 0; b < n; ++b) {
+        double max_coeff = std::max(std::max(batch.a00[b], batch.a11[b]),
+                                    batch.a22[b]);
+        max_coeff = std::max(std::max(max_coeff, batch.a01[b]),
+                             std::max(batch.a02[b], batch.a12[b]));
+        batch.max_coeff[b] = max_coeff;
+        const double scale = max_coeff > 0 ? max_coeff : 1.0;
+        const double a00 = batch.a00[b] / scale;
+        const double a01 = batch.a01[b] / scale;
+        const double a02 = batch.a02[b] / scale;
+        const double a11 = batch.a11[b] / scale;
+        const double a12 = batch.a12[b] / scale;
+        const double a22 = batch.a22[b] / scale;
+        batch.a00[b] = a00;
+        batch.a01[b] = a01;
+        batch.a02[b] = a02;
+        batch.a11[b] = a11;
+        batch.a12[b] = a12;
+        batch.a22[b] = a22;
+
+        const double norm = a01 * a01 + a02 * a02 + a12 * a12;
+        batch.norm[b] = norm;
+
+        const double q = (a00 + a11 + a22) / 3;
+        const double b00 = a00 - q;
+        const double b11 = a11 - q;
+        const double b22 = a22 - q;
 
         double p =
                 std::sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+        p = p > 0 ? p : 1.0;
 
-        double c00 = b11 * b22 - A(1, 2) * A(1, 2);
-        double c01 = A(0, 1) * b22 - A(1, 2) * A(0, 2);
-        double c02 = A(0, 1) * A(1, 2) - b11 * A(0, 2);
-        double det = (b00 * c00 - A(0, 1) * c01 + A(0, 2) * c02) / (p * p * p);
+        const double c00 = b11 * b22 - a12 * a12;
+        const double c01 = a01 * b22 - a12 * a02;
+        const double c02 = a01 * a12 - b11 * a02;
+        const double det = (b00 * c00 - a01 * c01 + a02 * c02) / (p * p * p);
 
         double half_det = det * 0.5;
         half_det = std::min(std::max(half_det, -1.0), 1.0);
+        batch.half_det[b] = half_det;
 
-        double angle = std::acos(half_det) / (double)3;
-        double const two_thirds_pi = 2.09439510239319549;
-        double beta2 = std::cos(angle) * 2;
-        double beta0 = std::cos(angle + two_thirds_pi) * 2;
-        double beta1 = -(beta0 + beta2);
+        const double angle = std::acos(half_det) / (double)3;
+        const double two_thirds_pi = 2.09439510239319549;
+        const double beta2 = std::cos(angle) * 2;
+        const double beta0 = std::cos(angle + two_thirds_pi) * 2;
+        const double beta1 = -(beta0 + beta2);
 
-        eval(0) = q + p * beta0;
-        eval(1) = q + p * beta1;
-        eval(2) = q + p * beta2;
+        batch.eval0[b] = q + p * beta0;
+        batch.eval1[b] = q + p * beta1;
+        batch.eval2[b] = q + p * beta2;
+    }
+}
 
-        if (half_det >= 0) {
-            evec2 = ComputeEigenvector0(A, eval(2));
+// Returns the eigenvector of the smallest eigenvalue of matrix b of a batch
+// processed by ComputeEigenvalues.
+Eigen::Vector3d ComputeEigenvector(const CovarianceBatch &batch, int64_t b) {
+    if (batch.max_coeff[b] == 0) {
+        return Eigen::Vector3d::Zero();
+    }
+    const Eigen::Matrix3d A = batch.Get(b);
+    if (batch.norm[b] > 0) {
+        const Eigen::Vector3d eval(batch.eval0[b], batch.eval1[b],
+                                   batch.eval2[b]);
+        if (batch.half_det[b] >= 0) {
+            Eigen::Vector3d evec2 = ComputeEigenvector0(A, eval(2));
             if (eval(2) < eval(0) && eval(2) < eval(1)) {
-                A *= max_coeff;
                 return evec2;
             }
-            evec1 = ComputeEigenvector1(A, evec2, eval(1));
-            A *= max_coeff;
+            Eigen::Vector3d evec1 = ComputeEigenvector1(A, evec2, eval(1));
             if (eval(1) < eval(0) && eval(1) < eval(2)) {
                 return evec1;
             }
-            evec0 = evec1.cross(evec2);
-            return evec0;
+            return evec1.cross(evec2);
         } else {
-            evec0 = ComputeEigenvector0(A, eval(0));
+            Eigen::Vector3d evec0 = ComputeEigenvector0(A, eval(0));
             if (eval(0) < eval(1) && eval(0) < eval(2)) {
-                A *= max_coeff;
                 return evec0;
             }
-            evec1 = ComputeEigenvector1(A, evec0, eval(1));
-            A *= max_coeff;
+            Eigen::Vector3d evec1 = ComputeEigenvector1(A, evec0, eval(1));
             if (eval(1) < eval(0) && eval(1) < eval(2)) {
                 return evec1;
             }
-            evec2 = evec0.cross(evec1);
-            return evec2;
+            return evec0.cross(evec1);
         }
     } else {
-        A *= max_coeff;
         if (A(0, 0) < A(1, 1) && A(0, 0) < A(2, 2)) {
             return Eigen::Vector3d(1, 0, 0);
         } else if (A(1, 1) < A(0, 0) && A(1, 1) < A(2, 2)) {
@@ -221,89 +282,316 @@ Eigen::Vector3d FastEigen3x3(Eigen::Matrix3d &A) {
     }
 }
 
-Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
-                              const std::vector<int> &indices,
-                              bool fast_normal_computation) {
-    if (indices.size() == 0) {
-        return Eigen::Vector3d::Zero();
+// Returns the covariance of the points with the given indices. The
+// coordinates are gathered into one array per axis, relative to the first
+// point to limit cancellation, so that the sums are vectorized.
+Eigen::Matrix3d ComputeCovariance(const std::vector<Eigen::Vector3d> &points,
+                                  const std::vector<int> &indices,
+                                  std::vector<double> &xs,
+                                  std::vector<double> &ys,
+                                  std::vector<double> &zs) {
+    const int64_t n = int64_t(indices.size());
+    xs.resize(n);
+    ys.resize(n);
+    zs.resize(n);
+    const Eigen::Vector3d origin = points[indices[0]];
+    for (int64_t j = 0; j < n; ++j) {
+        const Eigen::Vector3d &point = points[indices[j]];
+        xs[j] = point(0) - origin(0);
+        ys[j] = point(1) - origin(1);
+        zs[j] = point(2) - origin(2);
     }
-    Eigen::Matrix3d covariance =
-            utility::ComputeCovariance(cloud.points_, indices);
-
-    if (fast_normal_computation) {
-        return FastEigen3x3(covariance);
-    } else {
-        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
-        solver.compute(covariance, Eigen::ComputeEigenvectors);
-        return solver.eigenvectors().col(0);
+    const double *x = xs.data();
+    const double *y = ys.data();
+    const double *z = zs.data();
+    double sx = 0, sy = 0, sz = 0;
+    double sxx = 0, sxy = 0, sxz = 0, syy = 0, syz = 0, szz = 0;
+#pragma omp simd reduction(+ : sx, sy, sz, sxx, sxy, sxz, syy, syz, szz)
+    for (int64_t j = 0; j < n; ++j) {
+        sx += x[j];
+        sy += y[j];
+        sz += z[j];
+        sxx += x[j] * x[j];
+        sxy += x[j] * y[j];
+        sxz += x[j] * z[j];
+        syy += y[j] * y[j];
+        syz += y[j] * z[j];
+        szz += z[j] * z[j];
     }
+    const double inv_n = 1.0 / double(n);
+    sx *= inv_n;
+    sy *= inv_n;
+    sz *= inv_n;
+    Eigen::Matrix3d covariance;
+    covariance(0, 0) = sxx * inv_n - sx * sx;
+    covariance(1, 1) = syy * inv_n - sy * sy;
+    covariance(2, 2) = szz * inv_n - sz * sz;
+    covariance(0, 1) = sxy * inv_n - sx * sy;
+    covariance(1, 0) = covariance(0, 1);
+    covariance(0, 2) = sxz * inv_n - sx * sz;
+    covariance(2, 0) = covariance(0, 2);
+    covariance(1, 2) = syz * inv_n - sy * sz;
+    covariance(2, 1) = covariance(1, 2);
+    return covariance;
 }
 
-// Disjoint set data structure to find cycles in graphs
-class DisjointSet {
-public:
-    DisjointSet(size_t size) : parent_(size), size_(size) {
-        for (size_t idx = 0; idx < size; idx++) {
-            parent_[idx] = idx;
-            size_[idx] = 0;
-        }
+// Estimates the normals of the cloud batch by batch. search(i, indices)
+// fills the neighbor indices of point i.
+template <typename search_t>
+void EstimateNormalsInBatches(PointCloud &cloud,
+                              const search_t &search,
+                              bool fast_normal_computation) {
+    bool has_normal = cloud.HasNormals();
+    if (!has_normal) {
+        cloud.normals_.resize(cloud.points_.size());
     }
-
-    // find representative element for given x
-    // using path compression
-    size_t Find(size_t x) {
-        if (x != parent_[x]) {
-            parent_[x] = Find(parent_[x]);
+    const int64_t num_points = int64_t(cloud.points_.size());
+    const int64_t num_batches =
+            (num_points + kNormalBatchSize - 1) / kNormalBatchSize;
+    core::ParallelFor(num_batches, [&](int64_t batch_idx) {
+        const int64_t begin = batch_idx * kNormalBatchSize;
+        const int64_t n = std::min(kNormalBatchSize, num_points - begin);
+        std::vector<int> indices;
+        std::vector<double> xs, ys, zs;
+        CovarianceBatch batch;
+        bool valid[kNormalBatchSize];
+        for (int64_t b = 0; b < n; ++b) {
+            search(begin + b, indices);
+            valid[b] = indices.size() >= 3;
+            batch.Set(b, valid[b] ? ComputeCovariance(cloud.points_, indices,
+                                                      xs, ys, zs)
+                                  : Eigen::Matrix3d::Identity());
         }
-        return parent_[x];
-    }
-
-    // combine two sets using size of sets
-    void Union(size_t x, size_t y) {
-        x = Find(x);
-        y = Find(y);
-        if (x != y) {
-            if (size_[x] < size_[y]) {
-                size_[y] += size_[x];
-                parent_[x] = y;
+        if (fast_normal_computation) {
+            ComputeEigenvalues(batch, n);
+        }
+        for (int64_t b = 0; b < n; ++b) {
+            const int64_t i = begin + b;
+            if (!valid[b]) {
+                cloud.normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
+                continue;
+            }
+            Eigen::Vector3d normal;
+            if (fast_normal_computation) {
+                normal = ComputeEigenvector(batch, b);
             } else {
-                size_[x] += size_[y];
-                parent_[y] = x;
+                Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+                solver.compute(batch.Get(b), Eigen::ComputeEigenvectors);
+                normal = solver.eigenvectors().col(0);
             }
+            if (normal.norm() == 0.0) {
+                if (has_normal) {
+                    normal = cloud.normals_[i];
+                } else {
+                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                }
+            }
+            if (has_normal && normal.dot(cloud.normals_[i]) < 0.0) {
+                normal *= -1.0;
+            }
+            cloud.normals_[i] = normal;
         }
-    }
+    });
+}
 
-private:
-    std::vector<size_t> parent_;
-    std::vector<size_t> size_;
-};
+// Undirected weighted graph. The arcs of vertex v, one per incident edge, are
+// arc_vertices_[offsets_[v]] to arc_vertices_[offsets_[v + 1] - 1], sorted by
+// the opposite vertex, and arc_edges_ holds the matching edge indices.
+struct CSRGraph {
+    CSRGraph(int64_t num_vertices, const std::vector<Eigen::Vector2i> &edges);
 
-struct WeightedEdge {
-    WeightedEdge(size_t v0, size_t v1, double weight)
-        : v0_(v0), v1_(v1), weight_(weight) {}
-    size_t v0_;
-    size_t v1_;
-    double weight_;
+    std::vector<Eigen::Vector2i> edges_;
+    std::vector<int64_t> offsets_;
+    std::vector<int> arc_vertices_;
+    std::vector<int64_t> arc_edges_;
 };
 
-// Minimum Spanning Tree algorithm (Kruskal's algorithm)
-std::vector<WeightedEdge> Kruskal(std::vector<WeightedEdge> &edges,
-                                  size_t n_vertices) {
-    std::sort(edges.begin(), edges.end(),
-              [](WeightedEdge &e0, WeightedEdge &e1) {
-                  return e0.weight_ < e1.weight_;
-              });
-    DisjointSet disjoint_set(n_vertices);
-    std::vector<WeightedEdge> mst;
-    for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
-        size_t set0 = disjoint_set.Find(edges[eidx].v0_);
-        size_t set1 = disjoint_set.Find(edges[eidx].v1_);
-        if (set0 != set1) {
-            mst.push_back(edges[eidx]);
-            disjoint_set.Union(set0, set1);
+CSRGraph::CSRGraph(int64_t num_vertices,
+                   const std::vector<Eigen::Vector2i> &edges)
+    : edges_(edges) {
+    const int64_t num_edges = int64_t(edges.size());
+    // Each edge (v0, v1) gives the arcs (v0, v1) and (v1, v0), sorted by
+    // source and then target vertex.
+    std::vector<std::tuple<int, int, int64_t>> arcs(2 * num_edges);
+    core::ParallelFor(num_edges, [&](int64_t e) {
+        arcs[2 * e] = std::make_tuple(edges[e](0), edges[e](1), e);
+        arcs[2 * e + 1] = std::make_tuple(edges[e](1), edges[e](0), e);
+    });
+    tbb::parallel_sort(arcs.begin(), arcs.end());
+
+    auto SourceLess = [](const std::tuple<int, int, int64_t> &arc, int v) {
+        return std::get<0>(arc) < v;
+    };
+    offsets_.resize(num_vertices + 1);
+    core::ParallelFor(num_vertices + 1, [&](int64_t v) {
+        offsets_[v] = std::lower_bound(arcs.begin(), arcs.end(), int(v),
+                                       SourceLess) -
+                      arcs.begin();
+    });
+    arc_vertices_.resize(arcs.size());
+    arc_edges_.resize(arcs.size());
+    core::ParallelFor(int64_t(arcs.size()), [&](int64_t a) {
+        arc_vertices_[a] = std::get<1>(arcs[a]);
+        arc_edges_[a] = std::get<2>(arcs[a]);
+    });
+}
+
+// Returns the edges of the k nearest neighbor graph of the points, each
+// undirected edge once.
+std::vector<Eigen::Vector2i> ComputeKNNGraphEdges(const PointCloud &cloud,
+                                                  size_t k) {
+    const int64_t num_points = int64_t(cloud.points_.size());
+    KDTreeFlann kdtree(cloud);
+    std::vector<std::vector<int>> neighbors(num_points);
+    core::ParallelFor(num_points, [&](int64_t v0) {
+        std::vector<double> dists2;
+        kdtree.SearchKNN(cloud.points_[v0], int(k), neighbors[v0], dists2);
+    });
+
+    // Edges as (min, max) vertex pairs packed into 64 bits, deduplicated.
+    std::vector<int64_t> offsets(num_points + 1, 0);
+    for (int64_t v0 = 0; v0 < num_points; ++v0) {
+        offsets[v0 + 1] = offsets[v0] + int64_t(neighbors[v0].size());
+    }
+    std::vector<uint64_t> keys(offsets.back());
+    core::ParallelFor(num_points, [&](int64_t v0) {
+        uint64_t *key = keys.data() + offsets[v0];
+        for (int v1 : neighbors[v0]) {
+            const uint64_t lo = uint64_t(std::min(int(v0), v1));
+            const uint64_t hi = uint64_t(std::max(int(v0), v1));
+            *key++ = (lo << 32) | hi;
+        }
+        std::vector<int>().swap(neighbors[v0]);
+    });
+    tbb::parallel_sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    // Drop the self loops from each point to itself.
+    keys.erase(std::remove_if(keys.begin(), keys.end(),
+                              [](uint64_t key) {
+                                  return (key >> 32) == (key & 0xffffffff);
+                              }),
+               keys.end());
+
+    std::vector<Eigen::Vector2i> edges(keys.size());
+    core::ParallelFor(int64_t(keys.size()), [&](int64_t e) {
+        edges[e] = Eigen::Vector2i(int(keys[e] >> 32),
+                                   int(keys[e] & 0xffffffff));
+    });
+    return edges;
+}
+
+// Returns the edges of the minimum spanning forest of the graph with Boruvka's
+// algorithm, and in components the representative vertex of the tree of each
+// vertex. Edges are ordered by weight and then by index, so that the forest is
+// unique and every round is deterministic. In each round, every component
+// selects its lightest outgoing edge in parallel, and the selected edges link
+// the components, which are then merged by pointer jumping.
+std::vector<int64_t> ComputeMinimumSpanningForest(
+        const CSRGraph &graph,
+        const std::vector<double> &weights,
+        std::vector<int> &components) {
+    const int64_t num_vertices = int64_t(graph.offsets_.size()) - 1;
+    auto lighter = [&](int64_t e0, int64_t e1) {
+        return weights[e0] < weights[e1] ||
+               (weights[e0] == weights[e1] && e0 < e1);
+    };
+
+    components.resize(num_vertices);
+    std::iota(components.begin(), components.end(), 0);
+    std::vector<int> roots(num_vertices);
+    std::iota(roots.begin(), roots.end(), 0);
+    std::vector<std::atomic<int64_t>> lightest(num_vertices);
+    std::vector<int> link(num_vertices);
+    std::vector<int> next_link(num_vertices);
+    std::vector<char> in_forest(graph.edges_.size(), 0);
+
+    while (!roots.empty()) {
+        for (int root : roots) {
+            lightest[root].store(-1, std::memory_order_relaxed);
+        }
+        core::ParallelFor(num_vertices, [&](int64_t v) {
+            const int component = components[v];
+            int64_t best = -1;
+            for (int64_t a = graph.offsets_[v]; a < graph.offsets_[v + 1];
+                 ++a) {
+                if (components[graph.arc_vertices_[a]] != component &&
+                    (best < 0 || lighter(graph.arc_edges_[a], best))) {
+                    best = graph.arc_edges_[a];
+                }
+            }
+            if (best < 0) {
+                return;
+            }
+            std::atomic<int64_t> &current = lightest[component];
+            int64_t expected = current.load(std::memory_order_relaxed);
+            while ((expected < 0 || lighter(best, expected)) &&
+                   !current.compare_exchange_weak(expected, best)) {
+            }
+        });
+
+        // Link every component to the component across its lightest edge.
+        // Two components that selected the same edge would link to each
+        // other; the smaller one becomes the root of the merged component.
+        const int64_t num_roots = int64_t(roots.size());
+        core::ParallelFor(num_roots, [&](int64_t r) {
+            const int root = roots[r];
+            const int64_t e = lightest[root].load(std::memory_order_relaxed);
+            if (e < 0) {
+                link[root] = root;
+                return;
+            }
+            const int c0 = components[graph.edges_[e](0)];
+            const int c1 = components[graph.edges_[e](1)];
+            link[root] = c0 == root ? c1 : c0;
+        });
+        core::ParallelFor(num_roots, [&](int64_t r) {
+            const int root = roots[r];
+            const int other = link[root];
+            if (other != root && link[other] == root && root < other) {
+                next_link[root] = root;
+            } else {
+                next_link[root] = other;
+                if (other != root) {
+                    in_forest[lightest[root].load(std::memory_order_relaxed)] =
+                            1;
+                }
+            }
+        });
+        std::atomic<bool> changed(true);
+        while (changed) {
+            changed = false;
+            core::ParallelFor(num_roots, [&](int64_t r) {
+                link[roots[r]] = next_link[next_link[roots[r]]];
+            });
+            core::ParallelFor(num_roots, [&](int64_t r) {
+                if (link[roots[r]] != next_link[roots[r]]) {
+                    next_link[roots[r]] = link[roots[r]];
+                    changed = true;
+                }
+            });
+        }
+        core::ParallelFor(num_vertices, [&](int64_t v) {
+            components[v] = next_link[components[v]];
+        });
+
+        // Components without outgoing edges are complete trees.
+        std::vector<int> next_roots;
+        for (int root : roots) {
+            if (next_link[root] == root &&
+                lightest[root].load(std::memory_order_relaxed) >= 0) {
+                next_roots.push_back(root);
+            }
+        }
+        roots.swap(next_roots);
+    }
+
+    std::vector<int64_t> forest;
+    for (int64_t e = 0; e < int64_t(in_forest.size()); ++e) {
+        if (in_forest[e]) {
+            forest.push_back(e);
         }
     }
-    return mst;
+    return forest;
 }
 
 }  // unnamed namespace
@@ -313,34 +601,33 @@ namespace geometry {
 void PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
         bool fast_normal_computation /* = true */) {
-    bool has_normal = HasNormals();
-    if (!has_normal) {
-        normals_.resize(points_.size());
-    }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
-            if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
-                } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-                }
-            }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
-            }
-            normals_[i] = normal;
-        } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-        }
+    EstimateNormalsInBatches(
+            *this,
+            [&](int64_t i, std::vector<int> &indices) {
+                std::vector<double> distance2;
+                kdtree.Search(points_[i], search_param, indices, distance2);
+            },
+            fast_normal_computation);
+}
+
+void PointCloud::EstimateNormals(const NeighborhoodCache &neighborhoods,
+                                 bool fast_normal_computation /* = true */) {
+    if (neighborhoods.GetNumPoints() != int64_t(points_.size())) {
+        utility::LogError(
+                "[EstimateNormals] The neighborhood cache has {:d} points, "
+                "but the point cloud has {:d} points.",
+                neighborhoods.GetNumPoints(), points_.size());
     }
+    EstimateNormalsInBatches(
+            *this,
+            [&](int64_t i, std::vector<int> &indices) {
+                const int *neighbors = neighborhoods.GetNeighbors(i);
+                indices.assign(neighbors,
+                               neighbors + neighborhoods.GetNumNeighbors(i));
+            },
+            fast_normal_computation);
 }
 
 void PointCloud::OrientNormalsToAlignWithDirection(
@@ -351,15 +638,14 @@ void PointCloud::OrientNormalsToAlignWithDirection(
                 "[OrientNormalsToAlignWithDirection] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    core::ParallelFor((int)points_.size(), [&](int i) {
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
             normal = orientation_reference;
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsTowardsCameraLocation(
@@ -369,8 +655,7 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
                 "[OrientNormalsTowardsCameraLocation] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    core::ParallelFor((int)points_.size(), [&](int i) {
         Eigen::Vector3d orientation_reference = camera_location - points_[i];
         auto &normal = normals_[i];
         if (normal.norm() == 0.0) {
@@ -383,7 +668,7 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
         } else if (normal.dot(orientation_reference) < 0.0) {
             normal *= -1.0;
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
@@ -393,109 +678,82 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
                 "PointCloud. Call EstimateNormals() first.");
     }
 
-    // Create Riemannian graph (Euclidian MST + kNN)
-    // Euclidian MST is subgraph of Delaunay triangulation
-    std::shared_ptr<TetraMesh> delaunay_mesh;
-    std::vector<size_t> pt_map;
-    std::tie(delaunay_mesh, pt_map) = TetraMesh::CreateFromPointCloud(*this);
-    std::vector<WeightedEdge> delaunay_graph;
-    std::unordered_set<size_t> graph_edges;
-    auto EdgeIndex = [&](size_t v0, size_t v1) -> size_t {
-        return std::min(v0, v1) * points_.size() + std::max(v0, v1);
-    };
-    auto AddEdgeToDelaunayGraph = [&](size_t v0, size_t v1) {
-        v0 = pt_map[v0];
-        v1 = pt_map[v1];
-        size_t edge = EdgeIndex(v0, v1);
-        if (graph_edges.count(edge) == 0) {
-            double dist = (points_[v0] - points_[v1]).squaredNorm();
-            delaunay_graph.push_back(WeightedEdge(v0, v1, dist));
-            graph_edges.insert(edge);
-        }
-    };
-    for (const Eigen::Vector4i &tetra : delaunay_mesh->tetras_) {
-        AddEdgeToDelaunayGraph(tetra[0], tetra[1]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[2], tetra[3]);
+    const int64_t num_points = int64_t(points_.size());
+    if (num_points == 0) {
+        return;
     }
 
-    std::vector<WeightedEdge> mst = Kruskal(delaunay_graph, points_.size());
-
-    auto NormalWeight = [&](size_t v0, size_t v1) -> double {
-        return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
-    };
-    for (auto &edge : mst) {
-        edge.weight_ = NormalWeight(edge.v0_, edge.v1_);
+    // Riemannian graph: the kNN graph, weighted so that edges between points
+    // with parallel normals are cheap.
+    const CSRGraph graph(num_points, ComputeKNNGraphEdges(*this, k));
+    std::vector<double> weights(graph.edges_.size());
+    core::ParallelFor(int64_t(weights.size()), [&](int64_t e) {
+        const Eigen::Vector2i &edge = graph.edges_[e];
+        weights[e] = 1.0 - std::abs(normals_[edge(0)].dot(normals_[edge(1)]));
+    });
+
+    std::vector<int> components;
+    const std::vector<int64_t> forest_edges =
+            ComputeMinimumSpanningForest(graph, weights, components);
+    std::vector<Eigen::Vector2i> forest_vertices(forest_edges.size());
+    for (size_t e = 0; e < forest_edges.size(); ++e) {
+        forest_vertices[e] = graph.edges_[forest_edges[e]];
     }
-
-    // Add k nearest neighbors to Riemannian graph
-    KDTreeFlann kdtree(*this);
-    for (size_t v0 = 0; v0 < points_.size(); ++v0) {
-        std::vector<int> neighbors;
-        std::vector<double> dists2;
-        kdtree.SearchKNN(points_[v0], int(k), neighbors, dists2);
-        for (size_t vidx1 = 0; vidx1 < neighbors.size(); ++vidx1) {
-            size_t v1 = size_t(neighbors[vidx1]);
-            if (v0 == v1) {
-                continue;
-            }
-            size_t edge = EdgeIndex(v0, v1);
-            if (graph_edges.count(edge) == 0) {
-                double weight = NormalWeight(v0, v1);
-                mst.push_back(WeightedEdge(v0, v1, weight));
-                graph_edges.insert(edge);
-            }
+    const CSRGraph forest(num_points, forest_vertices);
+
+    // Every tree is traversed from its point with maximal z, whose normal is
+    // oriented towards +z.
+    std::vector<int> seeds(num_points, -1);
+    for (int v = 0; v < int(num_points); ++v) {
+        int &seed = seeds[components[v]];
+        if (seed < 0 || points_[v](2) > points_[seed](2)) {
+            seed = v;
         }
     }
-
-    // extract MST from Riemannian graph
-    mst = Kruskal(mst, points_.size());
-
-    // convert list of edges to graph
-    std::vector<std::unordered_set<size_t>> mst_graph(points_.size());
-    for (const auto &edge : mst) {
-        size_t v0 = edge.v0_;
-        size_t v1 = edge.v1_;
-        mst_graph[v0].insert(v1);
-        mst_graph[v1].insert(v0);
-    }
-
-    // find start node for tree traversal
-    // init with node that maximizes z
-    double max_z = std::numeric_limits<double>::lowest();
-    size_t v0 = 0;
-    for (size_t vidx = 0; vidx < points_.size(); ++vidx) {
-        const Eigen::Vector3d &v = points_[vidx];
-        if (v(2) > max_z) {
-            max_z = v(2);
-            v0 = vidx;
+    seeds.erase(std::remove(seeds.begin(), seeds.end(), -1), seeds.end());
+    for (int seed : seeds) {
+        if (normals_[seed](2) < 0) {
+            normals_[seed] *= -1;
         }
     }
 
-    // traverse MST and orient normals consistently
-    std::queue<size_t> traversal_queue;
-    std::vector<bool> visited(points_.size(), false);
-    traversal_queue.push(v0);
-    auto TestAndOrientNormal = [&](const Eigen::Vector3d &n0,
-                                   Eigen::Vector3d &n1) {
-        if (n0.dot(n1) < 0) {
-            n1 *= -1;
-        }
-    };
-    TestAndOrientNormal(Eigen::Vector3d(0, 0, 1), normals_[v0]);
-    while (!traversal_queue.empty()) {
-        v0 = traversal_queue.front();
-        traversal_queue.pop();
-        visited[v0] = true;
-        for (size_t v1 : mst_graph[v0]) {
-            if (!visited[v1]) {
-                traversal_queue.push(v1);
-                TestAndOrientNormal(normals_[v0], normals_[v1]);
-            }
+    // Breadth first traversal of all trees at once, level by level. Each
+    // frontier vertex stores its parent, so in a tree its children are all
+    // other neighbors and no visited flags are needed.
+    std::vector<Eigen::Vector2i> frontier(seeds.size());
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        frontier[i] = Eigen::Vector2i(seeds[i], -1);
+    }
+    std::vector<int64_t> offsets;
+    std::vector<Eigen::Vector2i> next_frontier;
+    while (!frontier.empty()) {
+        offsets.resize(frontier.size() + 1);
+        offsets[0] = 0;
+        for (size_t i = 0; i < frontier.size(); ++i) {
+            const int v = frontier[i](0);
+            offsets[i + 1] = offsets[i] + forest.offsets_[v + 1] -
+                             forest.offsets_[v] - (frontier[i](1) >= 0);
         }
+        next_frontier.resize(offsets.back());
+        core::ParallelFor(
+                int64_t(frontier.size()),
+                [&](int64_t i) {
+                    const int v0 = frontier[i](0);
+                    int64_t child = offsets[i];
+                    for (int64_t a = forest.offsets_[v0];
+                         a < forest.offsets_[v0 + 1]; ++a) {
+                        const int v1 = forest.arc_vertices_[a];
+                        if (v1 == frontier[i](1)) {
+                            continue;
+                        }
+                        if (normals_[v0].dot(normals_[v1]) < 0) {
+                            normals_[v1] *= -1;
+                        }
+                        next_frontier[child++] = Eigen::Vector2i(v1, v0);
+                    }
+                },
+                1024);
+        frontier.swap(next_frontier);
     }
 }
 
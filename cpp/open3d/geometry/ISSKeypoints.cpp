@@ -35,6 +35,7 @@
 #include <tuple>
 #include <vector>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/Keypoint.h"
 #include "open3d/geometry/PointCloud.h"
@@ -100,19 +101,18 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
     }
 
     std::vector<double> third_eigen_values(points.size());
-#pragma omp parallel for schedule(static) shared(third_eigen_values)
-    for (int i = 0; i < (int)points.size(); i++) {
+    core::ParallelFor((int)points.size(), [&](int i) {
         std::vector<int> indices;
         std::vector<double> dist;
         int nb_neighbors =
                 kdtree.SearchRadius(points[i], salient_radius, indices, dist);
         if (nb_neighbors < min_neighbors) {
-            continue;
+            return;
         }
 
         Eigen::Matrix3d cov = utility::ComputeCovariance(points, indices);
         if (cov.isZero()) {
-            continue;
+            return;
         }
 
         Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cov);
@@ -123,12 +123,10 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
         if ((e2c / e1c) < gamma_21 && e3c / e2c < gamma_32) {
             third_eigen_values[i] = e3c;
         }
-    }
+    });
 
-    std::vector<size_t> kp_indices;
-    kp_indices.reserve(points.size());
-#pragma omp parallel for schedule(static) shared(kp_indices)
-    for (int i = 0; i < (int)points.size(); i++) {
+    std::vector<uint8_t> is_keypoint(points.size(), 0);
+    core::ParallelFor((int)points.size(), [&](int i) {
         if (third_eigen_values[i] > 0.0) {
             std::vector<int> nn_indices;
             std::vector<double> dist;
@@ -137,9 +135,15 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
 
             if (nb_neighbors >= min_neighbors &&
                 IsLocalMaxima(i, nn_indices, third_eigen_values)) {
-                kp_indices.emplace_back(i);
+                is_keypoint[i] = 1;
             }
         }
+    });
+    std::vector<size_t> kp_indices;
+    for (size_t i = 0; i < is_keypoint.size(); i++) {
+        if (is_keypoint[i]) {
+            kp_indices.push_back(i);
+        }
     }
 
     utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
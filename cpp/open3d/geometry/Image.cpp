@@ -26,6 +26,8 @@
 
 #include "open3d/geometry/Image.h"
 
+#include "open3d/core/ParallelFor.h"
+
 namespace {
 /// Isotropic 2D kernels are separable:
 /// two 1D kernels are applied in x and y direction.
@@ -154,12 +156,7 @@ std::shared_ptr<Image> Image::Downsample() const {
     int half_height = (int)floor((double)height_ / 2.0);
     output->Prepare(half_width, half_height, 1, 4);
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < output->height_; y++) {
+    core::ParallelFor(output->height_, [&](int y) {
         for (int x = 0; x < output->width_; x++) {
             float *p1 = PointerAt<float>(x * 2, y * 2);
             float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
@@ -168,7 +165,7 @@ std::shared_ptr<Image> Image::Downsample() const {
             float *p = output->PointerAt<float>(x, y);
             *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
         }
-    }
+    });
     return output;
 }
 
@@ -185,12 +182,7 @@ std::shared_ptr<Image> Image::FilterHorizontal(
 
     const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
+    core::ParallelFor(height_, [&](int y) {
         for (int x = 0; x < width_; x++) {
             float *po = output->PointerAt<float>(x, y, 0);
             double temp = 0;
@@ -203,7 +195,7 @@ std::shared_ptr<Image> Image::FilterHorizontal(
             }
             *po = (float)temp;
         }
-    }
+    });
     return output;
 }
 
@@ -268,12 +260,7 @@ std::shared_ptr<Image> Image::Transpose() const {
     int in_bytes_per_line = BytesPerLine();
     int bytes_per_pixel = num_of_channels_ * bytes_per_channel_;
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
+    core::ParallelFor(height_, [&](int y) {
         for (int x = 0; x < width_; x++) {
             std::copy(
                     data_.data() + y * in_bytes_per_line + x * bytes_per_pixel,
@@ -282,7 +269,7 @@ std::shared_ptr<Image> Image::Transpose() const {
                     output->data_.data() + x * out_bytes_per_line +
                             y * bytes_per_pixel);
         }
-    }
+    });
 
     return output;
 }
@@ -292,12 +279,11 @@ std::shared_ptr<Image> Image::FlipVertical() const {
     output->Prepare(width_, height_, num_of_channels_, bytes_per_channel_);
 
     int bytes_per_line = BytesPerLine();
-#pragma omp parallel for schedule(static)
-    for (int y = 0; y < height_; y++) {
+    core::ParallelFor(height_, [&](int y) {
         std::copy(data_.data() + y * bytes_per_line,
                   data_.data() + (y + 1) * bytes_per_line,
                   output->data_.data() + (height_ - y - 1) * bytes_per_line);
-    }
+    });
     return output;
 }
 
@@ -307,12 +293,7 @@ std::shared_ptr<Image> Image::FlipHorizontal() const {
 
     int bytes_per_line = BytesPerLine();
     int bytes_per_pixel = num_of_channels_ * bytes_per_channel_;
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
+    core::ParallelFor(height_, [&](int y) {
         for (int x = 0; x < width_; x++) {
             std::copy(data_.data() + y * bytes_per_line + x * bytes_per_pixel,
                       data_.data() + y * bytes_per_line +
@@ -320,7 +301,7 @@ std::shared_ptr<Image> Image::FlipHorizontal() const {
                       output->data_.data() + y * bytes_per_line +
                               (width_ - x - 1) * bytes_per_pixel);
         }
-    }
+    });
 
     return output;
 }
@@ -332,12 +313,7 @@ std::shared_ptr<Image> Image::Dilate(int half_kernel_size /* = 1 */) const {
     }
     output->Prepare(width_, height_, 1, 1);
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
+    core::ParallelFor(height_, [&](int y) {
         for (int x = 0; x < width_; x++) {
             for (int yy = -half_kernel_size; yy <= half_kernel_size; yy++) {
                 for (int xx = -half_kernel_size; xx <= half_kernel_size; xx++) {
@@ -353,7 +329,7 @@ std::shared_ptr<Image> Image::Dilate(int half_kernel_size /* = 1 */) const {
                 }
             }
         }
-    }
+    });
     return output;
 }
 
@@ -370,12 +346,7 @@ std::shared_ptr<Image> Image::CreateDepthBoundaryMask(
     auto mask = std::make_shared<Image>();
     mask->Prepare(width, height, 1, 1);
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int v = 0; v < height; v++) {
+    core::ParallelFor(height, [&](int v) {
         for (int u = 0; u < width; u++) {
             double dx = *depth_image_gradient_dx->PointerAt<float>(u, v);
             double dy = *depth_image_gradient_dy->PointerAt<float>(u, v);
@@ -386,7 +357,7 @@ std::shared_ptr<Image> Image::CreateDepthBoundaryMask(
                 *mask->PointerAt<unsigned char>(u, v) = 0;
             }
         }
-    }
+    });
     if (half_dilation_kernel_size_for_discontinuity_map >= 1) {
         auto mask_dilated =
                 mask->Dilate(half_dilation_kernel_size_for_discontinuity_map);
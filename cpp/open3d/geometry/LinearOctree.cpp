@@ -0,0 +1,475 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Code of points that fall outside of the octree. Valid codes use at most
+/// 3 * LinearOctree::kMaxDepth = 63 bits, so this sorts after all of them.
+constexpr uint64_t kInvalidCode = std::numeric_limits<uint64_t>::max();
+
+/// Nodes of one depth, used while building the octree bottom-up.
+struct LinearOctreeLevel {
+    std::vector<uint64_t> codes_;
+    std::vector<size_t> point_begins_;
+    std::vector<size_t> point_ends_;
+    /// Index of the first child within the next level.
+    std::vector<size_t> first_children_;
+    std::vector<uint8_t> child_masks_;
+};
+
+/// Returns the positions where a new run of equal codes starts.
+std::vector<size_t> FindRunStarts(const std::vector<uint64_t>& codes) {
+    const int64_t n = static_cast<int64_t>(codes.size());
+    std::vector<size_t> run_ids(n);
+    core::ParallelFor(n, [&](int64_t i) {
+        run_ids[i] = (i == 0 || codes[i] != codes[i - 1]) ? 1 : 0;
+    });
+    utility::InclusivePrefixSum(run_ids.data(), run_ids.data() + n,
+                                run_ids.data());
+    std::vector<size_t> run_starts(n > 0 ? run_ids.back() : 0);
+    core::ParallelFor(n, [&](int64_t i) {
+        if (i == 0 || run_ids[i] != run_ids[i - 1]) {
+            run_starts[run_ids[i] - 1] = i;
+        }
+    });
+    return run_starts;
+}
+
+/// Returns the Morton code of the leaf containing \p point, descending the
+/// tree with the same arithmetic as Octree::InsertPoint so that points on
+/// node boundaries end up in the same leaf.
+uint64_t ComputeLeafCode(const Eigen::Vector3d& point,
+                         const Eigen::Vector3d& root_origin,
+                         double root_size,
+                         size_t max_depth) {
+    Eigen::Vector3d origin = root_origin;
+    double size = root_size;
+    if (!Octree::IsPointInBound(point, origin, size)) {
+        return kInvalidCode;
+    }
+    uint64_t code = 0;
+    for (size_t depth = 0; depth < max_depth; ++depth) {
+        size /= 2.0;
+        size_t x_index = point(0) < origin(0) + size ? 0 : 1;
+        size_t y_index = point(1) < origin(1) + size ? 0 : 1;
+        size_t z_index = point(2) < origin(2) + size ? 0 : 1;
+        origin += Eigen::Vector3d(x_index * size, y_index * size,
+                                  z_index * size);
+        if (!Octree::IsPointInBound(point, origin, size)) {
+            return kInvalidCode;
+        }
+        code = (code << 3) | (x_index + y_index * 2 + z_index * 4);
+    }
+    return code;
+}
+
+uint64_t SplitBy3(uint32_t value) {
+    uint64_t x = value & 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+uint32_t CompactBy3(uint64_t code) {
+    uint64_t x = code & 0x1249249249249249;
+    x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3;
+    x = (x ^ (x >> 4)) & 0x100f00f00f00f00f;
+    x = (x ^ (x >> 8)) & 0x1f0000ff0000ff;
+    x = (x ^ (x >> 16)) & 0x1f00000000ffff;
+    x = (x ^ (x >> 32)) & 0x1fffff;
+    return static_cast<uint32_t>(x);
+}
+
+int CountBits(uint8_t mask) {
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        ++count;
+    }
+    return count;
+}
+
+std::shared_ptr<OctreeNode> ToOctreeNode(const LinearOctree& octree,
+                                         size_t node) {
+    std::vector<size_t> indices(
+            octree.point_indices_.begin() + octree.node_point_begins_[node],
+            octree.point_indices_.begin() + octree.node_point_ends_[node]);
+    std::sort(indices.begin(), indices.end());
+    if (octree.node_first_children_[node] < 0) {
+        auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+        leaf_node->color_ =
+                octree.leaf_colors_[node -
+                                    octree.level_offsets_[octree.max_depth_]];
+        leaf_node->indices_ = std::move(indices);
+        return leaf_node;
+    }
+    auto internal_node = std::make_shared<OctreeInternalPointNode>();
+    internal_node->indices_ = std::move(indices);
+    for (size_t cid = 0; cid < 8; ++cid) {
+        int64_t child = octree.GetChild(node, cid);
+        if (child >= 0) {
+            internal_node->children_[cid] = ToOctreeNode(octree, child);
+        }
+    }
+    return internal_node;
+}
+
+}  // namespace
+
+LinearOctree& LinearOctree::Clear() {
+    origin_.setZero();
+    size_ = 0;
+    level_offsets_.clear();
+    node_codes_.clear();
+    node_point_begins_.clear();
+    node_point_ends_.clear();
+    node_first_children_.clear();
+    node_child_masks_.clear();
+    leaf_colors_.clear();
+    point_indices_.clear();
+    points_.clear();
+    return *this;
+}
+
+bool LinearOctree::IsEmpty() const { return node_codes_.empty(); }
+
+void LinearOctree::ConvertFromPointCloud(const PointCloud& point_cloud,
+                                         double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    if (max_depth_ > kMaxDepth) {
+        utility::LogError("max_depth {} exceeds the maximum depth {}.",
+                          max_depth_, kMaxDepth);
+    }
+
+    // Set bounds
+    Clear();
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    // Sort the points by leaf code. Ties keep the input order, so the last
+    // point of each leaf is the one Octree uses for the leaf color.
+    const int64_t num_points = static_cast<int64_t>(point_cloud.points_.size());
+    std::vector<std::pair<uint64_t, size_t>> keys(num_points);
+    core::ParallelFor(num_points, [&](int64_t i) {
+        keys[i] = std::make_pair(ComputeLeafCode(point_cloud.points_[i],
+                                                 origin_, size_, max_depth_),
+                                 static_cast<size_t>(i));
+    });
+    tbb::parallel_sort(keys.begin(), keys.end());
+    const int64_t num_valid =
+            std::lower_bound(keys.begin(), keys.end(),
+                             std::make_pair(kInvalidCode, size_t(0))) -
+            keys.begin();
+    if (num_valid == 0) {
+        return;
+    }
+
+    std::vector<uint64_t> codes(num_valid);
+    point_indices_.resize(num_valid);
+    points_.resize(num_valid);
+    core::ParallelFor(num_valid, [&](int64_t i) {
+        codes[i] = keys[i].first;
+        point_indices_[i] = keys[i].second;
+        points_[i] = point_cloud.points_[keys[i].second];
+    });
+    keys.clear();
+    keys.shrink_to_fit();
+
+    // Build the levels bottom-up. The nodes of a level are the runs of equal
+    // codes among the children, after dropping the lowest three bits.
+    std::vector<LinearOctreeLevel> levels(max_depth_ + 1);
+    for (int64_t depth = max_depth_; depth >= 0; --depth) {
+        LinearOctreeLevel& level = levels[depth];
+        const bool is_leaf_level = depth == int64_t(max_depth_);
+        if (!is_leaf_level) {
+            for (uint64_t& code : codes) {
+                code >>= 3;
+            }
+        }
+        std::vector<size_t> run_starts = FindRunStarts(codes);
+        const int64_t num_nodes = static_cast<int64_t>(run_starts.size());
+        const int64_t num_children = static_cast<int64_t>(codes.size());
+        level.codes_.resize(num_nodes);
+        level.point_begins_.resize(num_nodes);
+        level.point_ends_.resize(num_nodes);
+        level.first_children_.resize(num_nodes);
+        level.child_masks_.resize(num_nodes);
+        core::ParallelFor(num_nodes, [&](int64_t i) {
+            const size_t begin = run_starts[i];
+            const size_t end =
+                    i + 1 < num_nodes ? run_starts[i + 1] : num_children;
+            level.codes_[i] = codes[begin];
+            if (is_leaf_level) {
+                level.point_begins_[i] = begin;
+                level.point_ends_[i] = end;
+                level.child_masks_[i] = 0;
+            } else {
+                const LinearOctreeLevel& child_level = levels[depth + 1];
+                level.point_begins_[i] = child_level.point_begins_[begin];
+                level.point_ends_[i] = child_level.point_ends_[end - 1];
+                level.first_children_[i] = begin;
+                uint8_t mask = 0;
+                for (size_t c = begin; c < end; ++c) {
+                    mask |= uint8_t(1) << (child_level.codes_[c] & 7);
+                }
+                level.child_masks_[i] = mask;
+            }
+        });
+        codes = level.codes_;
+    }
+
+    // Concatenate the levels, root first.
+    level_offsets_.resize(max_depth_ + 2);
+    level_offsets_[0] = 0;
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        level_offsets_[depth + 1] =
+                level_offsets_[depth] + levels[depth].codes_.size();
+    }
+    const size_t num_nodes = level_offsets_.back();
+    node_codes_.resize(num_nodes);
+    node_point_begins_.resize(num_nodes);
+    node_point_ends_.resize(num_nodes);
+    node_first_children_.resize(num_nodes);
+    node_child_masks_.resize(num_nodes);
+    for (size_t depth = 0; depth <= max_depth_; ++depth) {
+        const LinearOctreeLevel& level = levels[depth];
+        const size_t offset = level_offsets_[depth];
+        const size_t child_offset = level_offsets_[depth + 1];
+        const bool is_leaf_level = depth == max_depth_;
+        core::ParallelFor(level.codes_.size(), [&](int64_t i) {
+            node_codes_[offset + i] = level.codes_[i];
+            node_point_begins_[offset + i] = level.point_begins_[i];
+            node_point_ends_[offset + i] = level.point_ends_[i];
+            node_first_children_[offset + i] =
+                    is_leaf_level ? -1
+                                  : int64_t(child_offset +
+                                            level.first_children_[i]);
+            node_child_masks_[offset + i] = level.child_masks_[i];
+        });
+    }
+
+    const LinearOctreeLevel& leaves = levels[max_depth_];
+    const bool has_colors = point_cloud.HasColors();
+    leaf_colors_.resize(leaves.codes_.size());
+    core::ParallelFor(leaves.codes_.size(), [&](int64_t i) {
+        const size_t last = point_indices_[leaves.point_ends_[i] - 1];
+        leaf_colors_[i] = has_colors ? point_cloud.colors_[last]
+                                     : Eigen::Vector3d::Zero();
+    });
+}
+
+std::shared_ptr<Octree> LinearOctree::ToOctree() const {
+    auto octree = std::make_shared<Octree>(max_depth_, origin_, size_);
+    if (!IsEmpty()) {
+        octree->root_node_ = ToOctreeNode(*this, 0);
+    }
+    return octree;
+}
+
+int64_t LinearOctree::LocateLeafNode(const Eigen::Vector3d& point) const {
+    if (IsEmpty()) {
+        return -1;
+    }
+    uint64_t code = ComputeLeafCode(point, origin_, size_, max_depth_);
+    if (code == kInvalidCode) {
+        return -1;
+    }
+    return FindNode(max_depth_, code);
+}
+
+int64_t LinearOctree::FindNode(size_t depth, uint64_t code) const {
+    if (depth + 1 >= level_offsets_.size()) {
+        return -1;
+    }
+    auto begin = node_codes_.begin() + level_offsets_[depth];
+    auto end = node_codes_.begin() + level_offsets_[depth + 1];
+    auto it = std::lower_bound(begin, end, code);
+    if (it == end || *it != code) {
+        return -1;
+    }
+    return it - node_codes_.begin();
+}
+
+size_t LinearOctree::GetNodeDepth(size_t node) const {
+    return std::upper_bound(level_offsets_.begin(), level_offsets_.end(),
+                            node) -
+           level_offsets_.begin() - 1;
+}
+
+OctreeNodeInfo LinearOctree::GetNodeInfo(size_t node) const {
+    const size_t depth = GetNodeDepth(node);
+    const uint64_t code = node_codes_[node];
+    Eigen::Vector3d origin = origin_;
+    double size = size_;
+    for (size_t d = depth; d > 0; --d) {
+        const uint64_t child_index = (code >> (3 * (d - 1))) & 7;
+        size /= 2.0;
+        origin += Eigen::Vector3d((child_index & 1) * size,
+                                  ((child_index >> 1) & 1) * size,
+                                  ((child_index >> 2) & 1) * size);
+    }
+    return OctreeNodeInfo(origin, size, depth, depth == 0 ? 0 : code & 7);
+}
+
+int64_t LinearOctree::GetChild(size_t node, size_t child_index) const {
+    const uint8_t mask = node_child_masks_[node];
+    if (node_first_children_[node] < 0 || !((mask >> child_index) & 1)) {
+        return -1;
+    }
+    return node_first_children_[node] +
+           CountBits(mask & ((1 << child_index) - 1));
+}
+
+std::vector<size_t> LinearOctree::GetNeighborLeafNodes(size_t leaf) const {
+    std::vector<size_t> neighbors;
+    uint32_t x, y, z;
+    DecodeMorton(node_codes_[leaf], x, y, z);
+    const int64_t resolution = int64_t(1) << max_depth_;
+    for (int64_t dz = -1; dz <= 1; ++dz) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dx = -1; dx <= 1; ++dx) {
+                const int64_t nx = x + dx;
+                const int64_t ny = y + dy;
+                const int64_t nz = z + dz;
+                if ((dx == 0 && dy == 0 && dz == 0) || nx < 0 || ny < 0 ||
+                    nz < 0 || nx >= resolution || ny >= resolution ||
+                    nz >= resolution) {
+                    continue;
+                }
+                int64_t neighbor = FindNode(
+                        max_depth_, EncodeMorton(uint32_t(nx), uint32_t(ny),
+                                                 uint32_t(nz)));
+                if (neighbor >= 0) {
+                    neighbors.push_back(neighbor);
+                }
+            }
+        }
+    }
+    return neighbors;
+}
+
+int LinearOctree::SearchRadius(const Eigen::Vector3d& query,
+                               double radius,
+                               std::vector<size_t>& indices,
+                               std::vector<double>& distance2) const {
+    indices.clear();
+    distance2.clear();
+    if (IsEmpty()) {
+        return 0;
+    }
+    const double radius2 = radius * radius;
+    struct StackEntry {
+        size_t node_;
+        Eigen::Vector3d origin_;
+        double size_;
+    };
+    std::vector<StackEntry> stack{{0, origin_, size_}};
+    while (!stack.empty()) {
+        StackEntry entry = stack.back();
+        stack.pop_back();
+        const Eigen::Array3d min_bound = entry.origin_.array();
+        const Eigen::Array3d max_bound = min_bound + entry.size_;
+        const Eigen::Array3d q = query.array();
+        const double box_distance2 = (min_bound - q)
+                                             .max(q - max_bound)
+                                             .max(0.0)
+                                             .square()
+                                             .sum();
+        if (box_distance2 > radius2) {
+            continue;
+        }
+        if (node_first_children_[entry.node_] < 0) {
+            for (size_t i = node_point_begins_[entry.node_];
+                 i < node_point_ends_[entry.node_]; ++i) {
+                const double dist2 = (points_[i] - query).squaredNorm();
+                if (dist2 <= radius2) {
+                    indices.push_back(point_indices_[i]);
+                    distance2.push_back(dist2);
+                }
+            }
+            continue;
+        }
+        const double child_size = entry.size_ / 2.0;
+        for (size_t cid = 0; cid < 8; ++cid) {
+            int64_t child = GetChild(entry.node_, cid);
+            if (child >= 0) {
+                stack.push_back(
+                        {size_t(child),
+                         entry.origin_ +
+                                 Eigen::Vector3d((cid & 1) * child_size,
+                                                 ((cid >> 1) & 1) * child_size,
+                                                 ((cid >> 2) & 1) * child_size),
+                         child_size});
+            }
+        }
+    }
+    return static_cast<int>(indices.size());
+}
+
+uint64_t LinearOctree::EncodeMorton(uint32_t x, uint32_t y, uint32_t z) {
+    return SplitBy3(x) | (SplitBy3(y) << 1) | (SplitBy3(z) << 2);
+}
+
+void LinearOctree::DecodeMorton(uint64_t code,
+                                uint32_t& x,
+                                uint32_t& y,
+                                uint32_t& z) {
+    x = CompactBy3(code);
+    y = CompactBy3(code >> 1);
+    z = CompactBy3(code >> 2);
+}
+
+}  // namespace geometry
+}  // namespace open3d
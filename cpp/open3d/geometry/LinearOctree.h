@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree with nodes stored in contiguous arrays.
+///
+/// Nodes are identified by Morton codes. The code of a node at depth d has 3d
+/// bits; bits [3(d - k), 3(d - k) + 3) hold the child index (x + 2y + 4z, as
+/// in OctreeInternalNode) of its ancestor at depth k. The nodes of each depth
+/// are stored in ascending code order, and the points are sorted by the code
+/// of their leaf, so the points of every node are a contiguous range of
+/// point_indices_. Only non-empty nodes are stored.
+///
+/// The octree subdivides space exactly like Octree::ConvertFromPointCloud,
+/// and ToOctree() converts it to the equivalent pointer-based Octree.
+class LinearOctree {
+public:
+    /// \brief Default Constructor.
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Depth of the leaf nodes, at most kMaxDepth.
+    explicit LinearOctree(size_t max_depth)
+        : origin_(0, 0, 0), size_(0), max_depth_(max_depth) {}
+    ~LinearOctree() {}
+
+public:
+    /// Maximum supported depth, limited by the 64-bit Morton codes.
+    static constexpr size_t kMaxDepth = 21;
+
+    /// Clear all nodes and points, keeping max_depth_.
+    LinearOctree& Clear();
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const;
+
+    /// \brief Build the octree from a point cloud in parallel.
+    ///
+    /// The bounds are computed as in Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// Convert to the equivalent pointer-based Octree.
+    std::shared_ptr<Octree> ToOctree() const;
+
+    /// Returns the number of nodes at \p depth, or 0 if the octree is empty
+    /// or \p depth is beyond max_depth_.
+    size_t GetNumNodes(size_t depth) const {
+        if (depth + 1 >= level_offsets_.size()) {
+            return 0;
+        }
+        return level_offsets_[depth + 1] - level_offsets_[depth];
+    }
+
+    /// Returns the node index of the leaf containing \p point, or -1 if the
+    /// point is outside of the octree or in an empty leaf.
+    int64_t LocateLeafNode(const Eigen::Vector3d& point) const;
+
+    /// Returns the node index of the node at \p depth with Morton code
+    /// \p code, or -1 if that node is empty.
+    int64_t FindNode(size_t depth, uint64_t code) const;
+
+    /// Returns origin, size, depth and child index of node \p node.
+    OctreeNodeInfo GetNodeInfo(size_t node) const;
+
+    /// Returns the depth of node \p node.
+    size_t GetNodeDepth(size_t node) const;
+
+    /// Returns the index of child \p child_index of \p node, or -1 if that
+    /// child is empty or \p node is a leaf.
+    int64_t GetChild(size_t node, size_t child_index) const;
+
+    /// Returns the non-empty leaves sharing a face, edge or corner with leaf
+    /// \p leaf.
+    std::vector<size_t> GetNeighborLeafNodes(size_t leaf) const;
+
+    /// \brief Find all points within \p radius of \p query.
+    ///
+    /// \param query Query position.
+    /// \param radius Search radius.
+    /// \param indices Indices of the found points in the input point cloud.
+    /// \param distance2 Squared distances of the found points.
+    /// \return The number of points found.
+    int SearchRadius(const Eigen::Vector3d& query,
+                     double radius,
+                     std::vector<size_t>& indices,
+                     std::vector<double>& distance2) const;
+
+    /// Interleave the bits of 21-bit integer coordinates into a Morton code.
+    static uint64_t EncodeMorton(uint32_t x, uint32_t y, uint32_t z);
+    /// Inverse of EncodeMorton.
+    static void DecodeMorton(uint64_t code,
+                             uint32_t& x,
+                             uint32_t& y,
+                             uint32_t& z);
+
+public:
+    /// Global min bound (include).
+    Eigen::Vector3d origin_;
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+    /// Depth of the leaf nodes. The root is of depth 0.
+    size_t max_depth_;
+
+    /// The nodes of depth d are [level_offsets_[d], level_offsets_[d + 1]).
+    std::vector<size_t> level_offsets_;
+    /// Morton code of each node, relative to its depth.
+    std::vector<uint64_t> node_codes_;
+    /// The points of node i are point_indices_[node_point_begins_[i]] to
+    /// point_indices_[node_point_ends_[i] - 1].
+    std::vector<size_t> node_point_begins_;
+    std::vector<size_t> node_point_ends_;
+    /// Index of the first child of each node, -1 for leaves. The children of
+    /// a node are stored consecutively in child index order.
+    std::vector<int64_t> node_first_children_;
+    /// Bit i is set if child i of the node is non-empty.
+    std::vector<uint8_t> node_child_masks_;
+    /// Color of each leaf, taken from the last point of the leaf in the input
+    /// point cloud. Indexed by node index - level_offsets_[max_depth_].
+    std::vector<Eigen::Vector3d> leaf_colors_;
+    /// Point cloud indices in Morton order.
+    std::vector<size_t> point_indices_;
+    /// Point positions in Morton order.
+    std::vector<Eigen::Vector3d> points_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/geometry/NeighborhoodCache.h"
+
+#include <algorithm>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace geometry {
+
+NeighborhoodCache::NeighborhoodCache(const PointCloud &cloud,
+                                     const KDTreeSearchParam &search_param) {
+    Compute(cloud, search_param);
+}
+
+void NeighborhoodCache::Compute(const PointCloud &cloud,
+                                const KDTreeSearchParam &search_param) {
+    search_type_ = search_param.GetSearchType();
+    switch (search_type_) {
+        case KDTreeSearchParam::SearchType::Knn:
+            radius_ = 0;
+            max_nn_ = ((const KDTreeSearchParamKNN &)search_param).knn_;
+            break;
+        case KDTreeSearchParam::SearchType::Radius:
+            radius_ = ((const KDTreeSearchParamRadius &)search_param).radius_;
+            max_nn_ = 0;
+            break;
+        case KDTreeSearchParam::SearchType::Hybrid:
+            radius_ = ((const KDTreeSearchParamHybrid &)search_param).radius_;
+            max_nn_ = ((const KDTreeSearchParamHybrid &)search_param).max_nn_;
+            break;
+    }
+
+    const int64_t num_points = int64_t(cloud.points_.size());
+    offsets_.assign(1, 0);
+    indices_.clear();
+    distances2_.clear();
+    if (num_points == 0) {
+        return;
+    }
+    KDTreeFlann kdtree;
+    kdtree.SetGeometry(cloud);
+
+    // Search into per-point buffers first, since radius neighborhoods have
+    // different sizes, then pack them.
+    std::vector<std::vector<int>> indices(num_points);
+    std::vector<std::vector<double>> distances2(num_points);
+    core::ParallelFor(num_points, [&](int64_t i) {
+        kdtree.Search(cloud.points_[i], search_param, indices[i],
+                      distances2[i]);
+    });
+
+    offsets_.assign(num_points + 1, 0);
+    for (int64_t i = 0; i < num_points; ++i) {
+        offsets_[i + 1] = offsets_[i] + int64_t(indices[i].size());
+    }
+    indices_.resize(offsets_.back());
+    distances2_.resize(offsets_.back());
+    core::ParallelFor(num_points, [&](int64_t i) {
+        std::copy(indices[i].begin(), indices[i].end(),
+                  indices_.begin() + offsets_[i]);
+        std::copy(distances2[i].begin(), distances2[i].end(),
+                  distances2_.begin() + offsets_[i]);
+        std::vector<int>().swap(indices[i]);
+        std::vector<double>().swap(distances2[i]);
+    });
+    utility::LogDebug("Cached {:d} neighbors of {:d} points.",
+                      (int64_t)indices_.size(), num_points);
+}
+
+}  // namespace geometry
+}  // namespace open3d
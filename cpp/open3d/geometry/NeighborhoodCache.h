@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class NeighborhoodCache
+///
+/// \brief Neighborhoods of all points of a point cloud, searched once with a
+/// KDTree and reused by EstimateNormals, RemoveRadiusOutliers and
+/// ComputeFPFHFeature.
+///
+/// The neighbors of point i are stored contiguously, sorted by distance as
+/// returned by KDTreeFlann. The cache does not track the point cloud; it must
+/// be recomputed whenever the points change.
+class NeighborhoodCache {
+public:
+    /// \brief Default Constructor.
+    NeighborhoodCache() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param cloud Point cloud whose neighborhoods are searched.
+    /// \param search_param The KDTree search parameters.
+    NeighborhoodCache(const PointCloud &cloud,
+                      const KDTreeSearchParam &search_param);
+
+public:
+    /// Searches the neighborhoods of all points of \p cloud in parallel.
+    void Compute(const PointCloud &cloud,
+                 const KDTreeSearchParam &search_param);
+
+    /// Returns the number of points whose neighborhoods are cached.
+    int64_t GetNumPoints() const { return int64_t(offsets_.size()) - 1; }
+    /// Returns the number of neighbors of point \p i, including itself.
+    int GetNumNeighbors(int64_t i) const {
+        return int(offsets_[i + 1] - offsets_[i]);
+    }
+    /// Returns the indices of the neighbors of point \p i.
+    const int *GetNeighbors(int64_t i) const {
+        return indices_.data() + offsets_[i];
+    }
+    /// Returns the squared distances to the neighbors of point \p i.
+    const double *GetDistances2(int64_t i) const {
+        return distances2_.data() + offsets_[i];
+    }
+    /// Get the search type (KNN, Radius, Hybrid) used to build the cache.
+    KDTreeSearchParam::SearchType GetSearchType() const {
+        return search_type_;
+    }
+    /// Returns the search radius, 0 for a KNN search.
+    double GetRadius() const { return radius_; }
+    /// Returns the maximum number of neighbors, 0 for a radius search.
+    int GetMaxNN() const { return max_nn_; }
+
+public:
+    /// The neighbors of point i are at offsets_[i] to offsets_[i + 1] - 1.
+    std::vector<int64_t> offsets_ = {0};
+    /// Neighbor indices of all points.
+    std::vector<int> indices_;
+    /// Squared neighbor distances of all points.
+    std::vector<double> distances2_;
+
+private:
+    KDTreeSearchParam::SearchType search_type_ =
+            KDTreeSearchParam::SearchType::Knn;
+    double radius_ = 0;
+    int max_nn_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -31,10 +31,13 @@
 #include <numeric>
 #include <random>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/NeighborhoodCache.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/VoxelGrouping.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
 
@@ -129,8 +132,7 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
     std::vector<double> distances(points_.size());
     KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    core::ParallelFor((int)points_.size(), [&](int i) {
         std::vector<int> indices(1);
         std::vector<double> dists(1);
         if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
@@ -141,7 +143,7 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
         } else {
             distances[i] = std::sqrt(dists[0]);
         }
-    }
+    });
     return distances;
 }
 
@@ -198,113 +200,8 @@ std::shared_ptr<PointCloud> PointCloud::SelectByIndex(
     return output;
 }
 
-// helper classes for VoxelDownSample and VoxelDownSampleAndTrace
-namespace {
-class AccumulatedPoint {
-public:
-    AccumulatedPoint()
-        : num_of_points_(0),
-          point_(0.0, 0.0, 0.0),
-          normal_(0.0, 0.0, 0.0),
-          color_(0.0, 0.0, 0.0) {}
-
-public:
-    void AddPoint(const PointCloud &cloud, int index) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
-        }
-        if (cloud.HasColors()) {
-            color_ += cloud.colors_[index];
-        }
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetAveragePoint() const {
-        return point_ / double(num_of_points_);
-    }
-
-    Eigen::Vector3d GetAverageNormal() const {
-        // Call NormalizeNormals() afterwards if necessary
-        return normal_ / double(num_of_points_);
-    }
-
-    Eigen::Vector3d GetAverageColor() const {
-        return color_ / double(num_of_points_);
-    }
-
-public:
-    int num_of_points_;
-    Eigen::Vector3d point_;
-    Eigen::Vector3d normal_;
-    Eigen::Vector3d color_;
-};
-
-class point_cubic_id {
-public:
-    size_t point_id;
-    int cubic_id;
-};
-
-class AccumulatedPointForTrace : public AccumulatedPoint {
-public:
-    void AddPoint(const PointCloud &cloud,
-                  size_t index,
-                  int cubic_index,
-                  bool approximate_class) {
-        point_ += cloud.points_[index];
-        if (cloud.HasNormals()) {
-            if (!std::isnan(cloud.normals_[index](0)) &&
-                !std::isnan(cloud.normals_[index](1)) &&
-                !std::isnan(cloud.normals_[index](2))) {
-                normal_ += cloud.normals_[index];
-            }
-        }
-        if (cloud.HasColors()) {
-            if (approximate_class) {
-                auto got = classes.find(int(cloud.colors_[index][0]));
-                if (got == classes.end())
-                    classes[int(cloud.colors_[index][0])] = 1;
-                else
-                    classes[int(cloud.colors_[index][0])] += 1;
-            } else {
-                color_ += cloud.colors_[index];
-            }
-        }
-        point_cubic_id new_id;
-        new_id.point_id = index;
-        new_id.cubic_id = cubic_index;
-        original_id.push_back(new_id);
-        num_of_points_++;
-    }
-
-    Eigen::Vector3d GetMaxClass() {
-        int max_class = -1;
-        int max_count = -1;
-        for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
-                max_count = it->second;
-                max_class = it->first;
-            }
-        }
-        return Eigen::Vector3d(max_class, max_class, max_class);
-    }
-
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
-
-private:
-    // original point cloud id in higher resolution + its cubic id
-    std::vector<point_cubic_id> original_id;
-    std::unordered_map<int, int> classes;
-};
-}  // namespace
-
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
-        double voxel_size) const {
+        double voxel_size, VoxelReduction reduction) const {
     auto output = std::make_shared<PointCloud>();
     if (voxel_size <= 0.0) {
         utility::LogError("[VoxelDownSample] voxel_size <= 0.");
@@ -317,27 +214,37 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
+    if (!HasPoints()) {
+        return output;
     }
+    VoxelGrouping grouping(points_.data(), int64_t(points_.size()),
+                           voxel_size, voxel_min_bound);
+    const int64_t num_voxels = grouping.GetNumVoxels();
+
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    output->points_.resize(num_voxels);
+    if (has_normals) output->normals_.resize(num_voxels);
+    if (has_colors) output->colors_.resize(num_voxels);
+    if (reduction == VoxelReduction::First ||
+        reduction == VoxelReduction::ClosestToCenter) {
+        std::vector<int64_t> selected = grouping.SelectPoints(reduction);
+        core::ParallelFor(num_voxels, [&](int64_t v) {
+            output->points_[v] = points_[selected[v]];
+            if (has_normals) output->normals_[v] = normals_[selected[v]];
+            if (has_colors) output->colors_[v] = colors_[selected[v]];
+        });
+    } else {
+        grouping.Reduce(reduction, points_[0].data(), 3,
+                        output->points_[0].data());
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            // Call NormalizeNormals() afterwards if necessary.
+            grouping.Reduce(reduction, normals_[0].data(), 3,
+                            output->normals_[0].data());
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            grouping.Reduce(reduction, colors_[0].data(), 3,
+                            output->colors_[0].data());
         }
     }
     utility::LogDebug(
@@ -366,52 +273,73 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    VoxelGrouping grouping(points_.data(), int64_t(points_.size()),
+                           voxel_size, voxel_min_bound);
+    const int64_t num_voxels = grouping.GetNumVoxels();
+
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
-    cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
-        if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+    output->points_.resize(num_voxels);
+    if (num_voxels > 0) {
+        grouping.Reduce(VoxelReduction::Mean, points_[0].data(), 3,
+                        output->points_[0].data());
+    }
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+        grouping.Reduce(VoxelReduction::Mean, normals_[0].data(), 3,
+                        output->normals_[0].data());
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+        if (!approximate_class) {
+            grouping.Reduce(VoxelReduction::Mean, colors_[0].data(), 3,
+                            output->colors_[0].data());
         }
-        if (has_colors) {
-            if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
-            } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+    }
+
+    // The points of each voxel in increasing index order, and the last point
+    // of each of its eight octants.
+    cubic_id.resize(num_voxels, 8);
+    cubic_id.setConstant(-1);
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    int cid_temp[3] = {1, 2, 4};
+    core::ParallelFor(num_voxels, [&](int64_t v) {
+        const Eigen::Vector3i &voxel_index = grouping.voxels_[v];
+        std::vector<int> classes;
+        for (int64_t i = grouping.voxel_begins_[v];
+             i < grouping.voxel_begins_[v + 1]; ++i) {
+            int pid = int(grouping.point_indices_[i]);
+            auto ref_coord = (points_[pid] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            cubic_id(v, cid) = pid;
+            original_indices[v].push_back(pid);
+            if (has_colors && approximate_class) {
+                classes.push_back(int(colors_[pid][0]));
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+        if (has_colors && approximate_class) {
+            // The most frequent class, the smallest one on ties.
+            std::sort(classes.begin(), classes.end());
+            int max_class = -1;
+            size_t max_count = 0;
+            for (size_t begin = 0, end; begin < classes.size(); begin = end) {
+                end = begin + 1;
+                while (end < classes.size() && classes[end] == classes[begin]) {
+                    ++end;
+                }
+                if (end - begin > max_count) {
+                    max_count = end - begin;
+                    max_class = classes[begin];
+                }
+            }
+            output->colors_[v] = Eigen::Vector3d::Constant(max_class);
         }
-        cnt++;
-    }
+    });
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
             (int)points_.size(), (int)output->points_.size());
@@ -474,15 +402,14 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
     }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-    std::vector<bool> mask = std::vector<bool>(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(points_.size()); i++) {
+    std::vector<char> mask(points_.size());
+    core::ParallelFor(int(points_.size()), [&](int i) {
         std::vector<int> tmp_indices;
         std::vector<double> dist;
         size_t nb_neighbors = kdtree.SearchRadius(points_[i], search_radius,
                                                   tmp_indices, dist);
         mask[i] = (nb_neighbors > nb_points);
-    }
+    });
     std::vector<size_t> indices;
     for (size_t i = 0; i < mask.size(); i++) {
         if (mask[i]) {
@@ -492,6 +419,34 @@ PointCloud::RemoveRadiusOutliers(size_t nb_points, double search_radius) const {
     return std::make_tuple(SelectByIndex(indices), indices);
 }
 
+std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+PointCloud::RemoveRadiusOutliers(size_t nb_points,
+                                 const NeighborhoodCache &neighborhoods) const {
+    if (nb_points < 1) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] Illegal input parameters, number of "
+                "points must be positive");
+    }
+    if (neighborhoods.GetSearchType() == KDTreeSearchParam::SearchType::Knn) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] KNN neighborhoods are not supported, "
+                "use radius or hybrid neighborhoods.");
+    }
+    if (neighborhoods.GetNumPoints() != int64_t(points_.size())) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] The neighborhood cache has {:d} "
+                "points, but the point cloud has {:d} points.",
+                neighborhoods.GetNumPoints(), points_.size());
+    }
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < points_.size(); i++) {
+        if (size_t(neighborhoods.GetNumNeighbors(i)) > nb_points) {
+            indices.push_back(i);
+        }
+    }
+    return std::make_tuple(SelectByIndex(indices), indices);
+}
+
 std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
 PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
                                       double std_ratio) const {
@@ -510,8 +465,7 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
     std::vector<size_t> indices;
     size_t valid_distances = 0;
 
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(points_.size()); i++) {
+    core::ParallelFor(int(points_.size()), [&](int i) {
         std::vector<int> tmp_indices;
         std::vector<double> dist;
         kdtree.SearchKNN(points_[i], int(nb_neighbors), tmp_indices, dist);
@@ -523,7 +477,7 @@ PointCloud::RemoveStatisticalOutliers(size_t nb_neighbors,
             mean = std::accumulate(dist.begin(), dist.end(), 0.0) / dist.size();
         }
         avg_distances[i] = mean;
-    }
+    });
     if (valid_distances == 0) {
         return std::make_tuple(std::make_shared<PointCloud>(),
                                std::vector<size_t>());
@@ -566,11 +520,10 @@ std::vector<double> PointCloud::ComputeMahalanobisDistance() const {
     Eigen::Matrix3d covariance;
     std::tie(mean, covariance) = ComputeMeanAndCovariance();
     Eigen::Matrix3d cov_inv = covariance.inverse();
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    core::ParallelFor((int)points_.size(), [&](int i) {
         Eigen::Vector3d p = points_[i] - mean;
         mahalanobis[i] = std::sqrt(p.transpose() * cov_inv * p);
-    }
+    });
     return mahalanobis;
 }
 
@@ -581,8 +534,7 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
 
     std::vector<double> nn_dis(points_.size());
     KDTreeFlann kdtree(*this);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
+    core::ParallelFor((int)points_.size(), [&](int i) {
         std::vector<int> indices(2);
         std::vector<double> dists(2);
         if (kdtree.SearchKNN(points_[i], 2, indices, dists) <= 1) {
@@ -593,7 +545,7 @@ std::vector<double> PointCloud::ComputeNearestNeighborDistance() const {
         } else {
             nn_dis[i] = std::sqrt(dists[1]);
         }
-    }
+    });
     return nn_dis;
 }
 
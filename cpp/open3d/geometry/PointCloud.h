@@ -33,6 +33,7 @@
 
 #include "open3d/geometry/Geometry3D.h"
 #include "open3d/geometry/KDTreeSearchParam.h"
+#include "open3d/geometry/VoxelGrouping.h"
 
 namespace open3d {
 
@@ -43,6 +44,7 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class NeighborhoodCache;
 class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
@@ -133,11 +135,17 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// The points of each voxel are reduced to one point, together with their
+    /// normals and colors if they exist. The output points are ordered by
+    /// voxel.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
-    std::shared_ptr<PointCloud> VoxelDownSample(double voxel_size) const;
+    /// \param reduction How the points of a voxel are reduced. Mean averages
+    /// them.
+    std::shared_ptr<PointCloud> VoxelDownSample(
+            double voxel_size,
+            VoxelReduction reduction = VoxelReduction::Mean) const;
 
     /// \brief Function to downsample using geometry.PointCloud.VoxelDownSample
     ///
@@ -198,6 +206,16 @@ public:
     std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
     RemoveRadiusOutliers(size_t nb_points, double search_radius) const;
 
+    /// \brief Function to remove points that have less than \p nb_points in
+    /// their cached neighborhood.
+    ///
+    /// \param nb_points Number of points within the neighborhood.
+    /// \param neighborhoods Radius or hybrid neighborhoods of the points. With
+    /// hybrid neighborhoods at most max_nn neighbors are counted.
+    std::tuple<std::shared_ptr<PointCloud>, std::vector<size_t>>
+    RemoveRadiusOutliers(size_t nb_points,
+                         const NeighborhoodCache &neighborhoods) const;
+
     /// \brief Function to remove points that are further away from their
     /// \p nb_neighbor neighbors in average.
     ///
@@ -219,6 +237,19 @@ public:
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
+    /// \brief Function to compute the normals of a point cloud from cached
+    /// neighborhoods.
+    ///
+    /// Same as EstimateNormals(search_param, fast_normal_computation), without
+    /// searching the neighborhoods again.
+    ///
+    /// \param neighborhoods Neighborhoods of the points of this point cloud.
+    /// \param fast_normal_computation If true, the normal estiamtion uses a
+    /// non-iterative method to extract the eigenvector from the covariance
+    /// matrix.
+    void EstimateNormals(const NeighborhoodCache &neighborhoods,
+                         bool fast_normal_computation = true);
+
     /// \brief Function to orient the normals of a point cloud.
     ///
     /// \param orientation_reference Normals are oriented with respect to
@@ -238,6 +269,11 @@ public:
     /// consistent tangent planes as described in Hoppe et al., "Surface
     /// Reconstruction from Unorganized Points", 1992.
     ///
+    /// Orientation is propagated along the minimum spanning forest of the k
+    /// nearest neighbour graph. Each connected component of the graph is
+    /// oriented independently, starting from its highest point whose normal
+    /// is oriented towards +z.
+    ///
     /// \param k k nearest neighbour for graph reconstruction for normal
     /// propagation.
     void OrientNormalsConsistentTangentPlane(size_t k);
@@ -300,17 +336,44 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// Hypotheses are generated in batches and scored in parallel. For large
+    /// point clouds, a batch is first compared on a random subset of the
+    /// points, dropping the worse half of it after every block of the subset
+    /// (preemptive RANSAC, Nister 2005), and only its best hypothesis is
+    /// scored on all points.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// The iterations stop early once the inlier ratio of the best plane makes
+    /// a better one unlikely.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
-    /// the plane inliers.
+    /// the plane inliers. If no plane has an inlier, e.g. because the points
+    /// are collinear, the model is zero and there are no inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segments up to \p max_planes planes with RANSAC.
+    ///
+    /// Planes are segmented one after the other as by SegmentPlane, each
+    /// among the points that are not inliers of a previous plane. The points
+    /// are never copied. Stops early if fewer than \p ransac_n points remain
+    /// or a plane has fewer than \p ransac_n inliers.
+    ///
+    /// \return Returns the plane models and the indices of their inliers,
+    /// in the order in which they are segmented.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const size_t max_planes,
+                  const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
@@ -24,89 +24,353 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <atomic>
+#include <climits>
+#include <mutex>
+#include <numeric>
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Disjoint sets that can be merged from several threads at once. A root is
+/// always linked below a smaller root, so concurrent links cannot form
+/// cycles.
+class ConcurrentDisjointSets {
+public:
+    explicit ConcurrentDisjointSets(int size) : parents_(size) {
+        for (int i = 0; i < size; ++i) {
+            parents_[i] = i;
+        }
+    }
+
+    int Find(int x) {
+        while (true) {
+            int parent = parents_[x].load();
+            if (parent == x) {
+                return x;
+            }
+            // Path halving.
+            int grandparent = parents_[parent].load();
+            if (grandparent != parent) {
+                parents_[x].compare_exchange_weak(parent, grandparent);
+            }
+            x = grandparent;
+        }
+    }
+
+    void Union(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            int expected = a;
+            if (parents_[a].compare_exchange_strong(expected, b)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+/// The points sorted into cubic cells whose diagonal is shorter than eps, so
+/// that all points of a cell are neighbors of each other.
+struct DBSCANGrid {
+    DBSCANGrid(const std::vector<Eigen::Vector3d> &points, double eps)
+        : eps2_(eps * eps) {
+        // Slightly smaller than eps / sqrt(3), so that rounding cannot put
+        // two points eps apart into one cell.
+        const double cell_size = eps / std::sqrt(3.0) * (1.0 - 1e-6);
+        const int num_points = int(points.size());
+        Eigen::Vector3d min_bound = ComputeMinBound(points);
+        Eigen::Vector3d max_bound = ComputeMaxBound(points);
+        if (((max_bound - min_bound) / cell_size).maxCoeff() >= INT_MAX) {
+            utility::LogError(
+                    "eps {} is too small for the extent of the point cloud.",
+                    eps);
+        }
+        std::vector<Eigen::Vector3i> point_cells(num_points);
+        core::ParallelFor(num_points, [&](int i) {
+            point_cells[i] = ((points[i] - min_bound) / cell_size)
+                                     .array()
+                                     .floor()
+                                     .cast<int>();
+        });
+
+        indices_.resize(num_points);
+        std::iota(indices_.begin(), indices_.end(), 0);
+        tbb::parallel_sort(indices_.begin(), indices_.end(),
+                           [&](int a, int b) {
+                               return std::tie(point_cells[a](0),
+                                               point_cells[a](1),
+                                               point_cells[a](2), a) <
+                                      std::tie(point_cells[b](0),
+                                               point_cells[b](1),
+                                               point_cells[b](2), b);
+                           });
+        points_.resize(num_points);
+        core::ParallelFor(num_points,
+                          [&](int i) { points_[i] = points[indices_[i]]; });
+        for (int i = 0; i < num_points; ++i) {
+            const Eigen::Vector3i &cell = point_cells[indices_[i]];
+            if (cells_.empty() || cells_.back() != cell) {
+                cells_.push_back(cell);
+                cell_begins_.push_back(i);
+            }
+        }
+        cell_begins_.push_back(num_points);
+
+        // Offsets of the cells that can hold points closer than eps.
+        for (int dx = -2; dx <= 2; ++dx) {
+            for (int dy = -2; dy <= 2; ++dy) {
+                for (int dz = -2; dz <= 2; ++dz) {
+                    Eigen::Vector3d gap(std::max(std::abs(dx) - 1, 0),
+                                        std::max(std::abs(dy) - 1, 0),
+                                        std::max(std::abs(dz) - 1, 0));
+                    neighbor_offsets_[dx + 2][dy + 2][dz + 2] =
+                            (gap * cell_size).squaredNorm() < eps2_;
+                }
+            }
+        }
+    }
+
+    int NumCells() const { return int(cells_.size()); }
+
+    int CellSize(int c) const { return cell_begins_[c + 1] - cell_begins_[c]; }
+
+    /// Calls \p func(nb) for each cell nb, including \p c, that can hold
+    /// neighbors of the points of \p c, until \p func returns false.
+    template <typename Func>
+    void ForEachNeighborCell(int c, Func func) const {
+        const Eigen::Vector3i &cell = cells_[c];
+        for (int dx = -2; dx <= 2; ++dx) {
+            for (int dy = -2; dy <= 2; ++dy) {
+                // Cells with the same x and y are sorted by z.
+                Eigen::Vector3i first(cell(0) + dx, cell(1) + dy, cell(2) - 2);
+                auto it = std::lower_bound(
+                        cells_.begin(), cells_.end(), first,
+                        [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                            return std::tie(a(0), a(1), a(2)) <
+                                   std::tie(b(0), b(1), b(2));
+                        });
+                for (; it != cells_.end() && (*it)(0) == first(0) &&
+                       (*it)(1) == first(1) && (*it)(2) <= cell(2) + 2;
+                     ++it) {
+                    int dz = (*it)(2) - cell(2);
+                    if (neighbor_offsets_[dx + 2][dy + 2][dz + 2] &&
+                        !func(int(it - cells_.begin()))) {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+    /// Returns true if point \p i is closer than eps to one of the points
+    /// of cell \p c for which \p filter is true.
+    template <typename Filter>
+    bool HasNeighborInCell(int i, int c, Filter filter) const {
+        for (int j = cell_begins_[c]; j < cell_begins_[c + 1]; ++j) {
+            if (filter(j) && (points_[i] - points_[j]).squaredNorm() < eps2_) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    double eps2_;
+    /// Points sorted by cell, and their indices in the point cloud.
+    std::vector<Eigen::Vector3d> points_;
+    std::vector<int> indices_;
+    /// Integer coordinates of the non-empty cells in lexicographic order,
+    /// and the first sorted point of each cell.
+    std::vector<Eigen::Vector3i> cells_;
+    std::vector<int> cell_begins_;
+    bool neighbor_offsets_[5][5][5];
+
+private:
+    static Eigen::Vector3d ComputeMinBound(
+            const std::vector<Eigen::Vector3d> &points) {
+        return std::accumulate(
+                points.begin(), points.end(), points[0],
+                [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                    return a.cwiseMin(b);
+                });
+    }
+
+    static Eigen::Vector3d ComputeMaxBound(
+            const std::vector<Eigen::Vector3d> &points) {
+        return std::accumulate(
+                points.begin(), points.end(), points[0],
+                [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                    return a.cwiseMax(b);
+                });
+    }
+};
+
+}  // namespace
+
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
                                            bool print_progress) const {
-    KDTreeFlann kdtree(*this);
-
-    // Precompute all neighbors.
-    utility::LogDebug("Precompute neighbors.");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute neighbors.", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
-
-#pragma omp critical
-        { ++progress_bar; }
+    const int num_points = int(points_.size());
+    if (num_points == 0) {
+        return {};
+    }
+    if (eps <= 0) {
+        // No point has a neighbor other than itself.
+        std::vector<int> labels(num_points, -1);
+        if (min_points == 0) {
+            std::iota(labels.begin(), labels.end(), 0);
+        }
+        return labels;
     }
-    utility::LogDebug("Done Precompute neighbors.");
 
-    // Set all labels to undefined (-2).
-    utility::LogDebug("Compute Clusters");
-    progress_bar.Reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        // Label is not undefined.
-        if (labels[idx] != -2) {
-            continue;
-        }
-
-        // Check density.
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
-        }
-
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            // Noise label.
-            if (labels[nb] == -1) {
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            // Not undefined label.
-            if (labels[nb] != -2) {
-                continue;
-            }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+    utility::LogDebug("Sort points into cells.");
+    DBSCANGrid grid(points_, eps);
+    const int num_cells = grid.NumCells();
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+    // A point is a core point if it has at least min_points neighbors,
+    // itself included. Counting stops there, and all points of a cell are
+    // neighbors of each other.
+    utility::LogDebug("Find core points.");
+    utility::ConsoleProgressBar progress_bar(num_points, "Find core points",
+                                             print_progress);
+    std::mutex progress_mutex;
+    int progress = 0;
+    std::vector<uint8_t> is_core(num_points, 0);
+    core::ParallelFor(num_cells, [&](int c) {
+        const int begin = grid.cell_begins_[c];
+        const int end = grid.cell_begins_[c + 1];
+        for (int i = begin; i < end; ++i) {
+            size_t count = size_t(end - begin);
+            grid.ForEachNeighborCell(c, [&](int nb) {
+                if (nb == c) return count < min_points;
+                for (int j = grid.cell_begins_[nb];
+                     j < grid.cell_begins_[nb + 1] && count < min_points; ++j) {
+                    if ((grid.points_[i] - grid.points_[j]).squaredNorm() <
+                        grid.eps2_) {
+                        ++count;
                     }
                 }
+                return count < min_points;
+            });
+            is_core[i] = count >= min_points;
+        }
+        std::lock_guard<std::mutex> lock(progress_mutex);
+        progress += end - begin;
+        progress_bar.SetCurrentCount(progress);
+    });
+
+    // The core points of a cell belong to one cluster. Two cells are merged
+    // if they have core points closer than eps.
+    utility::LogDebug("Merge cells.");
+    std::vector<uint8_t> is_core_cell(num_cells, 0);
+    core::ParallelFor(num_cells, [&](int c) {
+        for (int i = grid.cell_begins_[c]; i < grid.cell_begins_[c + 1]; ++i) {
+            if (is_core[i]) {
+                is_core_cell[c] = 1;
+                break;
             }
         }
+    });
+    ConcurrentDisjointSets cell_sets(num_cells);
+    auto is_core_point = [&](int j) { return is_core[j] != 0; };
+    core::ParallelFor(num_cells, [&](int c) {
+        if (!is_core_cell[c]) return;
+        grid.ForEachNeighborCell(c, [&](int nb) {
+            if (nb <= c || !is_core_cell[nb] ||
+                cell_sets.Find(c) == cell_sets.Find(nb)) {
+                return true;
+            }
+            for (int i = grid.cell_begins_[c]; i < grid.cell_begins_[c + 1];
+                 ++i) {
+                if (is_core[i] &&
+                    grid.HasNeighborInCell(i, nb, is_core_point)) {
+                    cell_sets.Union(c, nb);
+                    break;
+                }
+            }
+            return true;
+        });
+    });
 
-        cluster_label++;
+    // Number the clusters by their smallest core point index, which is the
+    // order in which a sequential DBSCAN discovers them.
+    std::vector<int> cell_min_index(num_cells, INT_MAX);
+    core::ParallelFor(num_cells, [&](int c) {
+        for (int i = grid.cell_begins_[c]; i < grid.cell_begins_[c + 1]; ++i) {
+            if (is_core[i]) {
+                cell_min_index[c] =
+                        std::min(cell_min_index[c], grid.indices_[i]);
+            }
+        }
+    });
+    std::vector<int> root_min_index(num_cells, INT_MAX);
+    for (int c = 0; c < num_cells; ++c) {
+        if (is_core_cell[c]) {
+            int &min_index = root_min_index[cell_sets.Find(c)];
+            min_index = std::min(min_index, cell_min_index[c]);
+        }
+    }
+    std::vector<std::pair<int, int>> clusters;
+    for (int c = 0; c < num_cells; ++c) {
+        if (root_min_index[c] != INT_MAX) {
+            clusters.emplace_back(root_min_index[c], c);
+        }
     }
+    std::sort(clusters.begin(), clusters.end());
+    std::vector<int> root_labels(num_cells, -1);
+    for (int label = 0; label < int(clusters.size()); ++label) {
+        root_labels[clusters[label].second] = label;
+    }
+    std::vector<int> cell_labels(num_cells, -1);
+    core::ParallelFor(num_cells, [&](int c) {
+        if (is_core_cell[c]) {
+            cell_labels[c] = root_labels[cell_sets.Find(c)];
+        }
+    });
+
+    // Core points take the label of their cell. A border point takes the
+    // smallest label of the core points closer than eps, like the cluster
+    // that reaches it first in a sequential DBSCAN; other points are noise.
+    utility::LogDebug("Compute Clusters");
+    std::vector<int> labels(num_points, -1);
+    core::ParallelFor(num_cells, [&](int c) {
+        for (int i = grid.cell_begins_[c]; i < grid.cell_begins_[c + 1]; ++i) {
+            int &label = labels[grid.indices_[i]];
+            if (is_core[i]) {
+                label = cell_labels[c];
+                continue;
+            }
+            grid.ForEachNeighborCell(c, [&](int nb) {
+                if (cell_labels[nb] >= 0 &&
+                    (label < 0 || cell_labels[nb] < label) &&
+                    grid.HasNeighborInCell(i, nb, is_core_point)) {
+                    label = cell_labels[nb];
+                }
+                return true;
+            });
+        }
+    });
 
-    utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
+    utility::LogDebug("Done Compute Clusters: {:d}", clusters.size());
     return labels;
 }
 
@@ -29,8 +29,8 @@
 #include <iterator>
 #include <numeric>
 #include <random>
-#include <unordered_set>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
@@ -51,34 +51,62 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
+namespace {
+
+/// Number of hypotheses generated and scored together.
+constexpr int kRANSACBatchSize = 64;
+/// Hypotheses of a batch are compared on this many random points, and the
+/// worse half is dropped after every block of them, so that only the best
+/// hypothesis of the batch is scored on all points. Smaller point sets are
+/// scored completely.
+constexpr size_t kPreemptiveSampleSize = 4096;
+constexpr size_t kPreemptiveBlockSize = 512;
+
+}  // namespace
+
+// Calculates the number of inliers among points[candidates] given a plane
+// model, and the total distance between the inliers and the plane. These
+// numbers are then used to evaluate how well the plane model fits the given
+// points. The points are scored in parallel if \p parallel is true.
 RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &candidates,
         const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
         double distance_threshold,
-        double error) {
-    RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            error += distance;
-            inliers.emplace_back(idx);
+        bool parallel) {
+    const int64_t num_candidates = int64_t(candidates.size());
+    const int64_t num_chunks =
+            parallel ? std::min<int64_t>(core::GetNumThreads() * 4,
+                                         num_candidates)
+                     : 1;
+    std::vector<size_t> chunk_inliers(num_chunks, 0);
+    std::vector<double> chunk_errors(num_chunks, 0);
+    auto evaluate_chunk = [&](int64_t chunk) {
+        int64_t begin = num_candidates * chunk / num_chunks;
+        int64_t end = num_candidates * (chunk + 1) / num_chunks;
+        for (int64_t i = begin; i < end; ++i) {
+            const Eigen::Vector3d &point = points[candidates[i]];
+            double distance = std::abs(plane_model.head<3>().dot(point) +
+                                       plane_model(3));
+            if (distance < distance_threshold) {
+                chunk_errors[chunk] += distance;
+                ++chunk_inliers[chunk];
+            }
         }
+    };
+    if (parallel) {
+        core::ParallelFor(num_chunks, evaluate_chunk);
+    } else {
+        evaluate_chunk(0);
     }
 
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
+    size_t inlier_num = std::accumulate(chunk_inliers.begin(),
+                                        chunk_inliers.end(), size_t(0));
+    double error = std::accumulate(chunk_errors.begin(), chunk_errors.end(),
+                                   0.0);
+    RANSACResult result;
+    if (inlier_num > 0) {
+        result.fitness_ = (double)inlier_num / (double)num_candidates;
         result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
     }
     return result;
@@ -132,87 +160,222 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
-
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
-
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
-
-    std::random_device rd;
-    std::mt19937 rng(rd());
+// Segments the best plane among points[candidates] with RANSAC. Returns the
+// indices of its inliers in points.
+static std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &candidates,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        std::mt19937 &rng) {
+    const size_t num_candidates = candidates.size();
+    std::uniform_int_distribution<size_t> random_candidate(
+            0, num_candidates - 1);
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
+    // Random points on which the hypotheses of a batch are compared.
+    std::vector<size_t> preemptive_sample;
+    if (num_candidates > kPreemptiveSampleSize) {
+        preemptive_sample.resize(kPreemptiveSampleSize);
+        for (size_t &idx : preemptive_sample) {
+            idx = candidates[random_candidate(rng)];
+        }
     }
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
+    RANSACResult result;
+    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+    int max_iteration = num_iterations;
+    std::vector<Eigen::Vector4d> plane_models;
+    for (int itr = 0; itr < max_iteration; itr += kRANSACBatchSize) {
+        // Fit models to ransac_n distinct randomly selected points. The
+        // first three points define the plane.
+        plane_models.clear();
+        int batch_size = std::min(kRANSACBatchSize, max_iteration - itr);
+        for (int i = 0; i < batch_size; ++i) {
+            size_t sample[3];
+            for (int j = 0; j < 3; ++j) {
+                do {
+                    sample[j] = candidates[random_candidate(rng)];
+                } while (std::find(sample, sample + j, sample[j]) !=
+                         sample + j);
+            }
+            Eigen::Vector4d plane_model = TriangleMesh::ComputeTrianglePlane(
+                    points[sample[0]], points[sample[1]], points[sample[2]]);
+            if (!plane_model.isZero(0)) {
+                plane_models.push_back(plane_model);
+            }
         }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
+        if (plane_models.empty()) {
+            continue;
         }
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+        // Preemptive scoring: all hypotheses are scored on a block of the
+        // sample, then the better half on the next block, and so on.
+        if (!preemptive_sample.empty()) {
+            std::vector<size_t> scores(plane_models.size(), 0);
+            std::vector<size_t> order(plane_models.size());
+            std::iota(order.begin(), order.end(), 0);
+            for (size_t begin = 0;
+                 begin < preemptive_sample.size() && order.size() > 1;
+                 begin += kPreemptiveBlockSize) {
+                size_t end = std::min(begin + kPreemptiveBlockSize,
+                                      preemptive_sample.size());
+                core::ParallelFor(int64_t(order.size()), [&](int64_t i) {
+                    const Eigen::Vector4d &plane_model =
+                            plane_models[order[i]];
+                    for (size_t j = begin; j < end; ++j) {
+                        const Eigen::Vector3d &point =
+                                points[preemptive_sample[j]];
+                        if (std::abs(plane_model.head<3>().dot(point) +
+                                     plane_model(3)) < distance_threshold) {
+                            ++scores[order[i]];
+                        }
+                    }
+                });
+                std::stable_sort(order.begin(), order.end(),
+                                 [&](size_t a, size_t b) {
+                                     return scores[a] > scores[b];
+                                 });
+                order.resize((order.size() + 1) / 2);
+            }
+            plane_models = {plane_models[order[0]]};
         }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+        // Score the remaining hypotheses on all points, in parallel over
+        // the points for a single hypothesis and over the hypotheses
+        // otherwise.
+        std::vector<RANSACResult> results(plane_models.size());
+        if (plane_models.size() == 1) {
+            results[0] = EvaluateRANSACBasedOnDistance(
+                    points, candidates, plane_models[0], distance_threshold,
+                    true);
+        } else {
+            core::ParallelFor(int64_t(plane_models.size()), [&](int64_t i) {
+                results[i] = EvaluateRANSACBasedOnDistance(
+                        points, candidates, plane_models[i],
+                        distance_threshold, false);
+            });
         }
+        for (size_t i = 0; i < plane_models.size(); ++i) {
+            if (results[i].fitness_ > result.fitness_ ||
+                (results[i].fitness_ == result.fitness_ &&
+                 results[i].inlier_rmse_ < result.inlier_rmse_)) {
+                result = results[i];
+                best_plane_model = plane_models[i];
+            }
+        }
+
+        // Stop once a better plane is found with less than 1 - probability
+        // chance, assuming the inlier ratio of the best plane so far.
+        if (result.fitness_ > 0) {
+            double break_iteration =
+                    std::log(1.0 - probability) /
+                    std::log(1.0 - std::pow(result.fitness_, ransac_n));
+            if (break_iteration < max_iteration) {
+                max_iteration = std::max(int(std::ceil(break_iteration)), 1);
+            }
+        }
+    }
+
+    // No hypothesis has been scored, e.g. because the points are collinear.
+    if (result.fitness_ == 0) {
+        utility::LogDebug("RANSAC | No plane found.");
+        return std::make_tuple(best_plane_model, std::vector<size_t>());
     }
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
-                              1);
-        double distance = std::abs(best_plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            inliers.emplace_back(idx);
+    std::vector<uint8_t> is_inlier(num_candidates, 0);
+    core::ParallelFor(int64_t(num_candidates), [&](int64_t i) {
+        const Eigen::Vector3d &point = points[candidates[i]];
+        is_inlier[i] = std::abs(best_plane_model.head<3>().dot(point) +
+                                best_plane_model(3)) < distance_threshold;
+    });
+    std::vector<size_t> inliers;
+    for (size_t i = 0; i < num_candidates; ++i) {
+        if (is_inlier[i]) {
+            inliers.push_back(candidates[i]);
         }
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    if (!inliers.empty()) {
+        best_plane_model = GetPlaneFromPoints(points, inliers);
+    }
 
     utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
                       inliers.size(), result.fitness_, result.inlier_rmse_);
     return std::make_tuple(best_plane_model, inliers);
 }
 
+static void CheckSegmentPlaneParameters(size_t num_points,
+                                        int ransac_n,
+                                        double probability) {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (num_points < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be in (0, 1], but got {}.",
+                          probability);
+    }
+}
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    CheckSegmentPlaneParameters(points_.size(), ransac_n, probability);
+
+    std::vector<size_t> indices(points_.size());
+    std::iota(std::begin(indices), std::end(indices), 0);
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return SegmentPlaneRANSAC(points_, indices, distance_threshold, ransac_n,
+                              num_iterations, probability, rng);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const size_t max_planes,
+                          const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const double probability /* = 0.99999999 */) const {
+    CheckSegmentPlaneParameters(points_.size(), ransac_n, probability);
+
+    // Indices of the points not assigned to a plane yet.
+    std::vector<size_t> remaining(points_.size());
+    std::iota(std::begin(remaining), std::end(remaining), 0);
+    std::vector<uint8_t> assigned(points_.size(), 0);
+    std::random_device rd;
+    std::mt19937 rng(rd());
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    while (planes.size() < max_planes && remaining.size() >= size_t(ransac_n)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) =
+                SegmentPlaneRANSAC(points_, remaining, distance_threshold,
+                                   ransac_n, num_iterations, probability, rng);
+        if (inliers.size() < size_t(ransac_n)) {
+            break;
+        }
+        for (size_t idx : inliers) {
+            assigned[idx] = 1;
+        }
+        remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                       [&](size_t idx) {
+                                           return assigned[idx] != 0;
+                                       }),
+                        remaining.end());
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -27,11 +27,13 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
+#include <mutex>
 #include <numeric>
 #include <queue>
 #include <random>
 #include <tuple>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -939,11 +941,10 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     // precompute all neighbours
     utility::LogDebug("Precompute Neighbours");
     std::vector<std::vector<int>> nbs(vertices_.size());
-#pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(vertices_.size()); ++idx) {
+    core::ParallelFor(int(vertices_.size()), [&](int idx) {
         std::vector<double> dists2;
         kdtree.SearchRadius(vertices_[idx], eps, nbs[idx], dists2);
-    }
+    });
     utility::LogDebug("Done Precompute Neighbours");
 
     bool has_vertex_normals = HasVertexNormals();
@@ -1234,10 +1235,15 @@ double TriangleMesh::GetVolume() const {
 
     double volume = 0;
     int64_t num_triangles = triangles_.size();
-#pragma omp parallel for reduction(+ : volume)
-    for (int64_t tidx = 0; tidx < num_triangles; ++tidx) {
-        volume += GetSignedVolumeOfTriangle(tidx);
-    }
+    std::mutex volume_mutex;
+    core::ParallelForRange(num_triangles, [&](int64_t begin, int64_t end) {
+        double partial_volume = 0;
+        for (int64_t tidx = begin; tidx < end; ++tidx) {
+            partial_volume += GetSignedVolumeOfTriangle(tidx);
+        }
+        std::lock_guard<std::mutex> lock(volume_mutex);
+        volume += partial_volume;
+    });
     return std::abs(volume);
 }
 
@@ -1439,8 +1445,7 @@ TriangleMesh::ClusterConnectedTriangles() const {
     utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
     auto edges_to_triangles = GetEdgeToTrianglesMap();
     std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#pragma omp parallel for schedule(static)
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+    core::ParallelFor(int(triangles_.size()), [&](int tidx) {
         const auto &triangle = triangles_[tidx];
         for (auto tnb :
              edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
@@ -1454,7 +1459,7 @@ TriangleMesh::ClusterConnectedTriangles() const {
              edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
             adjacency_list[tidx].insert(tnb);
         }
-    }
+    });
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done computing triangle adjacency");
 
@@ -28,6 +28,7 @@
 #include <Eigen/Sparse>
 #include <algorithm>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
 
@@ -112,8 +113,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             std::swap(Rs, Rs_old);
         }
 
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        core::ParallelFor(int(vertices_.size()), [&](int i) {
             // Update rotations
             Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
             Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
@@ -146,10 +146,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
                         "[DeformAsRigidAsPossible] something went wrong with "
                         "updating R");
             }
-        }
+        });
 
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        core::ParallelFor(int(vertices_.size()), [&](int i) {
             // Update Positions
             Eigen::Vector3d bi(0, 0, 0);
             if (constraints.count(i) > 0) {
@@ -164,9 +163,8 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             b[0](i) = bi(0);
             b[1](i) = bi(1);
             b[2](i) = bi(2);
-        }
-#pragma omp parallel for schedule(static)
-        for (int comp = 0; comp < 3; ++comp) {
+        });
+        core::ParallelFor(3, [&](int comp) {
             Eigen::VectorXd p_prime = solver.solve(b[comp]);
             if (solver.info() != Eigen::Success) {
                 utility::LogError(
@@ -175,7 +173,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
             for (int i = 0; i < int(vertices_.size()); ++i) {
                 prime->vertices_[i](comp) = p_prime(i);
             }
-        }
+        });
 
         // Compute energy and log
         double energy = 0;
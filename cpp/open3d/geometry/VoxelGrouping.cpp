@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/VoxelGrouping.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+namespace open3d {
+namespace geometry {
+
+VoxelGrouping::VoxelGrouping(const Eigen::Vector3d *points,
+                             int64_t num_points,
+                             double voxel_size,
+                             const Eigen::Vector3d &origin)
+    : points_(points), voxel_size_(voxel_size), origin_(origin) {
+    if (voxel_size <= 0.0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    std::vector<Eigen::Vector3i> point_voxels(num_points);
+    std::atomic<bool> in_range(true);
+    core::ParallelFor(num_points, [&](int64_t i) {
+        Eigen::Vector3d voxel =
+                ((points[i] - origin) / voxel_size).array().floor();
+        if ((voxel.array().abs() >= std::numeric_limits<int>::max()).any()) {
+            in_range = false;
+            return;
+        }
+        point_voxels[i] = voxel.cast<int>();
+    });
+    if (!in_range) {
+        utility::LogError("voxel_size is too small.");
+    }
+
+    point_indices_.resize(num_points);
+    std::iota(point_indices_.begin(), point_indices_.end(), 0);
+    tbb::parallel_sort(point_indices_.begin(), point_indices_.end(),
+                       [&](int64_t a, int64_t b) {
+                           const Eigen::Vector3i &va = point_voxels[a];
+                           const Eigen::Vector3i &vb = point_voxels[b];
+                           return std::tie(va(0), va(1), va(2), a) <
+                                  std::tie(vb(0), vb(1), vb(2), b);
+                       });
+    for (int64_t i = 0; i < num_points; ++i) {
+        const Eigen::Vector3i &voxel = point_voxels[point_indices_[i]];
+        if (voxels_.empty() || voxels_.back() != voxel) {
+            voxels_.push_back(voxel);
+            voxel_begins_.push_back(i);
+        }
+    }
+    voxel_begins_.push_back(num_points);
+}
+
+std::vector<int64_t> VoxelGrouping::SelectPoints(
+        VoxelReduction reduction) const {
+    std::vector<int64_t> selected(GetNumVoxels());
+    if (reduction == VoxelReduction::First) {
+        core::ParallelFor(GetNumVoxels(), [&](int64_t v) {
+            selected[v] = point_indices_[voxel_begins_[v]];
+        });
+    } else if (reduction == VoxelReduction::ClosestToCenter) {
+        core::ParallelFor(GetNumVoxels(), [&](int64_t v) {
+            Eigen::Vector3d center =
+                    origin_ + (voxels_[v].cast<double>() +
+                               Eigen::Vector3d::Constant(0.5)) *
+                                      voxel_size_;
+            double min_distance2 = std::numeric_limits<double>::infinity();
+            for (int64_t i = voxel_begins_[v]; i < voxel_begins_[v + 1]; ++i) {
+                double distance2 =
+                        (points_[point_indices_[i]] - center).squaredNorm();
+                if (distance2 < min_distance2) {
+                    min_distance2 = distance2;
+                    selected[v] = point_indices_[i];
+                }
+            }
+        });
+    } else {
+        utility::LogError(
+                "SelectPoints only supports First and ClosestToCenter.");
+    }
+    return selected;
+}
+
+}  // namespace geometry
+}  // namespace open3d
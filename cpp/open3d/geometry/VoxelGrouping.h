@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \enum VoxelReduction
+///
+/// \brief How the points of a voxel are reduced to one point.
+enum class VoxelReduction {
+    /// Mean of each attribute.
+    Mean,
+    /// Attributes of the point with the smallest index.
+    First,
+    /// Attributes of the point closest to the center of the voxel.
+    ClosestToCenter,
+    /// Median of each component of each attribute.
+    Median,
+};
+
+/// \class VoxelGrouping
+///
+/// \brief Groups points by the voxel that contains them.
+///
+/// The point indices are sorted by voxel coordinates in parallel, so that the
+/// points of each voxel are contiguous and the voxels can be reduced in
+/// parallel without a hash map.
+class VoxelGrouping {
+public:
+    /// \param points Points to group, \p num_points contiguous vectors.
+    /// \param voxel_size Edge length of the voxels.
+    /// \param origin Corner of the voxel with coordinates (0, 0, 0).
+    VoxelGrouping(const Eigen::Vector3d *points,
+                  int64_t num_points,
+                  double voxel_size,
+                  const Eigen::Vector3d &origin);
+
+    int64_t GetNumVoxels() const { return int64_t(voxels_.size()); }
+
+    /// Returns the number of points in voxel \p v.
+    int64_t GetNumPoints(int64_t v) const {
+        return voxel_begins_[v + 1] - voxel_begins_[v];
+    }
+
+    /// Returns for each voxel the index of the point selected by
+    /// \p reduction, which must be First or ClosestToCenter.
+    std::vector<int64_t> SelectPoints(VoxelReduction reduction) const;
+
+    /// Reduces the rows of \p values, num_points x \p num_columns values,
+    /// with \p reduction, which must be Mean or Median. \p reduced receives
+    /// GetNumVoxels() rows. Integer results are rounded. A row with a NaN
+    /// value adds nothing to a mean, but still counts as a point.
+    template <typename T>
+    void Reduce(VoxelReduction reduction,
+                const T *values,
+                int64_t num_columns,
+                T *reduced) const;
+
+    /// Integer coordinates of the voxels, in lexicographic order.
+    std::vector<Eigen::Vector3i> voxels_;
+    /// Point indices sorted by voxel, in increasing order within a voxel.
+    std::vector<int64_t> point_indices_;
+    /// The points of voxel v are point_indices_[voxel_begins_[v]] to
+    /// point_indices_[voxel_begins_[v + 1] - 1].
+    std::vector<int64_t> voxel_begins_;
+
+private:
+    const Eigen::Vector3d *points_;
+    double voxel_size_;
+    Eigen::Vector3d origin_;
+};
+
+template <typename T>
+void VoxelGrouping::Reduce(VoxelReduction reduction,
+                           const T *values,
+                           int64_t num_columns,
+                           T *reduced) const {
+    auto round = [](double value) {
+        return std::is_integral<T>::value ? T(std::round(value)) : T(value);
+    };
+    if (reduction == VoxelReduction::Mean) {
+        core::ParallelFor(GetNumVoxels(), [&](int64_t v) {
+            std::vector<double> sum(num_columns, 0.0);
+            for (int64_t i = voxel_begins_[v]; i < voxel_begins_[v + 1]; ++i) {
+                const T *row = values + point_indices_[i] * num_columns;
+                if (std::any_of(row, row + num_columns,
+                                [](T x) { return std::isnan(double(x)); })) {
+                    continue;
+                }
+                for (int64_t c = 0; c < num_columns; ++c) {
+                    sum[c] += double(row[c]);
+                }
+            }
+            for (int64_t c = 0; c < num_columns; ++c) {
+                reduced[v * num_columns + c] =
+                        round(sum[c] / double(GetNumPoints(v)));
+            }
+        });
+    } else if (reduction == VoxelReduction::Median) {
+        core::ParallelFor(GetNumVoxels(), [&](int64_t v) {
+            const int64_t n = GetNumPoints(v);
+            std::vector<T> column(n);
+            for (int64_t c = 0; c < num_columns; ++c) {
+                for (int64_t i = 0; i < n; ++i) {
+                    column[i] = values[point_indices_[voxel_begins_[v] + i] *
+                                               num_columns +
+                                       c];
+                }
+                auto middle = column.begin() + n / 2;
+                std::nth_element(column.begin(), middle, column.end());
+                double median = double(*middle);
+                if (n % 2 == 0) {
+                    median = 0.5 * (median +
+                                    double(*std::max_element(column.begin(),
+                                                             middle)));
+                }
+                reduced[v * num_columns + c] = round(median);
+            }
+        });
+    } else {
+        utility::LogError("Reduce only supports Mean and Median.");
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/io/LZFCompression.h"
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+
+namespace open3d {
+namespace io {
+
+int64_t WriteLZFStream(FILE *file,
+                       int64_t size,
+                       const LZFFillFunction &fill,
+                       int64_t chunk_size) {
+    if (size < 0 || chunk_size <= 0 ||
+        chunk_size > std::numeric_limits<unsigned int>::max() / 2) {
+        return -1;
+    }
+    // lzf_compress writes at most 104% of the input.
+    const int64_t max_compressed_size = chunk_size + chunk_size / 16 + 64;
+    const int64_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    const int64_t batch_size =
+            std::min<int64_t>(num_chunks, 2 * core::GetNumThreads());
+
+    std::vector<std::unique_ptr<uint8_t[]>> staging(batch_size);
+    std::vector<std::unique_ptr<uint8_t[]>> compressed(batch_size);
+    std::vector<int64_t> compressed_sizes(batch_size);
+    for (int64_t b = 0; b < batch_size; ++b) {
+        staging[b].reset(new uint8_t[chunk_size]);
+        compressed[b].reset(new uint8_t[max_compressed_size]);
+    }
+
+    int64_t total_compressed_size = 0;
+    for (int64_t first = 0; first < num_chunks; first += batch_size) {
+        const int64_t num_batch_chunks =
+                std::min(batch_size, num_chunks - first);
+        core::ParallelFor(num_batch_chunks, [&](int64_t b) {
+            const int64_t offset = (first + b) * chunk_size;
+            const int64_t length = std::min(chunk_size, size - offset);
+            fill(offset, length, staging[b].get());
+            compressed_sizes[b] = lzf_compress(
+                    staging[b].get(), static_cast<unsigned int>(length),
+                    compressed[b].get(),
+                    static_cast<unsigned int>(max_compressed_size));
+        });
+        for (int64_t b = 0; b < num_batch_chunks; ++b) {
+            if (compressed_sizes[b] == 0 ||
+                fwrite(compressed[b].get(), 1, compressed_sizes[b], file) !=
+                        static_cast<size_t>(compressed_sizes[b])) {
+                return -1;
+            }
+            total_compressed_size += compressed_sizes[b];
+        }
+    }
+    return total_compressed_size;
+}
+
+bool DecompressLZF(const uint8_t *src,
+                   int64_t src_size,
+                   uint8_t *dst,
+                   int64_t dst_size) {
+    if (src_size < 0 || dst_size < 0 ||
+        src_size > std::numeric_limits<unsigned int>::max() ||
+        dst_size > std::numeric_limits<unsigned int>::max()) {
+        return false;
+    }
+    if (dst_size == 0) {
+        return true;
+    }
+    return lzf_decompress(src, static_cast<unsigned int>(src_size), dst,
+                          static_cast<unsigned int>(dst_size)) ==
+           static_cast<unsigned int>(dst_size);
+}
+
+}  // namespace io
+}  // namespace open3d
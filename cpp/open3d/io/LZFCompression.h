@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+
+namespace open3d {
+namespace io {
+
+/// Writes bytes [\p offset, \p offset + \p size) of the uncompressed data to
+/// \p dst. Called concurrently for disjoint ranges.
+using LZFFillFunction =
+        std::function<void(int64_t offset, int64_t size, uint8_t *dst)>;
+
+/// Compresses the \p size bytes produced by \p fill and writes them to
+/// \p file as a single LZF stream.
+///
+/// The data is split into chunks of \p chunk_size bytes that are filled and
+/// compressed in parallel and written in order. LZF back-references never
+/// reach outside the chunk they were produced for, so the concatenated
+/// chunks form a valid LZF stream that lzf_decompress reads in one call.
+/// Only a few chunks per thread are staged at any time.
+///
+/// \return The number of compressed bytes written, or -1 on failure.
+int64_t WriteLZFStream(FILE *file,
+                       int64_t size,
+                       const LZFFillFunction &fill,
+                       int64_t chunk_size = 1 << 20);
+
+/// Decompresses the LZF stream [\p src, \p src + \p src_size) into exactly
+/// \p dst_size bytes at \p dst.
+bool DecompressLZF(const uint8_t *src,
+                   int64_t src_size,
+                   uint8_t *dst,
+                   int64_t dst_size);
+
+}  // namespace io
+}  // namespace open3d
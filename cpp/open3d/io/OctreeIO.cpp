@@ -26,6 +26,9 @@
 
 #include "open3d/io/OctreeIO.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <unordered_map>
 
 #include "open3d/io/IJsonConvertibleIO.h"
@@ -109,5 +112,191 @@ bool WriteOctreeToJson(const std::string &filename,
                        const geometry::Octree &octree) {
     return WriteIJsonConvertibleToJSON(filename, octree);
 }
+
+namespace {
+
+constexpr char kLinearOctreeMagic[8] = {'O', '3', 'D', 'L', 'O', 'C', 'T', '1'};
+
+template <typename T>
+bool WriteArray(FILE *file, const std::vector<T> &array) {
+    uint64_t size = array.size();
+    return fwrite(&size, sizeof(size), 1, file) == 1 &&
+           fwrite(array.data(), sizeof(T), array.size(), file) ==
+                   array.size();
+}
+
+/// Reads an array whose size is checked against the \p file_size bytes of
+/// the file before allocating it.
+template <typename T>
+bool ReadArray(FILE *file, int64_t file_size, std::vector<T> &array) {
+    uint64_t size;
+    if (fread(&size, sizeof(size), 1, file) != 1) {
+        return false;
+    }
+    const int64_t pos = static_cast<int64_t>(ftell(file));
+    if (pos < 0 || pos > file_size ||
+        size > uint64_t(file_size - pos) / sizeof(T)) {
+        return false;
+    }
+    array.resize(size);
+    return fread(array.data(), sizeof(T), size, file) == size;
+}
+
+int CountBits(uint8_t mask) {
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        ++count;
+    }
+    return count;
+}
+
+/// Returns true if the arrays of \p octree are consistent, so that every
+/// query stays within them.
+bool IsValidLinearOctree(const geometry::LinearOctree &octree) {
+    const size_t num_nodes = octree.node_codes_.size();
+    const size_t num_points = octree.points_.size();
+    const size_t max_depth = octree.max_depth_;
+    if (max_depth > geometry::LinearOctree::kMaxDepth ||
+        octree.point_indices_.size() != num_points) {
+        return false;
+    }
+    if (octree.level_offsets_.empty()) {
+        return num_nodes == 0 && octree.node_point_begins_.empty() &&
+               octree.node_point_ends_.empty() &&
+               octree.node_first_children_.empty() &&
+               octree.node_child_masks_.empty() &&
+               octree.leaf_colors_.empty() && num_points == 0;
+    }
+
+    // Every level holds at least one node, and the root is node 0.
+    const std::vector<size_t> &offsets = octree.level_offsets_;
+    if (offsets.size() != max_depth + 2 || offsets[0] != 0 ||
+        offsets[1] != 1 || offsets.back() != num_nodes ||
+        octree.node_point_begins_.size() != num_nodes ||
+        octree.node_point_ends_.size() != num_nodes ||
+        octree.node_first_children_.size() != num_nodes ||
+        octree.node_child_masks_.size() != num_nodes) {
+        return false;
+    }
+    for (size_t depth = 0; depth <= max_depth; ++depth) {
+        if (offsets[depth] >= offsets[depth + 1]) {
+            return false;
+        }
+    }
+    if (octree.leaf_colors_.size() != octree.GetNumNodes(max_depth)) {
+        return false;
+    }
+
+    for (size_t depth = 0; depth <= max_depth; ++depth) {
+        const uint64_t code_end = uint64_t(1) << (3 * depth);
+        for (size_t node = offsets[depth]; node < offsets[depth + 1]; ++node) {
+            // Codes are strictly ascending within a level.
+            const uint64_t code = octree.node_codes_[node];
+            if (code >= code_end || (node > offsets[depth] &&
+                                     octree.node_codes_[node - 1] >= code)) {
+                return false;
+            }
+            if (octree.node_point_begins_[node] >
+                        octree.node_point_ends_[node] ||
+                octree.node_point_ends_[node] > num_points) {
+                return false;
+            }
+            // Leaves are exactly the nodes of the last level, and the
+            // children of a node are in the next level.
+            const int64_t first_child = octree.node_first_children_[node];
+            if (depth == max_depth) {
+                if (first_child >= 0) {
+                    return false;
+                }
+                continue;
+            }
+            const int num_children =
+                    CountBits(octree.node_child_masks_[node]);
+            if (first_child < int64_t(offsets[depth + 1]) ||
+                num_children == 0 ||
+                uint64_t(first_child) + num_children > offsets[depth + 2]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+bool ReadLinearOctree(const std::string &filename,
+                      geometry::LinearOctree &octree) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == nullptr) {
+        utility::LogWarning("Read LinearOctree failed: unable to open file {}",
+                            filename);
+        return false;
+    }
+    octree.Clear();
+    int64_t file_size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        file_size = static_cast<int64_t>(ftell(file));
+    }
+    fseek(file, 0, SEEK_SET);
+    char magic[8];
+    uint64_t max_depth = 0;
+    bool success =
+            fread(magic, sizeof(magic), 1, file) == 1 &&
+            std::equal(magic, magic + 8, kLinearOctreeMagic) &&
+            fread(octree.origin_.data(), sizeof(double), 3, file) == 3 &&
+            fread(&octree.size_, sizeof(double), 1, file) == 1 &&
+            fread(&max_depth, sizeof(max_depth), 1, file) == 1 &&
+            ReadArray(file, file_size, octree.level_offsets_) &&
+            ReadArray(file, file_size, octree.node_codes_) &&
+            ReadArray(file, file_size, octree.node_point_begins_) &&
+            ReadArray(file, file_size, octree.node_point_ends_) &&
+            ReadArray(file, file_size, octree.node_first_children_) &&
+            ReadArray(file, file_size, octree.node_child_masks_) &&
+            ReadArray(file, file_size, octree.leaf_colors_) &&
+            ReadArray(file, file_size, octree.point_indices_) &&
+            ReadArray(file, file_size, octree.points_);
+    fclose(file);
+    octree.max_depth_ = max_depth;
+    success = success && IsValidLinearOctree(octree);
+    if (!success) {
+        utility::LogWarning("Read LinearOctree failed: invalid file {}",
+                            filename);
+        octree.Clear();
+        return false;
+    }
+    return true;
+}
+
+bool WriteLinearOctree(const std::string &filename,
+                       const geometry::LinearOctree &octree) {
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == nullptr) {
+        utility::LogWarning(
+                "Write LinearOctree failed: unable to open file {}", filename);
+        return false;
+    }
+    const uint64_t max_depth = octree.max_depth_;
+    bool success =
+            fwrite(kLinearOctreeMagic, sizeof(kLinearOctreeMagic), 1, file) ==
+                    1 &&
+            fwrite(octree.origin_.data(), sizeof(double), 3, file) == 3 &&
+            fwrite(&octree.size_, sizeof(double), 1, file) == 1 &&
+            fwrite(&max_depth, sizeof(max_depth), 1, file) == 1 &&
+            WriteArray(file, octree.level_offsets_) &&
+            WriteArray(file, octree.node_codes_) &&
+            WriteArray(file, octree.node_point_begins_) &&
+            WriteArray(file, octree.node_point_ends_) &&
+            WriteArray(file, octree.node_first_children_) &&
+            WriteArray(file, octree.node_child_masks_) &&
+            WriteArray(file, octree.leaf_colors_) &&
+            WriteArray(file, octree.point_indices_) &&
+            WriteArray(file, octree.points_);
+    if (fclose(file) != 0 || !success) {
+        utility::LogWarning("Write LinearOctree failed: unable to write {}",
+                            filename);
+        return false;
+    }
+    return true;
+}
 }  // namespace io
 }  // namespace open3d
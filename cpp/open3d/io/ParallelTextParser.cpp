@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/io/ParallelTextParser.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+/// Parses the token at \p pos with strtod.
+bool ParseNumberWithStrtod(const char *&pos, const char *end, double &value) {
+    const char *token_end = pos;
+    while (token_end < end && !IsBlank(*token_end) && *token_end != '\n') {
+        ++token_end;
+    }
+    const std::string token(pos, token_end);
+    char *parsed_end = nullptr;
+    value = std::strtod(token.c_str(), &parsed_end);
+    if (parsed_end == token.c_str()) {
+        return false;
+    }
+    pos += parsed_end - token.c_str();
+    return true;
+}
+
+}  // namespace
+
+bool ParseNumber(const char *&pos, const char *end, double &value) {
+    // Powers of 10 that are exactly representable as doubles.
+    static const double kPowersOf10[] = {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+            1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const uint64_t kMaxExactMantissa = uint64_t(1) << 53;
+
+    while (pos < end && IsBlank(*pos)) {
+        ++pos;
+    }
+    const char *p = pos;
+    bool negative = false;
+    if (p < end && (*p == '+' || *p == '-')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    // Up to 19 significant digits fit in the mantissa.
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    bool truncated = false;
+    while (p < end && IsDigit(*p)) {
+        has_digits = true;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            num_digits += mantissa != 0;
+        } else {
+            ++exponent;
+            truncated |= *p != '0';
+        }
+        ++p;
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        while (p < end && IsDigit(*p)) {
+            has_digits = true;
+            if (num_digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                num_digits += mantissa != 0;
+                --exponent;
+            } else {
+                truncated |= *p != '0';
+            }
+            ++p;
+        }
+    }
+    if (!has_digits || (p < end && (*p == 'x' || *p == 'X'))) {
+        return ParseNumberWithStrtod(pos, end, value);
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool negative_exponent = false;
+        if (q < end && (*q == '+' || *q == '-')) {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+        if (q < end && IsDigit(*q)) {
+            int explicit_exponent = 0;
+            while (q < end && IsDigit(*q)) {
+                explicit_exponent =
+                        std::min(explicit_exponent * 10 + (*q - '0'), 100000);
+                ++q;
+            }
+            exponent += negative_exponent ? -explicit_exponent
+                                          : explicit_exponent;
+            p = q;
+        }
+    }
+
+    // Exact operands give correctly rounded results.
+    if (mantissa == 0 && !truncated) {
+        value = negative ? -0.0 : 0.0;
+    } else if (!truncated && mantissa <= kMaxExactMantissa &&
+               exponent >= -22 && exponent <= 22) {
+        value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / kPowersOf10[-exponent]
+                             : value * kPowersOf10[exponent];
+        value = negative ? -value : value;
+    } else {
+        return ParseNumberWithStrtod(pos, end, value);
+    }
+    pos = p;
+    return true;
+}
+
+bool SkipToken(const char *&pos, const char *end) {
+    while (pos < end && IsBlank(*pos)) {
+        ++pos;
+    }
+    const char *begin = pos;
+    while (pos < end && !IsBlank(*pos) && *pos != '\n') {
+        ++pos;
+    }
+    return pos != begin;
+}
+
+std::vector<const char *> SplitTextAtLines(const char *begin,
+                                           const char *end,
+                                           int64_t range_size) {
+    std::vector<const char *> bounds = {begin};
+    while (end - bounds.back() > range_size) {
+        const char *target = bounds.back() + range_size;
+        const char *line_break = static_cast<const char *>(
+                std::memchr(target, '\n', end - target));
+        if (!line_break || line_break + 1 >= end) {
+            break;
+        }
+        bounds.push_back(line_break + 1);
+    }
+    bounds.push_back(end);
+    return bounds;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+
+namespace open3d {
+namespace io {
+
+/// Parses a decimal floating point number at \p pos, after skipping blanks,
+/// without reading past \p end. Unlike strtod, the common case does not
+/// depend on the locale: the decimal point is always '.'. Values with more
+/// than 19 significant digits or very large exponents, hexadecimal numbers,
+/// "inf" and "nan" fall back to strtod.
+/// \return true and advances \p pos past the number if there is one.
+bool ParseNumber(const char *&pos, const char *end, double &value);
+
+/// Advances \p pos past the next blank-separated token.
+/// \return false if there is no token before \p end.
+bool SkipToken(const char *&pos, const char *end);
+
+/// Splits the text [\p begin, \p end) after line breaks into ranges of about
+/// \p range_size bytes. Returns the range boundaries, starting with \p begin
+/// and ending with \p end.
+std::vector<const char *> SplitTextAtLines(const char *begin,
+                                           const char *end,
+                                           int64_t range_size);
+
+/// Parses the lines of the text [\p begin, \p end) in parallel. The text is
+/// split into ranges of whole lines, each range is parsed into its own rows,
+/// and the rows are concatenated in the order of the lines.
+///
+/// \param parse_line Called as parse_line(line_begin, line_end, row) for
+/// each line, without the line break, and a value-initialized \p row. Returns
+/// false to skip the line. Must be safe to call concurrently.
+template <typename Row, typename ParseLine>
+std::vector<Row> ParseLinesInParallel(const char *begin,
+                                      const char *end,
+                                      const ParseLine &parse_line) {
+    const int64_t kRangeSize = 1 << 20;
+    const std::vector<const char *> bounds =
+            SplitTextAtLines(begin, end, kRangeSize);
+    const int64_t num_ranges = static_cast<int64_t>(bounds.size()) - 1;
+    std::vector<std::vector<Row>> range_rows(num_ranges);
+    core::ParallelFor(num_ranges, [&](int64_t r) {
+        const char *range_end = bounds[r + 1];
+        for (const char *line = bounds[r]; line < range_end;) {
+            const char *line_end = static_cast<const char *>(
+                    std::memchr(line, '\n', range_end - line));
+            if (!line_end) {
+                line_end = range_end;
+            }
+            Row row{};
+            if (parse_line(line, line_end, row)) {
+                range_rows[r].push_back(row);
+            }
+            line = line_end + 1;
+        }
+    });
+
+    std::vector<int64_t> offsets(num_ranges + 1, 0);
+    for (int64_t r = 0; r < num_ranges; ++r) {
+        offsets[r + 1] =
+                offsets[r] + static_cast<int64_t>(range_rows[r].size());
+    }
+    std::vector<Row> rows(offsets[num_ranges]);
+    core::ParallelFor(num_ranges, [&](int64_t r) {
+        std::copy(range_rows[r].begin(), range_rows[r].end(),
+                  rows.begin() + offsets[r]);
+        std::vector<Row>().swap(range_rows[r]);
+    });
+    return rows;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -24,13 +24,18 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <liblzf/lzf.h>
-
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <limits>
 #include <sstream>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/LZFCompression.h"
+#include "open3d/io/ParallelTextParser.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -332,7 +337,111 @@ Eigen::Vector3d UnpackASCIIPCDColor(const char *data_ptr,
     }
 }
 
+/// Parses the ASCII data section, which starts at \p data_offset in the file,
+/// in parallel. Lines with too few values are skipped.
+bool ReadPCDASCIIData(const std::string &filename,
+                      int64_t data_offset,
+                      const PCDHeader &header,
+                      geometry::PointCloud &pointcloud) {
+    size_t file_size = 0;
+    std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+            filename, file_size, false, nullptr);
+    if (!mapping || data_offset < 0 ||
+        static_cast<size_t>(data_offset) > file_size) {
+        utility::LogWarning("[ReadPCDData] Failed to read data record.");
+        return false;
+    }
+    const char *data = reinterpret_cast<const char *>(mapping.get());
+
+    // Values are stored in the row as x, y, z, normal_x, normal_y, normal_z
+    // and the color.
+    struct ASCIIField {
+        int count_offset;
+        int slot;
+        char type;
+        int size;
+    };
+    std::vector<ASCIIField> ascii_fields;
+    const std::vector<std::string> slot_names = {
+            "x", "y", "z", "normal_x", "normal_y", "normal_z"};
+    for (const auto &field : header.fields) {
+        auto it = std::find(slot_names.begin(), slot_names.end(), field.name);
+        if (it != slot_names.end()) {
+            ascii_fields.push_back({field.count_offset,
+                                    int(it - slot_names.begin()), field.type,
+                                    field.size});
+        } else if (field.name == "rgb" || field.name == "rgba") {
+            ascii_fields.push_back(
+                    {field.count_offset, 6, field.type, field.size});
+        }
+    }
+    std::sort(ascii_fields.begin(), ascii_fields.end(),
+              [](const ASCIIField &a, const ASCIIField &b) {
+                  return a.count_offset < b.count_offset;
+              });
+
+    typedef std::array<double, 9> Row;
+    const int elementnum = header.elementnum;
+    std::vector<Row> rows = ParseLinesInParallel<Row>(
+            data + data_offset, data + file_size,
+            [&](const char *pos, const char *end, Row &row) {
+                auto field = ascii_fields.begin();
+                for (int i = 0; i < elementnum; ++i) {
+                    const char *token_begin = pos;
+                    if (!SkipToken(pos, end)) {
+                        return false;
+                    }
+                    while (field != ascii_fields.end() &&
+                           field->count_offset == i) {
+                        // Only floats take the fast path, integers keep the
+                        // strtol semantics (hexadecimal and octal values).
+                        const char *value_pos = token_begin;
+                        if (field->slot < 6 && field->type == 'F' &&
+                            ParseNumber(value_pos, pos, row[field->slot])) {
+                            ++field;
+                            continue;
+                        }
+                        char token[64] = {0};
+                        while (std::isspace(
+                                static_cast<unsigned char>(*token_begin))) {
+                            ++token_begin;
+                        }
+                        std::memcpy(token, token_begin,
+                                    std::min<size_t>(pos - token_begin,
+                                                     sizeof(token) - 1));
+                        if (field->slot < 6) {
+                            row[field->slot] = UnpackASCIIPCDElement(
+                                    token, field->type, field->size);
+                        } else {
+                            Eigen::Vector3d color = UnpackASCIIPCDColor(
+                                    token, field->type, field->size);
+                            row[6] = color(0);
+                            row[7] = color(1);
+                            row[8] = color(2);
+                        }
+                        ++field;
+                    }
+                }
+                return true;
+            });
+
+    const int64_t num_rows =
+            std::min<int64_t>(static_cast<int64_t>(rows.size()), header.points);
+    core::ParallelFor(num_rows, [&](int64_t i) {
+        const Row &row = rows[i];
+        pointcloud.points_[i] = Eigen::Vector3d(row[0], row[1], row[2]);
+        if (header.has_normals) {
+            pointcloud.normals_[i] = Eigen::Vector3d(row[3], row[4], row[5]);
+        }
+        if (header.has_colors) {
+            pointcloud.colors_[i] = Eigen::Vector3d(row[6], row[7], row[8]);
+        }
+    });
+    return true;
+}
+
 bool ReadPCDData(FILE *file,
+                 const std::string &filename,
                  const PCDHeader &header,
                  geometry::PointCloud &pointcloud,
                  const ReadPointCloudOption &params) {
@@ -354,52 +463,9 @@ bool ReadPCDData(FILE *file,
     reporter.SetTotal(header.points);
 
     if (header.datatype == PCD_DATA_ASCII) {
-        char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-        int idx = 0;
-        while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file) &&
-               idx < header.points) {
-            std::string line(line_buffer);
-            std::vector<std::string> strs =
-                    utility::SplitString(line, "\t\r\n ");
-            if ((int)strs.size() < header.elementnum) {
-                continue;
-            }
-            for (size_t i = 0; i < header.fields.size(); i++) {
-                const auto &field = header.fields[i];
-                if (field.name == "x") {
-                    pointcloud.points_[idx](0) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "y") {
-                    pointcloud.points_[idx](1) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "z") {
-                    pointcloud.points_[idx](2) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_x") {
-                    pointcloud.normals_[idx](0) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_y") {
-                    pointcloud.normals_[idx](1) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "normal_z") {
-                    pointcloud.normals_[idx](2) = UnpackASCIIPCDElement(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                } else if (field.name == "rgb" || field.name == "rgba") {
-                    pointcloud.colors_[idx] = UnpackASCIIPCDColor(
-                            strs[field.count_offset].c_str(), field.type,
-                            field.size);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
+        if (!ReadPCDASCIIData(filename, ftell(file), header, pointcloud)) {
+            pointcloud.Clear();
+            return false;
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
         std::unique_ptr<char[]> buffer(new char[header.pointsize]);
@@ -476,10 +542,12 @@ bool ReadPCDData(FILE *file,
         }
         std::unique_ptr<char[]> buffer(new char[uncompressed_size]);
         reporter.Update(int(reporter_total * .2));
-        if (lzf_decompress(buffer_compressed.get(),
-                           (unsigned int)compressed_size, buffer.get(),
-                           (unsigned int)uncompressed_size) !=
-            uncompressed_size) {
+        if (!DecompressLZF(
+                    reinterpret_cast<const std::uint8_t *>(
+                            buffer_compressed.get()),
+                    compressed_size,
+                    reinterpret_cast<std::uint8_t *>(buffer.get()),
+                    uncompressed_size)) {
             utility::LogWarning("[ReadPCDData] Uncompression failed.");
             pointcloud.Clear();
             return false;
@@ -490,47 +558,47 @@ bool ReadPCDData(FILE *file,
                     double(base_ptr - buffer.get()) / uncompressed_size;
             reporter.Update(int(reporter_total * (progress + .2)));
             if (field.name == "x") {
-                for (int i = 0; i < header.points; i++) {
+                core::ParallelFor(header.points, [&](int64_t i) {
                     pointcloud.points_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
-                }
+                });
             } else if (field.name == "y") {
-                for (int i = 0; i < header.points; i++) {
+                core::ParallelFor(header.points, [&](int64_t i) {
                     pointcloud.points_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
-                }
+                });
             } else if (field.name == "z") {
-                for (int i = 0; i < header.points; i++) {
+                core::ParallelFor(header.points, [&](int64_t i) {
                     pointcloud.points_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
-                }
+                });
             } else if (field.name == "normal_x") {
-                for (int i = 0; i < header.points; i++) {
+                core::ParallelFor(header.points, [&](int64_t i) {
                     pointcloud.normals_[i](0) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
-                }
+                });
             } else if (field.name == "normal_y") {
-                for (int i = 0; i < header.points; i++) {
+                core::ParallelFor(header.points, [&](int64_t i) {
                     pointcloud.normals_[i](1) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
-                }
+                });
             } else if (field.name == "normal_z") {
-                for (int i = 0; i < header.points; i++) {
+                core::ParallelFor(header.points, [&](int64_t i) {
                     pointcloud.normals_[i](2) = UnpackBinaryPCDElement(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
-                }
+                });
             } else if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; i++) {
+                core::ParallelFor(header.points, [&](int64_t i) {
                     pointcloud.colors_[i] = UnpackBinaryPCDColor(
                             base_ptr + i * field.size * field.count, field.type,
                             field.size);
-                }
+                });
             }
         }
     }
@@ -693,52 +761,58 @@ bool WritePCDData(FILE *file,
             }
         }
     } else if (header.datatype == PCD_DATA_BINARY_COMPRESSED) {
-        double report_total = double(pointcloud.points_.size() * 2);
-        // 0%-50% packing into buffer
-        // 50%-75% compressing buffer
-        // 75%-100% writing compressed buffer
-        reporter.SetTotal(int(report_total));
-        int strip_size = header.points;
-        std::uint32_t buffer_size =
-                (std::uint32_t)(header.elementnum * header.points);
-        std::unique_ptr<float[]> buffer(new float[buffer_size]);
-        std::unique_ptr<float[]> buffer_compressed(new float[buffer_size * 2]);
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            buffer[0 * strip_size + i] = (float)point(0);
-            buffer[1 * strip_size + i] = (float)point(1);
-            buffer[2 * strip_size + i] = (float)point(2);
-            int idx = 3;
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                buffer[(idx + 0) * strip_size + i] = (float)normal(0);
-                buffer[(idx + 1) * strip_size + i] = (float)normal(1);
-                buffer[(idx + 2) * strip_size + i] = (float)normal(2);
-                idx += 3;
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                buffer[idx * strip_size + i] = ConvertRGBToFloat(color);
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        // The data is stored field by field, each field as a column of
+        // header.points floats. The columns are produced and compressed
+        // chunk by chunk, without staging the whole uncompressed buffer.
+        const int64_t num_points = header.points;
+        const int64_t column_size = num_points * int64_t(sizeof(float));
+        const int64_t buffer_size_in_bytes = column_size * header.elementnum;
+        if (buffer_size_in_bytes > std::numeric_limits<std::uint32_t>::max()) {
+            utility::LogWarning("[WritePCDData] Too much data to compress.");
+            return false;
         }
-        std::uint32_t buffer_size_in_bytes = buffer_size * sizeof(float);
-        std::uint32_t size_compressed =
-                lzf_compress(buffer.get(), buffer_size_in_bytes,
-                             buffer_compressed.get(), buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
+        auto fill = [&](int64_t offset, int64_t size, std::uint8_t *dst) {
+            // Chunks start and end at float boundaries.
+            float *value = reinterpret_cast<float *>(dst);
+            for (int64_t byte = offset; byte < offset + size;) {
+                const int64_t column = byte / column_size;
+                const int64_t begin = (byte % column_size) / sizeof(float);
+                const int64_t remaining = (offset + size - byte) / sizeof(float);
+                const int64_t end = std::min(num_points, begin + remaining);
+                for (int64_t i = begin; i < end; ++i) {
+                    if (column < 3) {
+                        *value++ = (float)pointcloud.points_[i](column);
+                    } else if (has_normal && column < 6) {
+                        *value++ = (float)pointcloud.normals_[i](column - 3);
+                    } else {
+                        *value++ = ConvertRGBToFloat(pointcloud.colors_[i]);
+                    }
+                }
+                byte += (end - begin) * sizeof(float);
+            }
+        };
+        const long sizes_pos = ftell(file);
+        std::uint32_t size_compressed = 0;
+        std::uint32_t size_uncompressed = (std::uint32_t)buffer_size_in_bytes;
+        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
+        fwrite(&size_uncompressed, sizeof(size_uncompressed), 1, file);
+        const int64_t stream_size =
+                WriteLZFStream(file, buffer_size_in_bytes, fill);
+        if (stream_size < 0 ||
+            stream_size > std::numeric_limits<std::uint32_t>::max()) {
             utility::LogWarning("[WritePCDData] Failed to compress data.");
             return false;
         }
         utility::LogDebug(
                 "[WritePCDData] {:d} bytes data compressed into {:d} bytes.",
-                buffer_size_in_bytes, size_compressed);
-        reporter.Update(int(report_total * 0.75));
-        fwrite(&size_compressed, sizeof(size_compressed), 1, file);
-        fwrite(&buffer_size_in_bytes, sizeof(buffer_size_in_bytes), 1, file);
-        fwrite(buffer_compressed.get(), 1, size_compressed, file);
+                buffer_size_in_bytes, stream_size);
+        size_compressed = (std::uint32_t)stream_size;
+        if (fseek(file, sizes_pos, SEEK_SET) != 0 ||
+            fwrite(&size_compressed, sizeof(size_compressed), 1, file) != 1 ||
+            fseek(file, 0, SEEK_END) != 0) {
+            utility::LogWarning("[WritePCDData] Failed to write data.");
+            return false;
+        }
     }
     reporter.Finish();
     return true;
@@ -779,7 +853,7 @@ bool ReadPointCloudFromPCD(const std::string &filename,
                       header.has_points ? "yes" : "no",
                       header.has_normals ? "yes" : "no",
                       header.has_colors ? "yes" : "no");
-    if (!ReadPCDData(file, header, pointcloud, params)) {
+    if (!ReadPCDData(file, filename, header, pointcloud, params)) {
         utility::LogWarning("Read PCD failed: unable to read data.");
         fclose(file);
         return false;
@@ -24,9 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <array>
 #include <cstdio>
+#include <cstring>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelTextParser.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -44,17 +47,25 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        size_t file_size = 0;
+        std::string error_str;
+        std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+                filename, file_size, false, &error_str);
+        if (!mapping) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
+        const char *data = reinterpret_cast<const char *>(mapping.get());
+        const char *data_end = data + file_size;
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data, '\n', file_size));
+        const char *data_begin = line_end ? line_end + 1 : data_end;
         size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
+        double header_value = 0;
+        const char *pos = data;
+        if (ParseNumber(pos, data_begin, header_value) && header_value > 0) {
+            num_of_pts = static_cast<size_t>(header_value);
         }
         if (num_of_pts <= 0) {
             utility::LogWarning("Read PTS failed: unable to read header.");
@@ -64,41 +75,55 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         reporter.SetTotal(num_of_pts);
 
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st =
-                        utility::SplitString(line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z, i;
-            int r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
+        if (data_begin == data_end) {
+            reporter.Finish();
+            return true;
+        }
+
+        // The first data line decides the layout of all lines.
+        int num_of_fields = 0;
+        line_end = static_cast<const char *>(
+                std::memchr(data_begin, '\n', data_end - data_begin));
+        pos = data_begin;
+        while (SkipToken(pos, line_end ? line_end : data_end)) {
+            ++num_of_fields;
         }
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+
+        // Every line takes its index, invalid lines are left zero.
+        // X Y Z [I R G B]
+        const int num_values = num_of_fields >= 7 ? 7 : 3;
+        std::vector<std::array<double, 7>> rows =
+                ParseLinesInParallel<std::array<double, 7>>(
+                        data_begin, data_end,
+                        [num_values](const char *pos, const char *end,
+                                     std::array<double, 7> &row) {
+                            std::array<double, 7> values{};
+                            for (int i = 0; i < num_values; ++i) {
+                                if (!ParseNumber(pos, end, values[i])) {
+                                    return true;
+                                }
+                            }
+                            row = values;
+                            return true;
+                        });
+        rows.resize(num_of_pts, std::array<double, 7>{});
+        pointcloud.points_.resize(num_of_pts);
+        if (num_of_fields >= 7) {
+            pointcloud.colors_.resize(num_of_pts);
+        }
+        core::ParallelFor(num_of_pts, [&](int64_t idx) {
+            const std::array<double, 7> &row = rows[idx];
+            pointcloud.points_[idx] = Eigen::Vector3d(row[0], row[1], row[2]);
+            if (num_of_fields >= 7) {
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        static_cast<int>(row[4]), static_cast<int>(row[5]),
+                        static_cast<int>(row[6]));
+            }
+        });
         reporter.Finish();
 
         return true;
@@ -27,6 +27,7 @@
 #include <cstdio>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelTextParser.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -43,27 +44,27 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        size_t file_size = 0;
+        std::string error_str;
+        std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+                filename, file_size, false, &error_str);
+        if (!mapping) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file_size);
 
+        const char *data = reinterpret_cast<const char *>(mapping.get());
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        pointcloud.points_ = ParseLinesInParallel<Eigen::Vector3d>(
+                data, data + file_size,
+                [](const char *pos, const char *end, Eigen::Vector3d &point) {
+                    return ParseNumber(pos, end, point(0)) &&
+                           ParseNumber(pos, end, point(1)) &&
+                           ParseNumber(pos, end, point(2));
+                });
         reporter.Finish();
 
         return true;
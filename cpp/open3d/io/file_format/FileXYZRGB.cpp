@@ -24,9 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <array>
 #include <cstdio>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelTextParser.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -43,29 +45,40 @@ bool ReadPointCloudFromXYZRGB(const std::string &filename,
                               geometry::PointCloud &pointcloud,
                               const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        size_t file_size = 0;
+        std::string error_str;
+        std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+                filename, file_size, false, &error_str);
+        if (!mapping) {
             utility::LogWarning("Read XYZRGB failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file_size);
 
+        const char *data = reinterpret_cast<const char *>(mapping.get());
+        const std::vector<std::array<double, 6>> rows =
+                ParseLinesInParallel<std::array<double, 6>>(
+                        data, data + file_size,
+                        [](const char *pos, const char *end,
+                           std::array<double, 6> &row) {
+                            for (double &value : row) {
+                                if (!ParseNumber(pos, end, value)) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, r, g, b;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &r,
-                       &g, &b) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.colors_.push_back(Eigen::Vector3d(r, g, b));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        pointcloud.points_.resize(rows.size());
+        pointcloud.colors_.resize(rows.size());
+        core::ParallelFor(rows.size(), [&](int64_t i) {
+            pointcloud.points_[i] =
+                    Eigen::Vector3d(rows[i][0], rows[i][1], rows[i][2]);
+            pointcloud.colors_[i] =
+                    Eigen::Vector3d(rows[i][3], rows[i][4], rows[i][5]);
+        });
         reporter.Finish();
 
         return true;
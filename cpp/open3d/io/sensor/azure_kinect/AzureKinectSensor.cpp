@@ -32,6 +32,7 @@
 
 #include <memory>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/sensor/azure_kinect/K4aPlugin.h"
 
@@ -176,19 +177,14 @@ void ConvertBGRAToRGB(geometry::Image &bgra, geometry::Image &rgb) {
                 "dimensions.");
     }
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(3) schedule(static)
-#endif
-    for (int v = 0; v < bgra.height_; ++v) {
+    core::ParallelFor(bgra.height_, [&](int v) {
         for (int u = 0; u < bgra.width_; ++u) {
             for (int c = 0; c < 3; ++c) {
                 *rgb.PointerAt<uint8_t>(u, v, c) =
                         *bgra.PointerAt<uint8_t>(u, v, 2 - c);
             }
         }
-    }
+    });
 }
 
 bool AzureKinectSensor::PrintFirmware(k4a_device_t device) {
@@ -26,6 +26,7 @@
 
 #include <numeric>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
 namespace open3d {
@@ -183,8 +184,7 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
     core::Tensor result = core::Tensor::Full(
             {num_query_points, max_num_neighbors}, -1, core::Dtype::Int64);
 
-#pragma omp parallel for schedule(static)
-    for (int64_t batch_idx = 0; batch_idx < num_batches; ++batch_idx) {
+    core::ParallelFor(num_batches, [&](int64_t batch_idx) {
         int32_t result_start_idx = query_prefix_indices[batch_idx];
         int32_t result_end_idx = query_prefix_indices[batch_idx + 1];
 
@@ -212,7 +212,7 @@ const core::Tensor RadiusSearch(const core::Tensor& query_points,
             result_slice.AsRvalue() = indices_slice.View({1, num_neighbor});
             indices_start_idx += num_neighbor;
         }
-    }
+    });
 
     return result.To(core::Dtype::Int32);
 }
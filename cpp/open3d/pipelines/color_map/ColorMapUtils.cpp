@@ -27,6 +27,7 @@
 #include "open3d/pipelines/color_map/ColorMapUtils.h"
 
 #include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
@@ -147,8 +148,7 @@ CreateVertexAndImageVisibility(
     std::vector<std::vector<int>> visibility_vertex_to_image;
     visibility_vertex_to_image.resize(n_vertex);
 
-#pragma omp parallel for schedule(static)
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+    core::ParallelFor(int(n_camera), [&](int camera_id) {
         for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
             Eigen::Vector3d X = mesh.vertices_[vertex_id];
             float u, v, d;
@@ -178,8 +178,11 @@ CreateVertexAndImageVisibility(
                 continue;
             }
             visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
+        }
+    });
+    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+        for (int vertex_id : visibility_image_to_vertex[camera_id]) {
+            visibility_vertex_to_image[vertex_id].push_back(camera_id);
         }
     }
 
@@ -206,8 +209,7 @@ void SetProxyIntensityForVertex(
     auto n_vertex = mesh.vertices_.size();
     proxy_intensity.resize(n_vertex);
 
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < int(n_vertex); i++) {
+    core::ParallelFor(int(n_vertex), [&](int i) {
         proxy_intensity[i] = 0.0;
         float sum = 0.0;
         for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
@@ -235,7 +237,7 @@ void SetProxyIntensityForVertex(
         if (sum > 0) {
             proxy_intensity[i] /= sum;
         }
-    }
+    });
 }
 
 void SetGeometryColorAverage(
@@ -249,10 +251,8 @@ void SetGeometryColorAverage(
     size_t n_vertex = mesh.vertices_.size();
     mesh.vertex_colors_.clear();
     mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)n_vertex; i++) {
+    std::vector<char> valid(n_vertex, 0);
+    core::ParallelFor((int)n_vertex, [&](int i) {
         mesh.vertex_colors_[i] = Eigen::Vector3d::Zero();
         double sum = 0.0;
         for (size_t iter = 0; iter < visibility_vertex_to_image[i].size();
@@ -283,22 +283,25 @@ void SetGeometryColorAverage(
                 sum += 1.0;
             }
         }
-#pragma omp critical
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+        if (sum > 0.0) {
+            mesh.vertex_colors_[i] /= sum;
+            valid[i] = 1;
+        }
+    });
+    std::vector<size_t> valid_vertices;
+    std::vector<size_t> invalid_vertices;
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (valid[i]) {
+            valid_vertices.push_back(i);
+        } else {
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
         std::shared_ptr<geometry::TriangleMesh> valid_mesh =
                 mesh.SelectByIndex(valid_vertices);
         geometry::KDTreeFlann kd_tree(*valid_mesh);
-#pragma omp parallel for schedule(static)
-        for (int i = 0; i < (int)invalid_vertices.size(); ++i) {
+        core::ParallelFor((int)invalid_vertices.size(), [&](int i) {
             size_t invalid_vertex = invalid_vertices[i];
             std::vector<int> indices;  // indices to valid_mesh
             std::vector<double> dists;
@@ -312,7 +315,7 @@ void SetGeometryColorAverage(
                 new_color /= static_cast<double>(indices.size());
             }
             mesh.vertex_colors_[invalid_vertex] = new_color;
-        }
+        });
     }
 }
 
@@ -27,8 +27,10 @@
 #include "open3d/pipelines/color_map/NonRigidOptimizer.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/ImageWarpingFieldIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
@@ -81,8 +83,8 @@ static std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
     double r2_sum = 0.0;
     JTJ.setZero();
     JTr.setZero();
-#pragma omp parallel
-    {
+    std::mutex sum_mutex;
+    core::ParallelForRange(iteration_num, [&](int64_t begin, int64_t end) {
         MatOutType JTJ_private(6 + nonrigidval, 6 + nonrigidval);
         VecOutType JTr_private(6 + nonrigidval);
         double r2_sum_private = 0.0;
@@ -91,8 +93,7 @@ static std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
         VecInTypeDouble J_r;
         VecInTypeInt pattern;
         double r;
-#pragma omp for nowait
-        for (int i = 0; i < iteration_num; i++) {
+        for (int i = int(begin); i < int(end); i++) {
             f(i, J_r, r, pattern);
             for (auto x = 0; x < J_r.size(); x++) {
                 for (auto y = 0; y < J_r.size(); y++) {
@@ -104,13 +105,11 @@ static std::tuple<MatOutType, VecOutType, double> ComputeJTJandJTrNonRigid(
             }
             r2_sum_private += r * r;
         }
-#pragma omp critical
-        {
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-        }
-    }
+        std::lock_guard<std::mutex> lock(sum_mutex);
+        JTJ += JTJ_private;
+        JTr += JTr_private;
+        r2_sum += r2_sum_private;
+    });
     if (verbose) {
         utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
                           r2_sum / (double)iteration_num, iteration_num);
@@ -300,10 +299,9 @@ geometry::TriangleMesh RunNonRigidOptimizer(
                                option.image_boundary_margin_);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
-        double residual = 0.0;
-        double residual_reg = 0.0;
-#pragma omp parallel for schedule(static)
-        for (int c = 0; c < n_camera; c++) {
+        std::vector<double> residuals(n_camera);
+        std::vector<double> residuals_reg(n_camera);
+        core::ParallelFor(n_camera, [&](int c) {
             int nonrigidval = warping_fields[c].anchor_w_ *
                               warping_fields[c].anchor_h_ * 2;
             double rr_reg = 0.0;
@@ -361,12 +359,14 @@ geometry::TriangleMesh RunNonRigidOptimizer(
                 warping_fields[c].flow_(j) += result(6 + j);
             }
             opt_camera_trajectory.parameters_[c].extrinsic_ = pose;
-
-#pragma omp critical
-            {
-                residual += r2;
-                residual_reg += rr_reg;
-            }
+            residuals[c] = r2;
+            residuals_reg[c] = rr_reg;
+        });
+        double residual = 0.0;
+        double residual_reg = 0.0;
+        for (int c = 0; c < n_camera; c++) {
+            residual += residuals[c];
+            residual_reg += residuals_reg[c];
         }
         utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
                           residual_reg);
@@ -29,6 +29,7 @@
 #include <memory>
 #include <vector>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
 #include "open3d/io/TriangleMeshIO.h"
@@ -162,10 +163,8 @@ geometry::TriangleMesh RunRigidOptimizer(
                                option.image_boundary_margin_);
     for (int itr = 0; itr < option.maximum_iteration_; itr++) {
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
-        double residual = 0.0;
-        total_num_ = 0;
-#pragma omp parallel for schedule(static)
-        for (int c = 0; c < n_camera; c++) {
+        std::vector<double> residuals(n_camera);
+        core::ParallelFor(n_camera, [&](int c) {
             Eigen::Matrix4d pose;
             pose = opt_camera_trajectory.parameters_[c].extrinsic_;
 
@@ -200,11 +199,13 @@ geometry::TriangleMesh RunRigidOptimizer(
                                                                          JTr);
             pose = delta * pose;
             opt_camera_trajectory.parameters_[c].extrinsic_ = pose;
-#pragma omp critical
-            {
-                residual += r2;
-                total_num_ += int(visibility_image_to_vertex[c].size());
-            }
+            residuals[c] = r2;
+        });
+        double residual = 0.0;
+        total_num_ = 0;
+        for (int c = 0; c < n_camera; c++) {
+            residual += residuals[c];
+            total_num_ += int(visibility_image_to_vertex[c].size());
         }
         if (total_num_ > 0) {
             utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})",
@@ -27,9 +27,11 @@
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 
 #include <iostream>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/utility/Helper.h"
@@ -276,26 +278,31 @@ std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
     voxel_grid->voxel_size_ = voxel_length_;
     voxel_grid->origin_ = origin_;
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            for (int z = 0; z < resolution_; z++) {
-                const int ind = IndexOf(x, y, z);
-                const float w = voxels_[ind].weight_;
-                const float f = voxels_[ind].tsdf_;
-                if (w != 0.0f && f < 0.98f && f >= -0.98f) {
-                    double c = (f + 1.0) * 0.5;
-                    Eigen::Vector3d color = Eigen::Vector3d(c, c, c);
-                    Eigen::Vector3i index = Eigen::Vector3i(x, y, z);
-                    voxel_grid->voxels_[index] = geometry::Voxel(index, color);
+    // Voxels are collected per worker range, as the voxel map can only be
+    // modified by one thread at a time.
+    std::mutex voxels_mutex;
+    core::ParallelForRange(
+            resolution_ * resolution_, [&](int64_t begin, int64_t end) {
+                std::vector<geometry::Voxel> voxels;
+                for (int64_t xy = begin; xy < end; xy++) {
+                    const int x = int(xy / resolution_);
+                    const int y = int(xy % resolution_);
+                    for (int z = 0; z < resolution_; z++) {
+                        const int ind = IndexOf(x, y, z);
+                        const float w = voxels_[ind].weight_;
+                        const float f = voxels_[ind].tsdf_;
+                        if (w != 0.0f && f < 0.98f && f >= -0.98f) {
+                            double c = (f + 1.0) * 0.5;
+                            voxels.emplace_back(Eigen::Vector3i(x, y, z),
+                                                Eigen::Vector3d(c, c, c));
+                        }
+                    }
                 }
-            }
-        }
-    }
+                std::lock_guard<std::mutex> lock(voxels_mutex);
+                for (const geometry::Voxel &voxel : voxels) {
+                    voxel_grid->voxels_[voxel.grid_index_] = voxel;
+                }
+            });
     return voxel_grid;
 }
 
@@ -303,21 +310,16 @@ std::vector<Eigen::Vector2d> UniformTSDFVolume::ExtractVolumeTSDF() const {
     std::vector<Eigen::Vector2d> sharedvoxels_;
     sharedvoxels_.resize(voxel_num_);
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            for (int z = 0; z < resolution_; z++) {
-                const int ind = IndexOf(x, y, z);
-                const float f = voxels_[ind].tsdf_;
-                const float w = voxels_[ind].weight_;
-                sharedvoxels_[ind] = Eigen::Vector2d(f, w);
-            }
+    core::ParallelFor(resolution_ * resolution_, [&](int xy) {
+        const int x = xy / resolution_;
+        const int y = xy % resolution_;
+        for (int z = 0; z < resolution_; z++) {
+            const int ind = IndexOf(x, y, z);
+            const float f = voxels_[ind].tsdf_;
+            const float w = voxels_[ind].weight_;
+            sharedvoxels_[ind] = Eigen::Vector2d(f, w);
         }
-    }
+    });
     return sharedvoxels_;
 }
 
@@ -325,55 +327,40 @@ std::vector<Eigen::Vector3d> UniformTSDFVolume::ExtractVolumeColor() const {
     std::vector<Eigen::Vector3d> sharedcolors_;
     sharedcolors_.resize(voxel_num_);
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            for (int z = 0; z < resolution_; z++) {
-                const int ind = IndexOf(x, y, z);
-                sharedcolors_[ind] = voxels_[ind].color_;
-            }
+    core::ParallelFor(resolution_ * resolution_, [&](int xy) {
+        const int x = xy / resolution_;
+        const int y = xy % resolution_;
+        for (int z = 0; z < resolution_; z++) {
+            const int ind = IndexOf(x, y, z);
+            sharedcolors_[ind] = voxels_[ind].color_;
         }
-    }
+    });
     return sharedcolors_;
 }
 
 void UniformTSDFVolume::InjectVolumeTSDF(
         const std::vector<Eigen::Vector2d> &sharedvoxels) {
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            for (int z = 0; z < resolution_; z++) {
-                const int ind = IndexOf(x, y, z);
-                voxels_[ind].tsdf_ = sharedvoxels[ind](0);
-                voxels_[ind].weight_ = sharedvoxels[ind](1);
-            }
+    core::ParallelFor(resolution_ * resolution_, [&](int xy) {
+        const int x = xy / resolution_;
+        const int y = xy % resolution_;
+        for (int z = 0; z < resolution_; z++) {
+            const int ind = IndexOf(x, y, z);
+            voxels_[ind].tsdf_ = sharedvoxels[ind](0);
+            voxels_[ind].weight_ = sharedvoxels[ind](1);
         }
-    }
+    });
 }
 
 void UniformTSDFVolume::InjectVolumeColor(
         const std::vector<Eigen::Vector3d> &sharedcolors) {
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            for (int z = 0; z < resolution_; z++) {
-                const int ind = IndexOf(x, y, z);
-                voxels_[ind].color_ = sharedcolors[ind];
-            }
+    core::ParallelFor(resolution_ * resolution_, [&](int xy) {
+        const int x = xy / resolution_;
+        const int y = xy % resolution_;
+        for (int z = 0; z < resolution_; z++) {
+            const int ind = IndexOf(x, y, z);
+            voxels_[ind].color_ = sharedcolors[ind];
         }
-    }
+    });
 }
 
 void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
@@ -394,78 +381,73 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
     const float safe_width_f = intrinsic.width_ - 0.0001f;
     const float safe_height_f = intrinsic.height_ - 0.0001f;
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int x = 0; x < resolution_; x++) {
-        for (int y = 0; y < resolution_; y++) {
-            Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
-                                             voxel_length_f * x + origin_(0)),
-                                       float(half_voxel_length_f +
-                                             voxel_length_f * y + origin_(1)),
-                                       float(half_voxel_length_f + origin_(2)),
-                                       1.f);
-            Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
-            for (int z = 0; z < resolution_; z++,
-                     pt_camera(0) += extrinsic_scaled_f(0, 2),
-                     pt_camera(1) += extrinsic_scaled_f(1, 2),
-                     pt_camera(2) += extrinsic_scaled_f(2, 2)) {
-                // Skip if negative depth after projection
-                if (pt_camera(2) <= 0) {
-                    continue;
-                }
-                // Skip if x-y coordinate not in range
-                float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
-                float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
-                if (!(u_f >= 0.0001f && u_f < safe_width_f && v_f >= 0.0001f &&
-                      v_f < safe_height_f)) {
-                    continue;
-                }
-                // Skip if negative depth in depth image
-                int u = (int)u_f;
-                int v = (int)v_f;
-                float d = *image.depth_.PointerAt<float>(u, v);
-                if (d <= 0.0f) {
-                    continue;
-                }
+    core::ParallelFor(resolution_ * resolution_, [&](int xy) {
+        const int x = xy / resolution_;
+        const int y = xy % resolution_;
+        Eigen::Vector4f pt_3d_homo(float(half_voxel_length_f +
+                                         voxel_length_f * x + origin_(0)),
+                                   float(half_voxel_length_f +
+                                         voxel_length_f * y + origin_(1)),
+                                   float(half_voxel_length_f + origin_(2)),
+                                   1.f);
+        Eigen::Vector4f pt_camera = extrinsic_f * pt_3d_homo;
+        for (int z = 0; z < resolution_; z++,
+                 pt_camera(0) += extrinsic_scaled_f(0, 2),
+                 pt_camera(1) += extrinsic_scaled_f(1, 2),
+                 pt_camera(2) += extrinsic_scaled_f(2, 2)) {
+            // Skip if negative depth after projection
+            if (pt_camera(2) <= 0) {
+                continue;
+            }
+            // Skip if x-y coordinate not in range
+            float u_f = pt_camera(0) * fx / pt_camera(2) + cx + 0.5f;
+            float v_f = pt_camera(1) * fy / pt_camera(2) + cy + 0.5f;
+            if (!(u_f >= 0.0001f && u_f < safe_width_f && v_f >= 0.0001f &&
+                  v_f < safe_height_f)) {
+                continue;
+            }
+            // Skip if negative depth in depth image
+            int u = (int)u_f;
+            int v = (int)v_f;
+            float d = *image.depth_.PointerAt<float>(u, v);
+            if (d <= 0.0f) {
+                continue;
+            }
 
-                int v_ind = IndexOf(x, y, z);
-                float sdf =
-                        (d - pt_camera(2)) *
-                        (*depth_to_camera_distance_multiplier.PointerAt<float>(
-                                u, v));
-                if (sdf > -sdf_trunc_f) {
-                    // integrate
-                    float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
+            int v_ind = IndexOf(x, y, z);
+            float sdf =
+                    (d - pt_camera(2)) *
+                    (*depth_to_camera_distance_multiplier.PointerAt<float>(
+                            u, v));
+            if (sdf > -sdf_trunc_f) {
+                // integrate
+                float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
+                voxels_[v_ind].tsdf_ =
+                        (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
+                         tsdf) /
+                        (voxels_[v_ind].weight_ + 1.0f);
+                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                    const uint8_t *rgb =
+                            image.color_.PointerAt<uint8_t>(u, v, 0);
+                    Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
+                    voxels_[v_ind].color_ =
+                            (voxels_[v_ind].color_ *
+                                     voxels_[v_ind].weight_ +
+                             rgb_f) /
+                            (voxels_[v_ind].weight_ + 1.0f);
+                } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+                    const float *intensity =
+                            image.color_.PointerAt<float>(u, v, 0);
+                    voxels_[v_ind].color_ =
+                            (voxels_[v_ind].color_.array() *
+                                     voxels_[v_ind].weight_ +
+                             (*intensity)) /
                             (voxels_[v_ind].weight_ + 1.0f);
-                    if (color_type_ == TSDFVolumeColorType::RGB8) {
-                        const uint8_t *rgb =
-                                image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    }
-                    voxels_[v_ind].weight_ += 1.0f;
                 }
+                voxels_[v_ind].weight_ += 1.0f;
             }
         }
-    }
+    });
 }
 
 Eigen::Vector3d UniformTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
@@ -28,7 +28,9 @@
 
 #include <Eigen/Dense>
 #include <memory>
+#include <mutex>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
@@ -133,14 +135,20 @@ static CorrespondenceSetPixelWise ComputeCorrespondence(
     std::tie(correspondence_map, depth_buffer) =
             InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
 
-#pragma omp parallel
-    {
+    // Each worker range of rows projects into private maps, which hold the
+    // closest source pixel for every target pixel and are merged at the end.
+    // The grain size keeps the number of full-size private maps close to the
+    // number of threads.
+    const int64_t grain_size =
+            (depth_s.height_ + core::GetNumThreads() - 1) /
+            core::GetNumThreads();
+    std::mutex map_mutex;
+    auto ProjectRows = [&](int64_t begin, int64_t end) {
         geometry::Image correspondence_map_private;
         geometry::Image depth_buffer_private;
         std::tie(correspondence_map_private, depth_buffer_private) =
                 InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#pragma omp for nowait
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        for (int v_s = int(begin); v_s < int(end); v_s++) {
             for (int u_s = 0; u_s < depth_s.width_; u_s++) {
                 double d_s = *depth_s.PointerAt<float>(u_s, v_s);
                 if (!std::isnan(d_s)) {
@@ -164,14 +172,12 @@ static CorrespondenceSetPixelWise ComputeCorrespondence(
                 }
             }
         }
-#pragma omp critical
-        {
-            MergeCorrespondenceMaps(correspondence_map, depth_buffer,
-                                    correspondence_map_private,
-                                    depth_buffer_private);
-
-        }  //    omp critical
-    }      //    omp parallel
+        std::lock_guard<std::mutex> lock(map_mutex);
+        MergeCorrespondenceMaps(correspondence_map, depth_buffer,
+                                correspondence_map_private,
+                                depth_buffer_private);
+    };
+    core::ParallelForRange(depth_s.height_, ProjectRows, grain_size);
 
     CorrespondenceSetPixelWise correspondence;
     int correspondence_count = CountCorrespondence(correspondence_map);
@@ -252,36 +258,39 @@ static Eigen::Matrix6d CreateInformationMatrix(
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
     Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
-#pragma omp parallel
-    {
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Identity();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
-#pragma omp for nowait
-        for (int row = 0; row < int(correspondence.size()); row++) {
-            int u_t = correspondence[row](2);
-            int v_t = correspondence[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-        }
-#pragma omp critical
-        { GTG += GTG_private; }
-    }
+    std::mutex GTG_mutex;
+    core::ParallelForRange(
+            int64_t(correspondence.size()), [&](int64_t begin, int64_t end) {
+                Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
+                Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
+                for (int64_t row = begin; row < end; row++) {
+                    int u_t = correspondence[row](2);
+                    int v_t = correspondence[row](3);
+                    double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
+                    double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
+                    double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+                    G_r_private.setZero();
+                    G_r_private(1) = z;
+                    G_r_private(2) = -y;
+                    G_r_private(3) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = -z;
+                    G_r_private(2) = x;
+                    G_r_private(4) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = y;
+                    G_r_private(1) = -x;
+                    G_r_private(5) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                }
+                std::lock_guard<std::mutex> lock(GTG_mutex);
+                GTG += GTG_private;
+            });
     return GTG;
 }
 
@@ -28,7 +28,9 @@
 
 #include <Eigen/Dense>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/NeighborhoodCache.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
 
@@ -70,19 +72,19 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
     return result;
 }
 
+// search(i, indices, distance2) fills the neighbors of point i, starting
+// with the point itself.
+template <typename search_t>
 static std::shared_ptr<Feature> ComputeSPFHFeature(
-        const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
+        const geometry::PointCloud &input, const search_t &search) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    core::ParallelFor((int)input.points_.size(), [&](int i) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        if (search(i, indices, distance2) > 1) {
             // only compute SPFH feature when a point has neighbors
             double hist_incr = 100.0 / (double)(indices.size() - 1);
             for (size_t k = 1; k < indices.size(); k++) {
@@ -104,14 +106,13 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
                 feature->data_(h_index + 22, i) += hist_incr;
             }
         }
-    }
+    });
     return feature;
 }
 
-std::shared_ptr<Feature> ComputeFPFHFeature(
-        const geometry::PointCloud &input,
-        const geometry::KDTreeSearchParam
-                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+template <typename search_t>
+static std::shared_ptr<Feature> ComputeFPFHFeatureWithSearch(
+        const geometry::PointCloud &input, const search_t &search) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
     if (!input.HasNormals()) {
@@ -119,17 +120,14 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    auto spfh = ComputeSPFHFeature(input, search);
     if (spfh == nullptr) {
         utility::LogError("Internal error: SPFH feature is nullptr.");
     }
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
+    core::ParallelFor((int)input.points_.size(), [&](int i) {
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
+        if (search(i, indices, distance2) > 1) {
             double sum[3] = {0.0, 0.0, 0.0};
             for (size_t k = 1; k < indices.size(); k++) {
                 // skip the point itself
@@ -153,10 +151,45 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 feature->data_(j, i) += spfh->data_(j, i);
             }
         }
-    }
+    });
     return feature;
 }
 
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam
+                &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    geometry::KDTreeFlann kdtree(input);
+    return ComputeFPFHFeatureWithSearch(
+            input, [&](int i, std::vector<int> &indices,
+                       std::vector<double> &distance2) {
+                return kdtree.Search(input.points_[i], search_param, indices,
+                                     distance2);
+            });
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborhoodCache &neighborhoods) {
+    if (neighborhoods.GetNumPoints() != int64_t(input.points_.size())) {
+        utility::LogError(
+                "[ComputeFPFHFeature] The neighborhood cache has {:d} points, "
+                "but the point cloud has {:d} points.",
+                neighborhoods.GetNumPoints(), input.points_.size());
+    }
+    return ComputeFPFHFeatureWithSearch(
+            input, [&](int i, std::vector<int> &indices,
+                       std::vector<double> &distance2) {
+                const int num_neighbors = neighborhoods.GetNumNeighbors(i);
+                indices.assign(neighborhoods.GetNeighbors(i),
+                               neighborhoods.GetNeighbors(i) + num_neighbors);
+                distance2.assign(
+                        neighborhoods.GetDistances2(i),
+                        neighborhoods.GetDistances2(i) + num_neighbors);
+                return num_neighbors;
+            });
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -35,6 +35,7 @@
 namespace open3d {
 
 namespace geometry {
+class NeighborhoodCache;
 class PointCloud;
 }
 
@@ -73,6 +74,15 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to compute FPFH feature for a point cloud from cached
+/// neighborhoods, which are reused for both the SPFH and the FPFH pass.
+///
+/// \param input The Input point cloud.
+/// \param neighborhoods Neighborhoods of the points of \p input.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborhoodCache &neighborhoods);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
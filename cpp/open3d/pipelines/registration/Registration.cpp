@@ -26,6 +26,11 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <atomic>
+#include <mutex>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/nns/KDForestIndex.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
@@ -36,6 +41,47 @@ namespace open3d {
 namespace pipelines {
 namespace registration {
 
+/// Returns the index of the nearest feature in \p dataset for each feature in
+/// \p query.
+static std::vector<int> MatchFeatures(const Feature &query,
+                                      const Feature &dataset,
+                                      const FeatureMatchingOption &option) {
+    const int num_query = int(query.Num());
+    std::vector<int> matches(num_query);
+    if (option.approximate_ && dataset.Num() > 0) {
+        // Single precision is plenty for an approximate search and halves
+        // the memory traffic.
+        const int64_t dimension = int64_t(query.Dimension());
+        core::Tensor dataset_points =
+                core::Tensor(dataset.data_.data(),
+                             {int64_t(dataset.Num()), dimension},
+                             core::Dtype::Float64)
+                        .To(core::Dtype::Float32);
+        core::Tensor query_points =
+                core::Tensor(query.data_.data(), {num_query, dimension},
+                             core::Dtype::Float64)
+                        .To(core::Dtype::Float32);
+        core::nns::KDForestIndex index(dataset_points, option.num_trees_,
+                                       option.max_checks_);
+        core::Tensor indices = index.SearchKnn(query_points, 1).first;
+        const int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        for (int i = 0; i < num_query; i++) {
+            matches[i] = int(indices_ptr[i]);
+        }
+        return matches;
+    }
+
+    geometry::KDTreeFlann kdtree(dataset);
+    core::ParallelFor(num_query, [&](int i) {
+        std::vector<int> corres_tmp(1);
+        std::vector<double> dist_tmp(1);
+        kdtree.SearchKNN(Eigen::VectorXd(query.data_.col(i)), 1, corres_tmp,
+                         dist_tmp);
+        matches[i] = corres_tmp[0];
+    });
+    return matches;
+}
+
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -49,31 +95,30 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
 
     double error2 = 0.0;
 
-#pragma omp parallel
-    {
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#pragma omp for nowait
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#pragma omp critical
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
-            }
-            error2 += error2_private;
-        }
-    }
+    std::mutex result_mutex;
+    core::ParallelForRange(
+            int64_t(source.points_.size()), [&](int64_t begin, int64_t end) {
+                double error2_private = 0.0;
+                CorrespondenceSet correspondence_set_private;
+                for (int i = int(begin); i < int(end); i++) {
+                    std::vector<int> indices(1);
+                    std::vector<double> dists(1);
+                    const auto &point = source.points_[i];
+                    if (target_kdtree.SearchHybrid(point,
+                                                   max_correspondence_distance,
+                                                   1, indices, dists) > 0) {
+                        error2_private += dists[0];
+                        correspondence_set_private.push_back(
+                                Eigen::Vector2i(i, indices[0]));
+                    }
+                }
+                std::lock_guard<std::mutex> lock(result_mutex);
+                result.correspondence_set_.insert(
+                        result.correspondence_set_.end(),
+                        correspondence_set_private.begin(),
+                        correspondence_set_private.end());
+                error2 += error2_private;
+            });
 
     if (result.correspondence_set_.empty()) {
         result.fitness_ = 0.0;
@@ -203,72 +248,69 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         return RegistrationResult();
     }
 
+    // The exit iteration is shared by all worker ranges and only decreases,
+    // as it is estimated from the fitness of each improved result.
     RegistrationResult best_result;
-    int exit_itr = -1;
-
-#pragma omp parallel
-    {
+    std::atomic<int> exit_itr(criteria.max_iteration_);
+    std::mutex best_result_mutex;
+    core::ParallelForRange(criteria.max_iteration_, [&](int64_t begin,
+                                                        int64_t end) {
         CorrespondenceSet ransac_corres(ransac_n);
         RegistrationResult best_result_local;
-        int exit_itr_local = criteria.max_iteration_;
-
-#pragma omp for nowait
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (itr < exit_itr_local) {
-                for (int j = 0; j < ransac_n; j++) {
-                    ransac_corres[j] = corres[utility::UniformRandInt(
-                            0, static_cast<int>(corres.size()) - 1)];
-                }
 
-                Eigen::Matrix4d transformation =
-                        estimation.ComputeTransformation(source, target,
-                                                         ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (!check) continue;
-
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto result = EvaluateRANSACBasedOnCorrespondence(
-                        pcd, target, corres, max_correspondence_distance,
-                        transformation);
-
-                if (result.IsBetterRANSACThan(best_result_local)) {
-                    best_result_local = result;
-
-                    // Update exit condition if necessary
-                    double exit_itr_d =
-                            std::log(1.0 - criteria.confidence_) /
-                            std::log(1.0 - std::pow(result.fitness_, ransac_n));
-                    exit_itr_local =
-                            exit_itr_d < double(criteria.max_iteration_)
-                                    ? static_cast<int>(std::ceil(exit_itr_d))
-                                    : exit_itr_local;
+        for (int itr = int(begin); itr < int(end) && itr < exit_itr; itr++) {
+            for (int j = 0; j < ransac_n; j++) {
+                ransac_corres[j] = corres[utility::UniformRandInt(
+                        0, static_cast<int>(corres.size()) - 1)];
+            }
+
+            Eigen::Matrix4d transformation = estimation.ComputeTransformation(
+                    source, target, ransac_corres);
+
+            // Check transformation: inexpensive
+            bool check = true;
+            for (const auto &checker : checkers) {
+                if (!checker.get().Check(source, target, ransac_corres,
+                                         transformation)) {
+                    check = false;
+                    break;
                 }
-            }  // if < exit_itr_local
-        }      // for loop
-#pragma omp critical
-        {
-            if (best_result_local.IsBetterRANSACThan(best_result)) {
-                best_result = best_result_local;
             }
-            if (exit_itr_local > exit_itr) {
-                exit_itr = exit_itr_local;
+            if (!check) continue;
+
+            geometry::PointCloud pcd = source;
+            pcd.Transform(transformation);
+            auto result = EvaluateRANSACBasedOnCorrespondence(
+                    pcd, target, corres, max_correspondence_distance,
+                    transformation);
+
+            if (result.IsBetterRANSACThan(best_result_local)) {
+                best_result_local = result;
+
+                // Update exit condition if necessary
+                double exit_itr_d =
+                        std::log(1.0 - criteria.confidence_) /
+                        std::log(1.0 - std::pow(result.fitness_, ransac_n));
+                if (exit_itr_d < double(criteria.max_iteration_)) {
+                    const int new_exit_itr =
+                            static_cast<int>(std::ceil(exit_itr_d));
+                    int current = exit_itr.load();
+                    while (new_exit_itr < current &&
+                           !exit_itr.compare_exchange_weak(current,
+                                                           new_exit_itr)) {
+                    }
+                }
             }
         }
-    }
+        std::lock_guard<std::mutex> lock(best_result_mutex);
+        if (best_result_local.IsBetterRANSACThan(best_result)) {
+            best_result = best_result_local;
+        }
+    });
     utility::LogDebug(
             "RANSAC exits at {:d}-th iteration: inlier ratio {:e}, "
             "RMSE {:e}",
-            exit_itr, best_result.fitness_, best_result.inlier_rmse_);
+            exit_itr.load(), best_result.fitness_, best_result.inlier_rmse_);
     return best_result;
 }
 
@@ -285,7 +327,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
-        /* = RANSACConvergenceCriteria()*/) {
+        /* = RANSACConvergenceCriteria()*/,
+        const FeatureMatchingOption &matching_option
+        /* = FeatureMatchingOption()*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -293,34 +337,20 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     int num_src_pts = int(source.points_.size());
     int num_tgt_pts = int(target.points_.size());
 
-    geometry::KDTreeFlann kdtree_target(target_feature);
+    std::vector<int> matches_ij =
+            MatchFeatures(source_feature, target_feature, matching_option);
     pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
-
-#pragma omp parallel for
     for (int i = 0; i < num_src_pts; i++) {
-        std::vector<int> corres_tmp(1);
-        std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
+        corres_ij[i] = Eigen::Vector2i(i, matches_ij[i]);
     }
 
     // Do reverse check if mutual_filter is enabled
     if (mutual_filter) {
-        geometry::KDTreeFlann kdtree_source(source_feature);
+        std::vector<int> matches_ji =
+                MatchFeatures(target_feature, source_feature, matching_option);
         pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
-
-#pragma omp parallel for
         for (int j = 0; j < num_tgt_pts; ++j) {
-            std::vector<int> corres_tmp(1);
-            std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
+            corres_ji[j] = Eigen::Vector2i(matches_ji[j], j);
         }
 
         pipelines::registration::CorrespondenceSet corres_mutual;
@@ -368,35 +398,39 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first in this implementation
     Eigen::Matrix6d GTG = Eigen::Matrix6d::Zero();
-#pragma omp parallel
-    {
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
-#pragma omp for nowait
-        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
-            int t = result.correspondence_set_[c](1);
-            double x = target.points_[t](0);
-            double y = target.points_[t](1);
-            double z = target.points_[t](2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-        }
-#pragma omp critical
-        { GTG += GTG_private; }
-    }
+    std::mutex GTG_mutex;
+    core::ParallelForRange(
+            int64_t(result.correspondence_set_.size()),
+            [&](int64_t begin, int64_t end) {
+                Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
+                Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
+                for (int64_t c = begin; c < end; c++) {
+                    int t = result.correspondence_set_[c](1);
+                    double x = target.points_[t](0);
+                    double y = target.points_[t](1);
+                    double z = target.points_[t](2);
+                    G_r_private.setZero();
+                    G_r_private(1) = z;
+                    G_r_private(2) = -y;
+                    G_r_private(3) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = -z;
+                    G_r_private(2) = x;
+                    G_r_private(4) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                    G_r_private.setZero();
+                    G_r_private(0) = y;
+                    G_r_private(1) = -x;
+                    G_r_private(5) = 1.0;
+                    GTG_private.noalias() +=
+                            G_r_private * G_r_private.transpose();
+                }
+                std::lock_guard<std::mutex> lock(GTG_mutex);
+                GTG += GTG_private;
+            });
     return GTG;
 }
 
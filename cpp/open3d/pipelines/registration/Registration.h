@@ -109,6 +109,42 @@ public:
     double confidence_;
 };
 
+/// \class FeatureMatchingOption
+///
+/// \brief Class that defines how features are matched to their nearest
+/// neighbor.
+///
+/// Features are matched exactly with a KDTree by default. Approximate matching
+/// with a randomized k-d forest is much faster for high dimensional features
+/// such as FPFH. The few wrong matches it returns are rejected by RANSAC as
+/// outliers.
+class FeatureMatchingOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param approximate Use approximate nearest neighbor search.
+    /// \param num_trees Number of randomized k-d trees for approximate search.
+    /// \param max_checks Maximum number of features compared per query in
+    /// approximate search. Higher values give more exact matches at the cost
+    /// of speed.
+    FeatureMatchingOption(bool approximate = false,
+                          int num_trees = 4,
+                          int max_checks = 128)
+        : approximate_(approximate),
+          num_trees_(num_trees),
+          max_checks_(max_checks) {}
+
+    ~FeatureMatchingOption() {}
+
+public:
+    /// Use approximate nearest neighbor search.
+    bool approximate_;
+    /// Number of randomized k-d trees for approximate search.
+    int num_trees_;
+    /// Maximum number of features compared per query in approximate search.
+    int max_checks_;
+};
+
 /// \class RegistrationResult
 ///
 /// Class that contains the registration results.
@@ -211,6 +247,7 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param ransac_n Fit ransac with `ransac_n` correspondences.
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
+/// \param matching_option Options for matching the features.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -224,7 +261,9 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria =
-                RANSACConvergenceCriteria());
+                RANSACConvergenceCriteria(),
+        const FeatureMatchingOption &matching_option =
+                FeatureMatchingOption());
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
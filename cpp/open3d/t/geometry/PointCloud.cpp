@@ -31,6 +31,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
@@ -249,6 +250,100 @@ PointCloud PointCloud::VoxelDownSample(
     return pcd_down;
 }
 
+PointCloud PointCloud::VoxelDownSample(
+        double voxel_size, open3d::geometry::VoxelReduction reduction) const {
+    using open3d::geometry::VoxelReduction;
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    if (device_.GetType() != core::Device::DeviceType::CPU) {
+        utility::LogError(
+                "VoxelDownSample with a reduction only supports CPU, but the "
+                "point cloud is on {}.",
+                device_.ToString());
+    }
+    core::Tensor points = GetPoints().To(core::Dtype::Float64).Contiguous();
+    open3d::geometry::VoxelGrouping grouping(
+            static_cast<const Eigen::Vector3d *>(points.GetDataPtr()),
+            points.GetLength(), voxel_size, Eigen::Vector3d::Zero());
+    const int64_t num_voxels = grouping.GetNumVoxels();
+
+    // Indices of the points selected by First or ClosestToCenter.
+    auto select_points = [&](VoxelReduction selection) {
+        return core::Tensor(grouping.SelectPoints(selection), {num_voxels},
+                            core::Dtype::Int64, device_);
+    };
+    const bool selects = reduction == VoxelReduction::First ||
+                         reduction == VoxelReduction::ClosestToCenter;
+    core::Tensor selected;
+    if (selects) {
+        selected = select_points(reduction);
+    }
+
+    PointCloud pcd_down(device_);
+    for (auto &kv : point_attr_) {
+        if (selects) {
+            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({selected}));
+            continue;
+        }
+        if (kv.second.GetDtype() == core::Dtype::Bool) {
+            if (selected.NumElements() == 0) {
+                selected = select_points(VoxelReduction::First);
+            }
+            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({selected}));
+            continue;
+        }
+        core::Tensor values = kv.second.Contiguous();
+        core::SizeVector shape = values.GetShape();
+        const int64_t num_columns =
+                core::SizeVector(shape.begin() + 1, shape.end()).NumElements();
+        shape[0] = num_voxels;
+        core::Tensor reduced =
+                core::Tensor::Empty(shape, values.GetDtype(), device_);
+        DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+            grouping.Reduce(reduction, values.GetDataPtr<scalar_t>(),
+                            num_columns, reduced.GetDataPtr<scalar_t>());
+        });
+        pcd_down.SetPointAttr(kv.first, reduced);
+    }
+    return pcd_down;
+}
+
+core::Tensor PointCloud::ClusterDBSCAN(double eps,
+                                       size_t min_points,
+                                       bool print_progress) const {
+    open3d::geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ =
+            core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
+    std::vector<int> labels =
+            pcd_legacy.ClusterDBSCAN(eps, min_points, print_progress);
+    return core::Tensor(labels, {int64_t(labels.size())}, core::Dtype::Int32,
+                        device_);
+}
+
+void PointCloud::EstimateNormals(int max_nn,
+                                 utility::optional<double> radius) {
+    open3d::geometry::PointCloud pcd_legacy;
+    pcd_legacy.points_ =
+            core::eigen_converter::TensorToEigenVector3dVector(GetPoints());
+    core::Dtype dtype = GetPoints().GetDtype();
+    if (HasPointNormals()) {
+        dtype = GetPointNormals().GetDtype();
+        pcd_legacy.normals_ =
+                core::eigen_converter::TensorToEigenVector3dVector(
+                        GetPointNormals());
+    }
+    if (radius.has_value()) {
+        pcd_legacy.EstimateNormals(open3d::geometry::KDTreeSearchParamHybrid(
+                radius.value(), max_nn));
+    } else {
+        pcd_legacy.EstimateNormals(
+                open3d::geometry::KDTreeSearchParamKNN(max_nn));
+    }
+    SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
+            pcd_legacy.normals_, dtype, device_));
+}
+
 static PointCloud CreatePointCloudWithNormals(
         const Image &depth_in, /* UInt16 or Float32 */
         const Image &color_in, /* Float32 */
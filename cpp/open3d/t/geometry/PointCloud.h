@@ -38,6 +38,7 @@
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -321,6 +322,51 @@ public:
                                const core::HashmapBackend &backend =
                                        core::HashmapBackend::Default) const;
 
+    /// \brief Downsamples a CPU point cloud with a specified voxel size.
+    ///
+    /// Voxels are aligned with the origin. The points of each voxel are
+    /// reduced to one point with all its attributes, as by the legacy
+    /// geometry::PointCloud::VoxelDownSample. The output points are ordered
+    /// by voxel.
+    ///
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param reduction How the points of a voxel are reduced. Mean and
+    /// Median round integer attributes; Bool attributes are taken from the
+    /// first point of the voxel.
+    PointCloud VoxelDownSample(double voxel_size,
+                               open3d::geometry::VoxelReduction reduction) const;
+
+    /// \brief Clusters the points with DBSCAN.
+    ///
+    /// The labels are those of the legacy geometry::PointCloud::ClusterDBSCAN,
+    /// whose grid-based parallel implementation runs on a Float64 CPU copy of
+    /// the points.
+    ///
+    /// \param eps Distance below which points are neighbors.
+    /// \param min_points Minimum number of neighbors, the point itself
+    /// included, of a core point.
+    /// \param print_progress If true, the progress is shown in the console.
+    /// \return Int32 labels of shape {N} on the device of the point cloud. -1
+    /// indicates noise.
+    core::Tensor ClusterDBSCAN(double eps,
+                               size_t min_points,
+                               bool print_progress = false) const;
+
+    /// \brief Estimates the normals of the points.
+    ///
+    /// The normals are those of the legacy geometry::PointCloud
+    /// ::EstimateNormals with the closed-form eigensolver, computed on a
+    /// Float64 CPU copy of the points. Existing normals are used to orient the
+    /// new ones and keep their dtype; otherwise the normals have the dtype of
+    /// the points.
+    ///
+    /// \param max_nn Maximum number of neighbors.
+    /// \param radius If given, neighbors are also limited to this radius
+    /// (hybrid search), otherwise the \p max_nn nearest neighbors are used.
+    void EstimateNormals(
+            int max_nn = 30,
+            utility::optional<double> radius = utility::nullopt);
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <mutex>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
@@ -87,8 +89,9 @@ void ProjectCPU(
                 float* depth_ptr = depth_indexer.GetDataPtr<float>(
                         static_cast<int64_t>(u), static_cast<int64_t>(v));
                 float d = zc * depth_scale;
-#pragma omp critical
                 {
+                    static std::mutex mutex;
+                    std::lock_guard<std::mutex> lock(mutex);
                     if (*depth_ptr == 0 || *depth_ptr >= d) {
                         *depth_ptr = d;
 
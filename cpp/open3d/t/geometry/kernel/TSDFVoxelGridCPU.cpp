@@ -31,6 +31,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/CPU/OpenAddressingHashmap.h"
 #include "open3d/core/hashmap/CPU/TBBHashmap.h"
 #include "open3d/core/hashmap/Dispatch.h"
 #include "open3d/core/kernel/CPULauncher.h"
@@ -26,6 +26,7 @@
 
 #include <atomic>
 #include <cmath>
+#include <mutex>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -1076,8 +1077,9 @@ void EstimateRangeCPU
                 atomicMinf(&(range_ptr[0]), z_min);
                 atomicMaxf(&(range_ptr[1]), z_max);
 #else
-#pragma omp critical
                 {
+                    static std::mutex mutex;
+                    std::lock_guard<std::mutex> lock(mutex);
                     range_ptr[0] = min(z_min, range_ptr[0]);
                     range_ptr[1] = max(z_max, range_ptr[1]);
                 }
@@ -1109,12 +1111,13 @@ struct BlockCache {
     }
 };
 
+template <typename HashmapImpl>
 #if defined(__CUDACC__)
-void RayCastCUDA
+void RayCastImplCUDA
 #else
-void RayCastCPU
+void RayCastImplCPU
 #endif
-        (std::shared_ptr<core::DeviceHashmap>& hashmap,
+        (const HashmapImpl& hashmap_impl,
          const core::Tensor& block_values,
          const core::Tensor& range_map,
          core::Tensor& vertex_map,
@@ -1133,21 +1136,6 @@ void RayCastCPU
          float depth_max,
          float weight_threshold) {
     using Key = core::Block<int, 3>;
-    using Hash = core::BlockHash<int, 3>;
-
-#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    auto cuda_hashmap =
-            std::dynamic_pointer_cast<core::StdGPUHashmap<Key, Hash>>(hashmap);
-    if (cuda_hashmap == nullptr) {
-        utility::LogError(
-                "Unsupported backend: CUDA raycasting only supports STDGPU.");
-    }
-    auto hashmap_impl = cuda_hashmap->GetImpl();
-#else
-    auto cpu_hashmap =
-            std::dynamic_pointer_cast<core::TBBHashmap<Key, Hash>>(hashmap);
-    auto hashmap_impl = *cpu_hashmap->GetImpl();
-#endif
 
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
     NDArrayIndexer range_map_indexer(range_map, 2);
@@ -1510,6 +1498,66 @@ void RayCastCPU
 #endif
 }
 
+#if defined(__CUDACC__)
+void RayCastCUDA
+#else
+void RayCastCPU
+#endif
+        (std::shared_ptr<core::DeviceHashmap>& hashmap,
+         const core::Tensor& block_values,
+         const core::Tensor& range_map,
+         core::Tensor& vertex_map,
+         core::Tensor& depth_map,
+         core::Tensor& color_map,
+         core::Tensor& normal_map,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         int h,
+         int w,
+         int64_t block_resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_min,
+         float depth_max,
+         float weight_threshold) {
+    using Key = core::Block<int, 3>;
+    using Hash = core::BlockHash<int, 3>;
+
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    auto cuda_hashmap =
+            std::dynamic_pointer_cast<core::StdGPUHashmap<Key, Hash>>(hashmap);
+    if (cuda_hashmap == nullptr) {
+        utility::LogError(
+                "Unsupported backend: CUDA raycasting only supports STDGPU.");
+    }
+    RayCastImplCUDA(cuda_hashmap->GetImpl(), block_values, range_map,
+                    vertex_map, depth_map, color_map, normal_map, intrinsics,
+                    extrinsics, h, w, block_resolution, voxel_size, sdf_trunc,
+                    depth_scale, depth_min, depth_max, weight_threshold);
+#else
+    if (auto cpu_hashmap = std::dynamic_pointer_cast<
+                core::OpenAddressingHashmap<Key, Hash>>(hashmap)) {
+        RayCastImplCPU(cpu_hashmap->GetImpl(), block_values, range_map,
+                       vertex_map, depth_map, color_map, normal_map,
+                       intrinsics, extrinsics, h, w, block_resolution,
+                       voxel_size, sdf_trunc, depth_scale, depth_min,
+                       depth_max, weight_threshold);
+    } else if (auto cpu_hashmap = std::dynamic_pointer_cast<
+                       core::TBBHashmap<Key, Hash>>(hashmap)) {
+        RayCastImplCPU(*cpu_hashmap->GetImpl(), block_values, range_map,
+                       vertex_map, depth_map, color_map, normal_map,
+                       intrinsics, extrinsics, h, w, block_resolution,
+                       voxel_size, sdf_trunc, depth_scale, depth_min,
+                       depth_max, weight_threshold);
+    } else {
+        utility::LogError(
+                "Unsupported backend: CPU raycasting only supports TBB and "
+                "OpenAddressing.");
+    }
+#endif
+}
+
 }  // namespace tsdf
 }  // namespace kernel
 }  // namespace geometry
@@ -26,8 +26,10 @@
 
 #include "open3d/t/io/ImageIO.h"
 
+#include <algorithm>
 #include <unordered_map>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -38,7 +40,7 @@ namespace io {
 
 static const std::unordered_map<
         std::string,
-        std::function<bool(const std::string &, geometry::Image &)>>
+        std::function<bool(const std::string &, geometry::Image &, bool)>>
         file_extension_to_image_read_function{
                 {"png", ReadImageFromPNG},
                 {"jpg", ReadImageFromJPG},
@@ -62,6 +64,12 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 }
 
 bool ReadImage(const std::string &filename, geometry::Image &image) {
+    return ReadImage(filename, image, /*reuse_storage=*/false);
+}
+
+bool ReadImage(const std::string &filename,
+               geometry::Image &image,
+               bool reuse_storage) {
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -76,7 +84,47 @@ bool ReadImage(const std::string &filename, geometry::Image &image) {
                 filename_ext);
         return false;
     }
-    return map_itr->second(filename, image);
+    return map_itr->second(filename, image, reuse_storage);
+}
+
+bool ReadImages(const std::vector<std::string> &filenames,
+                core::Tensor &images) {
+    if (filenames.empty()) {
+        utility::LogWarning("Read images failed: no filenames given.");
+        return false;
+    }
+    geometry::Image first;
+    if (!ReadImage(filenames[0], first)) {
+        return false;
+    }
+    const int64_t num_images = static_cast<int64_t>(filenames.size());
+    const core::SizeVector shape{num_images, first.GetRows(), first.GetCols(),
+                                 first.GetChannels()};
+    const core::Device device("CPU:0");
+    if (images.GetShape() != shape || images.GetDtype() != first.GetDtype() ||
+        images.GetDevice() != device || !images.IsContiguous()) {
+        images = core::Tensor(shape, first.GetDtype(), device);
+    }
+    images[0].AsRvalue() = first.AsTensor();
+
+    // Decode the other images directly into their slices of the output.
+    std::vector<uint8_t> success(num_images, 1);
+    core::ParallelFor(num_images - 1, [&](int64_t i) {
+        const int64_t index = i + 1;
+        core::Tensor slice = images[index];
+        geometry::Image image(slice);
+        if (!ReadImage(filenames[index], image, /*reuse_storage=*/true)) {
+            success[index] = 0;
+        } else if (image.GetDataPtr() != slice.GetDataPtr()) {
+            utility::LogWarning(
+                    "Read images failed: {} does not have the size, channels "
+                    "and dtype of {}.",
+                    filenames[index], filenames[0]);
+            success[index] = 0;
+        }
+    });
+    return std::all_of(success.begin(), success.end(),
+                       [](uint8_t s) { return s != 0; });
 }
 
 bool WriteImage(const std::string &filename,
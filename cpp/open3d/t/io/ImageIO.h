@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/ImageIO.h"
 #include "open3d/t/geometry/Image.h"
@@ -48,6 +49,32 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 /// \return return true if the read function is successful, false otherwise.
 bool ReadImage(const std::string &filename, geometry::Image &image);
 
+/// \brief Reads an image, reusing the storage of \p image if possible.
+///
+/// If \p reuse_storage is true and \p image is contiguous and already has the
+/// size, channels and dtype of the file, the file is decoded into its storage
+/// without allocating. Other images sharing that storage see the new content.
+/// Otherwise \p image is reallocated as in ReadImage().
+/// \param filename Full path to image. Supported file formats are png,
+/// jpg/jpeg.
+/// \param image An object of type open3d::t::geometry::Image.
+/// \param reuse_storage Decode into the existing storage of \p image.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadImage(const std::string &filename,
+               geometry::Image &image,
+               bool reuse_storage);
+
+/// \brief Reads images in parallel into one stacked tensor.
+///
+/// All images must have the size, channels and dtype of the first one. The
+/// storage of \p images is reused if it is a contiguous CPU tensor of the
+/// resulting shape and dtype.
+/// \param filenames Full paths to the images.
+/// \param images Output tensor of shape (N, H, W, C) on CPU.
+/// \return return true if all images are read successfully, false otherwise.
+bool ReadImages(const std::vector<std::string> &filenames,
+                core::Tensor &images);
+
 constexpr int kOpen3DImageIODefaultQuality = -1;
 
 /// The general entrance for writing an Image to a file
@@ -74,13 +101,17 @@ bool WriteImage(const std::string &filename,
                 const geometry::Image &image,
                 int quality = kOpen3DImageIODefaultQuality);
 
-bool ReadImageFromPNG(const std::string &filename, geometry::Image &image);
+bool ReadImageFromPNG(const std::string &filename,
+                      geometry::Image &image,
+                      bool reuse_storage = false);
 
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality = kOpen3DImageIODefaultQuality);
 
-bool ReadImageFromJPG(const std::string &filename, geometry::Image &image);
+bool ReadImageFromJPG(const std::string &filename,
+                      geometry::Image &image,
+                      bool reuse_storage = false);
 
 bool WriteImageToJPG(const std::string &filename,
                      const geometry::Image &image,
@@ -48,6 +48,8 @@ static const std::unordered_map<
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
                 {"pts", ReadPointCloudFromPTS},
+                {"pcd", ReadPointCloudFromPCD},
+                {"o3dt", ReadPointCloudFromO3DT},
         };
 
 static const std::unordered_map<
@@ -59,6 +61,8 @@ static const std::unordered_map<
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
                 {"pts", WritePointCloudToPTS},
+                {"pcd", WritePointCloudToPCD},
+                {"o3dt", WritePointCloudToO3DT},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
@@ -91,8 +95,11 @@ bool ReadPointCloud(const std::string &filename,
                 legacy_pointcloud, core::Dtype::Float64);
     } else {
         success = map_itr->second(filename, pointcloud, params);
+        if (!success) return false;
         utility::LogDebug("Read geometry::PointCloud: {:d} vertices.",
-                          (int)pointcloud.GetPoints().GetLength());
+                          pointcloud.HasPoints()
+                                  ? (int)pointcloud.GetPoints().GetLength()
+                                  : 0);
         if (params.remove_nan_points || params.remove_infinite_points) {
             utility::LogError(
                     "remove_nan_points and remove_infinite_points options are "
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -85,6 +86,44 @@ bool WritePointCloudToPTS(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+/// Reads ascii, binary and binary_compressed PCD files. x, y and z are read
+/// into "points", normal_x, normal_y and normal_z into "normals", packed "rgb"
+/// or "rgba" into UInt8 "colors", and every other field into the attribute
+/// named after it, with one column per element and the Dtype of the field.
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// Writes all point attributes as PCD fields, with the colors packed into
+/// "rgb". binary_compressed data is compressed in parallel chunks.
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
+/// Converts colors to UInt8, scaling floating point colors from [0, 1] and
+/// Bool colors to [0, 255].
+core::Tensor ConvertColorTensorToUint8(const core::Tensor &color_in);
+
+/// Reads the native tensor container format. The file is memory-mapped and
+/// the attributes are CPU tensors viewing the mapping, so nothing is copied.
+/// The mapping is private: modifying the tensors does not change the file.
+bool ReadPointCloudFromO3DT(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const ReadPointCloudOption &params);
+
+/// Writes all point attributes, each as a contiguous aligned blob.
+bool WritePointCloudToO3DT(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const WritePointCloudOption &params);
+
+/// Writes the concatenation of \p pointclouds, which must have the same
+/// attributes, as WritePointCloudToO3DT would write it. The point clouds are
+/// written one after the other instead of being concatenated in memory.
+bool WritePointCloudsToO3DT(
+        const std::string &filename,
+        const std::vector<geometry::PointCloud> &pointclouds,
+        const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
@@ -0,0 +1,1145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/t/io/PointCloudStreamIO.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/t/io/file_format/FileFormatUtil.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+using ParseFunc = bool (*)(const char *&pos, void *dst);
+using FormatFunc = void (*)(const void *src, bool fixed, std::string &out);
+
+/// One scalar value of a record in the file and the attribute column it is
+/// stored in.
+struct FieldLayout {
+    std::string name_;
+    // Dtype in the file. Undefined for unsupported types, which are skipped.
+    core::Dtype dtype_;
+    // Byte size and offset in a binary record.
+    int64_t byte_size_ = 0;
+    int64_t offset_ = 0;
+    // Index of the attribute in RecordLayout::attributes_, or -1 if skipped.
+    int64_t attribute_ = -1;
+    int64_t column_ = 0;
+    // PCD "rgb" and "rgba": 4 bytes packing the 3 UInt8 color columns.
+    bool packed_rgb_ = false;
+    ParseFunc parse_ = nullptr;
+    FormatFunc format_ = nullptr;
+};
+
+struct AttributeLayout {
+    std::string key_;
+    core::Dtype dtype_;
+    int64_t num_columns_;
+};
+
+/// Layout of the point records of a file.
+struct RecordLayout {
+    bool binary_ = false;
+    bool big_endian_ = false;
+    // Byte size of a binary record.
+    int64_t stride_ = 0;
+    std::vector<FieldLayout> fields_;
+    std::vector<AttributeLayout> attributes_;
+};
+
+using CombinedAttributes =
+        std::vector<std::pair<std::string, std::vector<std::string>>>;
+
+const CombinedAttributes kPLYCombinedAttributes = {
+        {"points", {"x", "y", "z"}},
+        {"normals", {"nx", "ny", "nz"}},
+        {"colors", {"red", "green", "blue"}}};
+
+const CombinedAttributes kPCDCombinedAttributes = {
+        {"points", {"x", "y", "z"}},
+        {"normals", {"normal_x", "normal_y", "normal_z"}}};
+
+template <typename scalar_t>
+bool ParseValue(const char *&pos, void *dst) {
+    char *end = nullptr;
+    scalar_t value;
+    if (std::is_floating_point<scalar_t>::value) {
+        value = static_cast<scalar_t>(std::strtod(pos, &end));
+    } else if (std::is_signed<scalar_t>::value) {
+        value = static_cast<scalar_t>(std::strtoll(pos, &end, 10));
+    } else {
+        value = static_cast<scalar_t>(std::strtoull(pos, &end, 10));
+    }
+    if (end == pos) {
+        return false;
+    }
+    std::memcpy(dst, &value, sizeof(scalar_t));
+    pos = end;
+    return true;
+}
+
+bool SkipToken(const char *&pos) {
+    while (std::isspace(static_cast<unsigned char>(*pos))) {
+        ++pos;
+    }
+    const char *begin = pos;
+    while (*pos != '\0' && !std::isspace(static_cast<unsigned char>(*pos))) {
+        ++pos;
+    }
+    return pos != begin;
+}
+
+bool IsBlankLine(const char *line) {
+    while (std::isspace(static_cast<unsigned char>(*line))) {
+        ++line;
+    }
+    return *line == '\0';
+}
+
+/// Appends \p src as text. Floating point values are written with enough
+/// digits to be read back exactly, or with 10 decimals if \p fixed.
+template <typename scalar_t>
+void FormatValue(const void *src, bool fixed, std::string &out) {
+    scalar_t value;
+    std::memcpy(&value, src, sizeof(scalar_t));
+    char buffer[64];
+    int length;
+    if (std::is_floating_point<scalar_t>::value) {
+        const char *format = fixed ? "%.10f"
+                                   : (sizeof(scalar_t) == 4 ? "%.9g" : "%.17g");
+        length = snprintf(buffer, sizeof(buffer), format,
+                          static_cast<double>(value));
+    } else if (std::is_signed<scalar_t>::value) {
+        length = snprintf(buffer, sizeof(buffer), "%lld",
+                          static_cast<long long>(value));
+    } else {
+        length = snprintf(buffer, sizeof(buffer), "%llu",
+                          static_cast<unsigned long long>(value));
+    }
+    out.append(buffer, static_cast<size_t>(std::max(length, 0)));
+}
+
+/// Sets the text parser and formatter of the supported fields.
+void PrepareFields(RecordLayout &layout) {
+    for (FieldLayout &field : layout.fields_) {
+        if (field.dtype_ == core::Dtype::Undefined) {
+            continue;
+        }
+        DISPATCH_DTYPE_TO_TEMPLATE(field.dtype_, [&]() {
+            field.parse_ = ParseValue<scalar_t>;
+            field.format_ = FormatValue<scalar_t>;
+        });
+    }
+}
+
+/// Stores the fields of each entry of \p combined_attrs in the columns of an
+/// {n, 3} attribute if all of them exist with the same Dtype, and each other
+/// supported field in the attribute named after it, with one column per field
+/// of that name.
+void AssignAttributes(RecordLayout &layout,
+                      const CombinedAttributes &combined_attrs) {
+    auto find_attribute = [&](const std::string &key) -> int64_t {
+        for (size_t i = 0; i < layout.attributes_.size(); ++i) {
+            if (layout.attributes_[i].key_ == key) {
+                return static_cast<int64_t>(i);
+            }
+        }
+        return -1;
+    };
+
+    for (const auto &combined_attr : combined_attrs) {
+        std::vector<FieldLayout *> fields;
+        for (const std::string &name : combined_attr.second) {
+            for (FieldLayout &field : layout.fields_) {
+                if (field.name_ == name && !field.packed_rgb_ &&
+                    field.dtype_ != core::Dtype::Undefined &&
+                    (fields.empty() || field.dtype_ == fields[0]->dtype_)) {
+                    fields.push_back(&field);
+                    break;
+                }
+            }
+        }
+        if (fields.size() != combined_attr.second.size() ||
+            find_attribute(combined_attr.first) >= 0) {
+            continue;
+        }
+        for (size_t c = 0; c < fields.size(); ++c) {
+            fields[c]->attribute_ =
+                    static_cast<int64_t>(layout.attributes_.size());
+            fields[c]->column_ = static_cast<int64_t>(c);
+        }
+        layout.attributes_.push_back(
+                {combined_attr.first, fields[0]->dtype_,
+                 static_cast<int64_t>(fields.size())});
+    }
+
+    for (FieldLayout &field : layout.fields_) {
+        if (field.attribute_ >= 0 || field.dtype_ == core::Dtype::Undefined) {
+            continue;
+        }
+        if (field.packed_rgb_) {
+            if (find_attribute("colors") < 0) {
+                field.attribute_ =
+                        static_cast<int64_t>(layout.attributes_.size());
+                layout.attributes_.push_back({"colors", core::Dtype::UInt8, 3});
+            }
+            continue;
+        }
+        int64_t attribute = find_attribute(field.name_);
+        if (attribute < 0) {
+            attribute = static_cast<int64_t>(layout.attributes_.size());
+            layout.attributes_.push_back({field.name_, field.dtype_, 0});
+        } else if (layout.attributes_[attribute].dtype_ != field.dtype_) {
+            continue;
+        }
+        field.attribute_ = attribute;
+        field.column_ = layout.attributes_[attribute].num_columns_++;
+    }
+}
+
+/// Reads a PLY header and skips the elements before "vertex", leaving the
+/// file at the first vertex record.
+bool ReadPLYHeader(utility::filesystem::CFile &file,
+                   RecordLayout &layout,
+                   int64_t &num_points) {
+    struct Element {
+        std::string name_;
+        int64_t count_ = 0;
+        bool has_list_ = false;
+        RecordLayout layout_;
+    };
+    std::vector<Element> elements;
+    bool has_format = false;
+    const char *line;
+    while ((line = file.ReadLine())) {
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            layout.binary_ = format != "ascii";
+            layout.big_endian_ = format == "binary_big_endian";
+            if (layout.binary_ && format != "binary_little_endian" &&
+                !layout.big_endian_) {
+                return false;
+            }
+            has_format = true;
+        } else if (keyword == "element") {
+            Element element;
+            if (!(tokens >> element.name_ >> element.count_) ||
+                element.count_ < 0) {
+                return false;
+            }
+            elements.push_back(element);
+        } else if (keyword == "property") {
+            if (elements.empty()) {
+                return false;
+            }
+            Element &element = elements.back();
+            FieldLayout field;
+            std::string type;
+            if (!(tokens >> type)) {
+                return false;
+            }
+            if (type == "list") {
+                element.has_list_ = true;
+                continue;
+            }
+            if (!(tokens >> field.name_)) {
+                return false;
+            }
+            field.byte_size_ = GetPLYTypeInfo(type, field.dtype_);
+            if (field.byte_size_ == 0) {
+                return false;
+            }
+            if (field.dtype_ == core::Dtype::Undefined &&
+                element.name_ == "vertex") {
+                utility::LogWarning(
+                        "Read PLY warning: skipping property \"{}\", "
+                        "unsupported datatype \"{}\".",
+                        field.name_, type);
+            }
+            field.offset_ = element.layout_.stride_;
+            element.layout_.stride_ += field.byte_size_;
+            element.layout_.fields_.push_back(field);
+        } else if (keyword == "end_header") {
+            break;
+        } else if (keyword != "ply" && keyword != "comment" &&
+                   keyword != "obj_info" && !keyword.empty()) {
+            return false;
+        }
+    }
+    if (!line || !has_format) {
+        return false;
+    }
+
+    for (const Element &element : elements) {
+        if (element.has_list_) {
+            utility::LogWarning(
+                    "Read PLY failed: list properties in element \"{}\" "
+                    "cannot be streamed.",
+                    element.name_);
+            return false;
+        }
+        if (element.name_ == "vertex") {
+            const bool binary = layout.binary_;
+            const bool big_endian = layout.big_endian_;
+            layout = element.layout_;
+            layout.binary_ = binary;
+            layout.big_endian_ = big_endian;
+            num_points = element.count_;
+            AssignAttributes(layout, kPLYCombinedAttributes);
+            return true;
+        }
+        if (layout.binary_) {
+            if (fseek(file.GetFILE(), element.count_ * element.layout_.stride_,
+                      SEEK_CUR) != 0) {
+                return false;
+            }
+        } else {
+            for (int64_t i = 0; i < element.count_; ++i) {
+                if (!file.ReadLine()) {
+                    return false;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/// Returns the Dtype of a PCD field of the given TYPE and SIZE, or Undefined.
+core::Dtype GetPCDDtype(char type, int64_t size) {
+    if (type == 'F') {
+        if (size == 4) return core::Dtype::Float32;
+        if (size == 8) return core::Dtype::Float64;
+    } else if (type == 'I') {
+        if (size == 1) return core::Dtype::Int8;
+        if (size == 2) return core::Dtype::Int16;
+        if (size == 4) return core::Dtype::Int32;
+        if (size == 8) return core::Dtype::Int64;
+    } else if (type == 'U') {
+        if (size == 1) return core::Dtype::UInt8;
+        if (size == 2) return core::Dtype::UInt16;
+        if (size == 4) return core::Dtype::UInt32;
+        if (size == 8) return core::Dtype::UInt64;
+    }
+    return core::Dtype::Undefined;
+}
+
+/// Reads a PCD header, leaving the file at the first point record.
+bool ReadPCDHeader(utility::filesystem::CFile &file,
+                   RecordLayout &layout,
+                   int64_t &num_points) {
+    std::vector<std::string> names;
+    std::vector<int64_t> sizes, counts;
+    std::vector<char> types;
+    int64_t width = 0, height = 1;
+    num_points = -1;
+    const char *line;
+    while ((line = file.ReadLine())) {
+        std::istringstream tokens(line);
+        std::string keyword, token;
+        tokens >> keyword;
+        if (keyword.empty() || keyword[0] == '#' || keyword == "VERSION" ||
+            keyword == "VIEWPOINT") {
+            continue;
+        } else if (keyword == "FIELDS" || keyword == "COLUMNS") {
+            while (tokens >> token) names.push_back(token);
+        } else if (keyword == "SIZE") {
+            while (tokens >> token) sizes.push_back(std::atoll(token.c_str()));
+        } else if (keyword == "TYPE") {
+            while (tokens >> token) types.push_back(token[0]);
+        } else if (keyword == "COUNT") {
+            while (tokens >> token) counts.push_back(std::atoll(token.c_str()));
+        } else if (keyword == "WIDTH") {
+            tokens >> width;
+        } else if (keyword == "HEIGHT") {
+            tokens >> height;
+        } else if (keyword == "POINTS") {
+            tokens >> num_points;
+        } else if (keyword == "DATA") {
+            tokens >> token;
+            if (token == "binary_compressed") {
+                utility::LogWarning(
+                        "Read PCD failed: binary_compressed data cannot be "
+                        "streamed.");
+                return false;
+            }
+            layout.binary_ = token == "binary";
+            if (!layout.binary_ && token != "ascii") {
+                return false;
+            }
+            break;
+        } else {
+            return false;
+        }
+    }
+    if (counts.empty()) {
+        counts.assign(names.size(), 1);
+    }
+    if (!line || names.empty() || sizes.size() != names.size() ||
+        types.size() != names.size() || counts.size() != names.size()) {
+        return false;
+    }
+    if (num_points < 0) {
+        num_points = width * height;
+    }
+
+    for (size_t i = 0; i < names.size(); ++i) {
+        for (int64_t c = 0; c < counts[i]; ++c) {
+            FieldLayout field;
+            field.name_ = names[i];
+            field.byte_size_ = sizes[i];
+            field.offset_ = layout.stride_;
+            if (names[i] != "_") {
+                field.dtype_ = GetPCDDtype(types[i], sizes[i]);
+                field.packed_rgb_ = (names[i] == "rgb" || names[i] == "rgba") &&
+                                    sizes[i] == 4;
+                if (field.dtype_ == core::Dtype::Undefined && c == 0) {
+                    utility::LogWarning(
+                            "Read PCD warning: skipping field \"{}\", "
+                            "unsupported type {}{}.",
+                            names[i], types[i], sizes[i]);
+                }
+            }
+            layout.stride_ += field.byte_size_;
+            layout.fields_.push_back(field);
+        }
+    }
+    AssignAttributes(layout, kPCDCombinedAttributes);
+    return true;
+}
+
+/// Builds the layout of a PTS file from its first point record: "x y z",
+/// optionally followed by the intensity and the 3 color values.
+bool ReadPTSHeader(utility::filesystem::CFile &file,
+                   RecordLayout &layout,
+                   int64_t &num_points) {
+    const char *line = file.ReadLine();
+    long long count = -1;
+    if (!line || std::sscanf(line, "%lld", &count) != 1 || count < 0) {
+        return false;
+    }
+    num_points = static_cast<int64_t>(count);
+    const int64_t data_pos = file.CurPos();
+    std::vector<std::string> names = {"x", "y", "z"};
+    if (num_points > 0 && (line = file.ReadLine())) {
+        int64_t num_tokens = 0;
+        for (const char *pos = line; SkipToken(pos);) {
+            ++num_tokens;
+        }
+        if (num_tokens == 4 || num_tokens == 7) {
+            names.push_back("intensities");
+        }
+        if (num_tokens == 6 || num_tokens == 7) {
+            names.insert(names.end(), {"red", "green", "blue"});
+        }
+        if (num_tokens != static_cast<int64_t>(names.size())) {
+            utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                line);
+            return false;
+        }
+    }
+    if (fseek(file.GetFILE(), data_pos, SEEK_SET) != 0) {
+        return false;
+    }
+    for (const std::string &name : names) {
+        FieldLayout field;
+        field.name_ = name;
+        field.dtype_ = name == "red" || name == "green" || name == "blue"
+                               ? core::Dtype::UInt8
+                               : core::Dtype::Float64;
+        layout.fields_.push_back(field);
+    }
+    AssignAttributes(layout, kPLYCombinedAttributes);
+    return true;
+}
+
+}  // namespace
+
+struct PointCloudReader::Impl {
+    utility::filesystem::CFile file_;
+    std::string format_;
+    RecordLayout layout_;
+    int64_t num_points_ = -1;
+    int64_t num_read_ = 0;
+    bool eof_ = true;
+    std::vector<char> buffer_;
+
+    int64_t ReadTextRecords(int64_t max_points,
+                            const std::vector<char *> &dst,
+                            const std::vector<int64_t> &dst_strides);
+    int64_t ReadBinaryRecords(int64_t max_points,
+                              const std::vector<char *> &dst,
+                              const std::vector<int64_t> &dst_strides);
+};
+
+/// Parses one line per point. Lines that are not valid records are skipped
+/// in XYZ files, as by the XYZ reader, and are an error otherwise.
+int64_t PointCloudReader::Impl::ReadTextRecords(
+        int64_t max_points,
+        const std::vector<char *> &dst,
+        const std::vector<int64_t> &dst_strides) {
+    int64_t count = 0;
+    const char *line;
+    while (count < max_points && (line = file_.ReadLine())) {
+        if (IsBlankLine(line)) {
+            continue;
+        }
+        const char *pos = line;
+        bool valid = true;
+        for (const FieldLayout &field : layout_.fields_) {
+            if (field.attribute_ < 0) {
+                valid = SkipToken(pos);
+            } else if (field.packed_rgb_) {
+                uint32_t rgb = 0;
+                valid = field.parse_(pos, &rgb);
+                uint8_t *color = reinterpret_cast<uint8_t *>(
+                        dst[field.attribute_] +
+                        count * dst_strides[field.attribute_]);
+                color[0] = (rgb >> 16) & 0xff;
+                color[1] = (rgb >> 8) & 0xff;
+                color[2] = rgb & 0xff;
+            } else {
+                valid = field.parse_(
+                        pos, dst[field.attribute_] +
+                                     count * dst_strides[field.attribute_] +
+                                     field.column_ * field.dtype_.ByteSize());
+            }
+            if (!valid) {
+                break;
+            }
+        }
+        if (valid) {
+            ++count;
+        } else if (format_ != "xyz") {
+            utility::LogError("Read {} failed: invalid record \"{}\".",
+                              utility::ToUpper(format_), line);
+        }
+    }
+    return count;
+}
+
+/// Reads the records in one block and copies each field to its column.
+int64_t PointCloudReader::Impl::ReadBinaryRecords(
+        int64_t max_points,
+        const std::vector<char *> &dst,
+        const std::vector<int64_t> &dst_strides) {
+    const int64_t stride = layout_.stride_;
+    buffer_.resize(static_cast<size_t>(max_points * stride));
+    const int64_t count = static_cast<int64_t>(file_.ReadData(
+            buffer_.data(), static_cast<size_t>(stride),
+            static_cast<size_t>(max_points)));
+    const bool byte_swap = layout_.big_endian_ == IsHostLittleEndian();
+    for (const FieldLayout &field : layout_.fields_) {
+        if (field.attribute_ < 0) {
+            continue;
+        }
+        const char *src = buffer_.data() + field.offset_;
+        char *field_dst = dst[field.attribute_];
+        const int64_t dst_stride = dst_strides[field.attribute_];
+        const int64_t byte_size = field.byte_size_;
+        const int64_t column_offset = field.column_ * byte_size;
+        const bool packed_rgb = field.packed_rgb_;
+        core::ParallelForRange(
+                count,
+                [&](int64_t begin, int64_t end) {
+                    char value[8];
+                    for (int64_t i = begin; i < end; ++i) {
+                        std::memcpy(value, src + i * stride, byte_size);
+                        if (byte_swap) {
+                            std::reverse(value, value + byte_size);
+                        }
+                        if (packed_rgb) {
+                            uint32_t rgb;
+                            std::memcpy(&rgb, value, sizeof(rgb));
+                            uint8_t *color = reinterpret_cast<uint8_t *>(
+                                    field_dst + i * dst_stride);
+                            color[0] = (rgb >> 16) & 0xff;
+                            color[1] = (rgb >> 8) & 0xff;
+                            color[2] = rgb & 0xff;
+                        } else {
+                            std::memcpy(field_dst + i * dst_stride +
+                                                column_offset,
+                                        value, byte_size);
+                        }
+                    }
+                },
+                1 << 14);
+    }
+    return count;
+}
+
+PointCloudReader::PointCloudReader() : impl_(new Impl()) {}
+
+PointCloudReader::~PointCloudReader() { Close(); }
+
+bool PointCloudReader::Open(const std::string &filename,
+                            const std::string &format) {
+    Close();
+    impl_->format_ = format;
+    if (format == "auto") {
+        impl_->format_ =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+    }
+    const std::string &fmt = impl_->format_;
+    if (fmt != "ply" && fmt != "pcd" && fmt != "xyz" && fmt != "pts") {
+        utility::LogWarning(
+                "PointCloudReader: streaming is not supported for format "
+                "\"{}\".",
+                fmt);
+        return false;
+    }
+    if (!impl_->file_.Open(filename, "rb")) {
+        utility::LogWarning("PointCloudReader: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    bool success = false;
+    try {
+        if (fmt == "ply") {
+            success = ReadPLYHeader(impl_->file_, impl_->layout_,
+                                    impl_->num_points_);
+        } else if (fmt == "pcd") {
+            success = ReadPCDHeader(impl_->file_, impl_->layout_,
+                                    impl_->num_points_);
+        } else if (fmt == "pts") {
+            success = ReadPTSHeader(impl_->file_, impl_->layout_,
+                                    impl_->num_points_);
+        } else {
+            for (const std::string name : {"x", "y", "z"}) {
+                FieldLayout field;
+                field.name_ = name;
+                field.dtype_ = core::Dtype::Float64;
+                impl_->layout_.fields_.push_back(field);
+            }
+            AssignAttributes(impl_->layout_, kPLYCombinedAttributes);
+            success = true;
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("PointCloudReader: {}", e.what());
+        success = false;
+    }
+    if (!success) {
+        utility::LogWarning(
+                "PointCloudReader: unable to read the {} header of {}.",
+                utility::ToUpper(fmt), filename);
+        Close();
+        return false;
+    }
+    PrepareFields(impl_->layout_);
+    impl_->eof_ = impl_->num_points_ == 0;
+    return true;
+}
+
+void PointCloudReader::Close() {
+    impl_->file_.Close();
+    impl_->layout_ = RecordLayout();
+    impl_->num_points_ = -1;
+    impl_->num_read_ = 0;
+    impl_->eof_ = true;
+    impl_->buffer_.clear();
+}
+
+bool PointCloudReader::IsOpened() const {
+    return impl_->file_.GetFILE() != nullptr;
+}
+
+int64_t PointCloudReader::GetNumPoints() const { return impl_->num_points_; }
+
+bool PointCloudReader::IsEOF() const { return impl_->eof_; }
+
+geometry::PointCloud PointCloudReader::Next(int64_t max_points) {
+    if (!IsOpened()) {
+        utility::LogError("PointCloudReader::Next() called on a closed file.");
+    }
+    if (max_points <= 0) {
+        utility::LogError("max_points must be positive, but got {}.",
+                          max_points);
+    }
+    int64_t num_points = impl_->eof_ ? 0 : max_points;
+    if (impl_->num_points_ >= 0) {
+        num_points = std::min(num_points,
+                              impl_->num_points_ - impl_->num_read_);
+    }
+
+    const std::vector<AttributeLayout> &attributes =
+            impl_->layout_.attributes_;
+    std::vector<core::Tensor> tensors;
+    std::vector<char *> dst;
+    std::vector<int64_t> dst_strides;
+    for (const AttributeLayout &attribute : attributes) {
+        tensors.push_back(core::Tensor::Empty(
+                {num_points, attribute.num_columns_}, attribute.dtype_));
+        dst.push_back(static_cast<char *>(tensors.back().GetDataPtr()));
+        dst_strides.push_back(attribute.num_columns_ *
+                              attribute.dtype_.ByteSize());
+    }
+
+    int64_t count = 0;
+    if (num_points > 0) {
+        count = impl_->layout_.binary_
+                        ? impl_->ReadBinaryRecords(num_points, dst, dst_strides)
+                        : impl_->ReadTextRecords(num_points, dst, dst_strides);
+    }
+    impl_->num_read_ += count;
+    if (count < num_points || impl_->num_read_ == impl_->num_points_) {
+        impl_->eof_ = true;
+    }
+    if (impl_->num_points_ >= 0 && impl_->num_read_ < impl_->num_points_ &&
+        impl_->eof_) {
+        utility::LogWarning(
+                "PointCloudReader: expected {} points, but read {}.",
+                impl_->num_points_, impl_->num_read_);
+    }
+
+    geometry::PointCloud chunk;
+    for (size_t i = 0; i < attributes.size(); ++i) {
+        chunk.SetPointAttr(attributes[i].key_,
+                           count < num_points ? tensors[i].Slice(0, 0, count)
+                                              : tensors[i]);
+    }
+    return chunk;
+}
+
+struct PointCloudWriter::Impl {
+    utility::filesystem::CFile file_;
+    std::string filename_;
+    std::string format_;
+    bool write_ascii_ = false;
+    // Whether the layout and the header have been written.
+    bool has_layout_ = false;
+    bool failed_ = false;
+    RecordLayout layout_;
+    // Attributes of the first chunk and their Dtypes in the input.
+    std::vector<AttributeLayout> inputs_;
+    // File positions of the point counts in the header.
+    std::vector<int64_t> count_positions_;
+    int64_t num_written_ = 0;
+
+    bool InitLayout(const geometry::PointCloud &chunk);
+    bool WriteHeader();
+    bool WriteRecords(const std::vector<core::Tensor> &tensors, int64_t n);
+};
+
+/// Derives the fields of the file from the attributes of \p chunk.
+bool PointCloudWriter::Impl::InitLayout(const geometry::PointCloud &chunk) {
+    // PTS records are "x y z [intensity] [r g b]".
+    const std::vector<std::string> leading_keys =
+            format_ == "pts"
+                    ? std::vector<std::string>{"points", "intensities",
+                                               "colors"}
+                    : std::vector<std::string>{"points", "normals", "colors"};
+    std::vector<std::string> keys;
+    for (const std::string &key : leading_keys) {
+        if (chunk.HasPointAttr(key)) keys.push_back(key);
+    }
+    std::vector<std::string> other_keys;
+    for (const auto &kv : chunk.GetPointAttr()) {
+        if (std::find(keys.begin(), keys.end(), kv.first) == keys.end()) {
+            other_keys.push_back(kv.first);
+        }
+    }
+    std::sort(other_keys.begin(), other_keys.end());
+    keys.insert(keys.end(), other_keys.begin(), other_keys.end());
+    if (keys.empty() || keys[0] != "points") {
+        utility::LogWarning("Write {} failed: point cloud has no points.",
+                            utility::ToUpper(format_));
+        return false;
+    }
+
+    const bool is_ply = format_ == "ply";
+    const bool is_pcd = format_ == "pcd";
+    for (const std::string &key : keys) {
+        const core::Tensor &tensor = chunk.GetPointAttr(key);
+        const core::Dtype input_dtype = tensor.GetDtype();
+        const int64_t num_columns =
+                tensor.NumDims() == 1 ? 1 : tensor.GetShape(1);
+        if (tensor.NumDims() > 2) {
+            utility::LogWarning(
+                    "Write {} failed: attribute \"{}\" has shape {}.",
+                    utility::ToUpper(format_), key, tensor.GetShape());
+            return false;
+        }
+
+        std::vector<std::string> names;
+        core::Dtype dtype = input_dtype;
+        bool packed_rgb = false;
+        if (key == "points") {
+            names = {"x", "y", "z"};
+        } else if (key == "normals" && (is_ply || is_pcd)) {
+            names = is_pcd ? std::vector<std::string>{"normal_x", "normal_y",
+                                                      "normal_z"}
+                           : std::vector<std::string>{"nx", "ny", "nz"};
+        } else if (key == "colors" && is_pcd) {
+            names = {"rgb"};
+            dtype = core::Dtype::UInt8;
+            packed_rgb = true;
+        } else if (key == "colors" && format_ == "pts") {
+            names = {"red", "green", "blue"};
+            dtype = core::Dtype::UInt8;
+        } else if (key == "colors" && is_ply) {
+            names = {"red", "green", "blue"};
+        } else if (key == "intensities" && format_ == "pts") {
+            names = {"intensities"};
+        } else if (is_pcd || (is_ply && num_columns == 1)) {
+            names.assign(num_columns, key);
+        } else {
+            utility::LogWarning(
+                    "Write {} warning: skipping attribute \"{}\" with shape "
+                    "{}.",
+                    utility::ToUpper(format_), key, tensor.GetShape());
+            continue;
+        }
+        if (!packed_rgb && static_cast<int64_t>(names.size()) != num_columns) {
+            utility::LogWarning(
+                    "Write {} failed: attribute \"{}\" has shape {}.",
+                    utility::ToUpper(format_), key, tensor.GetShape());
+            return false;
+        }
+
+        // XYZ and PTS store Float64 values, PLY its own set of types.
+        if (format_ == "xyz" || (format_ == "pts" && key != "colors")) {
+            dtype = core::Dtype::Float64;
+        } else if (is_ply && dtype != core::Dtype::UInt8 &&
+                   dtype != core::Dtype::UInt16 &&
+                   dtype != core::Dtype::Int32 &&
+                   dtype != core::Dtype::Float32) {
+            dtype = core::Dtype::Float64;
+        } else if (dtype == core::Dtype::Bool) {
+            dtype = core::Dtype::UInt8;
+        }
+
+        const int64_t attribute =
+                static_cast<int64_t>(layout_.attributes_.size());
+        layout_.attributes_.push_back({key, dtype, num_columns});
+        inputs_.push_back({key, input_dtype, num_columns});
+        for (size_t c = 0; c < names.size(); ++c) {
+            FieldLayout field;
+            field.name_ = names[c];
+            field.dtype_ = packed_rgb ? core::Dtype::Float32 : dtype;
+            field.byte_size_ = field.dtype_.ByteSize();
+            field.offset_ = layout_.stride_;
+            field.attribute_ = attribute;
+            field.column_ = static_cast<int64_t>(c);
+            field.packed_rgb_ = packed_rgb;
+            layout_.stride_ += field.byte_size_;
+            layout_.fields_.push_back(field);
+        }
+    }
+    layout_.binary_ = (is_ply || is_pcd) && !write_ascii_;
+    layout_.big_endian_ = !IsHostLittleEndian();
+    PrepareFields(layout_);
+    return true;
+}
+
+bool PointCloudWriter::Impl::WriteHeader() {
+    FILE *fp = file_.GetFILE();
+    auto write_count = [&](const char *prefix, const char *suffix) {
+        fputs(prefix, fp);
+        count_positions_.push_back(file_.CurPos());
+        fprintf(fp, "%20lld%s", 0LL, suffix);
+    };
+
+    if (format_ == "ply") {
+        const char *ply_format = "ascii";
+        if (layout_.binary_) {
+            ply_format = layout_.big_endian_ ? "binary_big_endian"
+                                             : "binary_little_endian";
+        }
+        fprintf(fp, "ply\nformat %s 1.0\ncomment Created by Open3D\n",
+                ply_format);
+        write_count("element vertex ", "\n");
+        for (const FieldLayout &field : layout_.fields_) {
+            const char *type = "double";
+            if (field.dtype_ == core::Dtype::UInt8) {
+                type = "uchar";
+            } else if (field.dtype_ == core::Dtype::UInt16) {
+                type = "ushort";
+            } else if (field.dtype_ == core::Dtype::Int32) {
+                type = "int";
+            } else if (field.dtype_ == core::Dtype::Float32) {
+                type = "float";
+            }
+            fprintf(fp, "property %s %s\n", type, field.name_.c_str());
+        }
+        fputs("end_header\n", fp);
+    } else if (format_ == "pcd") {
+        // Consecutive fields of the same name form one PCD field with COUNT
+        // values.
+        std::vector<std::pair<const FieldLayout *, int64_t>> pcd_fields;
+        for (const FieldLayout &field : layout_.fields_) {
+            if (!pcd_fields.empty() &&
+                pcd_fields.back().first->name_ == field.name_) {
+                ++pcd_fields.back().second;
+            } else {
+                pcd_fields.emplace_back(&field, 1);
+            }
+        }
+        std::string names, sizes, types, counts;
+        for (const auto &pcd_field : pcd_fields) {
+            const core::Dtype &dtype = pcd_field.first->dtype_;
+            char type = 'U';
+            if (dtype.GetDtypeCode() == core::Dtype::DtypeCode::Float) {
+                type = 'F';
+            } else if (dtype.GetDtypeCode() == core::Dtype::DtypeCode::Int) {
+                type = 'I';
+            }
+            names += " " + pcd_field.first->name_;
+            sizes += " " + std::to_string(dtype.ByteSize());
+            types += std::string(" ") + type;
+            counts += " " + std::to_string(pcd_field.second);
+        }
+        fprintf(fp,
+                "# .PCD v0.7 - Point Cloud Data file format\nVERSION 0.7\n"
+                "FIELDS%s\nSIZE%s\nTYPE%s\nCOUNT%s\n",
+                names.c_str(), sizes.c_str(), types.c_str(), counts.c_str());
+        write_count("WIDTH ", "\n");
+        fputs("HEIGHT 1\nVIEWPOINT 0 0 0 1 0 0 0\n", fp);
+        write_count("POINTS ", "\n");
+        fprintf(fp, "DATA %s\n", layout_.binary_ ? "binary" : "ascii");
+    } else if (format_ == "pts") {
+        write_count("", "\r\n");
+    }
+    return ferror(fp) == 0;
+}
+
+/// Writes \p n records from \p tensors, which hold the attributes in the
+/// Dtypes of the layout.
+bool PointCloudWriter::Impl::WriteRecords(
+        const std::vector<core::Tensor> &tensors, int64_t n) {
+    std::vector<const char *> src;
+    std::vector<int64_t> src_strides;
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        src.push_back(static_cast<const char *>(tensors[i].GetDataPtr()));
+        src_strides.push_back(layout_.attributes_[i].num_columns_ *
+                              layout_.attributes_[i].dtype_.ByteSize());
+    }
+    // Returns the address of the value of \p field in record \p i. Packed
+    // colors are stored in \p packed.
+    auto get_value = [&](const FieldLayout &field, int64_t i,
+                         uint32_t &packed) -> const void * {
+        const char *row =
+                src[field.attribute_] + i * src_strides[field.attribute_];
+        if (field.packed_rgb_) {
+            const uint8_t *color = reinterpret_cast<const uint8_t *>(row);
+            packed = (uint32_t(color[0]) << 16) | (uint32_t(color[1]) << 8) |
+                     uint32_t(color[2]);
+            return &packed;
+        }
+        return row + field.column_ * field.byte_size_;
+    };
+
+    FILE *fp = file_.GetFILE();
+    if (layout_.binary_) {
+        const int64_t stride = layout_.stride_;
+        std::vector<char> buffer(static_cast<size_t>(n * stride));
+        core::ParallelForRange(
+                n,
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        for (const FieldLayout &field : layout_.fields_) {
+                            uint32_t packed;
+                            std::memcpy(buffer.data() + i * stride +
+                                                field.offset_,
+                                        get_value(field, i, packed),
+                                        field.byte_size_);
+                        }
+                    }
+                },
+                1 << 14);
+        return fwrite(buffer.data(), 1, buffer.size(), fp) == buffer.size();
+    }
+
+    // Text records are formatted in parallel blocks and written in order.
+    const int64_t kBlockSize = 4096;
+    const bool fixed = format_ == "xyz" || format_ == "pts";
+    const char *line_end = format_ == "pts" ? "\r\n" : "\n";
+    std::vector<std::string> blocks((n + kBlockSize - 1) / kBlockSize);
+    core::ParallelFor(static_cast<int64_t>(blocks.size()), [&](int64_t b) {
+        std::string &out = blocks[b];
+        const int64_t end = std::min(n, (b + 1) * kBlockSize);
+        for (int64_t i = b * kBlockSize; i < end; ++i) {
+            for (size_t f = 0; f < layout_.fields_.size(); ++f) {
+                const FieldLayout &field = layout_.fields_[f];
+                if (f > 0) out.push_back(' ');
+                uint32_t packed;
+                field.format_(get_value(field, i, packed), fixed, out);
+            }
+            out += line_end;
+        }
+    });
+    for (const std::string &block : blocks) {
+        if (fwrite(block.data(), 1, block.size(), fp) != block.size()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+PointCloudWriter::PointCloudWriter() : impl_(new Impl()) {}
+
+PointCloudWriter::~PointCloudWriter() { Close(); }
+
+bool PointCloudWriter::Open(const std::string &filename,
+                            const WritePointCloudOption &params) {
+    Close();
+    impl_->format_ =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    const std::string &fmt = impl_->format_;
+    if (fmt != "ply" && fmt != "pcd" && fmt != "xyz" && fmt != "pts") {
+        utility::LogWarning(
+                "PointCloudWriter: streaming is not supported for format "
+                "\"{}\".",
+                fmt);
+        return false;
+    }
+    if (!impl_->file_.Open(filename, "wb")) {
+        utility::LogWarning("PointCloudWriter: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    impl_->filename_ = filename;
+    impl_->write_ascii_ = bool(params.write_ascii);
+    return true;
+}
+
+bool PointCloudWriter::Close() {
+    if (!IsOpened()) {
+        return false;
+    }
+    if (!impl_->has_layout_ && !impl_->failed_) {
+        geometry::PointCloud empty(
+                core::Tensor::Empty({0, 3}, core::Dtype::Float32));
+        impl_->failed_ = !impl_->InitLayout(empty) || !impl_->WriteHeader();
+        impl_->has_layout_ = true;
+    }
+    FILE *fp = impl_->file_.GetFILE();
+    for (int64_t position : impl_->count_positions_) {
+        if (fseek(fp, position, SEEK_SET) != 0 ||
+            fprintf(fp, "%20lld", static_cast<long long>(impl_->num_written_)) <
+                    0) {
+            impl_->failed_ = true;
+        }
+    }
+    const bool success = !impl_->failed_ && ferror(fp) == 0;
+    impl_->file_.Close();
+    if (!success) {
+        utility::LogWarning("PointCloudWriter: unable to write file: {}",
+                            impl_->filename_);
+    }
+    impl_.reset(new Impl());
+    return success;
+}
+
+bool PointCloudWriter::IsOpened() const {
+    return impl_->file_.GetFILE() != nullptr;
+}
+
+int64_t PointCloudWriter::GetNumPoints() const { return impl_->num_written_; }
+
+bool PointCloudWriter::Write(const geometry::PointCloud &chunk) {
+    if (!IsOpened() || impl_->failed_) {
+        return false;
+    }
+    if (chunk.GetPointAttr().empty() || !chunk.HasPoints()) {
+        return true;
+    }
+    const std::string format = utility::ToUpper(impl_->format_);
+    if (!chunk.GetPointAttr().IsSizeSynchronized()) {
+        utility::LogWarning(
+                "Write {} failed: attributes have different lengths.", format);
+        return false;
+    }
+    if (!impl_->has_layout_) {
+        if (!impl_->InitLayout(chunk) || !impl_->WriteHeader()) {
+            impl_->failed_ = true;
+            return false;
+        }
+        impl_->has_layout_ = true;
+    }
+
+    const std::vector<AttributeLayout> &attributes =
+            impl_->layout_.attributes_;
+    const int64_t n = chunk.GetPoints().GetLength();
+    std::vector<core::Tensor> tensors;
+    for (size_t i = 0; i < attributes.size(); ++i) {
+        const AttributeLayout &input = impl_->inputs_[i];
+        if (!chunk.HasPointAttr(input.key_) ||
+            chunk.GetPointAttr(input.key_).GetDtype() != input.dtype_) {
+            utility::LogWarning(
+                    "Write {} failed: chunk does not have attribute \"{}\" "
+                    "of Dtype {}.",
+                    format, input.key_, input.dtype_.ToString());
+            return false;
+        }
+        core::Tensor tensor = chunk.GetPointAttr(input.key_)
+                                      .To(core::Device("CPU:0"))
+                                      .Reshape({n, -1});
+        if (tensor.GetShape(1) != input.num_columns_) {
+            utility::LogWarning(
+                    "Write {} failed: attribute \"{}\" has {} columns, "
+                    "expected {}.",
+                    format, input.key_, tensor.GetShape(1),
+                    input.num_columns_);
+            return false;
+        }
+        if (input.key_ == "colors" &&
+            attributes[i].dtype_ == core::Dtype::UInt8) {
+            tensor = ConvertColorTensorToUint8(tensor);
+        }
+        tensors.push_back(tensor.To(attributes[i].dtype_).Contiguous());
+    }
+
+    if (!impl_->WriteRecords(tensors, n)) {
+        utility::LogWarning("Write {} failed: unable to write file: {}",
+                            format, impl_->filename_);
+        impl_->failed_ = true;
+        return false;
+    }
+    impl_->num_written_ += n;
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudReader
+///
+/// Reads a point cloud file in chunks of a bounded number of points, so that
+/// files larger than memory can be processed in streaming passes. Supports
+/// PLY and PCD (ascii and binary), XYZ and PTS. Chunks are CPU point clouds
+/// whose attributes are named as by ReadPointCloud.
+///
+/// Example:
+///     PointCloudReader reader;
+///     reader.Open("scan.ply");
+///     while (!reader.IsEOF()) {
+///         geometry::PointCloud chunk = reader.Next(1 << 20);
+///         ...
+///     }
+class PointCloudReader {
+public:
+    PointCloudReader();
+    ~PointCloudReader();
+    PointCloudReader(const PointCloudReader &) = delete;
+    PointCloudReader &operator=(const PointCloudReader &) = delete;
+
+    /// Opens \p filename and reads its header.
+    /// \param format File extension of the format, or "auto" to use the
+    /// extension of \p filename.
+    /// \return true if the file is opened and its format is supported.
+    bool Open(const std::string &filename, const std::string &format = "auto");
+
+    void Close();
+
+    bool IsOpened() const;
+
+    /// Returns the number of points in the file, or -1 if the format does not
+    /// record it (XYZ).
+    int64_t GetNumPoints() const;
+
+    /// Returns true if all points have been read.
+    bool IsEOF() const;
+
+    /// Reads the next chunk of at most \p max_points points. The chunk is
+    /// empty once all points have been read.
+    geometry::PointCloud Next(int64_t max_points);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \class PointCloudWriter
+///
+/// Writes a point cloud file chunk by chunk. The attributes, Dtypes and
+/// number of columns of all chunks must match the first one. Point counts in
+/// the header are written when the file is closed. Supports PLY and PCD
+/// (ascii and binary), XYZ and PTS; PCD is never compressed, since
+/// binary_compressed data cannot be appended to.
+class PointCloudWriter {
+public:
+    PointCloudWriter();
+    ~PointCloudWriter();
+    PointCloudWriter(const PointCloudWriter &) = delete;
+    PointCloudWriter &operator=(const PointCloudWriter &) = delete;
+
+    /// Creates \p filename. The format is given by its extension;
+    /// params.write_ascii selects ascii PLY and PCD.
+    bool Open(const std::string &filename,
+              const WritePointCloudOption &params = {});
+
+    /// Writes the header if needed, then finishes the file.
+    /// \return true if the whole file has been written successfully.
+    bool Close();
+
+    bool IsOpened() const;
+
+    /// Returns the number of points written so far.
+    int64_t GetNumPoints() const;
+
+    /// Appends the points of \p chunk.
+    /// \return false if \p chunk does not match the previous chunks or the
+    /// file cannot be written.
+    bool Write(const geometry::PointCloud &chunk);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,682 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TiledPointCloudStore.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/geometry/LinearOctree.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStreamIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/IJsonConvertible.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+using TileKey = TiledPointCloudStore::TileKey;
+
+static const std::string kIndexFileName = "index.json";
+static constexpr int kMaxCellBits = 21;
+
+/// Returns the file of \p key, or of one of its parts if \p part >= 0.
+std::string GetTileFileName(const std::string &store_path,
+                            const TileKey &key,
+                            int part = -1) {
+    std::string name = fmt::format("{}/{}/{}_{}_{}", store_path, key.level_,
+                                   key.x_, key.y_, key.z_);
+    if (part >= 0) {
+        name += fmt::format(".{}", part);
+    }
+    return name + ".o3dt";
+}
+
+/// Returns the rows \p indices of all attributes of \p pointcloud.
+geometry::PointCloud SelectPoints(const geometry::PointCloud &pointcloud,
+                                  const core::Tensor &indices) {
+    std::unordered_map<std::string, core::Tensor> attrs;
+    for (const auto &kv : pointcloud.GetPointAttr()) {
+        attrs[kv.first] = kv.second.IndexGet({indices});
+    }
+    return geometry::PointCloud(attrs);
+}
+
+/// Concatenates point clouds with the same attributes into one CPU point
+/// cloud, copying each attribute once.
+geometry::PointCloud ConcatenatePointClouds(
+        const std::vector<geometry::PointCloud> &pointclouds) {
+    if (pointclouds.size() == 1) {
+        return pointclouds[0];
+    }
+    int64_t num_points = 0;
+    for (const auto &pointcloud : pointclouds) {
+        num_points += pointcloud.GetPoints().GetLength();
+    }
+    std::unordered_map<std::string, core::Tensor> attrs;
+    for (const auto &kv : pointclouds[0].GetPointAttr()) {
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = num_points;
+        core::Tensor attr = core::Tensor::Empty(shape, kv.second.GetDtype());
+        int64_t offset = 0;
+        for (const auto &pointcloud : pointclouds) {
+            if (!pointcloud.HasPointAttr(kv.first)) {
+                utility::LogError("Point attribute {} is missing.", kv.first);
+            }
+            const core::Tensor &part = pointcloud.GetPointAttr(kv.first);
+            int64_t length = part.GetLength();
+            attr.Slice(0, offset, offset + length) = part.To(core::Device());
+            offset += length;
+        }
+        attrs[kv.first] = attr;
+    }
+    return geometry::PointCloud(attrs);
+}
+
+/// Returns the points of \p pointcloud as a contiguous Float64 CPU tensor.
+core::Tensor GetPointsAsFloat64(const geometry::PointCloud &pointcloud) {
+    return pointcloud.GetPoints()
+            .To(core::Device())
+            .To(core::Dtype::Float64)
+            .Contiguous();
+}
+
+bool WriteIndex(const std::string &store_path,
+                const Eigen::Vector3d &origin,
+                double size,
+                const TiledPointCloudStoreOption &option,
+                int64_t num_points,
+                const std::map<TileKey, int64_t> &tiles) {
+    Json::Value index;
+    index["version"] = 1;
+    for (int i = 0; i < 3; ++i) {
+        index["origin"].append(origin(i));
+    }
+    index["size"] = size;
+    index["max_level"] = option.max_level;
+    index["grid_size"] = option.grid_size;
+    index["num_points"] = Json::Int64(num_points);
+    index["tiles"] = Json::arrayValue;
+    for (const auto &kv : tiles) {
+        Json::Value tile;
+        tile.append(kv.first.level_);
+        tile.append(kv.first.x_);
+        tile.append(kv.first.y_);
+        tile.append(kv.first.z_);
+        tile.append(Json::Int64(kv.second));
+        index["tiles"].append(tile);
+    }
+    std::ofstream file(store_path + "/" + kIndexFileName);
+    file << utility::JsonToString(index);
+    return bool(file);
+}
+
+/// Returns true if \p max_level and \p grid_size address every sampling cell
+/// of the finest level with kMaxCellBits bits per axis.
+bool IsValidLevelLayout(int max_level, int grid_size) {
+    return max_level >= 0 && max_level < kMaxCellBits && grid_size >= 1 &&
+           (int64_t(grid_size) << max_level) <= (int64_t(1) << kMaxCellBits);
+}
+
+/// Sampling cell of each finite point of \p points, a Float64 CPU tensor, at
+/// the finest level. \p valid is 0 for points that are not finite.
+void ComputeCells(const core::Tensor &points,
+                  const Eigen::Vector3d &origin,
+                  double size,
+                  int64_t num_cells,
+                  std::vector<std::array<int64_t, 3>> &cells,
+                  std::vector<uint8_t> &valid) {
+    const double *data = points.GetDataPtr<double>();
+    const int64_t n = points.GetLength();
+    cells.resize(n);
+    valid.resize(n);
+    core::ParallelFor(n, [&](int64_t i) {
+        Eigen::Map<const Eigen::Vector3d> point(data + 3 * i);
+        valid[i] = point.allFinite();
+        if (!valid[i]) return;
+        Eigen::Vector3d u = (point - origin) / size * double(num_cells);
+        for (int j = 0; j < 3; ++j) {
+            cells[i][j] = std::min(std::max(int64_t(u(j)), int64_t(0)),
+                                   num_cells - 1);
+        }
+    });
+}
+
+/// Buffers the points of tiles in memory and writes them to \p path in parts
+/// whenever more than max_buffered_points points are buffered.
+class TileBuffer {
+public:
+    TileBuffer(const std::string &path, int64_t max_buffered_points)
+        : path_(path), max_buffered_points_(max_buffered_points) {}
+
+    /// Adds \p points to tile \p key.
+    bool Add(const TileKey &key, const geometry::PointCloud &points) {
+        const int64_t count = points.GetPoints().GetLength();
+        buffered_tiles_[key].push_back(points);
+        tiles_[key] += count;
+        num_buffered_points_ += count;
+        return num_buffered_points_ <= max_buffered_points_ || Write(false);
+    }
+
+    /// Writes every buffered tile, as a part if more points may follow or as
+    /// the whole tile if \p last and the tile has no parts on disk yet.
+    bool Write(bool last) {
+        using Parts = std::vector<geometry::PointCloud>;
+        std::vector<std::pair<std::string, const Parts *>> files;
+        for (const auto &kv : buffered_tiles_) {
+            int &parts = num_parts_[kv.first];
+            if (last && parts == 0) {
+                files.emplace_back(GetTileFileName(path_, kv.first),
+                                   &kv.second);
+            } else {
+                files.emplace_back(GetTileFileName(path_, kv.first, parts++),
+                                   &kv.second);
+            }
+        }
+        std::atomic<bool> success(true);
+        core::ParallelFor(int64_t(files.size()), [&](int64_t i) {
+            if (!WritePointCloudsToO3DT(files[i].first, *files[i].second, {})) {
+                success = false;
+            }
+        });
+        buffered_tiles_.clear();
+        num_buffered_points_ = 0;
+        return bool(success);
+    }
+
+    /// Writes the buffered tiles and merges the parts of the tiles that have
+    /// been written more than once. The tiles are merged one at a time, each
+    /// streaming its memory-mapped parts into the merged file, so the merge
+    /// does not hold whole tiles in memory.
+    bool Finish() {
+        if (!Write(true)) {
+            return false;
+        }
+        for (const auto &kv : num_parts_) {
+            if (kv.second == 0) continue;
+            std::vector<geometry::PointCloud> parts(kv.second);
+            for (int part = 0; part < kv.second; ++part) {
+                if (!ReadPointCloudFromO3DT(
+                            GetTileFileName(path_, kv.first, part), parts[part],
+                            {})) {
+                    return false;
+                }
+            }
+            if (!WritePointCloudsToO3DT(GetTileFileName(path_, kv.first), parts,
+                                        {})) {
+                return false;
+            }
+            // The parts are memory-mapped; release them before removing them.
+            parts.clear();
+            for (int part = 0; part < kv.second; ++part) {
+                utility::filesystem::RemoveFile(
+                        GetTileFileName(path_, kv.first, part));
+            }
+        }
+        return true;
+    }
+
+    /// Number of points of each tile.
+    const std::map<TileKey, int64_t> &GetTiles() const { return tiles_; }
+
+    /// Number of parts on disk of each tile.
+    const std::map<TileKey, int> &GetNumParts() const { return num_parts_; }
+
+private:
+    std::string path_;
+    int64_t max_buffered_points_;
+    std::map<TileKey, std::vector<geometry::PointCloud>> buffered_tiles_;
+    std::map<TileKey, int> num_parts_;
+    std::map<TileKey, int64_t> tiles_;
+    int64_t num_buffered_points_ = 0;
+};
+
+/// The sampling cells of one tile that hold a point. Cells are indexed
+/// x + grid_size * (y + grid_size * z). A bit set is used unless the tile has
+/// too many cells, and only the touched words are cleared between tiles.
+class TileOccupancy {
+public:
+    explicit TileOccupancy(int grid_size) {
+        const uint64_t num_cells = uint64_t(grid_size) * uint64_t(grid_size) *
+                                   uint64_t(grid_size);
+        if (num_cells <= kMaxDenseCells) {
+            words_.resize((num_cells + 63) / 64, 0);
+        }
+    }
+
+    /// Marks \p cell as occupied. Returns false if it already was.
+    bool Insert(uint64_t cell) {
+        if (words_.empty()) {
+            return cells_.insert(cell).second;
+        }
+        uint64_t &word = words_[cell / 64];
+        const uint64_t bit = uint64_t(1) << (cell % 64);
+        if (word & bit) {
+            return false;
+        }
+        if (word == 0) {
+            touched_words_.push_back(cell / 64);
+        }
+        word |= bit;
+        return true;
+    }
+
+    void Clear() {
+        for (uint64_t w : touched_words_) {
+            words_[w] = 0;
+        }
+        touched_words_.clear();
+        cells_.clear();
+    }
+
+private:
+    // 16 MB per level of detail.
+    static constexpr uint64_t kMaxDenseCells = uint64_t(1) << 27;
+    std::vector<uint64_t> words_;
+    std::vector<uint64_t> touched_words_;
+    std::unordered_set<uint64_t> cells_;
+};
+
+}  // namespace
+
+bool BuildTiledPointCloudStore(const std::string &input_filename,
+                               const std::string &store_path,
+                               const TiledPointCloudStoreOption &option) {
+    if (!IsValidLevelLayout(option.max_level, option.grid_size) ||
+        option.chunk_size < 1) {
+        utility::LogWarning(
+                "Invalid tiled store options: max_level {}, grid_size {}, "
+                "chunk_size {}.",
+                option.max_level, option.grid_size, option.chunk_size);
+        return false;
+    }
+
+    // Pass 1: bounds of the finite points.
+    PointCloudReader reader;
+    if (!reader.Open(input_filename)) {
+        utility::LogWarning("Read geometry::PointCloud failed: unable to open "
+                            "file: {}",
+                            input_filename);
+        return false;
+    }
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(INFINITY);
+    Eigen::Vector3d max_bound = Eigen::Vector3d::Constant(-INFINITY);
+    while (!reader.IsEOF()) {
+        geometry::PointCloud chunk = reader.Next(option.chunk_size);
+        if (chunk.IsEmpty()) break;
+        core::Tensor points = GetPointsAsFloat64(chunk);
+        const double *data = points.GetDataPtr<double>();
+        for (int64_t i = 0; i < points.GetLength(); ++i) {
+            Eigen::Map<const Eigen::Vector3d> point(data + 3 * i);
+            if (point.allFinite()) {
+                min_bound = min_bound.cwiseMin(point);
+                max_bound = max_bound.cwiseMax(point);
+            }
+        }
+    }
+    reader.Close();
+
+    // The root cube is enlarged slightly so that the maximum bound falls
+    // inside its last cell.
+    Eigen::Vector3d origin = Eigen::Vector3d::Zero();
+    double size = 1.0;
+    if (min_bound(0) <= max_bound(0)) {
+        origin = min_bound;
+        size = (max_bound - min_bound).maxCoeff();
+        size = size > 0 ? size * (1.0 + 1e-6) : 1.0;
+    }
+
+    const int max_level = option.max_level;
+    const int grid_size = option.grid_size;
+    const std::string staging_path = store_path + "/staging";
+    for (int level = 0; level <= max_level; ++level) {
+        if (!utility::filesystem::MakeDirectoryHierarchy(
+                    fmt::format("{}/{}", store_path, level))) {
+            utility::LogWarning("Unable to create directory {}.", store_path);
+            return false;
+        }
+    }
+    if (!utility::filesystem::MakeDirectoryHierarchy(
+                fmt::format("{}/{}", staging_path, max_level))) {
+        utility::LogWarning("Unable to create directory {}.", staging_path);
+        return false;
+    }
+
+    // Pass 2: sort the finite points into their tiles of the finest level,
+    // which are staged on disk. Cells are addressed at the finest level; the
+    // cell of a coarser level is obtained by a shift.
+    if (!reader.Open(input_filename)) {
+        utility::LogWarning("Read geometry::PointCloud failed: unable to open "
+                            "file: {}",
+                            input_filename);
+        return false;
+    }
+    const int64_t num_cells = int64_t(grid_size) << max_level;
+    TileBuffer staged_tiles(staging_path, option.max_buffered_points);
+    std::vector<std::array<int64_t, 3>> cells;
+    std::vector<uint8_t> valid;
+    while (!reader.IsEOF()) {
+        geometry::PointCloud chunk = reader.Next(option.chunk_size);
+        if (chunk.IsEmpty()) break;
+        ComputeCells(GetPointsAsFloat64(chunk), origin, size, num_cells, cells,
+                     valid);
+        std::map<TileKey, std::vector<int64_t>> groups;
+        for (int64_t i = 0; i < int64_t(cells.size()); ++i) {
+            if (!valid[i]) continue;
+            groups[{max_level, int(cells[i][0] / grid_size),
+                    int(cells[i][1] / grid_size), int(cells[i][2] / grid_size)}]
+                    .push_back(i);
+        }
+        for (auto &kv : groups) {
+            int64_t count = int64_t(kv.second.size());
+            core::Tensor indices(kv.second, {count}, core::Dtype::Int64);
+            if (!staged_tiles.Add(kv.first, SelectPoints(chunk, indices))) {
+                utility::LogWarning("Unable to write tiles to {}.",
+                                    staging_path);
+                return false;
+            }
+        }
+    }
+    reader.Close();
+    if (!staged_tiles.Write(false)) {
+        utility::LogWarning("Unable to write tiles to {}.", staging_path);
+        return false;
+    }
+
+    // Pass 3: visit the staged tiles in Morton order, so that the finest
+    // tiles inside each tile of a coarser level are visited consecutively
+    // and only the cells of the current tile of every level are tracked. A
+    // point goes to the coarsest level whose cell of it is free, and
+    // occupies its cells of all finer levels too, so that the levels up to
+    // l hold at most one point per cell of level l.
+    std::vector<std::pair<uint64_t, TileKey>> staged_keys;
+    for (const auto &kv : staged_tiles.GetNumParts()) {
+        const TileKey &key = kv.first;
+        staged_keys.emplace_back(
+                open3d::geometry::LinearOctree::EncodeMorton(
+                        uint32_t(key.x_), uint32_t(key.y_), uint32_t(key.z_)),
+                key);
+    }
+    std::sort(staged_keys.begin(), staged_keys.end(),
+              [](const std::pair<uint64_t, TileKey> &a,
+                 const std::pair<uint64_t, TileKey> &b) {
+                  return a.first < b.first;
+              });
+    TileBuffer tiles(store_path, option.max_buffered_points);
+    std::vector<TileOccupancy> occupancy(max_level, TileOccupancy(grid_size));
+    std::vector<TileKey> current_tiles(max_level, TileKey{-1, 0, 0, 0});
+    for (const auto &staged_key : staged_keys) {
+        const TileKey &leaf = staged_key.second;
+        for (int l = 0; l < max_level; ++l) {
+            const int shift = max_level - l;
+            const TileKey tile{l, leaf.x_ >> shift, leaf.y_ >> shift,
+                               leaf.z_ >> shift};
+            if (tile < current_tiles[l] || current_tiles[l] < tile) {
+                occupancy[l].Clear();
+                current_tiles[l] = tile;
+            }
+        }
+        const int num_parts = staged_tiles.GetNumParts().at(leaf);
+        for (int part = 0; part < num_parts; ++part) {
+            const std::string part_name =
+                    GetTileFileName(staging_path, leaf, part);
+            geometry::PointCloud chunk;
+            if (!ReadPointCloudFromO3DT(part_name, chunk, {})) {
+                utility::LogWarning("Unable to read tile {}.", part_name);
+                return false;
+            }
+            ComputeCells(GetPointsAsFloat64(chunk), origin, size, num_cells,
+                         cells, valid);
+            // This depends on the previous points and is thus sequential.
+            std::map<TileKey, std::vector<int64_t>> groups;
+            for (int64_t i = 0; i < int64_t(cells.size()); ++i) {
+                int level = max_level;
+                for (int l = 0; l < max_level; ++l) {
+                    const int shift = max_level - l;
+                    const uint64_t cell =
+                            uint64_t((cells[i][0] >> shift) % grid_size) +
+                            uint64_t(grid_size) *
+                                    (uint64_t((cells[i][1] >> shift) %
+                                              grid_size) +
+                                     uint64_t(grid_size) *
+                                             uint64_t((cells[i][2] >> shift) %
+                                                      grid_size));
+                    if (occupancy[l].Insert(cell) && level == max_level) {
+                        level = l;
+                    }
+                }
+                const int shift = max_level - level;
+                groups[{level, int((cells[i][0] >> shift) / grid_size),
+                        int((cells[i][1] >> shift) / grid_size),
+                        int((cells[i][2] >> shift) / grid_size)}]
+                        .push_back(i);
+            }
+            for (auto &kv : groups) {
+                int64_t count = int64_t(kv.second.size());
+                core::Tensor indices(kv.second, {count}, core::Dtype::Int64);
+                if (!tiles.Add(kv.first, SelectPoints(chunk, indices))) {
+                    utility::LogWarning("Unable to write tiles to {}.",
+                                        store_path);
+                    return false;
+                }
+            }
+            // The part is memory-mapped; release it before removing it.
+            chunk.Clear();
+            utility::filesystem::RemoveFile(part_name);
+        }
+    }
+    utility::filesystem::DeleteDirectory(
+            fmt::format("{}/{}", staging_path, max_level));
+    utility::filesystem::DeleteDirectory(staging_path);
+    if (!tiles.Finish()) {
+        utility::LogWarning("Unable to write tiles to {}.", store_path);
+        return false;
+    }
+
+    int64_t num_points = 0;
+    for (const auto &kv : tiles.GetTiles()) {
+        num_points += kv.second;
+    }
+    if (!WriteIndex(store_path, origin, size, option, num_points,
+                    tiles.GetTiles())) {
+        utility::LogWarning("Unable to write the index of {}.", store_path);
+        return false;
+    }
+    return true;
+}
+
+bool TiledPointCloudStore::Open(const std::string &store_path) {
+    Close();
+    std::vector<char> bytes;
+    std::string error;
+    if (!utility::filesystem::FReadToBuffer(store_path + "/" + kIndexFileName,
+                                            bytes, &error)) {
+        utility::LogWarning("Unable to read the index of {}: {}", store_path,
+                            error);
+        return false;
+    }
+    Json::Value index;
+    try {
+        index = utility::StringToJson(std::string(bytes.begin(), bytes.end()));
+    } catch (const std::exception &e) {
+        utility::LogWarning("Invalid index in {}: {}", store_path, e.what());
+        return false;
+    }
+    if (index["version"].asInt() != 1 || index["origin"].size() != 3 ||
+        !index["tiles"].isArray()) {
+        utility::LogWarning("Invalid index in {}.", store_path);
+        return false;
+    }
+    for (int i = 0; i < 3; ++i) {
+        origin_(i) = index["origin"][i].asDouble();
+    }
+    size_ = index["size"].asDouble();
+    max_level_ = index["max_level"].asInt();
+    grid_size_ = index["grid_size"].asInt();
+    num_points_ = index["num_points"].asInt64();
+    if (!IsValidLevelLayout(max_level_, grid_size_) || !(size_ > 0) ||
+        !std::isfinite(size_) || !origin_.allFinite()) {
+        utility::LogWarning("Invalid index in {}.", store_path);
+        return false;
+    }
+    for (const Json::Value &tile : index["tiles"]) {
+        if (tile.size() != 5) {
+            utility::LogWarning("Invalid index in {}.", store_path);
+            tiles_.clear();
+            return false;
+        }
+        TileKey key{tile[0].asInt(), tile[1].asInt(), tile[2].asInt(),
+                    tile[3].asInt()};
+        if (key.level_ < 0 || key.level_ > max_level_ ||
+            std::min({key.x_, key.y_, key.z_}) < 0 ||
+            std::max({key.x_, key.y_, key.z_}) >= (1 << key.level_)) {
+            utility::LogWarning("Invalid index in {}.", store_path);
+            tiles_.clear();
+            return false;
+        }
+        tiles_[key] = tile[4].asInt64();
+    }
+    store_path_ = store_path;
+    return true;
+}
+
+void TiledPointCloudStore::Close() {
+    store_path_.clear();
+    tiles_.clear();
+    num_points_ = 0;
+    num_tiles_read_ = 0;
+}
+
+geometry::PointCloud TiledPointCloudStore::Query(
+        const open3d::geometry::AxisAlignedBoundingBox &bbox,
+        double spacing) const {
+    if (!IsOpened()) {
+        utility::LogError("Tiled point cloud store is not opened.");
+    }
+    const int level = GetLevelForSpacing(spacing);
+    const Eigen::Vector3d &min_bound = bbox.min_bound_;
+    const Eigen::Vector3d &max_bound = bbox.max_bound_;
+
+    // Tiles intersecting the box, and whether they lie inside it entirely.
+    std::vector<std::pair<TileKey, bool>> query_tiles;
+    for (const auto &kv : tiles_) {
+        const TileKey &key = kv.first;
+        if (key.level_ > level) continue;
+        double tile_size = size_ / double(int64_t(1) << key.level_);
+        Eigen::Vector3d tile_min =
+                origin_ + tile_size * Eigen::Vector3d(key.x_, key.y_, key.z_);
+        Eigen::Vector3d tile_max =
+                tile_min + Eigen::Vector3d::Constant(tile_size);
+        if ((tile_min.array() > max_bound.array()).any() ||
+            (tile_max.array() < min_bound.array()).any()) {
+            continue;
+        }
+        bool inside = (tile_min.array() >= min_bound.array()).all() &&
+                      (tile_max.array() <= max_bound.array()).all();
+        query_tiles.emplace_back(key, inside);
+    }
+
+    std::vector<geometry::PointCloud> parts(query_tiles.size());
+    core::ParallelFor(int64_t(query_tiles.size()), [&](int64_t i) {
+        geometry::PointCloud tile;
+        if (!ReadPointCloudFromO3DT(GetTilePath(query_tiles[i].first), tile,
+                                    {})) {
+            utility::LogError("Unable to read tile {}.",
+                              GetTilePath(query_tiles[i].first));
+        }
+        if (query_tiles[i].second) {
+            parts[i] = tile;
+            return;
+        }
+        core::Tensor points = GetPointsAsFloat64(tile);
+        const double *data = points.GetDataPtr<double>();
+        std::vector<int64_t> indices;
+        for (int64_t j = 0; j < points.GetLength(); ++j) {
+            Eigen::Map<const Eigen::Vector3d> point(data + 3 * j);
+            if ((point.array() >= min_bound.array()).all() &&
+                (point.array() <= max_bound.array()).all()) {
+                indices.push_back(j);
+            }
+        }
+        if (!indices.empty()) {
+            int64_t count = int64_t(indices.size());
+            parts[i] = SelectPoints(
+                    tile, core::Tensor(indices, {count}, core::Dtype::Int64));
+        }
+    });
+    num_tiles_read_ += int64_t(query_tiles.size());
+
+    parts.erase(std::remove_if(parts.begin(), parts.end(),
+                               [](const geometry::PointCloud &part) {
+                                   return part.IsEmpty();
+                               }),
+                parts.end());
+    if (parts.empty()) {
+        return geometry::PointCloud();
+    }
+    return ConcatenatePointClouds(parts);
+}
+
+int TiledPointCloudStore::GetLevelForSpacing(double spacing) const {
+    if (spacing > 0) {
+        for (int level = 0; level < max_level_; ++level) {
+            if (GetLevelSpacing(level) <= spacing) return level;
+        }
+    }
+    return max_level_;
+}
+
+double TiledPointCloudStore::GetLevelSpacing(int level) const {
+    return size_ / double(int64_t(grid_size_) << level);
+}
+
+open3d::geometry::AxisAlignedBoundingBox TiledPointCloudStore::GetBoundingBox()
+        const {
+    return open3d::geometry::AxisAlignedBoundingBox(
+            origin_, origin_ + Eigen::Vector3d::Constant(size_));
+}
+
+std::string TiledPointCloudStore::GetTilePath(const TileKey &key) const {
+    return GetTileFileName(store_path_, key);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Options for BuildTiledPointCloudStore.
+struct TiledPointCloudStoreOption {
+    /// Finest level of detail. Level l splits the bounding cube of the
+    /// input into 2^l tiles along each axis, like the nodes of depth l of a
+    /// geometry::Octree.
+    int max_level = 6;
+    /// Number of sampling cells along each axis of a tile. The levels up to
+    /// l < max_level keep at most one point per cell of level l, so their
+    /// point spacing is size / (grid_size * 2^l). max_level and grid_size
+    /// must satisfy grid_size * 2^max_level <= 2^21.
+    int grid_size = 128;
+    /// Number of points read from the input at a time.
+    int64_t chunk_size = 1 << 20;
+    /// Tiles are written to disk whenever more points than this are
+    /// buffered in memory.
+    int64_t max_buffered_points = 1 << 24;
+};
+
+/// Builds a tiled level of detail store of the point cloud file
+/// \p input_filename in the directory \p store_path. The input is streamed
+/// twice with PointCloudReader, once for the bounds and once to stage the
+/// points in their tiles of the finest level, which are then visited in
+/// Morton order. Memory is thus bounded by the options rather than the
+/// input: the buffered points, plus one tile of occupied sampling cells per
+/// level. Every point is stored exactly once: in the coarsest level whose
+/// sampling cell of it is still empty when the point is visited, or in the
+/// finest level. Each tile is written as an O3DT file, and the layout is
+/// described by index.json.
+/// \return true if the store has been written successfully.
+bool BuildTiledPointCloudStore(const std::string &input_filename,
+                               const std::string &store_path,
+                               const TiledPointCloudStoreOption &option = {});
+
+/// \class TiledPointCloudStore
+///
+/// Spatial random access to a store written by BuildTiledPointCloudStore.
+/// Queries read only the tiles that intersect the query box, down to the
+/// level that provides the requested point spacing.
+///
+/// Example:
+///     TiledPointCloudStore store;
+///     store.Open("city_tiles");
+///     geometry::PointCloud block = store.Query(box, 0.1);
+class TiledPointCloudStore {
+public:
+    /// Address of a tile: its level and its integer position in the grid of
+    /// 2^level tiles along each axis.
+    struct TileKey {
+        int level_;
+        int x_;
+        int y_;
+        int z_;
+        bool operator<(const TileKey &other) const {
+            return std::tie(level_, x_, y_, z_) <
+                   std::tie(other.level_, other.x_, other.y_, other.z_);
+        }
+    };
+
+    TiledPointCloudStore() {}
+    TiledPointCloudStore(const TiledPointCloudStore &) = delete;
+    TiledPointCloudStore &operator=(const TiledPointCloudStore &) = delete;
+
+    /// Reads the index of the store in the directory \p store_path.
+    bool Open(const std::string &store_path);
+
+    void Close();
+
+    bool IsOpened() const { return !store_path_.empty(); }
+
+    /// Returns the points of the store inside \p bbox whose spacing is at
+    /// most \p spacing, i.e. all levels up to the coarsest one that is at
+    /// least as dense. A \p spacing of 0 returns the points at full density.
+    /// The attributes are CPU tensors. Tiles are read in parallel.
+    geometry::PointCloud Query(
+            const open3d::geometry::AxisAlignedBoundingBox &bbox,
+            double spacing = 0.0) const;
+
+    /// Returns the finest level of detail needed for \p spacing.
+    int GetLevelForSpacing(double spacing) const;
+
+    /// Returns the point spacing of \p level.
+    double GetLevelSpacing(int level) const;
+
+    /// Returns the bounding cube of the store.
+    open3d::geometry::AxisAlignedBoundingBox GetBoundingBox() const;
+
+    int GetMaxLevel() const { return max_level_; }
+
+    int64_t GetNumPoints() const { return num_points_; }
+
+    /// Returns the number of points of each stored tile.
+    const std::map<TileKey, int64_t> &GetTiles() const { return tiles_; }
+
+    /// Returns the number of tile files read by all queries so far.
+    int64_t GetNumTilesRead() const { return num_tiles_read_; }
+
+    /// Returns the file name of \p key inside the store.
+    std::string GetTilePath(const TileKey &key) const;
+
+private:
+    std::string store_path_;
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    double size_ = 0.0;
+    int max_level_ = 0;
+    int grid_size_ = 0;
+    int64_t num_points_ = 0;
+    std::map<TileKey, int64_t> tiles_;
+    mutable std::atomic<int64_t> num_tiles_read_{0};
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
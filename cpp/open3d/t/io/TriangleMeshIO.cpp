@@ -40,7 +40,9 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            geometry::TriangleMesh &,
                            const open3d::io::ReadTriangleMeshOptions &)>>
-        file_extension_to_trianglemesh_read_function{};
+        file_extension_to_trianglemesh_read_function{
+                {"o3dt", ReadTriangleMeshFromO3DT},
+        };
 
 static const std::unordered_map<
         std::string,
@@ -52,7 +54,9 @@ static const std::unordered_map<
                            const bool,
                            const bool,
                            const bool)>>
-        file_extension_to_trianglemesh_write_function{};
+        file_extension_to_trianglemesh_write_function{
+                {"o3dt", WriteTriangleMeshToO3DT},
+        };
 
 std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
         const std::string &filename, bool print_progress) {
@@ -100,12 +104,16 @@ bool ReadTriangleMesh(const std::string &filename,
         mesh = geometry::TriangleMesh::FromLegacyTriangleMesh(legacy_mesh);
     } else {
         success = map_itr->second(filename, mesh, params);
-        utility::LogDebug(
-                "Read geometry::TriangleMesh: {:d} triangles and {:d} "
-                "vertices.",
-                mesh.GetTriangles().GetLength(),
-                mesh.GetVertices().GetLength());
-        if (mesh.HasVertices() && !mesh.HasTriangles()) {
+        if (!success) {
+            return false;
+        }
+        if (mesh.HasTriangles()) {
+            utility::LogDebug(
+                    "Read geometry::TriangleMesh: {:d} triangles and {:d} "
+                    "vertices.",
+                    mesh.GetTriangles().GetLength(),
+                    mesh.HasVertices() ? mesh.GetVertices().GetLength() : 0);
+        } else if (mesh.HasVertices()) {
             utility::LogWarning(
                     "geometry::TriangleMesh appears to be a "
                     "geometry::PointCloud "
@@ -144,7 +152,8 @@ bool WriteTriangleMesh(const std::string &filename,
                                    write_triangle_uvs, print_progress);
     utility::LogDebug(
             "Write geometry::TriangleMesh: {:d} triangles and {:d} vertices.",
-            mesh.GetTriangles().GetLength(), mesh.GetVertices().GetLength());
+            mesh.HasTriangles() ? mesh.GetTriangles().GetLength() : 0,
+            mesh.HasVertices() ? mesh.GetVertices().GetLength() : 0);
     return success;
 }
 
@@ -63,6 +63,24 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+/// Reads the native tensor container format. The file is memory-mapped and
+/// the vertex and triangle attributes are CPU tensors viewing the mapping.
+bool ReadTriangleMeshFromO3DT(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+/// Writes all vertex and triangle attributes. The write_* flags are ignored;
+/// the container always stores every attribute in binary.
+bool WriteTriangleMeshToO3DT(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool compressed,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool write_triangle_uvs,
+                             const bool print_progress);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
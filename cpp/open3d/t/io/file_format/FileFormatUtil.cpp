@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/t/io/file_format/FileFormatUtil.h"
+
+#include <cstring>
+#include <limits>
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool IsHostLittleEndian() {
+    const uint16_t value = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+int64_t GetPLYTypeInfo(const std::string &type, core::Dtype &dtype) {
+    dtype = core::Dtype::Undefined;
+    if (type == "char" || type == "int8") {
+        return 1;
+    } else if (type == "uchar" || type == "uint8") {
+        dtype = core::Dtype::UInt8;
+        return 1;
+    } else if (type == "short" || type == "int16") {
+        return 2;
+    } else if (type == "ushort" || type == "uint16") {
+        dtype = core::Dtype::UInt16;
+        return 2;
+    } else if (type == "int" || type == "int32") {
+        dtype = core::Dtype::Int32;
+        return 4;
+    } else if (type == "uint" || type == "uint32") {
+        return 4;
+    } else if (type == "float" || type == "float32") {
+        dtype = core::Dtype::Float32;
+        return 4;
+    } else if (type == "double" || type == "float64") {
+        dtype = core::Dtype::Float64;
+        return 8;
+    }
+    return 0;
+}
+
+bool MulAddChecked(int64_t a, int64_t b, int64_t c, int64_t &result) {
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    if (a < 0 || b < 0 || c < 0 || (b != 0 && a > kMax / b) ||
+        a * b > kMax - c) {
+        return false;
+    }
+    result = a * b + c;
+    return true;
+}
+
+void ResetImageForRead(geometry::Image &image,
+                       int64_t rows,
+                       int64_t cols,
+                       int64_t channels,
+                       core::Dtype dtype,
+                       bool reuse_storage) {
+    if (reuse_storage && image.GetRows() == rows && image.GetCols() == cols &&
+        image.GetChannels() == channels && image.GetDtype() == dtype &&
+        image.AsTensor().IsContiguous()) {
+        return;
+    }
+    image.Reset(rows, cols, channels, dtype, image.GetDevice());
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -23,33 +23,42 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
-
 #pragma once
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+// Helpers shared by the tensor geometry readers and writers in t/io and
+// t/io/file_format. Not part of the public API.
+
+#include <cstdint>
+#include <string>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/t/geometry/Image.h"
 
 namespace open3d {
-namespace core {
-namespace kernel {
-
-inline int GetMaxThreads() {
-#ifdef _OPENMP
-    return omp_get_max_threads();
-#else
-    return 1;
-#endif
-}
-
-inline bool InParallel() {
-#ifdef _OPENMP
-    return omp_in_parallel();
-#else
-    return false;
-#endif
-}
-
-}  // namespace kernel
-}  // namespace core
+namespace t {
+namespace io {
+
+/// Returns true if the host stores multi-byte values little-endian.
+bool IsHostLittleEndian();
+
+/// Returns the byte size of a PLY scalar type name and its Dtype, using the
+/// same Dtypes as the rply based PLY reader. Types without a Dtype give
+/// Undefined and are skipped by the readers. Returns 0 for unknown type names.
+int64_t GetPLYTypeInfo(const std::string &type, core::Dtype &dtype);
+
+/// Computes \p a * \p b + \p c for non-negative operands read from a file.
+/// Returns false if an operand is negative or the result overflows int64_t.
+bool MulAddChecked(int64_t a, int64_t b, int64_t c, int64_t &result);
+
+/// Reallocates \p image for decoding unless \p reuse_storage is true and it
+/// is contiguous with the given shape and dtype.
+void ResetImageForRead(geometry::Image &image,
+                       int64_t rows,
+                       int64_t cols,
+                       int64_t channels,
+                       core::Dtype dtype,
+                       bool reuse_storage);
+
+}  // namespace io
+}  // namespace t
 }  // namespace open3d
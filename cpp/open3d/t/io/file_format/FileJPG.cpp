@@ -31,6 +31,7 @@
 // clang-format on
 
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/file_format/FileFormatUtil.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/FileSystem.h"
 
@@ -38,7 +39,9 @@ namespace open3d {
 namespace t {
 namespace io {
 
-bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
+bool ReadImageFromJPG(const std::string &filename,
+                      geometry::Image &image,
+                      bool reuse_storage) {
     struct jpeg_decompress_struct cinfo;
     struct jpeg_error_mgr jerr;
     FILE *file_in;
@@ -78,9 +81,8 @@ bool ReadImageFromJPG(const std::string &filename, geometry::Image &image) {
             return false;
     }
     jpeg_start_decompress(&cinfo);
-    image.Clear();
-    image.Reset(cinfo.output_height, cinfo.output_width, num_of_channels,
-                core::Dtype::UInt8, image.GetDevice());
+    ResetImageForRead(image, cinfo.output_height, cinfo.output_width,
+                      num_of_channels, core::Dtype::UInt8, reuse_storage);
 
     int row_stride = cinfo.output_width * cinfo.output_components;
     buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE,
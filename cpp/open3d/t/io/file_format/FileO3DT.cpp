@@ -0,0 +1,477 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+// Native binary container for tensor geometries (.o3dt).
+//
+// A file holds a fixed-size header, a table of attribute records and then one
+// contiguous blob per attribute, each starting at a multiple of
+// kBlobAlignment. Reading maps the file into memory and wraps the blobs as
+// CPU tensors without copying. All values are stored in native byte order.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/t/io/file_format/FileFormatUtil.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr char kO3DTFileMagic[8] = {'O', '3', 'D', 'T', 'G', 'E', 'O', 0};
+constexpr uint32_t kO3DTFileVersion = 1;
+constexpr int64_t kBlobAlignment = 64;
+constexpr int64_t kMaxAttributeDims = 8;
+constexpr size_t kMaxKeyLength = 64;
+
+enum class GeometryType : uint32_t { PointCloud = 0, TriangleMesh = 1 };
+
+/// Attribute map an attribute belongs to. Point clouds only use Primary.
+enum class AttributeMap : uint32_t { Primary = 0, Triangle = 1 };
+
+struct DtypeRecord {
+    int64_t code;
+    int64_t byte_size;
+    char name[16];
+};
+
+struct ShapeRecord {
+    int64_t ndims;
+    int64_t dims[kMaxAttributeDims];
+};
+
+struct AttributeRecord {
+    uint32_t attribute_map;
+    uint32_t reserved;
+    char key[kMaxKeyLength];
+    DtypeRecord dtype;
+    ShapeRecord shape;
+    // Byte offset of the blob from the beginning of the file.
+    int64_t offset;
+    int64_t byte_size;
+};
+
+struct O3DTFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t geometry_type;
+    int64_t num_attributes;
+    int64_t file_size;
+};
+
+struct Attribute {
+    AttributeMap attribute_map;
+    std::string key;
+    core::Tensor tensor;
+};
+
+/// Returns the dtype described by \p record in \p dtype, or false if it is
+/// not one of the built-in dtypes. Only the code is trusted to identify the
+/// dtype; its size and name must match.
+bool DtypeFromRecord(const DtypeRecord &record, core::Dtype &dtype) {
+    static const std::vector<core::Dtype> kDtypes = {
+            core::Dtype::Bool,    core::Dtype::UInt8,  core::Dtype::UInt16,
+            core::Dtype::UInt32,  core::Dtype::UInt64, core::Dtype::Int8,
+            core::Dtype::Int16,   core::Dtype::Int32,  core::Dtype::Int64,
+            core::Dtype::Float32, core::Dtype::Float64};
+    for (const core::Dtype &candidate : kDtypes) {
+        if (record.code == static_cast<int64_t>(candidate.GetDtypeCode()) &&
+            record.byte_size == candidate.ByteSize() &&
+            candidate.ToString() == record.name) {
+            dtype = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+int64_t AlignBlob(int64_t offset) {
+    return (offset + kBlobAlignment - 1) / kBlobAlignment * kBlobAlignment;
+}
+
+/// Attributes of \p tensor_map, primary key first and the rest sorted by key,
+/// so that the same geometry always gives the same file. Returns false if the
+/// attributes have different lengths.
+bool AppendAttributes(const geometry::TensorMap &tensor_map,
+                      AttributeMap attribute_map,
+                      std::vector<Attribute> &attributes) {
+    if (!tensor_map.empty() && !tensor_map.IsSizeSynchronized()) {
+        utility::LogWarning(
+                "Write O3DT failed: attributes of {} have different lengths.",
+                tensor_map.GetPrimaryKey());
+        return false;
+    }
+    std::vector<std::string> keys;
+    for (const auto &kv : tensor_map) {
+        if (kv.first != tensor_map.GetPrimaryKey()) {
+            keys.push_back(kv.first);
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    if (tensor_map.Contains(tensor_map.GetPrimaryKey())) {
+        keys.insert(keys.begin(), tensor_map.GetPrimaryKey());
+    }
+    for (const std::string &key : keys) {
+        attributes.push_back({attribute_map, key,
+                              tensor_map.at(key)
+                                      .To(core::Device("CPU:0"))
+                                      .Contiguous()});
+    }
+    return true;
+}
+
+/// Writes the attributes of \p parts, the attribute lists of geometries with
+/// the same keys, dtypes and element shapes, concatenated along the first
+/// dimension. Each blob is written part by part, so the concatenation is never
+/// held in memory.
+bool WriteO3DTFile(const std::string &filename,
+                   GeometryType geometry_type,
+                   const std::vector<std::vector<Attribute>> &parts) {
+    const std::vector<Attribute> &attributes = parts.front();
+    const int64_t num_attributes = static_cast<int64_t>(attributes.size());
+    std::vector<AttributeRecord> records(attributes.size());
+    int64_t offset = AlignBlob(sizeof(O3DTFileHeader) +
+                               num_attributes * sizeof(AttributeRecord));
+    for (int64_t i = 0; i < num_attributes; ++i) {
+        const Attribute &attribute = attributes[i];
+        const core::Dtype &dtype = attribute.tensor.GetDtype();
+        core::SizeVector shape = attribute.tensor.GetShape();
+        for (size_t p = 1; p < parts.size(); ++p) {
+            if (static_cast<int64_t>(parts[p].size()) != num_attributes ||
+                parts[p][i].key != attribute.key ||
+                parts[p][i].attribute_map != attribute.attribute_map ||
+                parts[p][i].tensor.GetDtype() != dtype || shape.empty() ||
+                parts[p][i].tensor.GetShape().size() != shape.size() ||
+                !std::equal(shape.begin() + 1, shape.end(),
+                            parts[p][i].tensor.GetShape().begin() + 1)) {
+                utility::LogWarning(
+                        "Write O3DT failed: parts do not have the same "
+                        "attributes.");
+                return false;
+            }
+            shape[0] += parts[p][i].tensor.GetShape()[0];
+        }
+        if (attribute.key.size() >= kMaxKeyLength) {
+            utility::LogWarning(
+                    "Write O3DT failed: attribute key {} is longer than {} "
+                    "characters.",
+                    attribute.key, kMaxKeyLength - 1);
+            return false;
+        }
+        if (static_cast<int64_t>(shape.size()) > kMaxAttributeDims) {
+            utility::LogWarning(
+                    "Write O3DT failed: attribute {} has more than {} "
+                    "dimensions.",
+                    attribute.key, kMaxAttributeDims);
+            return false;
+        }
+        if (dtype.IsObject()) {
+            utility::LogWarning(
+                    "Write O3DT failed: attribute {} has object dtype {}.",
+                    attribute.key, dtype.ToString());
+            return false;
+        }
+
+        AttributeRecord &record = records[i];
+        std::memset(&record, 0, sizeof(AttributeRecord));
+        record.attribute_map = static_cast<uint32_t>(attribute.attribute_map);
+        std::strncpy(record.key, attribute.key.c_str(), kMaxKeyLength - 1);
+        record.dtype.code = static_cast<int64_t>(dtype.GetDtypeCode());
+        record.dtype.byte_size = dtype.ByteSize();
+        std::strncpy(record.dtype.name, dtype.ToString().c_str(),
+                     sizeof(record.dtype.name) - 1);
+        record.shape.ndims = static_cast<int64_t>(shape.size());
+        std::copy(shape.begin(), shape.end(), record.shape.dims);
+        record.offset = offset;
+        record.byte_size = shape.NumElements() * dtype.ByteSize();
+        offset = AlignBlob(offset + record.byte_size);
+    }
+
+    O3DTFileHeader header;
+    std::memset(&header, 0, sizeof(O3DTFileHeader));
+    std::memcpy(header.magic, kO3DTFileMagic, sizeof(header.magic));
+    header.version = kO3DTFileVersion;
+    header.geometry_type = static_cast<uint32_t>(geometry_type);
+    header.num_attributes = num_attributes;
+    header.file_size = static_cast<int64_t>(sizeof(O3DTFileHeader));
+    if (num_attributes > 0) {
+        header.file_size = records.back().offset + records.back().byte_size;
+    }
+
+    // The file is written next to its destination and renamed over it, so
+    // tensors that still map the previous file, e.g. because the geometry was
+    // read from it, stay valid.
+    // The random suffix keeps concurrent writers of the same file apart.
+    const std::string temp_filename =
+            fmt::format("{}.{:08x}.tmp", filename, std::random_device()());
+    utility::filesystem::CFile file;
+    if (!file.Open(temp_filename, "wb")) {
+        utility::LogWarning("Write O3DT failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    FILE *fp = file.GetFILE();
+    bool success =
+            fwrite(&header, sizeof(O3DTFileHeader), 1, fp) == 1 &&
+            (records.empty() || fwrite(records.data(), sizeof(AttributeRecord),
+                                       records.size(), fp) == records.size());
+    static const std::vector<char> zeros(kBlobAlignment, 0);
+    for (int64_t i = 0; success && i < num_attributes; ++i) {
+        const int64_t pos = static_cast<int64_t>(ftell(fp));
+        if (pos < 0 || pos > records[i].offset) {
+            success = false;
+            break;
+        }
+        const size_t pad = static_cast<size_t>(records[i].offset - pos);
+        success = fwrite(zeros.data(), 1, pad, fp) == pad;
+        for (size_t p = 0; success && p < parts.size(); ++p) {
+            const core::Tensor &tensor = parts[p][i].tensor;
+            const size_t bytes = static_cast<size_t>(
+                    tensor.NumElements() * tensor.GetDtype().ByteSize());
+            success = bytes == 0 ||
+                      fwrite(tensor.GetDataPtr(), 1, bytes, fp) == bytes;
+        }
+    }
+    file.Close();
+    success = success &&
+              utility::filesystem::ReplaceFile(temp_filename, filename);
+    if (!success) {
+        std::remove(temp_filename.c_str());
+        utility::LogWarning("Write O3DT failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+/// Maps \p filename and returns its attributes as tensors that view the
+/// mapping. The mapping is private and writable, so the tensors can be
+/// modified without changing the file; it is released together with the last
+/// tensor referring to it.
+bool ReadO3DTFile(const std::string &filename,
+                  GeometryType geometry_type,
+                  std::vector<Attribute> &attributes) {
+    size_t file_size = 0;
+    std::string error_str;
+    std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+            filename, file_size, true, &error_str);
+    if (!mapping) {
+        utility::LogWarning("Read O3DT failed: unable to map file {}: {}",
+                            filename, error_str);
+        return false;
+    }
+
+    O3DTFileHeader header;
+    if (file_size < sizeof(O3DTFileHeader)) {
+        utility::LogWarning("Read O3DT failed: {} is not an O3DT file.",
+                            filename);
+        return false;
+    }
+    std::memcpy(&header, mapping.get(), sizeof(O3DTFileHeader));
+    if (std::memcmp(header.magic, kO3DTFileMagic, sizeof(kO3DTFileMagic)) !=
+        0) {
+        utility::LogWarning("Read O3DT failed: {} is not an O3DT file.",
+                            filename);
+        return false;
+    }
+    if (header.version != kO3DTFileVersion) {
+        utility::LogWarning("Read O3DT failed: unsupported version {}.",
+                            header.version);
+        return false;
+    }
+    if (header.geometry_type != static_cast<uint32_t>(geometry_type)) {
+        utility::LogWarning(
+                "Read O3DT failed: {} stores a different geometry type.",
+                filename);
+        return false;
+    }
+    if (header.num_attributes < 0 ||
+        header.num_attributes > static_cast<int64_t>(file_size) ||
+        header.file_size > static_cast<int64_t>(file_size)) {
+        utility::LogWarning("Read O3DT failed: {} is truncated.", filename);
+        return false;
+    }
+    const int64_t table_end =
+            sizeof(O3DTFileHeader) +
+            header.num_attributes * sizeof(AttributeRecord);
+    if (table_end > static_cast<int64_t>(file_size)) {
+        utility::LogWarning("Read O3DT failed: {} is truncated.", filename);
+        return false;
+    }
+
+    attributes.clear();
+    for (int64_t i = 0; i < header.num_attributes; ++i) {
+        AttributeRecord record;
+        std::memcpy(&record,
+                    mapping.get() + sizeof(O3DTFileHeader) +
+                            i * sizeof(AttributeRecord),
+                    sizeof(AttributeRecord));
+        record.key[kMaxKeyLength - 1] = 0;
+        record.dtype.name[sizeof(record.dtype.name) - 1] = 0;
+        core::Dtype dtype;
+        if (record.shape.ndims < 0 || record.shape.ndims > kMaxAttributeDims ||
+            record.attribute_map > static_cast<uint32_t>(
+                                           AttributeMap::Triangle) ||
+            std::any_of(record.shape.dims,
+                        record.shape.dims + record.shape.ndims,
+                        [](int64_t dim) { return dim < 0; }) ||
+            !DtypeFromRecord(record.dtype, dtype)) {
+            utility::LogWarning("Read O3DT failed: attribute {} is corrupted.",
+                                record.key);
+            return false;
+        }
+        const core::SizeVector shape(record.shape.dims,
+                                     record.shape.dims + record.shape.ndims);
+        // Sizes come from the file, so every product and sum is checked.
+        int64_t byte_size = dtype.ByteSize();
+        bool valid_size = true;
+        for (int64_t dim : shape) {
+            valid_size = valid_size &&
+                         MulAddChecked(byte_size, dim, 0, byte_size);
+        }
+        int64_t blob_end = 0;
+        if (!valid_size || record.byte_size != byte_size ||
+            record.offset % kBlobAlignment != 0 || record.offset < table_end ||
+            !MulAddChecked(record.byte_size, 1, record.offset, blob_end) ||
+            blob_end > header.file_size) {
+            utility::LogWarning("Read O3DT failed: attribute {} is corrupted.",
+                                record.key);
+            return false;
+        }
+
+        void *data_ptr = mapping.get() + record.offset;
+        auto blob = std::make_shared<core::Blob>(
+                core::Device("CPU:0"), data_ptr, [mapping](void *) {});
+        attributes.push_back(
+                {static_cast<AttributeMap>(record.attribute_map), record.key,
+                 core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                              data_ptr, dtype, blob)});
+    }
+    return true;
+}
+
+}  // namespace
+
+bool ReadPointCloudFromO3DT(const std::string &filename,
+                            geometry::PointCloud &pointcloud,
+                            const open3d::io::ReadPointCloudOption &params) {
+    std::vector<Attribute> attributes;
+    try {
+        if (!ReadO3DTFile(filename, GeometryType::PointCloud, attributes)) {
+            return false;
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DT failed with exception: {}", e.what());
+        return false;
+    }
+    pointcloud = geometry::PointCloud(core::Device("CPU:0"));
+    for (const Attribute &attribute : attributes) {
+        pointcloud.SetPointAttr(attribute.key, attribute.tensor);
+    }
+    return true;
+}
+
+bool WritePointCloudToO3DT(const std::string &filename,
+                           const geometry::PointCloud &pointcloud,
+                           const open3d::io::WritePointCloudOption &params) {
+    std::vector<Attribute> attributes;
+    if (!AppendAttributes(pointcloud.GetPointAttr(), AttributeMap::Primary,
+                          attributes)) {
+        return false;
+    }
+    return WriteO3DTFile(filename, GeometryType::PointCloud, {attributes});
+}
+
+bool WritePointCloudsToO3DT(
+        const std::string &filename,
+        const std::vector<geometry::PointCloud> &pointclouds,
+        const open3d::io::WritePointCloudOption &params) {
+    std::vector<std::vector<Attribute>> parts(
+            std::max<size_t>(pointclouds.size(), 1));
+    for (size_t p = 0; p < pointclouds.size(); ++p) {
+        if (!AppendAttributes(pointclouds[p].GetPointAttr(),
+                              AttributeMap::Primary, parts[p])) {
+            return false;
+        }
+    }
+    return WriteO3DTFile(filename, GeometryType::PointCloud, parts);
+}
+
+bool ReadTriangleMeshFromO3DT(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    std::vector<Attribute> attributes;
+    try {
+        if (!ReadO3DTFile(filename, GeometryType::TriangleMesh, attributes)) {
+            return false;
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DT failed with exception: {}", e.what());
+        return false;
+    }
+    mesh = geometry::TriangleMesh(core::Device("CPU:0"));
+    for (const Attribute &attribute : attributes) {
+        if (attribute.attribute_map == AttributeMap::Triangle) {
+            mesh.SetTriangleAttr(attribute.key, attribute.tensor);
+        } else {
+            mesh.SetVertexAttr(attribute.key, attribute.tensor);
+        }
+    }
+    return true;
+}
+
+bool WriteTriangleMeshToO3DT(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool compressed,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool write_triangle_uvs,
+                             const bool print_progress) {
+    std::vector<Attribute> attributes;
+    if (!AppendAttributes(mesh.GetVertexAttr(), AttributeMap::Primary,
+                          attributes) ||
+        !AppendAttributes(mesh.GetTriangleAttr(), AttributeMap::Triangle,
+                          attributes)) {
+        return false;
+    }
+    return WriteO3DTFile(filename, GeometryType::TriangleMesh, {attributes});
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,895 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/LZFCompression.h"
+#include "open3d/io/ParallelTextParser.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/file_format/FileFormatUtil.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// References for PCD file IO
+// http://pointclouds.org/documentation/tutorials/pcd_file_format.html
+// https://github.com/PointCloudLibrary/pcl/blob/master/io/src/pcd_io.cpp
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+enum class PCDDataType { ASCII, BINARY, BINARY_COMPRESSED };
+
+struct PCDField {
+    std::string name_;
+    char type_ = 'F';
+    int64_t size_ = 4;
+    int64_t count_ = 1;
+    // Undefined for types without a Dtype, which are skipped.
+    core::Dtype dtype_ = core::Dtype::Undefined;
+    // Byte offset in a binary record.
+    int64_t offset_ = 0;
+};
+
+struct PCDHeader {
+    std::vector<PCDField> fields_;
+    int64_t width_ = 0;
+    int64_t height_ = 1;
+    int64_t points_ = -1;
+    PCDDataType datatype_ = PCDDataType::ASCII;
+    // Byte size of a binary record.
+    int64_t record_size_ = 0;
+};
+
+/// A value of a point record and where it is stored: \p column of the
+/// attribute tensor, or the 3 color columns for packed "rgb" values.
+struct PCDColumn {
+    const PCDField *field_;
+    int64_t element_;
+    std::string key_;
+    int64_t column_;
+    bool packed_rgb_;
+};
+
+core::Dtype GetPCDDtype(char type, int64_t size) {
+    if (type == 'F') {
+        return size == 4 ? core::Dtype::Float32
+                         : size == 8 ? core::Dtype::Float64
+                                     : core::Dtype::Undefined;
+    }
+    switch (size) {
+        case 1:
+            return type == 'I' ? core::Dtype::Int8 : core::Dtype::UInt8;
+        case 2:
+            return type == 'I' ? core::Dtype::Int16 : core::Dtype::UInt16;
+        case 4:
+            return type == 'I' ? core::Dtype::Int32 : core::Dtype::UInt32;
+        case 8:
+            return type == 'I' ? core::Dtype::Int64 : core::Dtype::UInt64;
+        default:
+            return core::Dtype::Undefined;
+    }
+}
+
+bool IsPackedRGB(const PCDField &field) {
+    return (field.name_ == "rgb" || field.name_ == "rgba") &&
+           field.size_ == 4 && field.count_ == 1;
+}
+
+/// Parses the header at the start of \p data and sets \p data_offset to the
+/// start of the point data.
+bool ReadPCDHeader(const char *data,
+                   size_t size,
+                   PCDHeader &header,
+                   size_t &data_offset) {
+    const char *pos = data;
+    const char *end = data + size;
+    std::vector<int64_t> sizes, counts;
+    std::vector<char> types;
+    while (pos < end) {
+        const char *line_end =
+                static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+        line_end = line_end ? line_end : end;
+        const std::vector<std::string> tokens = utility::SplitString(
+                std::string(pos, line_end), "\t\r ");
+        pos = line_end + (line_end < end ? 1 : 0);
+        if (tokens.empty() || tokens[0][0] == '#') {
+            continue;
+        }
+        const std::string &keyword = tokens[0];
+        if (keyword == "FIELDS" || keyword == "COLUMNS") {
+            header.fields_.resize(tokens.size() - 1);
+            for (size_t i = 1; i < tokens.size(); ++i) {
+                header.fields_[i - 1].name_ = tokens[i];
+            }
+        } else if (keyword == "SIZE") {
+            for (size_t i = 1; i < tokens.size(); ++i) {
+                sizes.push_back(std::atoll(tokens[i].c_str()));
+            }
+        } else if (keyword == "TYPE") {
+            for (size_t i = 1; i < tokens.size(); ++i) {
+                types.push_back(tokens[i][0]);
+            }
+        } else if (keyword == "COUNT") {
+            for (size_t i = 1; i < tokens.size(); ++i) {
+                counts.push_back(std::atoll(tokens[i].c_str()));
+            }
+        } else if (keyword == "WIDTH" && tokens.size() > 1) {
+            header.width_ = std::atoll(tokens[1].c_str());
+        } else if (keyword == "HEIGHT" && tokens.size() > 1) {
+            header.height_ = std::atoll(tokens[1].c_str());
+        } else if (keyword == "POINTS" && tokens.size() > 1) {
+            header.points_ = std::atoll(tokens[1].c_str());
+        } else if (keyword == "DATA" && tokens.size() > 1) {
+            if (tokens[1] == "ascii") {
+                header.datatype_ = PCDDataType::ASCII;
+            } else if (tokens[1] == "binary") {
+                header.datatype_ = PCDDataType::BINARY;
+            } else if (tokens[1] == "binary_compressed") {
+                header.datatype_ = PCDDataType::BINARY_COMPRESSED;
+            } else {
+                utility::LogWarning("Read PCD failed: unknown DATA type {}.",
+                                    tokens[1]);
+                return false;
+            }
+            data_offset = static_cast<size_t>(pos - data);
+            break;
+        }
+    }
+    if (pos >= end && data_offset == 0) {
+        utility::LogWarning("Read PCD failed: missing DATA line.");
+        return false;
+    }
+
+    const size_t num_fields = header.fields_.size();
+    if (num_fields == 0 || sizes.size() != num_fields ||
+        types.size() != num_fields ||
+        (!counts.empty() && counts.size() != num_fields)) {
+        utility::LogWarning("Read PCD failed: inconsistent field header.");
+        return false;
+    }
+    header.record_size_ = 0;
+    for (size_t i = 0; i < num_fields; ++i) {
+        PCDField &field = header.fields_[i];
+        field.size_ = sizes[i];
+        field.type_ = types[i];
+        field.count_ = counts.empty() ? 1 : counts[i];
+        if (field.size_ <= 0 || field.count_ <= 0 ||
+            (field.type_ != 'F' && field.type_ != 'I' &&
+             field.type_ != 'U')) {
+            utility::LogWarning("Read PCD failed: invalid field {}.",
+                                field.name_);
+            return false;
+        }
+        field.dtype_ = GetPCDDtype(field.type_, field.size_);
+        field.offset_ = header.record_size_;
+        if (!MulAddChecked(field.size_, field.count_, header.record_size_,
+                           header.record_size_)) {
+            utility::LogWarning("Read PCD failed: invalid field {}.",
+                                field.name_);
+            return false;
+        }
+    }
+    if (header.points_ < 0 &&
+        !MulAddChecked(header.width_, header.height_, 0, header.points_)) {
+        header.points_ = -1;
+    }
+    if (header.points_ < 0) {
+        utility::LogWarning("Read PCD failed: invalid number of points.");
+        return false;
+    }
+    return true;
+}
+
+/// Assigns the values of a record to attribute columns: x, y and z to
+/// "points", normal_x, normal_y and normal_z to "normals", packed "rgb" or
+/// "rgba" to UInt8 "colors", and every other field to the attribute named
+/// after it, with one column per element. Returns the Dtype and number of
+/// columns of each attribute in \p attributes.
+std::vector<PCDColumn> AssignColumns(
+        const PCDHeader &header,
+        std::vector<std::pair<std::string, std::pair<core::Dtype, int64_t>>>
+                &attributes) {
+    std::vector<PCDColumn> columns;
+    auto has_attribute = [&](const std::string &key) {
+        return std::any_of(attributes.begin(), attributes.end(),
+                           [&](const auto &a) { return a.first == key; });
+    };
+    auto find_field = [&](const std::string &name) -> const PCDField * {
+        for (const PCDField &field : header.fields_) {
+            if (field.name_ == name) {
+                return &field;
+            }
+        }
+        return nullptr;
+    };
+
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            combined_attrs = {
+                    {"points", {"x", "y", "z"}},
+                    {"normals", {"normal_x", "normal_y", "normal_z"}}};
+    std::vector<const PCDField *> used;
+    for (const auto &combined_attr : combined_attrs) {
+        std::vector<const PCDField *> fields;
+        for (const std::string &name : combined_attr.second) {
+            const PCDField *field = find_field(name);
+            if (field && field->dtype_ != core::Dtype::Undefined &&
+                field->count_ == 1 &&
+                (fields.empty() || field->dtype_ == fields[0]->dtype_)) {
+                fields.push_back(field);
+            }
+        }
+        if (fields.size() != 3) {
+            continue;
+        }
+        for (int64_t c = 0; c < 3; ++c) {
+            columns.push_back({fields[c], 0, combined_attr.first, c, false});
+            used.push_back(fields[c]);
+        }
+        attributes.push_back({combined_attr.first, {fields[0]->dtype_, 3}});
+    }
+
+    for (const PCDField &field : header.fields_) {
+        if (std::find(used.begin(), used.end(), &field) != used.end() ||
+            field.dtype_ == core::Dtype::Undefined || field.name_ == "_") {
+            continue;
+        }
+        if (IsPackedRGB(field)) {
+            if (!has_attribute("colors")) {
+                columns.push_back({&field, 0, "colors", 0, true});
+                attributes.push_back({"colors", {core::Dtype::UInt8, 3}});
+            }
+            continue;
+        }
+        if (has_attribute(field.name_)) {
+            continue;
+        }
+        for (int64_t e = 0; e < field.count_; ++e) {
+            columns.push_back({&field, e, field.name_, e, false});
+        }
+        attributes.push_back({field.name_, {field.dtype_, field.count_}});
+    }
+    return columns;
+}
+
+/// Copies the value of \p size bytes of each point in [\p begin, \p end),
+/// found at \p src + i * \p src_stride, to \p dst + i * \p dst_stride.
+template <int64_t size>
+void CopyStrided(const uint8_t *src,
+                 int64_t src_stride,
+                 uint8_t *dst,
+                 int64_t dst_stride,
+                 int64_t begin,
+                 int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+        std::memcpy(dst + i * dst_stride, src + i * src_stride, size);
+    }
+}
+
+/// Scatters the values of points [\p begin, \p end) of \p data into the
+/// attribute tensors, starting at point \p first of the tensors. The value
+/// \p element of \p field of point i is at \p data +
+/// \p value_offset(field, element) + i * \p value_stride(field).
+template <typename OffsetFunc, typename StrideFunc>
+void ScatterColumns(const std::vector<PCDColumn> &columns,
+                    const uint8_t *data,
+                    const OffsetFunc &value_offset,
+                    const StrideFunc &value_stride,
+                    std::vector<core::Tensor> &tensors,
+                    int64_t first,
+                    int64_t begin,
+                    int64_t end) {
+    for (size_t c = 0; c < columns.size(); ++c) {
+        const PCDColumn &column = columns[c];
+        const PCDField &field = *column.field_;
+        const uint8_t *src = data + value_offset(field, column.element_);
+        const int64_t src_stride = value_stride(field);
+        core::Tensor &tensor = tensors[c];
+        const int64_t num_columns = tensor.GetShape(1);
+        uint8_t *dst = static_cast<uint8_t *>(tensor.GetDataPtr()) +
+                       first * num_columns * tensor.GetDtype().ByteSize();
+        if (column.packed_rgb_) {
+            // The color is packed in BGR order.
+            for (int64_t i = begin; i < end; ++i) {
+                const uint8_t *bgr = src + i * src_stride;
+                dst[3 * i + 0] = bgr[2];
+                dst[3 * i + 1] = bgr[1];
+                dst[3 * i + 2] = bgr[0];
+            }
+            continue;
+        }
+        dst += column.column_ * field.size_;
+        const int64_t dst_stride = num_columns * field.size_;
+        switch (field.size_) {
+            case 1:
+                CopyStrided<1>(src, src_stride, dst, dst_stride, begin, end);
+                break;
+            case 2:
+                CopyStrided<2>(src, src_stride, dst, dst_stride, begin, end);
+                break;
+            case 4:
+                CopyStrided<4>(src, src_stride, dst, dst_stride, begin, end);
+                break;
+            default:
+                CopyStrided<8>(src, src_stride, dst, dst_stride, begin, end);
+                break;
+        }
+    }
+}
+
+/// Parses one ASCII value of \p field into its binary representation.
+bool ParseASCIIValue(const char *&pos,
+                     const char *end,
+                     const PCDField &field,
+                     uint8_t *dst) {
+    if (field.dtype_ == core::Dtype::Undefined) {
+        return open3d::io::SkipToken(pos, end);
+    }
+    if (field.type_ == 'F' && !IsPackedRGB(field)) {
+        double value;
+        if (!open3d::io::ParseNumber(pos, end, value)) {
+            return false;
+        }
+        if (field.size_ == 4) {
+            const float float_value = static_cast<float>(value);
+            std::memcpy(dst, &float_value, 4);
+        } else {
+            std::memcpy(dst, &value, 8);
+        }
+        return true;
+    }
+
+    // Integers keep the strtol semantics (hexadecimal and octal values), and
+    // packed colors are parsed as floats directly to preserve their bits.
+    const char *token_begin = pos;
+    if (!open3d::io::SkipToken(pos, end)) {
+        return false;
+    }
+    while (std::isspace(static_cast<unsigned char>(*token_begin))) {
+        ++token_begin;
+    }
+    char token[64] = {0};
+    std::memcpy(token, token_begin,
+                std::min<size_t>(pos - token_begin, sizeof(token) - 1));
+    char *token_end = nullptr;
+    if (field.type_ == 'F') {
+        const float value = std::strtof(token, &token_end);
+        std::memcpy(dst, &value, 4);
+    } else if (field.type_ == 'I') {
+        const long long value = std::strtoll(token, &token_end, 0);
+        DISPATCH_DTYPE_TO_TEMPLATE(field.dtype_, [&]() {
+            const scalar_t typed_value = static_cast<scalar_t>(value);
+            std::memcpy(dst, &typed_value, sizeof(scalar_t));
+        });
+    } else {
+        const unsigned long long value = std::strtoull(token, &token_end, 0);
+        DISPATCH_DTYPE_TO_TEMPLATE(field.dtype_, [&]() {
+            const scalar_t typed_value = static_cast<scalar_t>(value);
+            std::memcpy(dst, &typed_value, sizeof(scalar_t));
+        });
+    }
+    return token_end != token;
+}
+
+/// A value written per point: element \p element of \p column_ of
+/// \p tensor_, or the UInt8 colors packed into a float for "rgb".
+struct PCDWriteField {
+    std::string name_;
+    char type_;
+    int64_t size_;
+    int64_t count_;
+    core::Dtype dtype_;
+    core::Tensor tensor_;
+    int64_t column_;
+    bool packed_rgb_;
+};
+
+bool GetPCDType(const core::Dtype &dtype, char &type) {
+    if (dtype == core::Dtype::Float32 || dtype == core::Dtype::Float64) {
+        type = 'F';
+    } else if (dtype == core::Dtype::Int8 || dtype == core::Dtype::Int16 ||
+               dtype == core::Dtype::Int32 || dtype == core::Dtype::Int64) {
+        type = 'I';
+    } else if (dtype == core::Dtype::UInt8 || dtype == core::Dtype::UInt16 ||
+               dtype == core::Dtype::UInt32 || dtype == core::Dtype::UInt64) {
+        type = 'U';
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/// Writes the binary representation of \p element of \p field for point
+/// \p i to \p dst.
+inline void GetFieldValue(const PCDWriteField &field,
+                          int64_t i,
+                          int64_t element,
+                          uint8_t *dst) {
+    const uint8_t *src =
+            static_cast<const uint8_t *>(field.tensor_.GetDataPtr());
+    const int64_t num_columns = field.tensor_.GetShape(1);
+    if (field.packed_rgb_) {
+        const uint8_t *rgb = src + 3 * i;
+        dst[0] = rgb[2];
+        dst[1] = rgb[1];
+        dst[2] = rgb[0];
+        dst[3] = 0;
+    } else {
+        std::memcpy(dst,
+                    src + (i * num_columns + field.column_ + element) *
+                                  field.size_,
+                    field.size_);
+    }
+}
+
+/// Appends the text of a binary value of \p field.
+void FormatFieldValue(const PCDWriteField &field,
+                      const uint8_t *value,
+                      std::string &out) {
+    char buffer[64];
+    int length = 0;
+    DISPATCH_DTYPE_TO_TEMPLATE(field.dtype_, [&]() {
+        scalar_t typed_value;
+        std::memcpy(&typed_value, value, sizeof(scalar_t));
+        if (std::is_floating_point<scalar_t>::value) {
+            length = snprintf(buffer, sizeof(buffer),
+                              sizeof(scalar_t) == 4 ? "%.9g" : "%.17g",
+                              static_cast<double>(typed_value));
+        } else if (std::is_signed<scalar_t>::value) {
+            length = snprintf(buffer, sizeof(buffer), "%lld",
+                              static_cast<long long>(typed_value));
+        } else {
+            length = snprintf(buffer, sizeof(buffer), "%llu",
+                              static_cast<unsigned long long>(typed_value));
+        }
+    });
+    out.append(buffer, static_cast<size_t>(std::max(length, 0)));
+}
+
+}  // namespace
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    pointcloud.Clear();
+    size_t file_size = 0;
+    std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+            filename, file_size, false, nullptr);
+    if (!mapping) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const uint8_t *data = mapping.get();
+    PCDHeader header;
+    size_t data_offset = 0;
+    if (!ReadPCDHeader(reinterpret_cast<const char *>(data), file_size, header,
+                       data_offset)) {
+        return false;
+    }
+    std::vector<std::pair<std::string, std::pair<core::Dtype, int64_t>>>
+            attributes;
+    const std::vector<PCDColumn> columns = AssignColumns(header, attributes);
+    if (attributes.empty() || attributes[0].first != "points") {
+        utility::LogWarning("Read PCD failed: no x, y and z fields.");
+        return false;
+    }
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(header.points_);
+
+    const uint8_t *data_begin = data + data_offset;
+    const int64_t data_size = static_cast<int64_t>(file_size - data_offset);
+    int64_t num_points = header.points_;
+    // The binary point records of each range of ASCII lines.
+    std::vector<const char *> line_ranges;
+    std::vector<std::vector<uint8_t>> range_records;
+    std::vector<uint8_t> decompressed;
+    if (header.datatype_ == PCDDataType::ASCII) {
+        const char *text = reinterpret_cast<const char *>(data_begin);
+        line_ranges = open3d::io::SplitTextAtLines(text, text + data_size,
+                                                   1 << 20);
+        range_records.resize(line_ranges.size() - 1);
+        core::ParallelFor(range_records.size(), [&](int64_t r) {
+            std::vector<uint8_t> record(header.record_size_);
+            const char *range_end = line_ranges[r + 1];
+            for (const char *line = line_ranges[r]; line < range_end;) {
+                const char *line_end = static_cast<const char *>(
+                        std::memchr(line, '\n', range_end - line));
+                line_end = line_end ? line_end : range_end;
+                const char *pos = line;
+                bool valid = true;
+                for (const PCDField &field : header.fields_) {
+                    for (int64_t e = 0; e < field.count_ && valid; ++e) {
+                        valid = ParseASCIIValue(
+                                pos, line_end, field,
+                                record.data() + field.offset_ +
+                                        e * field.size_);
+                    }
+                }
+                if (valid) {
+                    range_records[r].insert(range_records[r].end(),
+                                            record.begin(), record.end());
+                }
+                line = line_end + 1;
+            }
+        });
+        int64_t num_records = 0;
+        for (const auto &records : range_records) {
+            num_records += records.size() / header.record_size_;
+        }
+        num_points = std::min(num_points, num_records);
+    } else if (header.datatype_ == PCDDataType::BINARY) {
+        // The point count comes from the header, so it is compared with the
+        // records that fit in the file before multiplying.
+        if (num_points > data_size / header.record_size_) {
+            utility::LogWarning("Read PCD failed: file is truncated.");
+            return false;
+        }
+    } else {
+        uint32_t sizes[2];
+        if (data_size < int64_t(sizeof(sizes))) {
+            utility::LogWarning("Read PCD failed: file is truncated.");
+            return false;
+        }
+        std::memcpy(sizes, data_begin, sizeof(sizes));
+        int64_t uncompressed_size = 0;
+        if (!MulAddChecked(num_points, header.record_size_, 0,
+                           uncompressed_size) ||
+            int64_t(sizes[1]) != uncompressed_size ||
+            data_size - int64_t(sizeof(sizes)) < int64_t(sizes[0])) {
+            utility::LogWarning("Read PCD failed: invalid compressed data.");
+            return false;
+        }
+        decompressed.resize(sizes[1]);
+        if (!open3d::io::DecompressLZF(data_begin + sizeof(sizes), sizes[0],
+                                       decompressed.data(), sizes[1])) {
+            utility::LogWarning("Read PCD failed: decompression failed.");
+            return false;
+        }
+    }
+
+    std::vector<core::Tensor> tensors;
+    std::unordered_map<std::string, core::Tensor> attribute_tensors;
+    for (const auto &attribute : attributes) {
+        attribute_tensors[attribute.first] = core::Tensor(
+                {num_points, attribute.second.second}, attribute.second.first);
+    }
+    for (const PCDColumn &column : columns) {
+        tensors.push_back(attribute_tensors.at(column.key_));
+    }
+
+    if (header.datatype_ == PCDDataType::ASCII) {
+        int64_t first = 0;
+        for (const auto &records : range_records) {
+            const int64_t count = std::min<int64_t>(
+                    records.size() / header.record_size_, num_points - first);
+            core::ParallelForRange(
+                    count,
+                    [&](int64_t begin, int64_t end) {
+                        ScatterColumns(
+                                columns, records.data(),
+                                [](const PCDField &field, int64_t e) {
+                                    return field.offset_ + e * field.size_;
+                                },
+                                [&](const PCDField &) {
+                                    return header.record_size_;
+                                },
+                                tensors, first, begin, end);
+                    },
+                    1024);
+            first += count;
+        }
+    } else if (header.datatype_ == PCDDataType::BINARY) {
+        core::ParallelForRange(
+                num_points,
+                [&](int64_t begin, int64_t end) {
+                    ScatterColumns(
+                            columns, data_begin,
+                            [](const PCDField &field, int64_t e) {
+                                return field.offset_ + e * field.size_;
+                            },
+                            [&](const PCDField &) {
+                                return header.record_size_;
+                            },
+                            tensors, 0, begin, end);
+                },
+                1024);
+    } else {
+        // Each field is stored as a column of all points.
+        core::ParallelForRange(
+                num_points,
+                [&](int64_t begin, int64_t end) {
+                    ScatterColumns(
+                            columns, decompressed.data(),
+                            [&](const PCDField &field, int64_t e) {
+                                return field.offset_ * num_points +
+                                       e * field.size_;
+                            },
+                            [](const PCDField &field) {
+                                return field.size_ * field.count_;
+                            },
+                            tensors, 0, begin, end);
+                },
+                1024);
+    }
+
+    for (const auto &attribute : attributes) {
+        pointcloud.SetPointAttr(attribute.first,
+                                attribute_tensors.at(attribute.first));
+    }
+    reporter.Finish();
+    return true;
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const open3d::io::WritePointCloudOption &params) {
+    if (pointcloud.IsEmpty()) {
+        utility::LogWarning("Write PCD failed: point cloud has 0 points.");
+        return false;
+    }
+    const geometry::TensorMap &t_map = pointcloud.GetPointAttr();
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+    for (const auto &it : t_map) {
+        if (it.second.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write PCD failed: Points ({}) and {} ({}) have different "
+                    "lengths.",
+                    num_points, it.first, it.second.GetLength());
+            return false;
+        }
+    }
+
+    // x y z [normal_x normal_y normal_z] [rgb] [other attributes]
+    std::vector<PCDWriteField> fields;
+    auto add_xyz_fields = [&](const core::Tensor &tensor,
+                              const std::vector<std::string> &names) {
+        const core::Tensor values = tensor.To(core::Device("CPU:0"))
+                                            .Reshape({num_points, -1})
+                                            .Contiguous();
+        char type;
+        if (values.GetShape(1) != 3 || !GetPCDType(values.GetDtype(), type)) {
+            return false;
+        }
+        for (int64_t c = 0; c < 3; ++c) {
+            fields.push_back({names[c], type, values.GetDtype().ByteSize(), 1,
+                              values.GetDtype(), values, c, false});
+        }
+        return true;
+    };
+    if (!add_xyz_fields(pointcloud.GetPoints(), {"x", "y", "z"})) {
+        utility::LogWarning("Write PCD failed: points must be Nx3.");
+        return false;
+    }
+    if (pointcloud.HasPointNormals() &&
+        !add_xyz_fields(pointcloud.GetPointNormals(),
+                        {"normal_x", "normal_y", "normal_z"})) {
+        utility::LogWarning("Write PCD failed: normals must be Nx3.");
+        return false;
+    }
+    if (pointcloud.HasPointColors()) {
+        const core::Tensor colors =
+                ConvertColorTensorToUint8(
+                        pointcloud.GetPointColors().To(core::Device("CPU:0")))
+                        .Contiguous();
+        if (colors.NumDims() != 2 || colors.GetShape(1) != 3) {
+            utility::LogWarning("Write PCD failed: colors must be Nx3.");
+            return false;
+        }
+        fields.push_back({"rgb", 'F', 4, 1, core::Dtype::Float32, colors, 0,
+                          true});
+    }
+    for (const auto &it : t_map) {
+        if (it.first == "points" || it.first == "normals" ||
+            it.first == "colors") {
+            continue;
+        }
+        core::Tensor values = it.second.To(core::Device("CPU:0"));
+        if (values.GetDtype() == core::Dtype::Bool) {
+            values = values.To(core::Dtype::UInt8);
+        }
+        values = values.Reshape({num_points, -1}).Contiguous();
+        char type;
+        if (!GetPCDType(values.GetDtype(), type) || values.GetShape(1) == 0) {
+            utility::LogWarning("Write PCD: skipping attribute {}.", it.first);
+            continue;
+        }
+        fields.push_back({it.first, type, values.GetDtype().ByteSize(),
+                          values.GetShape(1), values.GetDtype(), values, 0,
+                          false});
+    }
+
+    const bool ascii = bool(params.write_ascii);
+    const bool compressed = !ascii && bool(params.compressed);
+    int64_t record_size = 0;
+    for (const PCDWriteField &field : fields) {
+        record_size += field.size_ * field.count_;
+    }
+    if (compressed &&
+        num_points * record_size > std::numeric_limits<uint32_t>::max()) {
+        utility::LogWarning("Write PCD failed: too much data to compress.");
+        return false;
+    }
+
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "wb")) {
+        utility::LogWarning("Write PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    std::string text = "# .PCD v0.7 - Point Cloud Data file format\n";
+    text += "VERSION 0.7\nFIELDS";
+    for (const PCDWriteField &field : fields) {
+        text += " " + field.name_;
+    }
+    text += "\nSIZE";
+    for (const PCDWriteField &field : fields) {
+        text += " " + std::to_string(field.size_);
+    }
+    text += "\nTYPE";
+    for (const PCDWriteField &field : fields) {
+        text += std::string(" ") + field.type_;
+    }
+    text += "\nCOUNT";
+    for (const PCDWriteField &field : fields) {
+        text += " " + std::to_string(field.count_);
+    }
+    text += "\nWIDTH " + std::to_string(num_points) + "\nHEIGHT 1\n";
+    text += "VIEWPOINT 0 0 0 1 0 0 0\n";
+    text += "POINTS " + std::to_string(num_points) + "\n";
+    text += ascii ? "DATA ascii\n"
+                  : compressed ? "DATA binary_compressed\n" : "DATA binary\n";
+    FILE *fp = file.GetFILE();
+    if (fwrite(text.data(), 1, text.size(), fp) != text.size()) {
+        utility::LogWarning("Write PCD failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_points);
+    if (compressed) {
+        // Each field is stored as a column of all points. Values may straddle
+        // chunk boundaries, so they are copied byte-exactly.
+        std::vector<int64_t> column_offsets(fields.size() + 1, 0);
+        for (size_t f = 0; f < fields.size(); ++f) {
+            column_offsets[f + 1] =
+                    column_offsets[f] +
+                    num_points * fields[f].size_ * fields[f].count_;
+        }
+        auto fill = [&](int64_t offset, int64_t size, uint8_t *dst) {
+            const int64_t chunk_end = offset + size;
+            for (size_t f = 0; f < fields.size(); ++f) {
+                const int64_t begin = std::max(offset, column_offsets[f]);
+                const int64_t end = std::min(chunk_end, column_offsets[f + 1]);
+                const PCDWriteField &field = fields[f];
+                for (int64_t v = (begin - column_offsets[f]) / field.size_;
+                     column_offsets[f] + v * field.size_ < end; ++v) {
+                    uint8_t value[8];
+                    GetFieldValue(field, v / field.count_, v % field.count_,
+                                  value);
+                    const int64_t value_begin =
+                            column_offsets[f] + v * field.size_;
+                    const int64_t copy_begin = std::max(value_begin, begin);
+                    const int64_t copy_end =
+                            std::min(value_begin + field.size_, end);
+                    std::memcpy(dst + copy_begin - offset,
+                                value + copy_begin - value_begin,
+                                copy_end - copy_begin);
+                }
+            }
+        };
+        const long sizes_pos = ftell(fp);
+        uint32_t sizes[2] = {
+                0, static_cast<uint32_t>(num_points * record_size)};
+        fwrite(sizes, sizeof(sizes), 1, fp);
+        const int64_t compressed_size = open3d::io::WriteLZFStream(
+                fp, num_points * record_size, fill);
+        if (compressed_size < 0 ||
+            compressed_size > std::numeric_limits<uint32_t>::max()) {
+            utility::LogWarning("Write PCD failed: unable to compress data.");
+            return false;
+        }
+        sizes[0] = static_cast<uint32_t>(compressed_size);
+        if (fseek(fp, sizes_pos, SEEK_SET) != 0 ||
+            fwrite(sizes, sizeof(sizes), 1, fp) != 1) {
+            utility::LogWarning("Write PCD failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+    } else {
+        // Blocks of records are formatted in parallel and written in order.
+        const int64_t kBlockSize = 4096;
+        const int64_t num_blocks = (num_points + kBlockSize - 1) / kBlockSize;
+        const int64_t batch_size = 4 * core::GetNumThreads();
+        std::vector<std::string> blocks(batch_size);
+        for (int64_t first = 0; first < num_blocks; first += batch_size) {
+            const int64_t num_batch_blocks =
+                    std::min(batch_size, num_blocks - first);
+            core::ParallelFor(num_batch_blocks, [&](int64_t b) {
+                const int64_t begin = (first + b) * kBlockSize;
+                const int64_t end = std::min(num_points, begin + kBlockSize);
+                std::string &block = blocks[b];
+                block.clear();
+                uint8_t value[8];
+                for (int64_t i = begin; i < end; ++i) {
+                    for (const PCDWriteField &field : fields) {
+                        for (int64_t e = 0; e < field.count_; ++e) {
+                            GetFieldValue(field, i, e, value);
+                            if (ascii) {
+                                if (&field != &fields[0] || e > 0) {
+                                    block += ' ';
+                                }
+                                FormatFieldValue(field, value, block);
+                            } else {
+                                block.append(reinterpret_cast<char *>(value),
+                                             field.size_);
+                            }
+                        }
+                    }
+                    if (ascii) {
+                        block += '\n';
+                    }
+                }
+            });
+            for (int64_t b = 0; b < num_batch_blocks; ++b) {
+                if (fwrite(blocks[b].data(), 1, blocks[b].size(), fp) !=
+                    blocks[b].size()) {
+                    utility::LogWarning(
+                            "Write PCD failed: unable to write file: {}",
+                            filename);
+                    return false;
+                }
+            }
+            reporter.Update(std::min(num_points,
+                                     (first + num_batch_blocks) * kBlockSize));
+        }
+    }
+    reporter.Finish();
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,11 +26,16 @@
 
 #include <rply.h>
 
+#include <cstring>
+#include <sstream>
+
 #include "open3d/core/Dtype.h"
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/file_format/FileFormatUtil.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -160,6 +165,8 @@ static core::Dtype GetDtype(e_ply_type type) {
         return core::Dtype::Float64;
     } else if (type == PLY_UCHAR) {
         return core::Dtype::UInt8;
+    } else if (type == PLY_USHORT) {
+        return core::Dtype::UInt16;
     } else if (type == PLY_INT) {
         return core::Dtype::Int32;
     } else if (type == PLY_FLOAT) {
@@ -171,9 +178,254 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+/// Layout of a binary PLY element, as declared in the header.
+struct PLYElementLayout {
+    struct Property {
+        std::string name_;
+        std::string type_;
+        // Undefined for types without a Dtype, which are skipped.
+        core::Dtype dtype_;
+        int64_t byte_size_;
+        int64_t offset_;
+    };
+    std::string name_;
+    int64_t count_;
+    // Byte size of one record, or -1 if it contains list properties.
+    int64_t stride_;
+    std::vector<Property> properties_;
+};
+
+/// Parses the header of a binary PLY file. Returns false if the file is not
+/// binary or the header is not understood.
+static bool ReadBinaryPLYHeader(const char *data,
+                                size_t size,
+                                bool &big_endian,
+                                std::vector<PLYElementLayout> &elements,
+                                size_t &data_offset) {
+    const std::string kEndHeader = "end_header";
+    size_t pos = 0;
+    bool has_format = false;
+    while (pos < size) {
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data + pos, '\n', size - pos));
+        if (!line_end) {
+            return false;
+        }
+        std::string line(data + pos, line_end);
+        pos = line_end - data + 1;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            if (format == "binary_little_endian") {
+                big_endian = false;
+            } else if (format == "binary_big_endian") {
+                big_endian = true;
+            } else {
+                return false;
+            }
+            has_format = true;
+        } else if (keyword == "element") {
+            PLYElementLayout element;
+            if (!(tokens >> element.name_ >> element.count_) ||
+                element.count_ < 0) {
+                return false;
+            }
+            element.stride_ = 0;
+            elements.push_back(element);
+        } else if (keyword == "property") {
+            if (elements.empty()) {
+                return false;
+            }
+            PLYElementLayout &element = elements.back();
+            std::string type;
+            tokens >> type;
+            if (type == "list") {
+                element.stride_ = -1;
+                continue;
+            }
+            PLYElementLayout::Property property;
+            if (!(tokens >> property.name_)) {
+                return false;
+            }
+            property.type_ = type;
+            property.byte_size_ = GetPLYTypeInfo(type, property.dtype_);
+            if (property.byte_size_ == 0) {
+                return false;
+            }
+            property.offset_ = element.stride_;
+            if (element.stride_ >= 0) {
+                element.stride_ += property.byte_size_;
+            }
+            element.properties_.push_back(property);
+        } else if (keyword == kEndHeader) {
+            data_offset = pos;
+            return has_format;
+        } else if (keyword != "ply" && keyword != "comment" &&
+                   keyword != "obj_info" && !keyword.empty()) {
+            return false;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+static T ByteSwap(T value) {
+    char *bytes = reinterpret_cast<char *>(&value);
+    std::reverse(bytes, bytes + sizeof(T));
+    return value;
+}
+
+/// Copies one property column of a fixed-stride element into \p dst, which
+/// has \p dst_stride elements per row.
+template <typename T>
+static void CopyPLYColumn(const char *src,
+                          int64_t src_stride,
+                          int64_t count,
+                          bool byte_swap,
+                          T *dst,
+                          int64_t dst_stride) {
+    core::ParallelForRange(
+            count,
+            [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    T value;
+                    std::memcpy(&value, src + i * src_stride, sizeof(T));
+                    dst[i * dst_stride] = byte_swap ? ByteSwap(value) : value;
+                }
+            },
+            1 << 16);
+}
+
+/// Fast path for binary PLY files whose elements up to "vertex" have no list
+/// properties. The file is memory-mapped and each property column is copied
+/// straight into its attribute Tensor, bypassing the per-value rply
+/// callbacks. Returns false if the file does not qualify, in which case the
+/// rply reader is used.
+static bool ReadPointCloudFromBinaryPLY(
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params) {
+    size_t file_size = 0;
+    std::shared_ptr<uint8_t> mapping =
+            utility::filesystem::FMapToBuffer(filename, file_size, false,
+                                              nullptr);
+    if (!mapping) {
+        return false;
+    }
+    const char *data = reinterpret_cast<const char *>(mapping.get());
+
+    bool big_endian = false;
+    std::vector<PLYElementLayout> elements;
+    size_t offset = 0;
+    if (!ReadBinaryPLYHeader(data, file_size, big_endian, elements, offset)) {
+        return false;
+    }
+
+    // Locate the vertex element, skipping the fixed-stride elements before
+    // it. Counts come from the header, so they are checked against the bytes
+    // left in the file before multiplying.
+    auto fits_in_file = [&](const PLYElementLayout &element) {
+        return offset <= file_size &&
+               (element.stride_ == 0 ||
+                uint64_t(element.count_) <=
+                        (file_size - offset) / uint64_t(element.stride_));
+    };
+    const PLYElementLayout *vertex = nullptr;
+    for (const PLYElementLayout &element : elements) {
+        if (element.stride_ < 0 || !fits_in_file(element)) {
+            return false;
+        }
+        if (element.name_ == "vertex") {
+            vertex = &element;
+            break;
+        }
+        offset += element.count_ * element.stride_;
+    }
+    if (!vertex) {
+        return false;
+    }
+
+    const int64_t num_points = vertex->count_;
+    const char *vertex_data = data + offset;
+    const bool byte_swap = big_endian == IsHostLittleEndian();
+
+    // Attributes read into the columns of a {num_points, 3} tensor, others
+    // into {num_points, 1} tensors.
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            combined_attrs = {{"points", {"x", "y", "z"}},
+                              {"normals", {"nx", "ny", "nz"}},
+                              {"colors", {"red", "green", "blue"}}};
+    std::unordered_map<std::string, const PLYElementLayout::Property *>
+            properties;
+    for (const PLYElementLayout::Property &property : vertex->properties_) {
+        if (property.dtype_ == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_, property.type_);
+        } else {
+            properties[property.name_] = &property;
+        }
+    }
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(num_points);
+    pointcloud.Clear();
+
+    auto copy_column = [&](const PLYElementLayout::Property &property,
+                           core::Tensor &dst, int64_t column) {
+        DISPATCH_DTYPE_TO_TEMPLATE(property.dtype_, [&]() {
+            CopyPLYColumn(vertex_data + property.offset_, vertex->stride_,
+                          num_points, byte_swap,
+                          dst.GetDataPtr<scalar_t>() + column,
+                          dst.GetShape()[1]);
+        });
+    };
+    for (const auto &combined_attr : combined_attrs) {
+        const std::vector<std::string> &names = combined_attr.second;
+        if (properties.count(names[0]) == 0 ||
+            properties.count(names[1]) == 0 ||
+            properties.count(names[2]) == 0) {
+            continue;
+        }
+        const core::Dtype dtype = properties.at(names[0])->dtype_;
+        if (properties.at(names[1])->dtype_ != dtype ||
+            properties.at(names[2])->dtype_ != dtype) {
+            utility::LogError(
+                    "Read PLY failed: datatype mismatch in base attributes.");
+        }
+        core::Tensor attr = core::Tensor::Empty({num_points, 3}, dtype);
+        for (int64_t c = 0; c < 3; ++c) {
+            copy_column(*properties.at(names[c]), attr, c);
+            properties.erase(names[c]);
+        }
+        pointcloud.SetPointAttr(combined_attr.first, attr);
+    }
+    for (const auto &it : properties) {
+        core::Tensor attr = core::Tensor::Empty({num_points, 1},
+                                                it.second->dtype_);
+        copy_column(*it.second, attr, 0);
+        pointcloud.SetPointAttr(it.first, attr);
+    }
+
+    reporter.Finish();
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    if (ReadPointCloudFromBinaryPLY(filename, pointcloud, params)) {
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
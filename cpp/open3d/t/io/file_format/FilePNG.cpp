@@ -27,6 +27,7 @@
 #include <png.h>
 
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/file_format/FileFormatUtil.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -54,7 +55,9 @@ static void SetPNGImageFromImage(const geometry::Image &image,
     }
 }
 
-bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
+bool ReadImageFromPNG(const std::string &filename,
+                      geometry::Image &image,
+                      bool reuse_storage) {
     png_image pngimage;
     memset(&pngimage, 0, sizeof(pngimage));
     pngimage.version = PNG_IMAGE_VERSION;
@@ -68,15 +71,12 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     if (pngimage.format & PNG_FORMAT_FLAG_COLORMAP) {
         pngimage.format &= ~PNG_FORMAT_FLAG_COLORMAP;
     }
-    if (pngimage.format & PNG_FORMAT_FLAG_LINEAR) {
-        image.Reset(pngimage.height, pngimage.width,
-                    PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
-                    core::Dtype::UInt16, image.GetDevice());
-    } else {
-        image.Reset(pngimage.height, pngimage.width,
-                    PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
-                    core::Dtype::UInt8, image.GetDevice());
-    }
+    ResetImageForRead(image, pngimage.height, pngimage.width,
+                      PNG_IMAGE_SAMPLE_CHANNELS(pngimage.format),
+                      (pngimage.format & PNG_FORMAT_FLAG_LINEAR)
+                              ? core::Dtype::UInt16
+                              : core::Dtype::UInt8,
+                      reuse_storage);
 
     if (png_image_finish_read(&pngimage, NULL, image.GetDataPtr(), 0, NULL) ==
         0) {
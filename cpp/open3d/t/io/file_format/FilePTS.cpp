@@ -25,8 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelTextParser.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -45,23 +47,25 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         pointcloud.Clear();
 
         // Get num_points.
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "rb")) {
+        size_t file_size = 0;
+        std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+                filename, file_size, false, nullptr);
+        if (!mapping) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
+        const char *data = reinterpret_cast<const char *>(mapping.get());
+        const char *data_end = data + file_size;
+        const char *line_end = static_cast<const char *>(
+                std::memchr(data, '\n', file_size));
+        const char *data_begin = line_end ? line_end + 1 : data_end;
 
         int64_t num_points = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            const char *format;
-            if (std::is_same<int64_t, long>::value) {
-                format = "%ld";
-            } else {
-                format = "%lld";
-            }
-            sscanf(line_buffer, format, &num_points);
+        double header_value = 0;
+        const char *pos = data;
+        if (open3d::io::ParseNumber(pos, data_begin, header_value)) {
+            num_points = static_cast<int64_t>(header_value);
         }
         if (num_points < 0) {
             utility::LogWarning(
@@ -74,116 +78,92 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(num_points);
 
-        // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
-
-        double *points_ptr = nullptr;
-        double *intensities_ptr = nullptr;
-        uint8_t *colors_ptr = nullptr;
-        size_t num_fields = 0;
-
-        if ((line_buffer = file.ReadLine())) {
-            num_fields = utility::SplitString(line_buffer, " ").size();
+        // The first data line decides the layout of all lines.
+        line_end = static_cast<const char *>(
+                std::memchr(data_begin, '\n', data_end - data_begin));
+        const std::string first_line(data_begin,
+                                     line_end ? line_end : data_end);
+        const size_t num_fields = utility::SplitString(first_line, " ").size();
+        if (num_fields != 3 && num_fields != 4 && num_fields != 6 &&
+            num_fields != 7) {
+            utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                first_line);
+            return false;
+        }
+        const bool has_intensities = num_fields == 4 || num_fields == 7;
+        const bool has_colors = num_fields >= 6;
 
-            // X Y Z I R G B.
-            if (num_fields == 7) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Dtype::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Dtype::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::Dtype::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Dtype::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointColors(
-                        core::Tensor({num_points, 3}, core::Dtype::UInt8));
-                colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
-            }
-            // X Y Z I.
-            else if (num_fields == 4) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Dtype::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-                pointcloud.SetPointAttr(
-                        "intensities",
-                        core::Tensor({num_points, 1}, core::Dtype::Float64));
-                intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                          .GetDataPtr<double>();
-            }
-            // X Y Z.
-            else if (num_fields == 3) {
-                pointcloud.SetPoints(
-                        core::Tensor({num_points, 3}, core::Dtype::Float64));
-                points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
-            } else {
-                utility::LogWarning("Read PTS failed: unknown pts format: {}",
-                                    line_buffer);
+        // X Y Z [I] [R G B], with a flag for the lines that are complete.
+        struct PTSRow {
+            double values[7];
+            bool valid;
+        };
+        std::vector<PTSRow> rows = open3d::io::ParseLinesInParallel<PTSRow>(
+                data_begin, data_end,
+                [num_fields](const char *pos, const char *end, PTSRow &row) {
+                    for (size_t i = 0; i < num_fields; ++i) {
+                        if (!open3d::io::ParseNumber(pos, end,
+                                                     row.values[i])) {
+                            row.valid = false;
+                            return true;
+                        }
+                    }
+                    row.valid = true;
+                    return true;
+                });
+        if (static_cast<int64_t>(rows.size()) > num_points) {
+            rows.resize(num_points);
+        }
+        const int64_t num_rows = static_cast<int64_t>(rows.size());
+        for (int64_t idx = 0; idx < num_rows; ++idx) {
+            if (!rows[idx].valid) {
+                const char *line = data_begin;
+                for (int64_t skip = 0; skip < idx; ++skip) {
+                    line = static_cast<const char *>(
+                                   std::memchr(line, '\n', data_end - line)) +
+                           1;
+                }
+                line_end = static_cast<const char *>(
+                        std::memchr(line, '\n', data_end - line));
+                utility::LogWarning("Read PTS failed at line: {}",
+                                    std::string(line, line_end ? line_end
+                                                               : data_end));
                 return false;
             }
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
-
-        int64_t idx = 0;
-        while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
-                return false;
+        pointcloud.SetPoints(core::Tensor::Zeros({num_points, 3},
+                                                 core::Dtype::Float64));
+        double *points_ptr = pointcloud.GetPoints().GetDataPtr<double>();
+        double *intensities_ptr = nullptr;
+        uint8_t *colors_ptr = nullptr;
+        if (has_intensities) {
+            pointcloud.SetPointAttr("intensities",
+                                    core::Tensor::Zeros({num_points, 1},
+                                                        core::Dtype::Float64));
+            intensities_ptr =
+                    pointcloud.GetPointAttr("intensities").GetDataPtr<double>();
+        }
+        if (has_colors) {
+            pointcloud.SetPointColors(core::Tensor::Zeros({num_points, 3},
+                                                          core::Dtype::UInt8));
+            colors_ptr = pointcloud.GetPointColors().GetDataPtr<uint8_t>();
+        }
+        core::ParallelFor(num_rows, [&](int64_t idx) {
+            const double *values = rows[idx].values;
+            points_ptr[3 * idx + 0] = values[0];
+            points_ptr[3 * idx + 1] = values[1];
+            points_ptr[3 * idx + 2] = values[2];
+            if (has_intensities) {
+                intensities_ptr[idx] = values[3];
             }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+            if (has_colors) {
+                const double *rgb = values + (has_intensities ? 4 : 3);
+                colors_ptr[3 * idx + 0] = static_cast<int>(rgb[0]);
+                colors_ptr[3 * idx + 1] = static_cast<int>(rgb[1]);
+                colors_ptr[3 * idx + 2] = static_cast<int>(rgb[2]);
             }
-        }
+        });
 
         reporter.Finish();
         return true;
@@ -24,11 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <array>
 #include <cstdio>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelTextParser.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -46,36 +48,47 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        size_t file_size = 0;
+        std::shared_ptr<uint8_t> mapping = utility::filesystem::FMapToBuffer(
+                filename, file_size, false, nullptr);
+        if (!mapping) {
             utility::LogWarning("Read XYZI failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        reporter.SetTotal(file_size);
+
+        // Every line takes a point, invalid lines are left zero.
+        const char *data = reinterpret_cast<const char *>(mapping.get());
+        const std::vector<std::array<double, 4>> rows =
+                open3d::io::ParseLinesInParallel<std::array<double, 4>>(
+                        data, data + file_size,
+                        [](const char *pos, const char *end,
+                           std::array<double, 4> &row) {
+                            std::array<double, 4> values;
+                            for (double &value : values) {
+                                if (!open3d::io::ParseNumber(pos, end,
+                                                             value)) {
+                                    return true;
+                                }
+                            }
+                            row = values;
+                            return true;
+                        });
+        const int64_t num_points = static_cast<int64_t>(rows.size());
 
         pointcloud.Clear();
         core::Tensor points({num_points, 3}, core::Dtype::Float64);
         core::Tensor intensities({num_points, 1}, core::Dtype::Float64);
         double *points_ptr = points.GetDataPtr<double>();
         double *intensities_ptr = intensities.GetDataPtr<double>();
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        core::ParallelFor(num_points, [&](int64_t i) {
+            points_ptr[3 * i + 0] = rows[i][0];
+            points_ptr[3 * i + 1] = rows[i][1];
+            points_ptr[3 * i + 2] = rows[i][2];
+            intensities_ptr[i] = rows[i][3];
+        });
         pointcloud.SetPoints(points);
         pointcloud.SetPointAttr("intensities", intensities);
         reporter.Finish();
@@ -0,0 +1,239 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/AsyncRGBDVideoReader.h"
+
+#include <utility>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+AsyncRGBDVideoReader::AsyncRGBDVideoReader(
+        std::unique_ptr<RGBDVideoReader> reader,
+        size_t buffer_size,
+        bool drop_frames,
+        bool convert_depth_to_float,
+        const core::Device &device)
+    : reader_(std::move(reader)),
+      drop_frames_(drop_frames),
+      convert_depth_to_float_(convert_depth_to_float),
+      device_(device),
+      frame_buffer_(buffer_size) {
+    if (reader_ == nullptr) {
+        utility::LogError("reader must not be null.");
+    }
+    if (buffer_size == 0) {
+        utility::LogError("buffer_size must be positive.");
+    }
+    if (reader_->IsOpened()) {
+        StartPrefetch();
+    }
+}
+
+AsyncRGBDVideoReader::~AsyncRGBDVideoReader() { StopPrefetch(); }
+
+bool AsyncRGBDVideoReader::IsEOF() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return is_eof_ && num_frames_ == 0;
+}
+
+bool AsyncRGBDVideoReader::Open(const std::string &filename) {
+    StopPrefetch();
+    if (!reader_->Open(filename)) {
+        return false;
+    }
+    StartPrefetch();
+    return true;
+}
+
+void AsyncRGBDVideoReader::Close() {
+    StopPrefetch();
+    reader_->Close();
+}
+
+bool AsyncRGBDVideoReader::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    StopPrefetch();
+    bool success = reader_->SeekTimestamp(timestamp);
+    if (success) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        timestamp_ = timestamp;
+    }
+    StartPrefetch();
+    return success;
+}
+
+uint64_t AsyncRGBDVideoReader::GetTimestamp() const {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return UINT64_MAX;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return timestamp_;
+}
+
+t::geometry::RGBDImage AsyncRGBDVideoReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (num_frames_ == 0 && !is_eof_) {
+        ++num_stalls_;
+        frame_available_.wait(lock,
+                              [this] { return num_frames_ > 0 || is_eof_; });
+    }
+    if (num_frames_ == 0) {
+        if (exception_) {
+            std::exception_ptr exception = exception_;
+            exception_ = nullptr;
+            std::rethrow_exception(exception);
+        }
+        utility::LogInfo("EOF reached");
+        return t::geometry::RGBDImage();
+    }
+    Frame frame = std::move(frame_buffer_[head_]);
+    head_ = (head_ + 1) % frame_buffer_.size();
+    --num_frames_;
+    timestamp_ = frame.timestamp_;
+    lock.unlock();
+    space_available_.notify_one();
+    return frame.rgbd_;
+}
+
+size_t AsyncRGBDVideoReader::GetNumDroppedFrames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_dropped_frames_;
+}
+
+size_t AsyncRGBDVideoReader::GetQueueDepth() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_frames_;
+}
+
+size_t AsyncRGBDVideoReader::GetNumStalls() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_stalls_;
+}
+
+void AsyncRGBDVideoReader::StartPrefetch() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        head_ = 0;
+        num_frames_ = 0;
+        stop_ = false;
+        is_eof_ = false;
+        exception_ = nullptr;
+    }
+    prefetch_thread_ = std::thread(&AsyncRGBDVideoReader::PrefetchFrames, this);
+}
+
+void AsyncRGBDVideoReader::StopPrefetch() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    space_available_.notify_one();
+    if (prefetch_thread_.joinable()) {
+        prefetch_thread_.join();
+    }
+    // Release the buffered frames.
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Frame &frame : frame_buffer_) {
+        frame = Frame();
+    }
+    num_frames_ = 0;
+}
+
+void AsyncRGBDVideoReader::PrefetchFrames() try {
+    const size_t buffer_size = frame_buffer_.size();
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            space_available_.wait(lock, [this, buffer_size] {
+                return stop_ || drop_frames_ || num_frames_ < buffer_size;
+            });
+            if (stop_) {
+                return;
+            }
+        }
+
+        // Decode and convert without holding the lock, so that the consumer
+        // can take earlier frames meanwhile.
+        Frame frame;
+        frame.rgbd_ = reader_->NextFrame();
+        frame.timestamp_ = reader_->GetTimestamp();
+        const bool is_eof = reader_->IsEOF();
+        const bool has_frame = !frame.rgbd_.IsEmpty();
+        if (has_frame) {
+            // Upload first, so that the conversion runs on the device and
+            // the smaller integer depth is copied.
+            frame.rgbd_ = frame.rgbd_.To(device_);
+            if (convert_depth_to_float_ &&
+                frame.rgbd_.depth_.GetDtype() != core::Dtype::Float32) {
+                frame.rgbd_.depth_ = t::geometry::Image(
+                        frame.rgbd_.depth_.AsTensor()
+                                .To(core::Dtype::Float32)
+                                .Div_(reader_->GetMetadata().depth_scale_));
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (has_frame) {
+                if (num_frames_ == buffer_size) {  // Only if drop_frames_.
+                    head_ = (head_ + 1) % buffer_size;
+                    --num_frames_;
+                    ++num_dropped_frames_;
+                }
+                frame_buffer_[(head_ + num_frames_) % buffer_size] =
+                        std::move(frame);
+                ++num_frames_;
+            }
+            is_eof_ = is_eof;
+        }
+        frame_available_.notify_one();
+        if (is_eof) {
+            return;
+        }
+    }
+} catch (...) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exception_ = std::current_exception();
+        is_eof_ = true;
+    }
+    frame_available_.notify_one();
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
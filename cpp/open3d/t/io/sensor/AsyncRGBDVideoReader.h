@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class AsyncRGBDVideoReader
+///
+/// Prefetching wrapper around another RGBDVideoReader.
+///
+/// A background thread reads frames from the wrapped reader into a bounded
+/// ring buffer, so that decoding overlaps with the processing of earlier
+/// frames by the caller. The thread can optionally convert depth to Float32
+/// meters and copy the frames to the target device, so NextFrame() returns
+/// frames that are ready to use.
+///
+/// In the default mode the thread waits when the buffer is full and every
+/// frame is delivered. With \p drop_frames, the oldest buffered frame is
+/// dropped instead, which keeps latency bounded for live processing that is
+/// slower than the stream.
+class AsyncRGBDVideoReader : public RGBDVideoReader {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 8;
+
+    /// Constructor. Prefetching starts immediately if \p reader is open.
+    ///
+    /// \param reader The reader to prefetch frames from.
+    /// \param buffer_size Max number of frames to store in the frame buffer.
+    /// \param drop_frames Drop the oldest frame instead of waiting when the
+    /// frame buffer is full.
+    /// \param convert_depth_to_float Convert depth images to Float32 meters,
+    /// using the depth scale of the metadata.
+    /// \param device Device to copy the frames to.
+    explicit AsyncRGBDVideoReader(
+            std::unique_ptr<RGBDVideoReader> reader,
+            size_t buffer_size = DEFAULT_BUFFER_SIZE,
+            bool drop_frames = false,
+            bool convert_depth_to_float = false,
+            const core::Device &device = core::Device("CPU:0"));
+
+    AsyncRGBDVideoReader(const AsyncRGBDVideoReader &) = delete;
+    AsyncRGBDVideoReader &operator=(const AsyncRGBDVideoReader &) = delete;
+    virtual ~AsyncRGBDVideoReader();
+
+    /// Check If the wrapped reader is opened.
+    virtual bool IsOpened() const override { return reader_->IsOpened(); }
+
+    /// Check if all frames have been read and returned.
+    virtual bool IsEOF() const override;
+
+    /// Open an RGBD video playback with the wrapped reader and start
+    /// prefetching.
+    ///
+    /// \param filename Path to the RGBD video file.
+    virtual bool Open(const std::string &filename) override;
+
+    /// Stop prefetching and close the wrapped reader.
+    virtual void Close() override;
+
+    /// Get (read-only) metadata of the playback.
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return reader_->GetMetadata();
+    }
+
+    /// Get reference to the metadata of the RGBD video playback.
+    virtual RGBDVideoMetadata &GetMetadata() override {
+        return reader_->GetMetadata();
+    }
+
+    /// Discard the prefetched frames and seek to the timestamp (in us).
+    ///
+    /// \param timestamp Time in us to seek to.
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Get timestamp (in us) of the frame last returned by NextFrame().
+    virtual uint64_t GetTimestamp() const override;
+
+    /// Return the next prefetched frame, waiting for it if necessary.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    /// Return filename being read.
+    virtual std::string GetFilename() const override {
+        return reader_->GetFilename();
+    }
+
+    /// Number of frames dropped because the frame buffer was full.
+    size_t GetNumDroppedFrames() const;
+
+    /// Number of frames currently waiting in the frame buffer.
+    size_t GetQueueDepth() const;
+
+    /// Number of NextFrame() calls that had to wait for a frame.
+    size_t GetNumStalls() const;
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    struct Frame {
+        t::geometry::RGBDImage rgbd_;
+        uint64_t timestamp_ = 0;
+    };
+
+    void StartPrefetch();
+    void StopPrefetch();
+    void PrefetchFrames();
+
+    std::unique_ptr<RGBDVideoReader> reader_;
+    const bool drop_frames_;
+    const bool convert_depth_to_float_;
+    const core::Device device_;
+
+    /// Ring buffer of frames, guarded by mutex_. The oldest frame is at
+    /// head_ and there are num_frames_ frames.
+    std::vector<Frame> frame_buffer_;
+    size_t head_ = 0;
+    size_t num_frames_ = 0;
+    bool stop_ = false;
+    bool is_eof_ = false;  ///< The wrapped reader has no more frames.
+    std::exception_ptr exception_;
+    size_t num_dropped_frames_ = 0;
+    size_t num_stalls_ = 0;
+    uint64_t timestamp_ = 0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable frame_available_;
+    std::condition_variable space_available_;
+    std::thread prefetch_thread_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
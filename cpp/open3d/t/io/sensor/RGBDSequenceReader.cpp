@@ -0,0 +1,329 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDSequenceReader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#include "open3d/core/ParallelFor.h"
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+std::vector<std::string> ListImages(const std::string &directory) {
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectory(directory, filenames);
+    filenames.erase(
+            std::remove_if(filenames.begin(), filenames.end(),
+                           [](const std::string &filename) {
+                               std::string ext = utility::filesystem::
+                                       GetFileExtensionInLowerCase(filename);
+                               return ext != "png" && ext != "jpg" &&
+                                      ext != "jpeg";
+                           }),
+            filenames.end());
+    std::sort(filenames.begin(), filenames.end());
+    return filenames;
+}
+
+/// Returns true if no other image or tensor shares the storage of \p image.
+bool IsStorageUnshared(const t::geometry::Image &image) {
+    std::shared_ptr<core::Blob> blob = image.AsTensor().GetBlob();
+    return blob.use_count() == 2;  // Held by image and blob.
+}
+
+bool IsInDepthFolder(const std::string &path) {
+    return utility::filesystem::GetFileParentDirectory(path).find("depth") !=
+           std::string::npos;
+}
+
+}  // namespace
+
+RGBDSequenceReader::RGBDSequenceReader(double depth_scale,
+                                       double fps,
+                                       size_t batch_size)
+    : default_depth_scale_(depth_scale),
+      default_fps_(fps),
+      batch_size_(batch_size) {
+    if (depth_scale <= 0) {
+        utility::LogError("depth_scale must be positive, but got {}.",
+                          depth_scale);
+    }
+    if (fps <= 0) {
+        utility::LogError("fps must be positive, but got {}.", fps);
+    }
+}
+
+bool RGBDSequenceReader::Open(const std::string &filename) {
+    Close();
+    std::string directory;
+    bool success = false;
+    if (utility::filesystem::DirectoryExists(filename)) {
+        directory = filename;
+        const std::string associations =
+                utility::filesystem::GetRegularizedDirectoryName(filename) +
+                "associations.txt";
+        if (utility::filesystem::FileExists(associations)) {
+            success = ReadAssociations(associations);
+        } else {
+            success = ListFrames(filename);
+        }
+    } else if (utility::filesystem::FileExists(filename)) {
+        directory = utility::filesystem::GetFileParentDirectory(filename);
+        success = ReadAssociations(filename);
+    } else {
+        utility::LogWarning("RGBD sequence {} does not exist.", filename);
+    }
+    if (success && color_files_.empty()) {
+        utility::LogWarning("RGBD sequence {} has no frames.", filename);
+        success = false;
+    }
+    if (!success) {
+        Close();
+        return false;
+    }
+
+    metadata_ = RGBDVideoMetadata();
+    metadata_.intrinsics_ = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    metadata_.depth_scale_ = default_depth_scale_;
+    metadata_.fps_ = default_fps_;
+    const std::string intrinsic_file =
+            utility::filesystem::GetRegularizedDirectoryName(directory) +
+            "intrinsic.json";
+    if (utility::filesystem::FileExists(intrinsic_file) &&
+        !open3d::io::ReadIJsonConvertible(intrinsic_file, metadata_)) {
+        utility::LogWarning("Unable to read metadata from {}.",
+                            intrinsic_file);
+    }
+    if (metadata_.fps_ <= 0) {
+        metadata_.fps_ = default_fps_;
+    }
+
+    const size_t num_frames = GetNumFrames();
+    if (timestamps_.empty()) {
+        timestamps_.resize(num_frames);
+        for (size_t i = 0; i < num_frames; ++i) {
+            timestamps_[i] = static_cast<uint64_t>(
+                    std::llround(i * 1e6 / metadata_.fps_));
+        }
+    } else if (num_frames > 1 && timestamps_.back() > 0) {
+        metadata_.fps_ = (num_frames - 1) * 1e6 / timestamps_.back();
+    }
+    metadata_.stream_length_usec_ =
+            timestamps_.back() +
+            static_cast<uint64_t>(std::llround(1e6 / metadata_.fps_));
+
+    filename_ = filename;
+    is_opened_ = true;
+
+    // The first frame determines the image properties.
+    DecodeBatch(0);
+    const t::geometry::RGBDImage &frame = batch_[0];
+    metadata_.width_ = static_cast<int>(frame.color_.GetCols());
+    metadata_.height_ = static_cast<int>(frame.color_.GetRows());
+    metadata_.color_dt_ = frame.color_.GetDtype();
+    metadata_.depth_dt_ = frame.depth_.GetDtype();
+    metadata_.color_channels_ =
+            static_cast<uint8_t>(frame.color_.GetChannels());
+    return true;
+}
+
+void RGBDSequenceReader::Close() {
+    is_opened_ = false;
+    is_eof_ = false;
+    filename_.clear();
+    color_files_.clear();
+    depth_files_.clear();
+    timestamps_.clear();
+    next_frame_ = 0;
+    batch_.clear();
+    batch_begin_ = 0;
+}
+
+bool RGBDSequenceReader::ListFrames(const std::string &directory) {
+    const std::string dir =
+            utility::filesystem::GetRegularizedDirectoryName(directory);
+    std::string color_dir;
+    for (const char *name : {"color", "rgb", "image"}) {
+        if (utility::filesystem::DirectoryExists(dir + name)) {
+            color_dir = dir + name;
+            break;
+        }
+    }
+    const std::string depth_dir = dir + "depth";
+    if (color_dir.empty() || !utility::filesystem::DirectoryExists(depth_dir)) {
+        utility::LogWarning(
+                "RGBD sequence {} needs a color (or rgb, image) and a depth "
+                "subfolder.",
+                directory);
+        return false;
+    }
+    color_files_ = ListImages(color_dir);
+    depth_files_ = ListImages(depth_dir);
+    if (color_files_.size() != depth_files_.size()) {
+        const size_t num_frames =
+                std::min(color_files_.size(), depth_files_.size());
+        utility::LogWarning(
+                "RGBD sequence {} has {} color and {} depth images, reading "
+                "the first {} frames.",
+                directory, color_files_.size(), depth_files_.size(),
+                num_frames);
+        color_files_.resize(num_frames);
+        depth_files_.resize(num_frames);
+    }
+    return true;
+}
+
+bool RGBDSequenceReader::ReadAssociations(const std::string &filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        utility::LogWarning("Unable to open associations file {}.", filename);
+        return false;
+    }
+    const std::string dir = utility::filesystem::GetRegularizedDirectoryName(
+            utility::filesystem::GetFileParentDirectory(filename));
+    auto resolve = [&dir](const std::string &path) {
+        return path.empty() || path[0] == '/' ? path : dir + path;
+    };
+
+    std::vector<double> times;
+    bool frame_numbers = true;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        std::string time_0, path_0, time_1, path_1;
+        if (line.empty() || line[0] == '#' ||
+            !(stream >> time_0 >> path_0 >> time_1 >> path_1)) {
+            continue;
+        }
+        if (IsInDepthFolder(path_0) && !IsInDepthFolder(path_1)) {
+            std::swap(time_0, time_1);
+            std::swap(path_0, path_1);
+        }
+        char *end = nullptr;
+        times.push_back(std::strtod(time_0.c_str(), &end));
+        if (*end != '\0') {
+            utility::LogWarning("Invalid timestamp {} in {}.", time_0,
+                                filename);
+            return false;
+        }
+        frame_numbers &= time_0.find_first_of(".eE") == std::string::npos;
+        color_files_.push_back(resolve(path_0));
+        depth_files_.push_back(resolve(path_1));
+    }
+    if (!frame_numbers) {
+        timestamps_.resize(times.size());
+        for (size_t i = 0; i < times.size(); ++i) {
+            timestamps_[i] = static_cast<uint64_t>(
+                    std::llround(std::max(times[i] - times[0], 0.0) * 1e6));
+        }
+    }
+    return true;
+}
+
+void RGBDSequenceReader::DecodeBatch(size_t first) {
+    const size_t batch_size =
+            batch_size_ > 0 ? batch_size_ : size_t(core::GetNumThreads());
+    const size_t num_frames = std::min(batch_size, GetNumFrames() - first);
+    batch_.resize(num_frames);
+    batch_begin_ = first;
+
+    // Decode color and depth images as separate tasks. Images of the previous
+    // batch are decoded into if the caller no longer holds them.
+    std::vector<uint8_t> success(2 * num_frames);
+    core::ParallelFor(2 * num_frames, [&](int64_t i) {
+        t::geometry::RGBDImage &rgbd = batch_[i / 2];
+        t::geometry::Image &image = i % 2 == 0 ? rgbd.color_ : rgbd.depth_;
+        const size_t frame = first + i / 2;
+        success[i] = ReadImage(
+                i % 2 == 0 ? color_files_[frame] : depth_files_[frame], image,
+                IsStorageUnshared(image));
+    });
+    for (size_t i = 0; i < success.size(); ++i) {
+        if (!success[i]) {
+            const size_t frame = first + i / 2;
+            utility::LogError("Unable to read frame {} from {}.", frame,
+                              i % 2 == 0 ? color_files_[frame]
+                                         : depth_files_[frame]);
+        }
+    }
+}
+
+bool RGBDSequenceReader::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    if (timestamp >= metadata_.stream_length_usec_) {
+        utility::LogWarning("Timestamp {} exceeds maximum {} (us).", timestamp,
+                            metadata_.stream_length_usec_);
+        return false;
+    }
+    next_frame_ = std::lower_bound(timestamps_.begin(), timestamps_.end(),
+                                   timestamp) -
+                  timestamps_.begin();
+    is_eof_ = false;
+    return true;
+}
+
+uint64_t RGBDSequenceReader::GetTimestamp() const {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return UINT64_MAX;
+    }
+    return next_frame_ == 0 ? 0 : timestamps_[next_frame_ - 1];
+}
+
+t::geometry::RGBDImage RGBDSequenceReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (next_frame_ >= GetNumFrames()) {
+        is_eof_ = true;
+        utility::LogInfo("EOF reached");
+        return t::geometry::RGBDImage();
+    }
+    if (next_frame_ < batch_begin_ ||
+        next_frame_ >= batch_begin_ + batch_.size()) {
+        DecodeBatch(next_frame_);
+    }
+    return batch_[next_frame_++ - batch_begin_];
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
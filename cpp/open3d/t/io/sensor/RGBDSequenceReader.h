@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDSequenceReader
+///
+/// Reader for RGBD datasets stored as sequences of PNG/JPG images.
+///
+/// Open() accepts either a directory or an associations file:
+///  - A directory with an `associations.txt` file is read with that file.
+///  - Otherwise the directory must have a color subfolder named `color`,
+///    `rgb` or `image`, and a `depth` subfolder. Their images are sorted by
+///    name and paired in order, and frame i gets timestamp i / fps. This is
+///    the layout of Redwood datasets and of RGBDVideoReader::SaveFrames().
+///  - An associations file has one frame per line, with four columns
+///    `timestamp color_path timestamp depth_path` as written by the TUM
+///    associate.py script. Paths are relative to the file. The order of the
+///    color and depth columns is swapped if the first path is in a depth
+///    folder, as in ICL-NUIM files. Timestamps are in seconds, except that
+///    integer timestamps are treated as frame numbers at fps.
+/// If the dataset directory has an `intrinsic.json` file with
+/// RGBDVideoMetadata, e.g. written by SaveFrames(), it is used as metadata.
+///
+/// Frames are decoded in batches, with the color and depth images of a batch
+/// decoded in parallel. NextFrame() returns frames in order from the current
+/// batch and decodes the next batch when it is used up. The next batch is
+/// decoded into the image buffers of the previous one, unless the caller
+/// still holds the returned frames.
+class RGBDSequenceReader : public RGBDVideoReader {
+public:
+    /// Constructor
+    ///
+    /// \param depth_scale Number of depth units per meter, used if the
+    /// dataset has no intrinsic.json. 1000 for Redwood, 5000 for TUM and
+    /// ICL-NUIM.
+    /// \param fps Frame rate, used if the dataset has no timestamps.
+    /// \param batch_size Number of frames decoded together. 0 uses the number
+    /// of threads.
+    explicit RGBDSequenceReader(double depth_scale = 1000.0,
+                                double fps = 30.0,
+                                size_t batch_size = 0);
+
+    virtual ~RGBDSequenceReader() {}
+
+    /// Check If the dataset is opened.
+    virtual bool IsOpened() const override { return is_opened_; }
+
+    /// Check if NextFrame() has been called after the last frame.
+    virtual bool IsEOF() const override { return is_eof_; }
+
+    /// Open an image sequence dataset.
+    ///
+    /// \param filename Path to the dataset directory or associations file.
+    virtual bool Open(const std::string &filename) override;
+
+    /// Close the opened dataset.
+    virtual void Close() override;
+
+    /// Get (read-only) metadata of the dataset.
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+
+    /// Get reference to the metadata of the dataset.
+    virtual RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+
+    /// Seek to the first frame at or after the timestamp (in us).
+    ///
+    /// \param timestamp Time in us to seek to.
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Get timestamp (in us) of the frame last returned by NextFrame().
+    virtual uint64_t GetTimestamp() const override;
+
+    /// Return the next frame, or an empty RGBDImage after the last frame.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    /// Return the path of the dataset being read.
+    virtual std::string GetFilename() const override { return filename_; };
+
+    /// Number of frames in the dataset.
+    size_t GetNumFrames() const { return color_files_.size(); }
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    bool ListFrames(const std::string &directory);
+    bool ReadAssociations(const std::string &filename);
+    /// Decode the batch of frames starting at frame \p first.
+    void DecodeBatch(size_t first);
+
+    const double default_depth_scale_;
+    const double default_fps_;
+    size_t batch_size_;
+
+    std::string filename_;
+    RGBDVideoMetadata metadata_;
+    bool is_opened_ = false;
+    bool is_eof_ = false;
+
+    std::vector<std::string> color_files_;
+    std::vector<std::string> depth_files_;
+    std::vector<uint64_t> timestamps_;  ///< Frame timestamps in us.
+    size_t next_frame_ = 0;             ///< Index of the next frame.
+
+    std::vector<t::geometry::RGBDImage> batch_;
+    size_t batch_begin_ = 0;  ///< Frame index of batch_[0].
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
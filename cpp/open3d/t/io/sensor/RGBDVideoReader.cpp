@@ -28,8 +28,10 @@
 
 #include <string>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/io/IJsonConvertibleIO.h"
 #include "open3d/io/ImageIO.h"
+#include "open3d/t/io/sensor/RGBDSequenceReader.h"
 #include "open3d/t/io/sensor/realsense/RSBagReader.h"
 #include "open3d/utility/FileSystem.h"
 
@@ -70,25 +72,24 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
     int idx = 0;
     open3d::geometry::Image im_color, im_depth;
     for (auto tim_rgbd = NextFrame(); !IsEOF() && GetTimestamp() < end_time;
-         ++idx, tim_rgbd = NextFrame())
-#pragma omp parallel sections
-    {
-#pragma omp section
-        {
-            im_color = tim_rgbd.color_.ToLegacyImage();
-            auto color_file =
-                    fmt::format("{0}/color/{1:05d}.jpg", frame_path, idx);
-            open3d::io::WriteImage(color_file, im_color);
-            utility::LogDebug("Written color image to {}", color_file);
-        }
-#pragma omp section
-        {
-            im_depth = tim_rgbd.depth_.ToLegacyImage();
-            auto depth_file =
-                    fmt::format("{0}/depth/{1:05d}.png", frame_path, idx);
-            open3d::io::WriteImage(depth_file, im_depth);
-            utility::LogDebug("Written depth image to {}", depth_file);
-        }
+         ++idx, tim_rgbd = NextFrame()) {
+        core::ParallelInvoke(
+                {[&]() {
+                     im_color = tim_rgbd.color_.ToLegacyImage();
+                     auto color_file = fmt::format("{0}/color/{1:05d}.jpg",
+                                                   frame_path, idx);
+                     open3d::io::WriteImage(color_file, im_color);
+                     utility::LogDebug("Written color image to {}",
+                                       color_file);
+                 },
+                 [&]() {
+                     im_depth = tim_rgbd.depth_.ToLegacyImage();
+                     auto depth_file = fmt::format("{0}/depth/{1:05d}.png",
+                                                   frame_path, idx);
+                     open3d::io::WriteImage(depth_file, im_depth);
+                     utility::LogDebug("Written depth image to {}",
+                                       depth_file);
+                 }});
     }
     utility::LogInfo("Written {} depth and color images to {}/{{depth,color}}/",
                      idx, frame_path);
@@ -96,6 +97,12 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
 
 std::unique_ptr<RGBDVideoReader> RGBDVideoReader::Create(
         const std::string &filename) {
+    if (utility::filesystem::DirectoryExists(filename) ||
+        utility::filesystem::GetFileExtensionInLowerCase(filename) == "txt") {
+        auto reader = std::make_unique<RGBDSequenceReader>();
+        reader->Open(filename);
+        return reader;
+    }
 #ifdef BUILD_LIBREALSENSE
     if (utility::ToLower(filename).compare(filename.length() - 4, 4, ".bag") ==
         0) {
@@ -89,6 +89,9 @@ public:
     virtual std::string ToString() const;
 
     /// Factory function to create object based on RGBD video file type.
+    ///
+    /// Directories and associations (.txt) files are read with
+    /// RGBDSequenceReader, and RealSense .bag files with RSBagReader.
     static std::unique_ptr<RGBDVideoReader> Create(const std::string &filename);
 };
 
@@ -24,13 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <tbb/parallel_for.h>
-#include <tbb/parallel_reduce.h>
-
 #include <cmath>
 #include <functional>
 #include <vector>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/t/pipelines/kernel/ComputeTransformImpl.h"
@@ -57,53 +55,32 @@ void ComputePosePointToPlaneCPU(const float *source_points_ptr,
     // support), [28] is for inlier count.
     std::vector<float> A_1x29(29, 0.0);
 
-#ifdef _WIN32
-    std::vector<float> zeros_29(29, 0.0);
-    A_1x29 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_29,
-            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
-                for (int workload_idx = r.begin(); workload_idx < r.end();
-                     workload_idx++) {
-#else
-    float *A_reduction = A_1x29.data();
-#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static)
-    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
-#endif
-                    float J[6] = {0};
-                    float r = 0;
-
-                    bool valid = GetJacobianPointToPlane(
-                            workload_idx, source_points_ptr, target_points_ptr,
-                            target_normals_ptr, correspondences_first,
-                            correspondences_second, J, r);
-
-                    if (valid) {
-                        for (int i = 0, j = 0; j < 6; j++) {
-                            for (int k = 0; k <= j; k++) {
-                                // ATA_ {1,21}, as ATA {6,6} is a symmetric
-                                // matrix.
-                                A_reduction[i] += J[j] * J[k];
-                                i++;
-                            }
-                            // ATB {6,1}.
-                            A_reduction[21 + j] += J[j] * r;
+    core::ParallelReduceSum(
+            n, 29,
+            [&](int64_t workload_idx, float *A_reduction) {
+                float J[6] = {0};
+                float r = 0;
+
+                bool valid = GetJacobianPointToPlane(
+                        workload_idx, source_points_ptr, target_points_ptr,
+                        target_normals_ptr, correspondences_first,
+                        correspondences_second, J, r);
+
+                if (valid) {
+                    for (int i = 0, j = 0; j < 6; j++) {
+                        for (int k = 0; k <= j; k++) {
+                            // ATA_ {1,21}, as ATA {6,6} is a symmetric matrix.
+                            A_reduction[i] += J[j] * J[k];
+                            i++;
                         }
-                        A_reduction[27] = r * r;
-                        A_reduction[28] += 1;
+                        // ATB {6,1}.
+                        A_reduction[21 + j] += J[j] * r;
                     }
+                    A_reduction[27] = r * r;
+                    A_reduction[28] += 1;
                 }
-#ifdef _WIN32
-                return A_reduction;
             },
-            // TBB: Defining reduction operation.
-            [&](std::vector<float> a, std::vector<float> b) {
-                std::vector<float> result(29);
-                for (int j = 0; j < 29; j++) {
-                    result[j] = a[j] + b[j];
-                }
-                return result;
-            });
-#endif
+            A_1x29.data());
 
     core::Tensor A_reduction_tensor(A_1x29, {1, 29}, core::Dtype::Float32,
                                     device);
@@ -128,37 +105,17 @@ void ComputeRtPointToPointCPU(const float *source_points_ptr,
     // target points respectively.
     std::vector<float> mean_1x6(6, 0.0);
 
-#ifdef _WIN32
-    std::vector<float> zeros_6(6, 0.0);
-    mean_1x6 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_6,
-            [&](tbb::blocked_range<int> r, std::vector<float> mean_reduction) {
-                for (int workload_idx = r.begin(); workload_idx < r.end();
-                     workload_idx++) {
-#else
-    float *mean_reduction = mean_1x6.data();
-#pragma omp parallel for reduction(+ : mean_reduction[:6]) schedule(static)
-    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
-#endif
-                    for (int i = 0; i < 3; i++) {
-                        mean_reduction[i] += source_points_ptr
-                                [3 * correspondences_first[workload_idx] + i];
-                        mean_reduction[i + 3] += target_points_ptr
-                                [3 * correspondences_second[workload_idx] + i];
-                    }
+    core::ParallelReduceSum(
+            n, 6,
+            [&](int64_t workload_idx, float *mean_reduction) {
+                for (int i = 0; i < 3; i++) {
+                    mean_reduction[i] += source_points_ptr
+                            [3 * correspondences_first[workload_idx] + i];
+                    mean_reduction[i + 3] += target_points_ptr
+                            [3 * correspondences_second[workload_idx] + i];
                 }
-#ifdef _WIN32
-                return mean_reduction;
             },
-            // TBB: Defining reduction operation.
-            [&](std::vector<float> a, std::vector<float> b) {
-                std::vector<float> result(6);
-                for (int j = 0; j < 6; j++) {
-                    result[j] = a[j] + b[j];
-                }
-                return result;
-            });
-#endif
+            mean_1x6.data());
 
     float num_correspondences = static_cast<float>(n);
     for (int i = 0; i < 6; i++) {
@@ -168,44 +125,23 @@ void ComputeRtPointToPointCPU(const float *source_points_ptr,
     // Calculating the Sxy for SVD.
     std::vector<float> sxy_1x9(9, 0.0);
 
-#ifdef _WIN32
-    std::vector<float> zeros_9(9, 0.0);
-    sxy_1x9 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_9,
-            [&](tbb::blocked_range<int> r,
-                std::vector<float> sxy_1x9_reduction) {
-                for (int workload_idx = r.begin(); workload_idx < r.end();
-                     workload_idx++) {
-#else
-    float *sxy_1x9_reduction = sxy_1x9.data();
-#pragma omp parallel for reduction(+ : sxy_1x9_reduction[:9]) schedule(static) collapse(2)
-    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
-#endif
-                    for (int i = 0; i < 9; i++) {
-                        const int row = i % 3;
-                        const int col = i / 3;
-                        const int source_idx =
-                                3 * correspondences_first[workload_idx] + row;
-                        const int target_idx =
-                                3 * correspondences_second[workload_idx] + col;
-                        sxy_1x9_reduction[i] += (source_points_ptr[source_idx] -
-                                                 mean_1x6[row]) *
-                                                (target_points_ptr[target_idx] -
-                                                 mean_1x6[3 + col]);
-                    }
+    core::ParallelReduceSum(
+            n, 9,
+            [&](int64_t workload_idx, float *sxy_1x9_reduction) {
+                for (int i = 0; i < 9; i++) {
+                    const int row = i % 3;
+                    const int col = i / 3;
+                    const int source_idx =
+                            3 * correspondences_first[workload_idx] + row;
+                    const int target_idx =
+                            3 * correspondences_second[workload_idx] + col;
+                    sxy_1x9_reduction[i] += (source_points_ptr[source_idx] -
+                                             mean_1x6[row]) *
+                                            (target_points_ptr[target_idx] -
+                                             mean_1x6[3 + col]);
                 }
-#ifdef _WIN32
-                return sxy_1x9_reduction;
             },
-            // TBB: Defining reduction operation.
-            [&](std::vector<float> a, std::vector<float> b) {
-                std::vector<float> result(9);
-                for (int j = 0; j < 9; j++) {
-                    result[j] = a[j] + b[j];
-                }
-                return result;
-            });
-#endif
+            sxy_1x9.data());
 
     // Compute linear system on CPU as Float64.
     core::Device host("CPU:0");
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <mutex>
+
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
 
@@ -114,8 +116,9 @@ void FillInRigidAlignmentTermCPU
         }
         atomicAdd(residual_ptr, r * r);
 #else
-#pragma omp critical
         {
+            static std::mutex mutex;
+            std::lock_guard<std::mutex> lock(mutex);
             for (int i_local = 0; i_local < 12; ++i_local) {
                 for (int j_local = 0; j_local < 12; ++j_local) {
                     AtA_local_ptr[i_local * 12 + j_local]
@@ -289,8 +292,9 @@ void FillInSLACAlignmentTermCPU
         }
         atomicAdd(residual_ptr, r * r);
 #else
-#pragma omp critical
         {
+            static std::mutex mutex;
+            std::lock_guard<std::mutex> lock(mutex);
             for (int ki = 0; ki < 60; ++ki) {
                 for (int kj = 0; kj < 60; ++kj) {
                     AtA_ptr[idx[ki] * n_vars + idx[kj]]
@@ -580,8 +584,9 @@ void FillInSLACRegularizerTermCPU
                               -weight * local_r[axis]);
                 }
 #else
-#pragma omp critical
                 {
+                    static std::mutex mutex;
+                    std::lock_guard<std::mutex> lock(mutex);
                     // Update residual
                     *residual_ptr += weight * (local_r[0] * local_r[0] +
                                                local_r[1] * local_r[1] +
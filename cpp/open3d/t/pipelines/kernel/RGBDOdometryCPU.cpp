@@ -24,9 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <tbb/parallel_for.h>
-#include <tbb/parallel_reduce.h>
-
+#include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
@@ -69,55 +67,35 @@ void ComputeOdometryResultPointToPlaneCPU(
 
     std::vector<float> A_1x29(29, 0.0);
 
-#ifdef _MSC_VER
-    std::vector<float> zeros_29(29, 0.0);
-    A_1x29 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_29,
-            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
-                for (int workload_idx = r.begin(); workload_idx < r.end();
-                     workload_idx++) {
-#else
-    float* A_reduction = A_1x29.data();
-#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static)
-    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
-#endif
-                    int y = workload_idx / cols;
-                    int x = workload_idx % cols;
-
-                    float J_ij[6];
-                    float r;
-
-                    bool valid = GetJacobianPointToPlane(
-                            x, y, depth_outlier_trunc, source_vertex_indexer,
-                            target_vertex_indexer, target_normal_indexer, ti,
-                            J_ij, r);
-
-                    if (valid) {
-                        float d_huber = HuberDeriv(r, depth_huber_delta);
-                        float r_huber = HuberLoss(r, depth_huber_delta);
-                        for (int i = 0, j = 0; j < 6; j++) {
-                            for (int k = 0; k <= j; k++) {
-                                A_reduction[i] += J_ij[j] * J_ij[k];
-                                i++;
-                            }
-                            A_reduction[21 + j] += J_ij[j] * d_huber;
+    core::ParallelReduceSum(
+            n, 29,
+            [&](int64_t workload_idx, float* A_reduction) {
+                int y = workload_idx / cols;
+                int x = workload_idx % cols;
+
+                float J_ij[6];
+                float r;
+
+                bool valid = GetJacobianPointToPlane(
+                        x, y, depth_outlier_trunc, source_vertex_indexer,
+                        target_vertex_indexer, target_normal_indexer, ti, J_ij,
+                        r);
+
+                if (valid) {
+                    float d_huber = HuberDeriv(r, depth_huber_delta);
+                    float r_huber = HuberLoss(r, depth_huber_delta);
+                    for (int i = 0, j = 0; j < 6; j++) {
+                        for (int k = 0; k <= j; k++) {
+                            A_reduction[i] += J_ij[j] * J_ij[k];
+                            i++;
                         }
-                        A_reduction[27] += r_huber;
-                        A_reduction[28] += 1;
+                        A_reduction[21 + j] += J_ij[j] * d_huber;
                     }
+                    A_reduction[27] += r_huber;
+                    A_reduction[28] += 1;
                 }
-#ifdef _MSC_VER
-                return A_reduction;
             },
-            // TBB: Defining reduction operation.
-            [&](std::vector<float> a, std::vector<float> b) {
-                std::vector<float> result(29);
-                for (int j = 0; j < 29; j++) {
-                    result[j] = a[j] + b[j];
-                }
-                return result;
-            });
-#endif
+            A_1x29.data());
     core::Tensor A_reduction_tensor(A_1x29, {1, 29}, core::Dtype::Float32,
                                     device);
     DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
@@ -162,59 +140,38 @@ void ComputeOdometryResultIntensityCPU(
 
     std::vector<float> A_1x29(29, 0.0);
 
-#ifdef _MSC_VER
-    std::vector<float> zeros_29(29, 0.0);
-    A_1x29 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_29,
-            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
-                for (int workload_idx = r.begin(); workload_idx < r.end();
-                     workload_idx++) {
-#else
-    float* A_reduction = A_1x29.data();
-#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static)
-    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
-#endif
-                    int y = workload_idx / cols;
-                    int x = workload_idx % cols;
-
-                    float J_I[6];
-                    float r_I;
-
-                    bool valid = GetJacobianIntensity(
-                            x, y, depth_outlier_trunc, source_depth_indexer,
-                            target_depth_indexer, source_intensity_indexer,
-                            target_intensity_indexer,
-                            target_intensity_dx_indexer,
-                            target_intensity_dy_indexer, source_vertex_indexer,
-                            ti, J_I, r_I);
-
-                    if (valid) {
-                        float d_huber = HuberDeriv(r_I, intensity_huber_delta);
-                        float r_huber = HuberLoss(r_I, intensity_huber_delta);
-
-                        for (int i = 0, j = 0; j < 6; j++) {
-                            for (int k = 0; k <= j; k++) {
-                                A_reduction[i] += J_I[j] * J_I[k];
-                                i++;
-                            }
-                            A_reduction[21 + j] += J_I[j] * d_huber;
+    core::ParallelReduceSum(
+            n, 29,
+            [&](int64_t workload_idx, float* A_reduction) {
+                int y = workload_idx / cols;
+                int x = workload_idx % cols;
+
+                float J_I[6];
+                float r_I;
+
+                bool valid = GetJacobianIntensity(
+                        x, y, depth_outlier_trunc, source_depth_indexer,
+                        target_depth_indexer, source_intensity_indexer,
+                        target_intensity_indexer, target_intensity_dx_indexer,
+                        target_intensity_dy_indexer, source_vertex_indexer, ti,
+                        J_I, r_I);
+
+                if (valid) {
+                    float d_huber = HuberDeriv(r_I, intensity_huber_delta);
+                    float r_huber = HuberLoss(r_I, intensity_huber_delta);
+
+                    for (int i = 0, j = 0; j < 6; j++) {
+                        for (int k = 0; k <= j; k++) {
+                            A_reduction[i] += J_I[j] * J_I[k];
+                            i++;
                         }
-                        A_reduction[27] += r_huber;
-                        A_reduction[28] += 1;
+                        A_reduction[21 + j] += J_I[j] * d_huber;
                     }
+                    A_reduction[27] += r_huber;
+                    A_reduction[28] += 1;
                 }
-#ifdef _MSC_VER
-                return A_reduction;
             },
-            // TBB: Defining reduction operation.
-            [&](std::vector<float> a, std::vector<float> b) {
-                std::vector<float> result(29);
-                for (int j = 0; j < 29; j++) {
-                    result[j] = a[j] + b[j];
-                }
-                return result;
-            });
-#endif
+            A_1x29.data());
     core::Tensor A_reduction_tensor(A_1x29, {1, 29}, core::Dtype::Float32,
                                     device);
     DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
@@ -263,66 +220,43 @@ void ComputeOdometryResultHybridCPU(const core::Tensor& source_depth,
 
     std::vector<float> A_1x29(29, 0.0);
 
-#ifdef _MSC_VER
-    std::vector<float> zeros_29(29, 0.0);
-    A_1x29 = tbb::parallel_reduce(
-            tbb::blocked_range<int>(0, n), zeros_29,
-            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
-                for (int workload_idx = r.begin(); workload_idx < r.end();
-                     workload_idx++) {
-#else
-    float* A_reduction = A_1x29.data();
-#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static)
-    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
-#endif
-                    int y = workload_idx / cols;
-                    int x = workload_idx % cols;
-
-                    float J_I[6], J_D[6];
-                    float r_I, r_D;
-
-                    bool valid = GetJacobianHybrid(
-                            x, y, depth_outlier_trunc, source_depth_indexer,
-                            target_depth_indexer, source_intensity_indexer,
-                            target_intensity_indexer, target_depth_dx_indexer,
-                            target_depth_dy_indexer,
-                            target_intensity_dx_indexer,
-                            target_intensity_dy_indexer, source_vertex_indexer,
-                            ti, J_I, J_D, r_I, r_D);
-
-                    if (valid) {
-                        float d_huber_I =
-                                HuberDeriv(r_I, intensity_huber_delta);
-                        float d_huber_D = HuberDeriv(r_D, depth_huber_delta);
-
-                        float r_huber_I = HuberLoss(r_I, intensity_huber_delta);
-                        float r_huber_D = HuberLoss(r_D, depth_huber_delta);
-
-                        for (int i = 0, j = 0; j < 6; j++) {
-                            for (int k = 0; k <= j; k++) {
-                                A_reduction[i] +=
-                                        J_I[j] * J_I[k] + J_D[j] * J_D[k];
-                                i++;
-                            }
-                            A_reduction[21 + j] +=
-                                    J_I[j] * d_huber_I + J_D[j] * d_huber_D;
+    core::ParallelReduceSum(
+            n, 29,
+            [&](int64_t workload_idx, float* A_reduction) {
+                int y = workload_idx / cols;
+                int x = workload_idx % cols;
+
+                float J_I[6], J_D[6];
+                float r_I, r_D;
+
+                bool valid = GetJacobianHybrid(
+                        x, y, depth_outlier_trunc, source_depth_indexer,
+                        target_depth_indexer, source_intensity_indexer,
+                        target_intensity_indexer, target_depth_dx_indexer,
+                        target_depth_dy_indexer, target_intensity_dx_indexer,
+                        target_intensity_dy_indexer, source_vertex_indexer, ti,
+                        J_I, J_D, r_I, r_D);
+
+                if (valid) {
+                    float d_huber_I = HuberDeriv(r_I, intensity_huber_delta);
+                    float d_huber_D = HuberDeriv(r_D, depth_huber_delta);
+
+                    float r_huber_I = HuberLoss(r_I, intensity_huber_delta);
+                    float r_huber_D = HuberLoss(r_D, depth_huber_delta);
+
+                    for (int i = 0, j = 0; j < 6; j++) {
+                        for (int k = 0; k <= j; k++) {
+                            A_reduction[i] += J_I[j] * J_I[k] + J_D[j] * J_D[k];
+                            i++;
                         }
-                        A_reduction[27] += r_huber_I + r_huber_D;
-                        A_reduction[28] += 1;
+                        A_reduction[21 + j] +=
+                                J_I[j] * d_huber_I + J_D[j] * d_huber_D;
                     }
+                    A_reduction[27] += r_huber_I + r_huber_D;
+                    A_reduction[28] += 1;
                 }
-#ifdef _MSC_VER
-                return A_reduction;
             },
-            // TBB: Defining reduction operation.
-            [&](std::vector<float> a, std::vector<float> b) {
-                std::vector<float> result(29);
-                for (int j = 0; j < 29; j++) {
-                    result[j] = a[j] + b[j];
-                }
-                return result;
-            });
-#endif
+            A_1x29.data());
     core::Tensor A_reduction_tensor(A_1x29, {1, 29}, core::Dtype::Float32,
                                     device);
     DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
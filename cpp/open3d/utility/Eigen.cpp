@@ -28,7 +28,9 @@
 
 #include <Eigen/Geometry>
 #include <Eigen/Sparse>
+#include <mutex>
 
+#include "open3d/core/ParallelFor.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -171,8 +173,8 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
     double r2_sum = 0.0;
     JTJ.setZero();
     JTr.setZero();
-#pragma omp parallel
-    {
+    std::mutex sum_mutex;
+    core::ParallelForRange(iteration_num, [&](int64_t begin, int64_t end) {
         MatType JTJ_private;
         VecType JTr_private;
         double r2_sum_private = 0.0;
@@ -182,20 +184,17 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         J_r.setZero();
         double r = 0.0;
         double w = 0.0;
-#pragma omp for nowait
-        for (int i = 0; i < iteration_num; i++) {
+        for (int i = int(begin); i < int(end); i++) {
             f(i, J_r, r, w);
             JTJ_private.noalias() += J_r * w * J_r.transpose();
             JTr_private.noalias() += J_r * w * r;
             r2_sum_private += r * r;
         }
-#pragma omp critical
-        {
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-        }
-    }
+        std::lock_guard<std::mutex> lock(sum_mutex);
+        JTJ += JTJ_private;
+        JTr += JTr_private;
+        r2_sum += r2_sum_private;
+    });
     if (verbose) {
         LogDebug("Residual : {:.2e} (# of elements : {:d})",
                  r2_sum / (double)iteration_num, iteration_num);
@@ -217,8 +216,8 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
     double r2_sum = 0.0;
     JTJ.setZero();
     JTr.setZero();
-#pragma omp parallel
-    {
+    std::mutex sum_mutex;
+    core::ParallelForRange(iteration_num, [&](int64_t begin, int64_t end) {
         MatType JTJ_private;
         VecType JTr_private;
         double r2_sum_private = 0.0;
@@ -227,8 +226,7 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         std::vector<double> r;
         std::vector<double> w;
         std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
-#pragma omp for nowait
-        for (int i = 0; i < iteration_num; i++) {
+        for (int i = int(begin); i < int(end); i++) {
             f(i, J_r, r, w);
             for (int j = 0; j < (int)r.size(); j++) {
                 JTJ_private.noalias() += J_r[j] * w[j] * J_r[j].transpose();
@@ -236,13 +234,11 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
                 r2_sum_private += r[j] * r[j];
             }
         }
-#pragma omp critical
-        {
-            JTJ += JTJ_private;
-            JTr += JTr_private;
-            r2_sum += r2_sum_private;
-        }
-    }
+        std::lock_guard<std::mutex> lock(sum_mutex);
+        JTJ += JTJ_private;
+        JTr += JTr_private;
+        r2_sum += r2_sum_private;
+    });
     if (verbose) {
         LogDebug("Residual : {:.2e} (# of elements : {:d})",
                  r2_sum / (double)iteration_num, iteration_num);
@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -240,6 +241,16 @@ bool RemoveFile(const std::string &filename) {
     return (std::remove(filename.c_str()) == 0);
 }
 
+bool ReplaceFile(const std::string &source, const std::string &target) {
+#ifdef WINDOWS
+    // rename fails on Windows if the target exists.
+    return MoveFileExA(source.c_str(), target.c_str(),
+                       MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return (std::rename(source.c_str(), target.c_str()) == 0);
+#endif
+}
+
 bool ListDirectory(const std::string &directory,
                    std::vector<std::string> &subdirs,
                    std::vector<std::string> &filenames) {
@@ -434,6 +445,58 @@ bool FReadToBuffer(const std::string &path,
     return true;
 }
 
+std::shared_ptr<uint8_t> FMapToBuffer(const std::string &path,
+                                      size_t &size,
+                                      bool writable,
+                                      std::string *errorStr) {
+    if (errorStr) {
+        errorStr->clear();
+    }
+#ifdef WINDOWS
+    std::vector<char> bytes;
+    if (!FReadToBuffer(path, bytes, errorStr)) {
+        return nullptr;
+    }
+    size = bytes.size();
+    std::shared_ptr<uint8_t> data(new uint8_t[std::max<size_t>(size, 1)],
+                                  std::default_delete<uint8_t[]>());
+    std::copy(bytes.begin(), bytes.end(), data.get());
+    return data;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        if (errorStr) {
+            *errorStr = GetIOErrorString(errno);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+        return nullptr;
+    }
+    size = static_cast<size_t>(st.st_size);
+    if (size == 0) {
+        // mmap does not accept empty ranges.
+        close(fd);
+        return std::shared_ptr<uint8_t>(new uint8_t[1],
+                                        std::default_delete<uint8_t[]>());
+    }
+    const int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *addr = mmap(nullptr, size, prot, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        if (errorStr) {
+            *errorStr = GetIOErrorString(errno);
+        }
+        return nullptr;
+    }
+    const size_t mapped_size = size;
+    return std::shared_ptr<uint8_t>(
+            static_cast<uint8_t *>(addr),
+            [mapped_size](uint8_t *ptr) { munmap(ptr, mapped_size); });
+#endif
+}
+
 CFile::~CFile() { Close(); }
 
 bool CFile::Open(const std::string &filename, const std::string &mode) {
@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -62,6 +64,11 @@ bool FileExists(const std::string &filename);
 
 bool RemoveFile(const std::string &filename);
 
+/// Renames \p source to \p target, replacing \p target if it exists. Where
+/// the platform allows it, readers that still have the old \p target open or
+/// mapped keep seeing its previous contents.
+bool ReplaceFile(const std::string &source, const std::string &target);
+
 bool ListDirectory(const std::string &directory,
                    std::vector<std::string> &subdirs,
                    std::vector<std::string> &filenames);
@@ -84,6 +91,16 @@ bool FReadToBuffer(const std::string &path,
                    std::vector<char> &bytes,
                    std::string *errorStr);
 
+/// Maps the file at \p path into memory. Returns a pointer to the contents and
+/// sets \p size, or returns nullptr on failure. The file stays mapped while a
+/// copy of the pointer exists. A \p writable mapping is private: changes are
+/// never written back to the file. Where mmap is not available the file is
+/// read into memory instead.
+std::shared_ptr<uint8_t> FMapToBuffer(const std::string &path,
+                                      size_t &size,
+                                      bool writable,
+                                      std::string *errorStr);
+
 /// RAII Wrapper for C FILE*
 /// Throws exceptions in situations where the caller is not usually going to
 /// have proper handling code:
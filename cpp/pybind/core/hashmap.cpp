@@ -107,6 +107,14 @@ void pybind_core_hashmap(py::module& m) {
     hashmap.def("clone", &Hashmap::Clone);
     hashmap.def("cpu", &Hashmap::CPU);
     hashmap.def("cuda", &Hashmap::CUDA, "device_id"_a = 0);
+
+    hashmap.def("save", &Hashmap::Save, "file_name"_a);
+    hashmap.def_static(
+            "load",
+            [](const std::string& file_name, const Device& device) {
+                return Hashmap::Load(file_name, device);
+            },
+            "file_name"_a, "device"_a = Device("CPU:0"));
 }
 }  // namespace core
 }  // namespace open3d
@@ -26,6 +26,9 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include "open3d/geometry/NeighborhoodCache.h"
+#include "open3d/geometry/PointCloud.h"
+
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
 #include "pybind/geometry/geometry_trampoline.h"
@@ -277,6 +280,53 @@ void pybind_kdtreeflann(py::module &m) {
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "set_matrix_data",
                                     map_kd_tree_flann_method_docs);
+
+    // open3d.geometry.NeighborhoodCache
+    py::class_<NeighborhoodCache, std::shared_ptr<NeighborhoodCache>>
+            neighborhood_cache(m, "NeighborhoodCache",
+                               "Neighborhoods of all points of a point cloud, "
+                               "searched once and reused by estimate_normals, "
+                               "remove_radius_outlier and "
+                               "compute_fpfh_feature.");
+    neighborhood_cache.def(py::init<>())
+            .def(py::init<const PointCloud &, const KDTreeSearchParam &>(),
+                 "pointcloud"_a, "search_param"_a)
+            .def("__repr__",
+                 [](const NeighborhoodCache &cache) {
+                     return std::string("NeighborhoodCache with ") +
+                            std::to_string(cache.GetNumPoints()) +
+                            " points and " +
+                            std::to_string(cache.indices_.size()) +
+                            " neighbors.";
+                 })
+            .def("compute", &NeighborhoodCache::Compute,
+                 "Searches the neighborhoods of all points of the point "
+                 "cloud.",
+                 "pointcloud"_a, "search_param"_a)
+            .def("get_neighbors",
+                 [](const NeighborhoodCache &cache, int64_t i) {
+                     if (i < 0 || i >= cache.GetNumPoints()) {
+                         throw py::index_error("Point index out of range.");
+                     }
+                     const int num_neighbors = cache.GetNumNeighbors(i);
+                     return std::make_tuple(
+                             std::vector<int>(cache.GetNeighbors(i),
+                                              cache.GetNeighbors(i) +
+                                                      num_neighbors),
+                             std::vector<double>(cache.GetDistances2(i),
+                                                 cache.GetDistances2(i) +
+                                                         num_neighbors));
+                 },
+                 "Returns the neighbor indices and squared distances of a "
+                 "point.",
+                 "index"_a)
+            .def("__len__", &NeighborhoodCache::GetNumPoints);
+    docstring::ClassMethodDocInject(
+            m, "NeighborhoodCache", "compute",
+            {{"pointcloud", "Point cloud whose neighborhoods are searched."},
+             {"search_param", "The KDTree search parameters."}});
+    docstring::ClassMethodDocInject(m, "NeighborhoodCache", "get_neighbors",
+                                    {{"index", "Index of the point."}});
 }
 
 }  // namespace geometry
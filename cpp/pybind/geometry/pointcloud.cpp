@@ -30,6 +30,7 @@
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/Image.h"
+#include "open3d/geometry/NeighborhoodCache.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
@@ -47,6 +48,18 @@ void pybind_pointcloud(py::module &m) {
                        "normals.");
     py::detail::bind_default_constructor<PointCloud>(pointcloud);
     py::detail::bind_copy_functions<PointCloud>(pointcloud);
+
+    py::enum_<VoxelReduction>(m, "VoxelReduction")
+            .value("Mean", VoxelReduction::Mean,
+                   "Attributes are averaged over the points of a voxel.")
+            .value("First", VoxelReduction::First,
+                   "The point with the smallest index in a voxel is kept.")
+            .value("ClosestToCenter", VoxelReduction::ClosestToCenter,
+                   "The point closest to the voxel center is kept.")
+            .value("Median", VoxelReduction::Median,
+                   "Attributes are reduced to their per-component median.")
+            .export_values();
+
     pointcloud
             .def(py::init<const std::vector<Eigen::Vector3d> &>(),
                  "Create a PointCloud from points", "points"_a)
@@ -75,8 +88,9 @@ void pybind_pointcloud(py::module &m) {
             .def("voxel_down_sample", &PointCloud::VoxelDownSample,
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
-                 "a voxel. Normals and colors are averaged if they exist.",
-                 "voxel_size"_a)
+                 "a voxel. Points, normals and colors are reduced per voxel "
+                 "with the chosen reduction.",
+                 "voxel_size"_a, "reduction"_a = VoxelReduction::Mean)
             .def("voxel_down_sample_and_trace",
                  &PointCloud::VoxelDownSampleAndTrace,
                  "Function to downsample using "
@@ -112,21 +126,38 @@ void pybind_pointcloud(py::module &m) {
             .def("remove_non_finite_points", &PointCloud::RemoveNonFinitePoints,
                  "Function to remove non-finite points from the PointCloud",
                  "remove_nan"_a = true, "remove_infinite"_a = true)
-            .def("remove_radius_outlier", &PointCloud::RemoveRadiusOutliers,
+            .def("remove_radius_outlier",
+                 py::overload_cast<size_t, double>(
+                         &PointCloud::RemoveRadiusOutliers, py::const_),
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
                  "nb_points"_a, "radius"_a)
+            .def("remove_radius_outlier",
+                 py::overload_cast<size_t, const NeighborhoodCache &>(
+                         &PointCloud::RemoveRadiusOutliers, py::const_),
+                 "Function to remove points that have less than nb_points"
+                 " in their cached radius or hybrid neighborhood",
+                 "nb_points"_a, "neighborhoods"_a)
             .def("remove_statistical_outlier",
                  &PointCloud::RemoveStatisticalOutliers,
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
-            .def("estimate_normals", &PointCloud::EstimateNormals,
+            .def("estimate_normals",
+                 py::overload_cast<const KDTreeSearchParam &, bool>(
+                         &PointCloud::EstimateNormals),
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
                  "search_param"_a = KDTreeSearchParamKNN(),
                  "fast_normal_computation"_a = true)
+            .def("estimate_normals",
+                 py::overload_cast<const NeighborhoodCache &, bool>(
+                         &PointCloud::EstimateNormals),
+                 "Function to compute the normals of a point cloud from "
+                 "cached neighborhoods. Normals are oriented with respect to "
+                 "the input point cloud if normals exist",
+                 "neighborhoods"_a, "fast_normal_computation"_a = true)
             .def("orient_normals_to_align_with_direction",
                  &PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -177,7 +208,15 @@ void pybind_pointcloud(py::module &m) {
             .def("segment_plane", &PointCloud::SegmentPlane,
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999)
+            .def("segment_planes", &PointCloud::SegmentPlanes,
+                 "Segments up to max_planes planes in the point cloud using "
+                 "the RANSAC algorithm, each among the points that are not "
+                 "inliers of a previous plane.",
+                 "max_planes"_a, "distance_threshold"_a = 0.01,
+                 "ransac_n"_a = 3, "num_iterations"_a = 100,
+                 "probability"_a = 0.99999999)
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
@@ -230,7 +269,8 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample",
             {{"voxel_size", "Voxel size to downsample into."},
-             {"invert", "set to ``True`` to invert the selection of indices"}});
+             {"reduction",
+              "How the points of a voxel are reduced to a single point."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "voxel_down_sample_and_trace",
             {{"voxel_size", "Voxel size to downsample into."},
@@ -256,7 +296,10 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_radius_outlier",
             {{"nb_points", "Number of points within the radius."},
-             {"radius", "Radius of the sphere."}});
+             {"radius", "Radius of the sphere."},
+             {"neighborhoods",
+              "Radius or hybrid neighborhoods of the points. With hybrid "
+              "neighborhoods at most max_nn neighbors are counted."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "remove_statistical_outlier",
             {{"nb_neighbors", "Number of neighbors around the target point."},
@@ -265,6 +308,8 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
             m, "PointCloud", "estimate_normals",
             {{"search_param",
               "The KDTree search parameters for neighborhood search."},
+             {"neighborhoods",
+              "Neighborhoods of the points, which are not searched again."},
              {"fast_normal_computation",
               "If true, the normal estiamtion uses a non-iterative method to "
               "extract the eigenvector from the covariance matrix. This is "
@@ -314,7 +359,21 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"max_planes", "Maximum number of planes to segment."},
+             {"distance_threshold",
+              "Max distance a point can be from a plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"probability",
+              "Expected probability of finding the optimal plane."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
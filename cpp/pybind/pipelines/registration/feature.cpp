@@ -26,6 +26,7 @@
 
 #include "open3d/pipelines/registration/Feature.h"
 
+#include "open3d/geometry/NeighborhoodCache.h"
 #include "open3d/geometry/PointCloud.h"
 #include "pybind/docstring.h"
 #include "pybind/pipelines/registration/registration.h"
@@ -65,13 +66,24 @@ void pybind_feature(py::module &m) {
 }
 
 void pybind_feature_methods(py::module &m) {
-    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+    m.def("compute_fpfh_feature",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::KDTreeSearchParam &>(
+                  &ComputeFPFHFeature),
           "Function to compute FPFH feature for a point cloud", "input"_a,
           "search_param"_a);
+    m.def("compute_fpfh_feature",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::NeighborhoodCache &>(
+                  &ComputeFPFHFeature),
+          "Function to compute FPFH feature for a point cloud from cached "
+          "neighborhoods",
+          "input"_a, "neighborhoods"_a);
     docstring::FunctionDocInject(
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
-             {"search_param", "KDTree KNN search parameter."}});
+             {"search_param", "KDTree KNN search parameter."},
+             {"neighborhoods", "Neighborhoods of the points of input."}});
 }
 
 }  // namespace registration
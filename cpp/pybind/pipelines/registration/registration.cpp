@@ -154,6 +154,35 @@ void pybind_registration_classes(py::module &m) {
                         c.max_iteration_, c.confidence_);
             });
 
+    // open3d.registration.FeatureMatchingOption
+    py::class_<FeatureMatchingOption> matching_option(
+            m, "FeatureMatchingOption",
+            "Class that defines how features are matched to their nearest "
+            "neighbor. Approximate matching with a randomized k-d forest is "
+            "much faster for high dimensional features such as FPFH.");
+    py::detail::bind_copy_functions<FeatureMatchingOption>(matching_option);
+    matching_option
+            .def(py::init([](bool approximate, int num_trees, int max_checks) {
+                     return new FeatureMatchingOption(approximate, num_trees,
+                                                      max_checks);
+                 }),
+                 "approximate"_a = false, "num_trees"_a = 4,
+                 "max_checks"_a = 128)
+            .def_readwrite("approximate", &FeatureMatchingOption::approximate_,
+                           "bool: Use approximate nearest neighbor search.")
+            .def_readwrite("num_trees", &FeatureMatchingOption::num_trees_,
+                           "int: Number of randomized k-d trees for "
+                           "approximate search.")
+            .def_readwrite("max_checks", &FeatureMatchingOption::max_checks_,
+                           "int: Maximum number of features compared per "
+                           "query in approximate search.")
+            .def("__repr__", [](const FeatureMatchingOption &c) {
+                return fmt::format(
+                        "FeatureMatchingOption class with approximate={}, "
+                        "num_trees={:d}, and max_checks={:d}",
+                        c.approximate_, c.num_trees_, c.max_checks_);
+            });
+
     // open3d.registration.TransformationEstimation
     py::class_<TransformationEstimation,
                PyTransformationEstimation<TransformationEstimation>>
@@ -547,6 +576,9 @@ static const std::unordered_map<std::string, std::string>
                 {"kernel", "Robust Kernel used in the Optimization"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
+                {"matching_option",
+                 "Options for matching the features to their nearest "
+                 "neighbor."},
                 {"mutual_filter",
                  "Enables mutual filter such that the correspondence of the "
                  "source point's correspondence is itself."},
@@ -614,7 +646,8 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 3,
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
-          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999));
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
+          "matching_option"_a = FeatureMatchingOption());
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
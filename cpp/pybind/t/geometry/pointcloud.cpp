@@ -127,6 +127,26 @@ void pybind_pointcloud(py::module& m) {
             },
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def(
+            "voxel_down_sample",
+            [](const PointCloud& pointcloud, const double voxel_size,
+               open3d::geometry::VoxelReduction reduction) {
+                return pointcloud.VoxelDownSample(voxel_size, reduction);
+            },
+            "Downsamples a CPU point cloud with a specified voxel size, "
+            "reducing the points of each voxel as specified.",
+            "voxel_size"_a, "reduction"_a);
+    pointcloud.def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                   py::call_guard<py::gil_scoped_release>(), "eps"_a,
+                   "min_points"_a, "print_progress"_a = false,
+                   "Clusters the points with DBSCAN. Returns Int32 point "
+                   "labels, -1 indicates noise.");
+    pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
+                   py::call_guard<py::gil_scoped_release>(), "max_nn"_a = 30,
+                   "radius"_a = py::none(),
+                   "Estimates the normals of the points from their max_nn "
+                   "nearest neighbors, limited to radius if given. Existing "
+                   "normals are used to orient the new ones.");
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             py::call_guard<py::gil_scoped_release>(), "depth"_a, "intrinsics"_a,
@@ -26,20 +26,28 @@
 
 #include "open3d/core/nns/FixedRadiusIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(FixedRadiusIndex, SearchRadius) {
-    core::Device device = core::Device("CUDA:0");
+class FixedRadiusIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FixedRadiusIndex,
+                         FixedRadiusIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FixedRadiusIndexPermuteDevices, SearchRadius) {
+    core::Device device = GetParam();
     std::vector<int> ref_indices = {1, 4};
     std::vector<float> ref_distance = {0.00626358, 0.00747938};
 
@@ -68,5 +76,85 @@ TEST(FixedRadiusIndex, SearchRadius) {
              std::vector<float>({0.00626358, 0.00747938}));
 }
 
+TEST_P(FixedRadiusIndexPermuteDevices, SearchHybrid) {
+    core::Device device = GetParam();
+
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32, device);
+    float radius = 0.1;
+    core::nns::FixedRadiusIndex index(ref, radius);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32, device);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchHybrid(query, radius, 3);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 3}));
+    ExpectEQ(indices.To(core::Dtype::Int32).ToFlatVector<int>(),
+             std::vector<int>({1, 4, -1}));
+    ExpectEQ(distances.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0}));
+}
+
+TEST(FixedRadiusIndex, SearchManyQueriesCPU) {
+    // Compare against brute force, also for search radii that differ from the
+    // radius the index was built with.
+    const int64_t num_points = 2000;
+    const int64_t num_queries = 3000;
+    std::vector<double> points(num_points * 3), queries(num_queries * 3);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    for (double &v : points) v = uniform(rng);
+    for (double &v : queries) v = uniform(rng);
+    core::nns::FixedRadiusIndex index(
+            core::Tensor(points, {num_points, 3}, core::Dtype::Float64), 0.1);
+    core::Tensor query(queries, {num_queries, 3}, core::Dtype::Float64);
+
+    const int max_knn = 4;
+    for (double radius : {0.05, 0.1, 0.25}) {
+        core::Tensor radius_indices, radius_distances, row_splits;
+        std::tie(radius_indices, radius_distances, row_splits) =
+                index.SearchRadius(query, radius);
+        core::Tensor hybrid_indices, hybrid_distances;
+        std::tie(hybrid_indices, hybrid_distances) =
+                index.SearchHybrid(query, radius, max_knn);
+
+        const int64_t *radius_ptr = radius_indices.GetDataPtr<int64_t>();
+        const double *radius_dist_ptr = radius_distances.GetDataPtr<double>();
+        const int64_t *splits_ptr = row_splits.GetDataPtr<int64_t>();
+        const int64_t *hybrid_ptr = hybrid_indices.GetDataPtr<int64_t>();
+        for (int64_t i = 0; i < num_queries; i += 7) {
+            std::vector<std::pair<double, int64_t>> ref_neighbors;
+            for (int64_t j = 0; j < num_points; ++j) {
+                double dist = 0;
+                for (int d = 0; d < 3; ++d) {
+                    double diff = queries[i * 3 + d] - points[j * 3 + d];
+                    dist += diff * diff;
+                }
+                if (dist <= radius * radius) {
+                    ref_neighbors.emplace_back(dist, j);
+                }
+            }
+            std::sort(ref_neighbors.begin(), ref_neighbors.end());
+
+            const int64_t num_in_radius = ref_neighbors.size();
+            ASSERT_EQ(splits_ptr[i + 1] - splits_ptr[i], num_in_radius);
+            for (int64_t k = 0; k < num_in_radius; ++k) {
+                EXPECT_EQ(radius_ptr[splits_ptr[i] + k],
+                          ref_neighbors[k].second);
+                EXPECT_DOUBLE_EQ(radius_dist_ptr[splits_ptr[i] + k],
+                                 ref_neighbors[k].first);
+            }
+            for (int k = 0; k < max_knn; ++k) {
+                EXPECT_EQ(hybrid_ptr[i * max_knn + k],
+                          k < num_in_radius ? ref_neighbors[k].second : -1);
+            }
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
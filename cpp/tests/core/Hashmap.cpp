@@ -26,6 +26,8 @@
 
 #include "open3d/core/hashmap/Hashmap.h"
 
+#include <cstdio>
+#include <cstring>
 #include <random>
 #include <unordered_map>
 
@@ -33,6 +35,7 @@
 #include "open3d/core/Indexer.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Optional.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
@@ -80,6 +83,7 @@ TEST_P(HashmapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -110,6 +114,7 @@ TEST_P(HashmapPermuteDevices, Find) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -154,6 +159,7 @@ TEST_P(HashmapPermuteDevices, Insert) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -207,6 +213,7 @@ TEST_P(HashmapPermuteDevices, Erase) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -272,6 +279,7 @@ TEST_P(HashmapPermuteDevices, Rehash) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -326,6 +334,7 @@ TEST_P(HashmapPermuteDevices, Clear) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -404,6 +413,7 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -455,5 +465,154 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, SaveLoad) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
+    }
+
+    const int n = 100000;
+    const int slots = 1023;
+    int init_capacity = 2048;
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_hashmap.o3dhm";
+
+    HashData<int, int> data(n, slots);
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+
+    for (auto backend : backends) {
+        core::Hashmap hashmap(init_capacity, core::Dtype::Int32,
+                              core::Dtype::Int32, {1}, {1}, device, backend);
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+
+        // Leave erased entries in the saved table.
+        core::Tensor erase_keys = keys.Slice(0, 0, 100);
+        hashmap.Erase(erase_keys, masks);
+        int64_t num_erased =
+                masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>();
+        EXPECT_EQ(hashmap.Size(), slots - num_erased);
+
+        hashmap.Find(keys, addrs, masks);
+        int64_t num_found =
+                masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>();
+
+        hashmap.Save(file_name);
+
+        // Same device and every CPU backend, including memory-mapped
+        // loading.
+        std::vector<core::HashmapBackend> load_backends = {
+                core::HashmapBackend::Default};
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            load_backends = backends;
+        }
+        for (auto load_backend : load_backends) {
+            core::Hashmap loaded =
+                    core::Hashmap::Load(file_name, device, load_backend);
+            EXPECT_EQ(loaded.GetDevice(), device);
+            EXPECT_EQ(loaded.Size(), hashmap.Size());
+
+            loaded.Find(keys, addrs, masks);
+            EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+                      num_found);
+            core::Tensor found_keys = keys.IndexGet({masks});
+            core::Tensor found_values =
+                    loaded.GetValueTensor()
+                            .IndexGet({addrs.To(core::Dtype::Int64)
+                                               .IndexGet({masks})})
+                            .View({found_keys.GetLength()});
+            EXPECT_TRUE(found_values.Mul(data.k_factor_).AllClose(found_keys));
+
+            // Loaded hashmaps stay modifiable, and the erased keys come back.
+            loaded.Insert(erase_keys, values.Slice(0, 0, 100), addrs, masks);
+            EXPECT_EQ(loaded.Size(), slots);
+        }
+
+        // Modifying a memory-mapped hashmap does not change the file.
+        core::Hashmap reloaded = core::Hashmap::Load(file_name, device);
+        EXPECT_EQ(reloaded.Size(), hashmap.Size());
+    }
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(Hashmap, LoadInvalid) {
+    const core::Device device("CPU:0");
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_hashmap_invalid.o3dhm";
+    const int n = 1000;
+    HashData<int, int> data(n, 100);
+    core::Tensor keys(data.keys_, {n}, core::Dtype::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Dtype::Int32, device);
+    core::Hashmap hashmap(256, core::Dtype::Int32, core::Dtype::Int32, {1},
+                          {1}, device, core::HashmapBackend::OpenAddressing);
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+    hashmap.Save(file_name);
+
+    std::vector<char> bytes;
+    EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, bytes, nullptr));
+    // Overwrites int64 fields of the header, which holds the key dtype size,
+    // capacity, size, bucket count, key element size and heap section offset
+    // at these offsets after the magic, version, dtypes and element shapes.
+    auto write_corrupted =
+            [&](const std::vector<std::pair<size_t, int64_t>> &fields) {
+                std::vector<char> corrupted = bytes;
+                for (const auto &field : fields) {
+                    std::memcpy(corrupted.data() + field.first, &field.second,
+                                sizeof(field.second));
+                }
+                FILE *fp = fopen(file_name.c_str(), "wb");
+                fwrite(corrupted.data(), 1, corrupted.size(), fp);
+                fclose(fp);
+            };
+    const size_t key_byte_size_offset = 24;
+    const size_t capacity_offset = 224;
+    const size_t size_offset = 232;
+    const size_t bucket_count_offset = 240;
+    const size_t dsize_key_offset = 256;
+    const size_t heap_offset_offset = 288;
+
+    write_corrupted({{capacity_offset, int64_t(1) << 40}});
+    EXPECT_ANY_THROW(core::Hashmap::Load(file_name, device));
+    write_corrupted({{size_offset, hashmap.GetCapacity() + 1}});
+    EXPECT_ANY_THROW(core::Hashmap::Load(file_name, device));
+    write_corrupted({{bucket_count_offset, hashmap.GetBucketCount() + 1}});
+    EXPECT_ANY_THROW(core::Hashmap::Load(file_name, device));
+    write_corrupted({{bucket_count_offset, hashmap.GetBucketCount() * 1024}});
+    EXPECT_ANY_THROW(core::Hashmap::Load(file_name, device));
+    // An Int32 key dtype of 3 bytes.
+    write_corrupted({{key_byte_size_offset, 3}, {dsize_key_offset, 3}});
+    EXPECT_ANY_THROW(core::Hashmap::Load(file_name, device));
+
+    // The first two heap addresses made equal.
+    int64_t heap_offset = 0;
+    std::memcpy(&heap_offset, bytes.data() + heap_offset_offset,
+                sizeof(heap_offset));
+    int32_t first_addr = 0;
+    std::memcpy(&first_addr, bytes.data() + heap_offset, sizeof(first_addr));
+    std::vector<char> duplicated = bytes;
+    std::memcpy(duplicated.data() + heap_offset + sizeof(int32_t), &first_addr,
+                sizeof(first_addr));
+    FILE *fp = fopen(file_name.c_str(), "wb");
+    fwrite(duplicated.data(), 1, duplicated.size(), fp);
+    fclose(fp);
+    EXPECT_ANY_THROW(core::Hashmap::Load(file_name, device));
+
+    // Truncated file.
+    fp = fopen(file_name.c_str(), "wb");
+    fwrite(bytes.data(), 1, bytes.size() / 2, fp);
+    fclose(fp);
+    EXPECT_ANY_THROW(core::Hashmap::Load(file_name, device));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
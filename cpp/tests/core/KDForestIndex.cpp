@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KDForestIndex.h"
+
+#include <algorithm>
+#include <random>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Returns the indices of the knn nearest points to each query by brute force.
+static std::vector<std::vector<int64_t>> BruteForceKnn(
+        const std::vector<float> &points,
+        const std::vector<float> &queries,
+        int64_t dimension,
+        int knn) {
+    const int64_t num_points = points.size() / dimension;
+    const int64_t num_queries = queries.size() / dimension;
+    std::vector<std::vector<int64_t>> result(num_queries);
+    for (int64_t i = 0; i < num_queries; ++i) {
+        std::vector<std::pair<float, int64_t>> neighbors;
+        for (int64_t j = 0; j < num_points; ++j) {
+            float dist = 0;
+            for (int64_t d = 0; d < dimension; ++d) {
+                float diff =
+                        queries[i * dimension + d] - points[j * dimension + d];
+                dist += diff * diff;
+            }
+            neighbors.emplace_back(dist, j);
+        }
+        std::partial_sort(neighbors.begin(), neighbors.begin() + knn,
+                          neighbors.end());
+        for (int k = 0; k < knn; ++k) {
+            result[i].push_back(neighbors[k].second);
+        }
+    }
+    return result;
+}
+
+static std::vector<float> RandomValues(int64_t size, int seed) {
+    std::vector<float> values(size);
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    for (float &v : values) v = uniform(rng);
+    return values;
+}
+
+TEST(KDForestIndex, SearchKnnSmall) {
+    // With max_checks above the dataset size nearly every point is compared,
+    // but the branch bounds are approximate, so a neighbor may still be
+    // missed. Most of the neighbors must match the brute force ones.
+    const int64_t num_points = 50;
+    const int64_t dimension = 8;
+    std::vector<float> points = RandomValues(num_points * dimension, 0);
+    std::vector<float> queries = RandomValues(10 * dimension, 1);
+    core::nns::KDForestIndex index(
+            core::Tensor(points, {num_points, dimension}, core::Dtype::Float32),
+            2, 1000);
+    core::Tensor query(queries, {10, dimension}, core::Dtype::Float32);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query, 3);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({10, 3}));
+    EXPECT_EQ(distances.GetShape(), core::SizeVector({10, 3}));
+    std::vector<std::vector<int64_t>> ref =
+            BruteForceKnn(points, queries, dimension, 3);
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<float> distances_vec = distances.ToFlatVector<float>();
+    int64_t num_found = 0;
+    for (int64_t i = 0; i < 10; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            num_found += std::count(ref[i].begin(), ref[i].end(),
+                                    indices_vec[i * 3 + k]);
+            if (k > 0) {
+                EXPECT_LE(distances_vec[i * 3 + k - 1],
+                          distances_vec[i * 3 + k]);
+            }
+        }
+    }
+    EXPECT_GE(num_found, 27);
+
+    // knn larger than the dataset.
+    std::tie(indices, distances) = index.SearchKnn(query, 100);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({10, num_points}));
+
+    // Invalid arguments.
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+    EXPECT_THROW(index.SetMaxChecks(0), std::runtime_error);
+    EXPECT_THROW(index.SearchRadius(query, 0.1), std::runtime_error);
+
+    // Index without data.
+    core::nns::KDForestIndex empty_index;
+    EXPECT_THROW(empty_index.SearchKnn(query, 3), std::runtime_error);
+}
+
+TEST(KDForestIndex, SearchKnnRecall) {
+    // Feature-like data: recall should grow with max_checks.
+    const int64_t num_points = 5000;
+    const int64_t num_queries = 500;
+    const int64_t dimension = 33;
+    std::vector<float> points = RandomValues(num_points * dimension, 0);
+    std::vector<float> queries = RandomValues(num_queries * dimension, 1);
+    core::nns::NearestNeighborSearch nns(core::Tensor(
+            points, {num_points, dimension}, core::Dtype::Float32));
+    core::Tensor query(queries, {num_queries, dimension},
+                       core::Dtype::Float32);
+    std::vector<std::vector<int64_t>> ref =
+            BruteForceKnn(points, queries, dimension, 1);
+
+    double last_recall = 0;
+    for (int max_checks : {32, 512, 4096}) {
+        nns.ApproxKnnIndex(4, max_checks);
+        core::Tensor indices = nns.KnnSearch(query, 1).first;
+        std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+        int64_t num_correct = 0;
+        for (int64_t i = 0; i < num_queries; ++i) {
+            num_correct += indices_vec[i] == ref[i][0];
+        }
+        double recall = double(num_correct) / num_queries;
+        EXPECT_GE(recall, last_recall);
+        last_recall = recall;
+    }
+    EXPECT_GT(last_recall, 0.9);
+}
+
+}  // namespace tests
+}  // namespace open3d
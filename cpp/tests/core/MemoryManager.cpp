@@ -26,6 +26,9 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <cstdint>
+#include <cstring>
+#include <thread>
 #include <vector>
 
 #include "open3d/core/Blob.h"
@@ -78,5 +81,57 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST(MemoryManager, CPUCachedMallocFree) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager mm;
+
+    for (size_t byte_size : {1, 63, 64, 65, 257, 1000, 100000, 3000000}) {
+        void* ptr = mm.Malloc(byte_size, device);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        std::memset(ptr, 0xff, byte_size);
+        mm.Free(ptr, device);
+
+        // The freed block is reused for a request of the same size class.
+        void* reused_ptr = mm.Malloc(byte_size, device);
+        EXPECT_EQ(reused_ptr, ptr);
+        mm.Free(reused_ptr, device);
+    }
+    EXPECT_EQ(mm.Malloc(0, device), nullptr);
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+}
+
+TEST(MemoryManager, CPUCachedMultiThread) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager mm;
+
+    // Blocks are allocated and freed on different threads.
+    std::vector<void*> ptrs(1000, nullptr);
+    std::thread producer([&]() {
+        for (size_t i = 0; i < ptrs.size(); ++i) {
+            ptrs[i] = mm.Malloc(i * 97 + 1, device);
+            std::memset(ptrs[i], 0, i * 97 + 1);
+        }
+    });
+    producer.join();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&, t]() {
+            for (size_t i = t; i < ptrs.size(); i += 4) {
+                mm.Free(ptrs[i], device);
+                void* ptr = mm.Malloc(i * 31 + 1, device);
+                std::memset(ptr, 0, i * 31 + 1);
+                mm.Free(ptr, device);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+}
+
 }  // namespace tests
 }  // namespace open3d
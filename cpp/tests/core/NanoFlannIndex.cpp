@@ -26,8 +26,10 @@
 
 #include "open3d/core/nns/NanoFlannIndex.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -108,5 +110,99 @@ TEST(NanoFlannIndex, SearchRadius) {
              std::vector<double>({0.00626358, 0.00747938}));
 }
 
+TEST(NanoFlannIndex, SearchHybrid) {
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::nns::NanoFlannIndex index(ref);
+
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64);
+
+    EXPECT_THROW(index.SearchHybrid(query, 0.1, 0), std::runtime_error);
+    EXPECT_THROW(index.SearchHybrid(query, 0.0, 1), std::runtime_error);
+
+    // Within radius 0.1 there are 2 neighbors, padded to max_knn.
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchHybrid(query, 0.1, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, -1}));
+    ExpectEQ(distances.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0}));
+
+    // Only the nearest max_knn neighbors are kept.
+    std::tie(indices, distances) = index.SearchHybrid(query, 0.2, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(distances.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0108912}));
+}
+
+TEST(NanoFlannIndex, SearchManyQueries) {
+    // Enough queries to be sorted spatially and searched in parallel
+    // batches. Results must stay in the order of the queries.
+    const int64_t num_points = 1000;
+    const int64_t num_queries = 20000;
+    std::vector<float> points(num_points * 3), queries(num_queries * 3);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(0, 1);
+    for (float &v : points) v = uniform(rng);
+    for (float &v : queries) v = uniform(rng);
+    core::nns::NanoFlannIndex index(
+            core::Tensor(points, {num_points, 3}, core::Dtype::Float32));
+    core::Tensor query(queries, {num_queries, 3}, core::Dtype::Float32);
+
+    const float radius = 0.1;
+    const int knn = 5;
+    core::Tensor knn_indices, knn_distances;
+    std::tie(knn_indices, knn_distances) = index.SearchKnn(query, knn);
+    core::Tensor radius_indices, radius_distances, row_splits;
+    std::tie(radius_indices, radius_distances, row_splits) =
+            index.SearchRadius(query, radius);
+    core::Tensor hybrid_indices, hybrid_distances;
+    std::tie(hybrid_indices, hybrid_distances) =
+            index.SearchHybrid(query, radius, knn);
+
+    const int64_t *knn_ptr = knn_indices.GetDataPtr<int64_t>();
+    const int64_t *radius_ptr = radius_indices.GetDataPtr<int64_t>();
+    const float *radius_dist_ptr = radius_distances.GetDataPtr<float>();
+    const int64_t *splits_ptr = row_splits.GetDataPtr<int64_t>();
+    const int64_t *hybrid_ptr = hybrid_indices.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < num_queries; i += 7) {
+        std::vector<std::pair<float, int64_t>> ref_neighbors;
+        for (int64_t j = 0; j < num_points; ++j) {
+            float dist = 0;
+            for (int d = 0; d < 3; ++d) {
+                float diff = queries[i * 3 + d] - points[j * 3 + d];
+                dist += diff * diff;
+            }
+            ref_neighbors.emplace_back(dist, j);
+        }
+        std::sort(ref_neighbors.begin(), ref_neighbors.end());
+
+        for (int k = 0; k < knn; ++k) {
+            EXPECT_EQ(knn_ptr[i * knn + k], ref_neighbors[k].second);
+        }
+
+        int64_t num_in_radius = 0;
+        while (ref_neighbors[num_in_radius].first < radius * radius) {
+            ++num_in_radius;
+        }
+        ASSERT_EQ(splits_ptr[i + 1] - splits_ptr[i], num_in_radius);
+        for (int64_t k = 0; k < num_in_radius; ++k) {
+            EXPECT_EQ(radius_ptr[splits_ptr[i] + k], ref_neighbors[k].second);
+            EXPECT_FLOAT_EQ(radius_dist_ptr[splits_ptr[i] + k],
+                            ref_neighbors[k].first);
+        }
+
+        for (int k = 0; k < knn; ++k) {
+            EXPECT_EQ(hybrid_ptr[i * knn + k],
+                      k < num_in_radius ? ref_neighbors[k].second : -1);
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ParallelFor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+/// Restores the thread limit when going out of scope.
+class NumThreadsGuard {
+public:
+    NumThreadsGuard() : num_threads_(core::GetNumThreads()) {}
+    ~NumThreadsGuard() { core::SetNumThreads(num_threads_); }
+
+private:
+    int num_threads_;
+};
+
+TEST(ParallelFor, VisitEachIndexOnce) {
+    for (int64_t n : {0, 1, 7, 1000, 100003}) {
+        for (int64_t grain_size : {1, 16, 1 << 20}) {
+            std::vector<int> visits(n, 0);
+            core::ParallelFor(
+                    n, [&](int64_t i) { visits[i]++; }, grain_size);
+            EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), n);
+        }
+    }
+}
+
+TEST(ParallelFor, RangeCoversAll) {
+    int64_t n = 100003;
+    int64_t grain_size = 100;
+    std::atomic<int64_t> sum(0);
+    std::atomic<bool> ranges_valid(true);
+    core::ParallelForRange(
+            n,
+            [&](int64_t begin, int64_t end) {
+                if (begin >= end || end > n ||
+                    end - begin < grain_size / 2) {
+                    ranges_valid = false;
+                }
+                int64_t partial_sum = 0;
+                for (int64_t i = begin; i < end; ++i) {
+                    partial_sum += i;
+                }
+                sum += partial_sum;
+            },
+            grain_size);
+    EXPECT_TRUE(ranges_valid);
+    EXPECT_EQ(sum, n * (n - 1) / 2);
+}
+
+TEST(ParallelFor, ReduceSum) {
+    NumThreadsGuard guard;
+    for (int num_threads : {1, 4}) {
+        core::SetNumThreads(num_threads);
+        for (int64_t n : {0, 3, 100003}) {
+            // Sums of i and of 1, added to the initial values.
+            std::vector<int64_t> sums = {10, 20};
+            core::ParallelReduceSum(
+                    n, 2,
+                    [](int64_t i, int64_t *sum) {
+                        sum[0] += i;
+                        sum[1] += 1;
+                    },
+                    sums.data());
+            EXPECT_EQ(sums[0], 10 + n * (n - 1) / 2);
+            EXPECT_EQ(sums[1], 20 + n);
+        }
+    }
+}
+
+TEST(ParallelFor, Nested) {
+    NumThreadsGuard guard;
+    core::SetNumThreads(4);
+    int64_t n = 100;
+    std::vector<int64_t> row_sums(n, 0);
+    core::ParallelFor(n, [&](int64_t i) {
+        std::atomic<int64_t> row_sum(0);
+        core::ParallelFor(n, [&](int64_t j) { row_sum += i * n + j; });
+        row_sums[i] = row_sum;
+    });
+    int64_t total = std::accumulate(row_sums.begin(), row_sums.end(),
+                                    static_cast<int64_t>(0));
+    EXPECT_EQ(total, n * n * (n * n - 1) / 2);
+}
+
+TEST(ParallelFor, FromMultipleThreads) {
+    std::vector<std::thread> threads;
+    std::vector<int64_t> sums(4, 0);
+    for (size_t t = 0; t < sums.size(); ++t) {
+        threads.emplace_back([&sums, t]() {
+            std::atomic<int64_t> sum(0);
+            core::ParallelFor(10000, [&](int64_t i) { sum += i; });
+            sums[t] = sum;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int64_t sum : sums) {
+        EXPECT_EQ(sum, 10000 * 9999 / 2);
+    }
+}
+
+TEST(ParallelFor, Exception) {
+    EXPECT_THROW(core::ParallelFor(1000,
+                                   [](int64_t i) {
+                                       if (i == 500) {
+                                           throw std::runtime_error("Error.");
+                                       }
+                                   }),
+                 std::runtime_error);
+}
+
+TEST(ParallelFor, SetNumThreads) {
+    NumThreadsGuard guard;
+    int default_num_threads = core::GetNumThreads();
+    EXPECT_GE(default_num_threads, 1);
+
+    core::SetNumThreads(1);
+    EXPECT_EQ(core::GetNumThreads(), 1);
+    std::atomic<int64_t> sum(0);
+    core::ParallelFor(1000, [&](int64_t i) { sum += i; });
+    EXPECT_EQ(sum, 1000 * 999 / 2);
+
+    core::SetNumThreads(0);
+    EXPECT_EQ(core::GetNumThreads(), default_num_threads);
+}
+
+TEST(ParallelFor, ParallelInvoke) {
+    std::vector<int> results(3, 0);
+    core::ParallelInvoke({[&]() { results[0] = 1; }, [&]() { results[1] = 2; },
+                          [&]() { results[2] = 3; }});
+    EXPECT_EQ(results, std::vector<int>({1, 2, 3}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -1714,6 +1714,52 @@ TEST_P(TensorPermuteDevices, ReduceSumLargeArray) {
     }
 }
 
+TEST_P(TensorPermuteDevices, ReduceMultipleOutputsLongReductionDim) {
+    core::Device device = GetParam();
+
+    // Few outputs and a long reduction dim, e.g. per-column bounds of a
+    // point cloud.
+    int64_t num_rows = 100003;
+    std::vector<int> vals(num_rows * 3);
+    std::transform(vals.begin(), vals.end(), vals.begin(), [](int x) -> int {
+        return utility::UniformRandInt(-1000, 1000);
+    });
+    std::vector<int> ref_sum(3, 0);
+    std::vector<int> ref_min(3, std::numeric_limits<int>::max());
+    std::vector<int> ref_max(3, std::numeric_limits<int>::lowest());
+    for (int64_t i = 0; i < num_rows; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            int val = vals[i * 3 + j];
+            ref_sum[j] += val;
+            ref_min[j] = std::min(ref_min[j], val);
+            ref_max[j] = std::max(ref_max[j], val);
+        }
+    }
+
+    core::Tensor src(vals, {num_rows, 3}, core::Dtype::Int32, device);
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<int>(), ref_sum);
+    EXPECT_EQ(src.Min({0}).ToFlatVector<int>(), ref_min);
+    EXPECT_EQ(src.Max({0}).ToFlatVector<int>(), ref_max);
+
+    core::Tensor dst = src.Sum({0}, true);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({1, 3}));
+    EXPECT_EQ(dst.ToFlatVector<int>(), ref_sum);
+
+    // Non-contiguous input and output with strides.
+    core::Tensor src_t = src.T();
+    EXPECT_EQ(src_t.Sum({1}).ToFlatVector<int>(), ref_sum);
+    EXPECT_EQ(src_t.Max({1}).ToFlatVector<int>(), ref_max);
+
+    // Multiple reduction dims.
+    core::Tensor src_3d =
+            src.Reshape({num_rows, 3, 1}).Expand({num_rows, 3, 2});
+    std::vector<int> ref_sum_3d;
+    for (int64_t j = 0; j < 3; ++j) {
+        ref_sum_3d.push_back(ref_sum[j] * 2);
+    }
+    EXPECT_EQ(src_3d.Sum({0, 2}).ToFlatVector<int>(), ref_sum_3d);
+}
+
 TEST_P(TensorPermuteDevices, ReduceProd) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>({{{22.f, 23.f, 20.f, 9.f},
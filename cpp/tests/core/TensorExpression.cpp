@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpression.h"
+
+#include <vector>
+
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorExpressionPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpression,
+                         TensorExpressionPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorExpressionPermuteDevices, ArithmeticChain) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    core::Tensor b = core::Tensor::Init<float>({1, 1, 1}, device);
+    core::Tensor c = core::Tensor::Init<float>({{2}, {3}}, device);
+    core::Tensor d = core::Tensor::Init<float>(10, device);
+
+    core::Tensor dst = ((core::TensorExpression(a) - b) * c + d).Eval();
+    EXPECT_TRUE(dst.AllClose(((a - b) * c + d)));
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({2, 3}));
+
+    // Scalars on both sides and repeated operands.
+    dst = (2.f * core::TensorExpression(a) * a - 1.f / (a + 1.f)).Eval();
+    EXPECT_TRUE(dst.AllClose(2.f * a * a - 1.f / (a + 1.f)));
+}
+
+TEST_P(TensorExpressionPermuteDevices, UnaryOps) {
+    core::Device device = GetParam();
+    core::Tensor a =
+            core::Tensor::Init<double>({-2.5, -1.0, 0.5, 4.0}, device);
+
+    core::Tensor dst = (-core::TensorExpression(a)).Abs().Sqrt().Eval();
+    EXPECT_TRUE(dst.AllClose(a.Neg().Abs().Sqrt()));
+
+    dst = (core::TensorExpression(a).Floor() + a.Ceil()).Exp().Eval();
+    EXPECT_TRUE(dst.AllClose((a.Floor() + a.Ceil()).Exp()));
+
+    dst = core::TensorExpression(a).Sin().Cos().Round().Eval();
+    EXPECT_TRUE(dst.AllClose(a.Sin().Cos().Round()));
+
+    // Float-only ops on integer tensors.
+    core::Tensor i = core::Tensor::Init<int32_t>({1, 2, 3}, device);
+    EXPECT_ANY_THROW(core::TensorExpression(i).Sqrt().Eval());
+    EXPECT_EQ((core::TensorExpression(i).Neg() * 2).Eval().ToFlatVector<int>(),
+              std::vector<int>({-2, -4, -6}));
+}
+
+TEST_P(TensorExpressionPermuteDevices, EvalInto) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({1, 2, 3}, device);
+    core::Tensor b = core::Tensor::Init<float>({4, 5, 6}, device);
+
+    // In-place into one of the operands.
+    (core::TensorExpression(a) * b + a).EvalInto(a);
+    EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({5, 12, 21}));
+
+    core::Tensor wrong_shape = core::Tensor::Zeros({4}, core::Dtype::Float32,
+                                                   device);
+    EXPECT_ANY_THROW((core::TensorExpression(a) + b).EvalInto(wrong_shape));
+
+    core::Tensor wrong_dtype = core::Tensor::Zeros({3}, core::Dtype::Float64,
+                                                   device);
+    EXPECT_ANY_THROW((core::TensorExpression(a) + wrong_dtype).Eval());
+}
+
+TEST_P(TensorExpressionPermuteDevices, ManyOperands) {
+    core::Device device = GetParam();
+
+    // More distinct operands than a single Indexer supports.
+    std::vector<core::Tensor> tensors;
+    for (int i = 0; i < 25; ++i) {
+        tensors.push_back(core::Tensor::Full({4, 5}, i, core::Dtype::Int64,
+                                             device));
+    }
+    core::TensorExpression expr(tensors[0]);
+    for (int i = 1; i < 25; ++i) {
+        expr = expr + tensors[i];
+    }
+    EXPECT_EQ(expr.Eval().ToFlatVector<int64_t>(),
+              std::vector<int64_t>(20, 300));
+}
+
+}  // namespace tests
+}  // namespace open3d
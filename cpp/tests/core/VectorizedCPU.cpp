@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/VectorizedCPU.h"
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+/// Restores the default instruction set when going out of scope.
+class SIMDInstructionSetGuard {
+public:
+    SIMDInstructionSetGuard()
+        : isa_(core::kernel::GetSIMDInstructionSet()) {}
+    ~SIMDInstructionSetGuard() { core::kernel::SetSIMDInstructionSet(isa_); }
+
+private:
+    core::kernel::SIMDInstructionSet isa_;
+};
+
+static std::vector<core::kernel::SIMDInstructionSet>
+SupportedSIMDInstructionSets() {
+    std::vector<core::kernel::SIMDInstructionSet> isas;
+    for (auto isa : {core::kernel::SIMDInstructionSet::Baseline,
+                     core::kernel::SIMDInstructionSet::AVX2,
+                     core::kernel::SIMDInstructionSet::AVX512}) {
+        if (static_cast<int>(isa) <=
+            static_cast<int>(core::kernel::GetSupportedSIMDInstructionSet())) {
+            isas.push_back(isa);
+        }
+    }
+    return isas;
+}
+
+/// Evaluates \p func with the generic kernels and with every supported
+/// instruction set, and checks that all results match.
+template <typename func_t>
+static void ExpectSameAsGeneric(func_t func) {
+    SIMDInstructionSetGuard guard;
+    core::kernel::SetSIMDInstructionSet(core::kernel::SIMDInstructionSet::None);
+    core::Tensor expected = func();
+    for (auto isa : SupportedSIMDInstructionSets()) {
+        core::kernel::SetSIMDInstructionSet(isa);
+        core::Tensor actual = func();
+        EXPECT_EQ(actual.GetShape(), expected.GetShape());
+        EXPECT_EQ(actual.GetDtype(), expected.GetDtype());
+        EXPECT_TRUE(actual.AllClose(expected))
+                << core::kernel::ToString(isa);
+    }
+}
+
+TEST(VectorizedCPU, SetSIMDInstructionSet) {
+    SIMDInstructionSetGuard guard;
+    EXPECT_EQ(core::kernel::GetSIMDInstructionSet(),
+              core::kernel::GetSupportedSIMDInstructionSet());
+    core::kernel::SetSIMDInstructionSet(core::kernel::SIMDInstructionSet::None);
+    EXPECT_EQ(core::kernel::GetSIMDInstructionSet(),
+              core::kernel::SIMDInstructionSet::None);
+}
+
+TEST(VectorizedCPU, BinaryEW) {
+    core::Device device("CPU:0");
+    // Not a multiple of the vector width or the chunk size.
+    int64_t n = 200003;
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64,
+                              core::Dtype::Int32, core::Dtype::UInt8}) {
+        core::Tensor a = core::Tensor::Arange(1, n + 1, 1, core::Dtype::Int64,
+                                              device)
+                                 .To(dtype);
+        core::Tensor b = core::Tensor::Ones({n}, dtype, device) * 3;
+        ExpectSameAsGeneric([&]() { return a + b; });
+        ExpectSameAsGeneric([&]() { return a - b; });
+        ExpectSameAsGeneric([&]() { return a * b; });
+        ExpectSameAsGeneric([&]() { return a / b; });
+        ExpectSameAsGeneric([&]() { return a * 2; });
+        ExpectSameAsGeneric([&]() { return 7 - a; });
+        ExpectSameAsGeneric([&]() { return a.Gt(b); });
+        ExpectSameAsGeneric([&]() { return a.Le(b); });
+        ExpectSameAsGeneric([&]() { return a.Eq(b); });
+        ExpectSameAsGeneric([&]() { return a.Ne(5); });
+        ExpectSameAsGeneric([&]() {
+            core::Tensor c = a.Clone();
+            c.Add_(b);
+            return c;
+        });
+    }
+}
+
+TEST(VectorizedCPU, UnaryEW) {
+    core::Device device("CPU:0");
+    core::Tensor a = core::Tensor::Arange(-50000, 50001, 1, core::Dtype::Int64,
+                                          device)
+                             .To(core::Dtype::Float32) /
+                     1000.f;
+    ExpectSameAsGeneric([&]() { return a.Abs().Sqrt(); });
+    ExpectSameAsGeneric([&]() { return a.Exp(); });
+    ExpectSameAsGeneric([&]() { return a.Neg(); });
+    ExpectSameAsGeneric([&]() { return a.To(core::Dtype::Int32).Abs(); });
+}
+
+TEST(VectorizedCPU, Reduction) {
+    core::Device device("CPU:0");
+    // Values with different extrema positions per row.
+    core::Tensor a = (core::Tensor::Arange(0, 3 * 100003, 1,
+                                           core::Dtype::Float64, device) *
+                      0.7)
+                             .Sin()
+                             .Reshape({3, 100003}) *
+                     1000;
+    for (core::Dtype dtype : {core::Dtype::Float64, core::Dtype::Int64,
+                              core::Dtype::Int32}) {
+        core::Tensor t = a.To(dtype);
+        ExpectSameAsGeneric([&]() { return t.Sum({0, 1}); });
+        ExpectSameAsGeneric([&]() { return t.Sum({1}); });
+        ExpectSameAsGeneric([&]() { return t.Min({1}); });
+        ExpectSameAsGeneric([&]() { return t.Max({0, 1}); });
+        ExpectSameAsGeneric([&]() { return t.ArgMax({1}); });
+        ExpectSameAsGeneric([&]() { return t.ArgMin({0, 1}); });
+        ExpectSameAsGeneric([&]() { return t.ArgMax({0, 1}); });
+        // Non-trailing reduction dims use the generic kernels.
+        ExpectSameAsGeneric([&]() { return t.Sum({0}); });
+    }
+
+    // ArgMax returns the first maximum.
+    core::Tensor ties = core::Tensor::Zeros({300000}, core::Dtype::Float32,
+                                            device);
+    ties.SetItem(core::TensorKey::Index(123456),
+                 core::Tensor::Init<float>(1, device));
+    ties.SetItem(core::TensorKey::Index(234567),
+                 core::Tensor::Init<float>(1, device));
+    EXPECT_EQ(ties.ArgMax({0}).Item<int64_t>(), 123456);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,12 +24,35 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(EstimateNormals, DISABLED_FastEigen3x3) { NotImplemented(); }
+TEST(EstimateNormals, FastEigen3x3) {
+    // Noisy samples of the plane z = 0.3 x - 0.2 y.
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, -0.01),
+         Eigen::Vector3d(10.0, 10.0, 0.01), 0);
+    for (Eigen::Vector3d &point : pcd.points_) {
+        point(2) += 0.3 * point(0) - 0.2 * point(1);
+    }
+    geometry::PointCloud pcd_iterative = pcd;
+
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(20), true);
+    pcd_iterative.EstimateNormals(geometry::KDTreeSearchParamKNN(20), false);
+
+    const Eigen::Vector3d plane_normal =
+            Eigen::Vector3d(-0.3, 0.2, 1.0).normalized();
+    for (size_t i = 0; i < pcd.points_.size(); ++i) {
+        EXPECT_NEAR(pcd.normals_[i].norm(), 1.0, 1e-12);
+        EXPECT_NEAR(std::abs(pcd.normals_[i].dot(pcd_iterative.normals_[i])),
+                    1.0, 1e-9);
+        EXPECT_GT(std::abs(pcd.normals_[i].dot(plane_normal)), 0.99);
+    }
+}
 
 TEST(EstimateNormals, DISABLED_ComputeNormal) { NotImplemented(); }
 
@@ -0,0 +1,218 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static geometry::PointCloud CreateRandomPointCloud(int size) {
+    geometry::PointCloud pc;
+    pc.points_.resize(size);
+    pc.colors_.resize(size);
+    Rand(pc.points_, Eigen::Vector3d(-2, -1, 0), Eigen::Vector3d(3, 2, 1), 0);
+    Rand(pc.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    return pc;
+}
+
+// Maps the origin of every internal node to its point indices.
+static std::map<std::vector<double>, std::vector<size_t>> GetInternalIndices(
+        const geometry::Octree& octree) {
+    std::map<std::vector<double>, std::vector<size_t>> result;
+    octree.Traverse([&](const std::shared_ptr<geometry::OctreeNode>& node,
+                        const std::shared_ptr<geometry::OctreeNodeInfo>& info)
+                            -> bool {
+        if (auto internal_node = std::dynamic_pointer_cast<
+                    geometry::OctreeInternalPointNode>(node)) {
+            result[{info->origin_(0), info->origin_(1), info->origin_(2),
+                    info->size_}] = internal_node->indices_;
+        }
+        return false;
+    });
+    return result;
+}
+
+TEST(LinearOctree, MortonCode) {
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(1, 0, 0), 1u);
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(0, 1, 0), 2u);
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(0, 0, 1), 4u);
+    EXPECT_EQ(geometry::LinearOctree::EncodeMorton(3, 0, 0), 9u);
+    for (uint32_t v : {0u, 1u, 12345u, 0x1fffffu}) {
+        uint64_t code = geometry::LinearOctree::EncodeMorton(v, v / 2, v / 3);
+        uint32_t x, y, z;
+        geometry::LinearOctree::DecodeMorton(code, x, y, z);
+        EXPECT_EQ(x, v);
+        EXPECT_EQ(y, v / 2);
+        EXPECT_EQ(z, v / 3);
+    }
+}
+
+TEST(LinearOctree, EmptyPointCloud) {
+    geometry::LinearOctree octree(4);
+    octree.ConvertFromPointCloud(geometry::PointCloud());
+    EXPECT_TRUE(octree.IsEmpty());
+    EXPECT_EQ(octree.GetNumNodes(0), 0u);
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(0, 0, 0)), -1);
+    EXPECT_TRUE(octree.ToOctree()->IsEmpty());
+}
+
+TEST(LinearOctree, ZeroDepth) {
+    geometry::PointCloud pc = CreateRandomPointCloud(10);
+    geometry::LinearOctree octree(0);
+    octree.ConvertFromPointCloud(pc);
+    EXPECT_EQ(octree.node_codes_.size(), 1u);
+    EXPECT_EQ(octree.point_indices_.size(), 10u);
+    ExpectEQ(octree.leaf_colors_[0], pc.colors_[9]);
+
+    geometry::Octree ref_octree(0);
+    ref_octree.ConvertFromPointCloud(pc);
+    EXPECT_TRUE(*octree.ToOctree() == ref_octree);
+}
+
+TEST(LinearOctree, MaxDepthTooLarge) {
+    geometry::PointCloud pc = CreateRandomPointCloud(10);
+    geometry::LinearOctree octree(geometry::LinearOctree::kMaxDepth + 1);
+    EXPECT_ANY_THROW(octree.ConvertFromPointCloud(pc));
+}
+
+TEST(LinearOctree, ConvertFromPointCloudMatchesOctree) {
+    geometry::PointCloud pc = CreateRandomPointCloud(5000);
+    // Include duplicates and points on node boundaries.
+    pc.points_.push_back(pc.points_[7]);
+    pc.colors_.push_back(Eigen::Vector3d(0.5, 0.5, 0.5));
+    pc.points_.push_back(Eigen::Vector3d(0.5, 0.5, 0.5));
+    pc.colors_.push_back(Eigen::Vector3d(1, 0, 0));
+
+    for (size_t max_depth : {1, 3, 6}) {
+        geometry::LinearOctree octree(max_depth);
+        octree.ConvertFromPointCloud(pc, 0.01);
+        geometry::Octree ref_octree(max_depth);
+        ref_octree.ConvertFromPointCloud(pc, 0.01);
+
+        auto converted = octree.ToOctree();
+        EXPECT_TRUE(*converted == ref_octree);
+        EXPECT_EQ(GetInternalIndices(*converted),
+                  GetInternalIndices(ref_octree));
+        EXPECT_EQ(octree.level_offsets_.size(), max_depth + 2);
+        EXPECT_EQ(octree.GetNumNodes(0), 1u);
+        EXPECT_EQ(octree.GetNumNodes(max_depth + 1), 0u);
+        EXPECT_EQ(octree.point_indices_.size(), pc.points_.size());
+    }
+}
+
+TEST(LinearOctree, LocateLeafNode) {
+    geometry::PointCloud pc = CreateRandomPointCloud(2000);
+    geometry::LinearOctree octree(5);
+    octree.ConvertFromPointCloud(pc);
+    geometry::Octree ref_octree(5);
+    ref_octree.ConvertFromPointCloud(pc);
+
+    for (size_t idx = 0; idx < pc.points_.size(); idx += 7) {
+        int64_t leaf = octree.LocateLeafNode(pc.points_[idx]);
+        ASSERT_GE(leaf, 0);
+        EXPECT_EQ(octree.GetNodeDepth(leaf), 5u);
+        auto begin = octree.point_indices_.begin() +
+                     octree.node_point_begins_[leaf];
+        auto end =
+                octree.point_indices_.begin() + octree.node_point_ends_[leaf];
+        EXPECT_NE(std::find(begin, end, idx), end);
+
+        geometry::OctreeNodeInfo info = octree.GetNodeInfo(leaf);
+        auto ref_info = ref_octree.LocateLeafNode(pc.points_[idx]).second;
+        ExpectEQ(info.origin_, ref_info->origin_);
+        EXPECT_EQ(info.size_, ref_info->size_);
+        EXPECT_EQ(info.depth_, ref_info->depth_);
+        EXPECT_EQ(info.child_index_, ref_info->child_index_);
+    }
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(10, 10, 10)), -1);
+}
+
+TEST(LinearOctree, GetNeighborLeafNodes) {
+    geometry::PointCloud pc = CreateRandomPointCloud(1000);
+    geometry::LinearOctree octree(4);
+    octree.ConvertFromPointCloud(pc);
+
+    const size_t leaf_begin = octree.level_offsets_[4];
+    const size_t leaf_end = octree.level_offsets_[5];
+    for (size_t leaf = leaf_begin; leaf < leaf_end; leaf += 5) {
+        uint32_t x, y, z;
+        geometry::LinearOctree::DecodeMorton(octree.node_codes_[leaf], x, y,
+                                             z);
+        std::vector<size_t> ref_neighbors;
+        for (size_t other = leaf_begin; other < leaf_end; ++other) {
+            uint32_t ox, oy, oz;
+            geometry::LinearOctree::DecodeMorton(octree.node_codes_[other], ox,
+                                                 oy, oz);
+            if (other != leaf && std::abs(int(ox) - int(x)) <= 1 &&
+                std::abs(int(oy) - int(y)) <= 1 &&
+                std::abs(int(oz) - int(z)) <= 1) {
+                ref_neighbors.push_back(other);
+            }
+        }
+        std::vector<size_t> neighbors = octree.GetNeighborLeafNodes(leaf);
+        std::sort(neighbors.begin(), neighbors.end());
+        EXPECT_EQ(neighbors, ref_neighbors);
+    }
+}
+
+TEST(LinearOctree, SearchRadius) {
+    geometry::PointCloud pc = CreateRandomPointCloud(3000);
+    geometry::LinearOctree octree(4);
+    octree.ConvertFromPointCloud(pc);
+
+    const Eigen::Vector3d query(0.5, 0.3, 0.6);
+    const double radius = 0.7;
+    std::vector<size_t> indices;
+    std::vector<double> distance2;
+    int result = octree.SearchRadius(query, radius, indices, distance2);
+    EXPECT_EQ(result, int(indices.size()));
+    EXPECT_EQ(indices.size(), distance2.size());
+
+    std::vector<size_t> ref_indices;
+    for (size_t idx = 0; idx < pc.points_.size(); ++idx) {
+        if ((pc.points_[idx] - query).squaredNorm() <= radius * radius) {
+            ref_indices.push_back(idx);
+        }
+    }
+    EXPECT_GT(ref_indices.size(), 0u);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        EXPECT_NEAR(distance2[i],
+                    (pc.points_[indices[i]] - query).squaredNorm(), 1e-12);
+    }
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(indices, ref_indices);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/geometry/NeighborhoodCache.h"
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static void ExpectMatchesKDTreeFlann(
+        const geometry::PointCloud &pc,
+        const geometry::KDTreeSearchParam &search_param) {
+    geometry::NeighborhoodCache cache(pc, search_param);
+    EXPECT_EQ(cache.GetSearchType(), search_param.GetSearchType());
+    ASSERT_EQ(cache.GetNumPoints(), int64_t(pc.points_.size()));
+
+    geometry::KDTreeFlann kdtree(pc);
+    for (size_t i = 0; i < pc.points_.size(); ++i) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        kdtree.Search(pc.points_[i], search_param, indices, distance2);
+        ASSERT_EQ(cache.GetNumNeighbors(i), int(indices.size()));
+        EXPECT_EQ(std::vector<int>(cache.GetNeighbors(i),
+                                   cache.GetNeighbors(i) + indices.size()),
+                  indices);
+        EXPECT_EQ(std::vector<double>(cache.GetDistances2(i),
+                                      cache.GetDistances2(i) + indices.size()),
+                  distance2);
+    }
+}
+
+TEST(NeighborhoodCache, MatchesKDTreeFlann) {
+    geometry::PointCloud pc;
+    pc.points_.resize(500);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+
+    ExpectMatchesKDTreeFlann(pc, geometry::KDTreeSearchParamKNN(10));
+    ExpectMatchesKDTreeFlann(pc, geometry::KDTreeSearchParamRadius(1.5));
+    ExpectMatchesKDTreeFlann(pc, geometry::KDTreeSearchParamHybrid(1.5, 5));
+
+    geometry::NeighborhoodCache cache(
+            pc, geometry::KDTreeSearchParamHybrid(1.5, 5));
+    EXPECT_EQ(cache.GetRadius(), 1.5);
+    EXPECT_EQ(cache.GetMaxNN(), 5);
+}
+
+TEST(NeighborhoodCache, Empty) {
+    geometry::NeighborhoodCache cache;
+    EXPECT_EQ(cache.GetNumPoints(), 0);
+
+    cache.Compute(geometry::PointCloud(), geometry::KDTreeSearchParamKNN());
+    EXPECT_EQ(cache.GetNumPoints(), 0);
+    EXPECT_TRUE(cache.indices_.empty());
+}
+
+}  // namespace tests
+}  // namespace open3d
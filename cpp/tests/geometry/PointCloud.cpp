@@ -31,6 +31,7 @@
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/Image.h"
+#include "open3d/geometry/NeighborhoodCache.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/ImageIO.h"
@@ -594,6 +595,71 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+TEST(PointCloud, VoxelDownSampleReductions) {
+    // voxel_size: 1, voxel_min_bound: (0, 0, 0)
+    // voxel_{0, 0, 0}: points 0, 2, 4; voxel_{1, 0, 0}: points 1, 3
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0.9, 0.9, 0.9},
+                   {1.9, 0.6, 0.5},
+                   {0.5, 0.5, 0.5},
+                   {1.4, 0.6, 0.6},
+                   {0.6, 0.8, 0.7}};
+    pcd.colors_ = {{0.0, 0.0, 0.0},
+                   {0.1, 0.0, 0.0},
+                   {0.2, 0.0, 0.0},
+                   {0.3, 0.0, 0.0},
+                   {0.4, 0.0, 0.0}};
+
+    auto pc_first = pcd.VoxelDownSample(1.0, geometry::VoxelReduction::First);
+    ExpectEQ(pc_first->points_,
+             std::vector<Eigen::Vector3d>({{0.9, 0.9, 0.9}, {1.9, 0.6, 0.5}}));
+    ExpectEQ(pc_first->colors_,
+             std::vector<Eigen::Vector3d>({{0.0, 0.0, 0.0}, {0.1, 0.0, 0.0}}));
+
+    auto pc_closest = pcd.VoxelDownSample(
+            1.0, geometry::VoxelReduction::ClosestToCenter);
+    ExpectEQ(pc_closest->points_,
+             std::vector<Eigen::Vector3d>({{0.5, 0.5, 0.5}, {1.4, 0.6, 0.6}}));
+    ExpectEQ(pc_closest->colors_,
+             std::vector<Eigen::Vector3d>({{0.2, 0.0, 0.0}, {0.3, 0.0, 0.0}}));
+
+    auto pc_median = pcd.VoxelDownSample(1.0, geometry::VoxelReduction::Median);
+    ExpectEQ(pc_median->points_, std::vector<Eigen::Vector3d>(
+                                         {{0.6, 0.8, 0.7}, {1.65, 0.6, 0.55}}));
+    ExpectEQ(pc_median->colors_,
+             std::vector<Eigen::Vector3d>({{0.2, 0.0, 0.0}, {0.2, 0.0, 0.0}}));
+}
+
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0.2, 0.2, 0.2},
+                   {1.7, 0.2, 0.2},
+                   {0.8, 0.2, 0.2},
+                   {0.3, 0.3, 0.3}};
+    pcd.colors_ = {{1, 1, 1}, {2, 2, 2}, {3, 3, 3}, {1, 1, 1}};
+
+    std::shared_ptr<geometry::PointCloud> pc_down;
+    Eigen::MatrixXi cubic_id;
+    std::vector<std::vector<int>> original_indices;
+    std::tie(pc_down, cubic_id, original_indices) =
+            pcd.VoxelDownSampleAndTrace(1.0, Eigen::Vector3d(0, 0, 0),
+                                        Eigen::Vector3d(2, 1, 1), true);
+
+    ExpectEQ(pc_down->points_,
+             std::vector<Eigen::Vector3d>({{1.3 / 3, 0.7 / 3, 0.7 / 3},
+                                           {1.7, 0.2, 0.2}}));
+    // The most frequent class of each voxel.
+    ExpectEQ(pc_down->colors_,
+             std::vector<Eigen::Vector3d>({{1, 1, 1}, {2, 2, 2}}));
+    // The last point of each octant of each voxel.
+    Eigen::MatrixXi cubic_id_ref(2, 8);
+    cubic_id_ref << 3, 2, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1,
+            -1;
+    EXPECT_EQ(cubic_id, cubic_id_ref);
+    EXPECT_EQ(original_indices,
+              std::vector<std::vector<int>>({{0, 2, 3}, {1}}));
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -721,6 +787,30 @@ TEST(PointCloud, Crop_OrientedBoundingBox) {
                                }));
 }
 
+TEST(PointCloud, RemoveRadiusOutliers) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(500);
+    Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+
+    std::vector<size_t> indices;
+    std::tie(std::ignore, indices) = pcd.RemoveRadiusOutliers(3, 1.5);
+    EXPECT_GT(indices.size(), 0u);
+    EXPECT_LT(indices.size(), pcd.points_.size());
+
+    std::shared_ptr<geometry::PointCloud> pcd_cached;
+    std::vector<size_t> indices_cached;
+    std::tie(pcd_cached, indices_cached) = pcd.RemoveRadiusOutliers(
+            3, geometry::NeighborhoodCache(
+                       pcd, geometry::KDTreeSearchParamRadius(1.5)));
+    EXPECT_EQ(indices_cached, indices);
+    EXPECT_EQ(pcd_cached->points_.size(), indices.size());
+
+    EXPECT_ANY_THROW(pcd.RemoveRadiusOutliers(
+            3, geometry::NeighborhoodCache(
+                       pcd, geometry::KDTreeSearchParamKNN(10))));
+}
+
 TEST(PointCloud, EstimateNormals) {
     geometry::PointCloud pcd({
             {0, 0, 0},
@@ -745,6 +835,32 @@ TEST(PointCloud, EstimateNormals) {
                                                          {v, v, v}}));
 }
 
+TEST(PointCloud, EstimateNormalsFromCache) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(500);
+    Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::PointCloud pcd_cached = pcd;
+
+    const geometry::KDTreeSearchParamHybrid search_param(2.0, 20);
+    pcd.EstimateNormals(search_param);
+    geometry::NeighborhoodCache neighborhoods(pcd_cached, search_param);
+    pcd_cached.EstimateNormals(neighborhoods);
+    ExpectEQ(pcd_cached.normals_, pcd.normals_);
+
+    // Existing normals orient the new ones.
+    for (Eigen::Vector3d &normal : pcd_cached.normals_) {
+        normal = -normal;
+    }
+    pcd_cached.EstimateNormals(neighborhoods);
+    for (Eigen::Vector3d &normal : pcd_cached.normals_) {
+        normal = -normal;
+    }
+    ExpectEQ(pcd_cached.normals_, pcd.normals_);
+
+    EXPECT_ANY_THROW(geometry::PointCloud().EstimateNormals(neighborhoods));
+}
+
 TEST(PointCloud, OrientNormalsToAlignWithDirection) {
     geometry::PointCloud pcd({
             {0, 0, 0},
@@ -855,6 +971,43 @@ TEST(PointCloud, OrientNormalsConsistentTangentPlane) {
                                                          {c, -b, -b}}));
 }
 
+TEST(PointCloud, OrientNormalsConsistentTangentPlaneComponents) {
+    // Two planar grids far apart form separate components of the kNN graph,
+    // and each one is oriented from its own highest point.
+    geometry::PointCloud pcd;
+    for (int plane = 0; plane < 2; ++plane) {
+        for (int i = 0; i < 5; ++i) {
+            for (int j = 0; j < 5; ++j) {
+                pcd.points_.push_back(Eigen::Vector3d(100 * plane + i, j, 0));
+                pcd.normals_.push_back(
+                        Eigen::Vector3d(0, 0, (i + j) % 2 ? 1 : -1));
+            }
+        }
+    }
+
+    pcd.OrientNormalsConsistentTangentPlane(/*k=*/4);
+    ExpectEQ(pcd.normals_, std::vector<Eigen::Vector3d>(pcd.points_.size(),
+                                                        {0, 0, 1}));
+}
+
+TEST(PointCloud, OrientNormalsConsistentTangentPlaneSphere) {
+    // Normals of a sphere with flipped signs are oriented outwards, as the
+    // highest point is oriented towards +z.
+    const int n = 1000;
+    geometry::PointCloud pcd;
+    for (int i = 0; i < n; ++i) {
+        const double z = 1 - 2 * (i + 0.5) / n;
+        const double r = std::sqrt(1 - z * z);
+        const double phi = i * M_PI * (3 - std::sqrt(5.0));
+        const Eigen::Vector3d point(r * std::cos(phi), r * std::sin(phi), z);
+        pcd.points_.push_back(point);
+        pcd.normals_.push_back(i % 3 == 0 ? -point : point);
+    }
+
+    pcd.OrientNormalsConsistentTangentPlane(/*k=*/10);
+    ExpectEQ(pcd.normals_, pcd.points_);
+}
+
 TEST(PointCloud, ComputePointCloudToPointCloudDistance) {
     geometry::PointCloud pc0({{0, 0, 0}, {1, 2, 0}, {2, 2, 0}});
     geometry::PointCloud pc1({{-1, 0, 0}, {-2, 0, 0}, {-1, 2, 0}});
@@ -1021,6 +1174,73 @@ TEST(PointCloud, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+// Sequential DBSCAN with brute force neighbor search, as a reference.
+static std::vector<int> ClusterDBSCANReference(
+        const std::vector<Eigen::Vector3d> &points,
+        double eps,
+        size_t min_points) {
+    std::vector<std::vector<int>> nbs(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (size_t j = 0; j < points.size(); ++j) {
+            if ((points[i] - points[j]).squaredNorm() < eps * eps) {
+                nbs[i].push_back(int(j));
+            }
+        }
+    }
+    std::vector<int> labels(points.size(), -2);
+    int cluster_label = 0;
+    for (size_t idx = 0; idx < points.size(); ++idx) {
+        if (labels[idx] != -2) continue;
+        if (nbs[idx].size() < min_points) {
+            labels[idx] = -1;
+            continue;
+        }
+        labels[idx] = cluster_label;
+        std::vector<int> queue(nbs[idx]);
+        while (!queue.empty()) {
+            int nb = queue.back();
+            queue.pop_back();
+            if (labels[nb] == -1) labels[nb] = cluster_label;
+            if (labels[nb] != -2) continue;
+            labels[nb] = cluster_label;
+            if (nbs[nb].size() >= min_points) {
+                queue.insert(queue.end(), nbs[nb].begin(), nbs[nb].end());
+            }
+        }
+        cluster_label++;
+    }
+    return labels;
+}
+
+TEST(PointCloud, ClusterDBSCANMatchesSequential) {
+    // Blobs of different densities and uniform noise.
+    geometry::PointCloud pcd;
+    std::vector<Eigen::Vector3d> noise(300);
+    Rand(noise, Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(10.0), 0);
+    for (int b = 0; b < 6; ++b) {
+        std::vector<Eigen::Vector3d> blob(100 * (b + 1));
+        Rand(blob, Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(b + 1.0),
+             b + 1);
+        for (auto &point : blob) {
+            point += Eigen::Vector3d(b * 1.5, (b % 2) * 4.0, (b % 3) * 3.0);
+        }
+        pcd.points_.insert(pcd.points_.end(), blob.begin(), blob.end());
+        pcd.points_.insert(pcd.points_.begin() + b * 50, noise.begin() + b * 50,
+                           noise.begin() + (b + 1) * 50);
+    }
+
+    for (double eps : {0.1, 0.3, 0.5, 1.0}) {
+        for (size_t min_points : {0, 1, 4, 10}) {
+            EXPECT_EQ(pcd.ClusterDBSCAN(eps, min_points),
+                      ClusterDBSCANReference(pcd.points_, eps, min_points));
+        }
+    }
+
+    EXPECT_EQ(geometry::PointCloud().ClusterDBSCAN(0.1, 10),
+              std::vector<int>());
+    EXPECT_EQ(pcd.ClusterDBSCAN(0.0, 1), std::vector<int>(2400, -1));
+}
+
 TEST(PointCloud, SegmentPlane) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd);
@@ -1050,6 +1270,82 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlaneCollinear) {
+    // Every hypothesis is degenerate.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 10; ++i) {
+        pcd.points_.push_back(Eigen::Vector3d(i, 2.0 * i, 0.5 * i));
+    }
+
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 3, 100);
+    ExpectEQ(plane_model, Eigen::Vector4d(0, 0, 0, 0));
+    EXPECT_TRUE(inliers.empty());
+    EXPECT_TRUE(pcd.SegmentPlanes(3, 0.01, 3, 100).empty());
+}
+
+TEST(PointCloud, SegmentPlaneLarge) {
+    // More points than are used for preemptive scoring: a plane z = 1 and
+    // uniform noise.
+    std::vector<Eigen::Vector3d> plane(12000);
+    Rand(plane, Eigen::Vector3d(0, 0, 1), Eigen::Vector3d(10, 10, 1), 0);
+    std::vector<Eigen::Vector3d> noise(8000);
+    Rand(noise, Eigen::Vector3d(0, 0, 2), Eigen::Vector3d(10, 10, 12), 1);
+    geometry::PointCloud pcd(plane);
+    pcd.points_.insert(pcd.points_.end(), noise.begin(), noise.end());
+
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 3, 1000);
+    if (plane_model(2) < 0) plane_model = -plane_model;
+    ExpectEQ(plane_model, Eigen::Vector4d(0, 0, 1, -1), 1e-6);
+    ASSERT_EQ(inliers.size(), plane.size());
+    for (size_t i = 0; i < inliers.size(); ++i) {
+        EXPECT_EQ(inliers[i], i);
+    }
+}
+
+TEST(PointCloud, SegmentPlanes) {
+    // A floor z = 0 and a wall x = 0, interleaved, and sparse noise.
+    std::vector<Eigen::Vector3d> floor(8000);
+    Rand(floor, Eigen::Vector3d(0.5, 0, 0), Eigen::Vector3d(10, 10, 0), 0);
+    std::vector<Eigen::Vector3d> wall(6000);
+    Rand(wall, Eigen::Vector3d(0, 0, 0.5), Eigen::Vector3d(0, 10, 10), 1);
+    std::vector<Eigen::Vector3d> noise(1000);
+    Rand(noise, Eigen::Vector3d(1, 1, 1), Eigen::Vector3d(10, 10, 10), 2);
+    geometry::PointCloud pcd;
+    for (size_t i = 0; i < floor.size(); ++i) {
+        pcd.points_.push_back(floor[i]);
+        if (i < wall.size()) pcd.points_.push_back(wall[i]);
+    }
+    pcd.points_.insert(pcd.points_.end(), noise.begin(), noise.end());
+
+    auto planes = pcd.SegmentPlanes(3, 0.01, 3, 1000);
+    ASSERT_EQ(planes.size(), 3u);
+    const std::vector<Eigen::Vector4d> expected_models = {
+            Eigen::Vector4d(0, 0, 1, 0), Eigen::Vector4d(1, 0, 0, 0)};
+    const std::vector<size_t> expected_sizes = {floor.size(), wall.size()};
+    std::vector<int> counts(pcd.points_.size(), 0);
+    for (size_t p = 0; p < planes.size(); ++p) {
+        Eigen::Vector4d plane_model = std::get<0>(planes[p]);
+        const std::vector<size_t> &inliers = std::get<1>(planes[p]);
+        EXPECT_GE(inliers.size(), 3u);
+        for (size_t idx : inliers) {
+            ++counts[idx];
+        }
+        if (p < expected_models.size()) {
+            if (plane_model.head<3>().sum() < 0) plane_model = -plane_model;
+            ExpectEQ(plane_model, expected_models[p], 1e-6);
+            EXPECT_EQ(inliers.size(), expected_sizes[p]);
+        }
+    }
+    // Every point belongs to at most one plane.
+    EXPECT_EQ(*std::max_element(counts.begin(), counts.end()), 1);
+
+    EXPECT_TRUE(pcd.SegmentPlanes(0).empty());
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log";
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/io/LZFCompression.h"
+
+#include <cstdio>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(LZFCompression, WriteLZFStream) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_lzf_stream.bin";
+    // Compressible data whose size is not a multiple of the chunk size.
+    std::vector<uint8_t> data(1000003);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>((i / 7) % 251);
+    }
+    for (int64_t chunk_size : {int64_t(1) << 20, int64_t(4096), int64_t(13)}) {
+        FILE *file = fopen(file_name.c_str(), "wb");
+        const int64_t compressed_size = io::WriteLZFStream(
+                file, data.size(),
+                [&](int64_t offset, int64_t size, uint8_t *dst) {
+                    std::copy(data.begin() + offset,
+                              data.begin() + offset + size, dst);
+                },
+                chunk_size);
+        fclose(file);
+        EXPECT_GT(compressed_size, 0);
+
+        std::vector<char> compressed;
+        EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, compressed,
+                                                       nullptr));
+        EXPECT_EQ(static_cast<int64_t>(compressed.size()), compressed_size);
+        std::vector<uint8_t> decompressed(data.size());
+        EXPECT_TRUE(io::DecompressLZF(
+                reinterpret_cast<const uint8_t *>(compressed.data()),
+                compressed.size(), decompressed.data(), decompressed.size()));
+        EXPECT_EQ(decompressed, data);
+
+        // The uncompressed size must match exactly.
+        decompressed.resize(data.size() + 1);
+        EXPECT_FALSE(io::DecompressLZF(
+                reinterpret_cast<const uint8_t *>(compressed.data()),
+                compressed.size(), decompressed.data(), decompressed.size()));
+    }
+    std::remove(file_name.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -29,10 +29,14 @@
 #include <json/json.h>
 
 #include <cstdio>
+#include <cstring>
+#include <vector>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/Octree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/IJsonConvertible.h"
 #include "tests/UnitTest.h"
 
@@ -105,5 +109,59 @@ TEST(OctreeIO, JsonFileIOSevenCubes) {
     WriteReadAndAssertEqual(octree);
 }
 
+TEST(OctreeIO, LinearOctreeBinary) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    pcd.colors_.resize(1000);
+    Rand(pcd.points_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 2, 3), 0);
+    Rand(pcd.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    geometry::LinearOctree src_octree(5);
+    src_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::string file_name = std::string(TEST_DATA_DIR) + "/temp_octree.lot";
+    EXPECT_TRUE(io::WriteLinearOctree(file_name, src_octree));
+    geometry::LinearOctree dst_octree;
+    EXPECT_TRUE(io::ReadLinearOctree(file_name, dst_octree));
+    std::vector<char> bytes;
+    EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, bytes, nullptr));
+    EXPECT_EQ(std::remove(file_name.c_str()), 0);
+
+    EXPECT_EQ(dst_octree.max_depth_, src_octree.max_depth_);
+    ExpectEQ(dst_octree.origin_, src_octree.origin_);
+    EXPECT_EQ(dst_octree.size_, src_octree.size_);
+    EXPECT_EQ(dst_octree.level_offsets_, src_octree.level_offsets_);
+    EXPECT_EQ(dst_octree.node_codes_, src_octree.node_codes_);
+    EXPECT_EQ(dst_octree.point_indices_, src_octree.point_indices_);
+    EXPECT_TRUE(*dst_octree.ToOctree() == *src_octree.ToOctree());
+
+    // Truncated files are rejected.
+    std::string bad_file_name =
+            std::string(TEST_DATA_DIR) + "/temp_octree_bad.lot";
+    FILE *file = fopen(bad_file_name.c_str(), "wb");
+    fwrite("O3DLOCT1", 1, 8, file);
+    fclose(file);
+    EXPECT_FALSE(io::ReadLinearOctree(bad_file_name, dst_octree));
+    EXPECT_TRUE(dst_octree.IsEmpty());
+
+    // The level offsets array follows the magic, origin, size and max depth.
+    // Corrupting its size or its entries is detected.
+    auto write_corrupted = [&](size_t offset, uint64_t value) {
+        std::vector<char> corrupted = bytes;
+        std::memcpy(corrupted.data() + offset, &value, sizeof(value));
+        FILE *fp = fopen(bad_file_name.c_str(), "wb");
+        fwrite(corrupted.data(), 1, corrupted.size(), fp);
+        fclose(fp);
+    };
+    const size_t level_offsets_size_offset = 48;
+    write_corrupted(level_offsets_size_offset, uint64_t(1) << 60);
+    EXPECT_FALSE(io::ReadLinearOctree(bad_file_name, dst_octree));
+    EXPECT_TRUE(dst_octree.IsEmpty());
+    write_corrupted(level_offsets_size_offset + 8 * 3,
+                    src_octree.node_codes_.size() + 1);
+    EXPECT_FALSE(io::ReadLinearOctree(bad_file_name, dst_octree));
+    EXPECT_TRUE(dst_octree.IsEmpty());
+    EXPECT_EQ(std::remove(bad_file_name.c_str()), 0);
+}
+
 }  // namespace tests
 }  // namespace open3d
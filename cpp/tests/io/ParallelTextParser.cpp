@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/io/ParallelTextParser.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ParallelTextParser, ParseNumber) {
+    const std::vector<std::string> numbers = {
+            "0",
+            "-0",
+            "1",
+            "-12.5",
+            "+3.25",
+            "0.1",
+            ".5",
+            "5.",
+            "1e10",
+            "1.5E-7",
+            "-2e+3",
+            "123456789012345678901234",
+            "0.30000000000000004441",
+            "3.14159265358979323846",
+            "9007199254740993",
+            "1e-320",
+            "1e400",
+            "0x1p3",
+            "inf",
+            "-nan"};
+    for (const std::string &number : numbers) {
+        const std::string text = "  " + number + " tail";
+        const char *pos = text.c_str();
+        double value = 0;
+        EXPECT_TRUE(io::ParseNumber(pos, text.c_str() + text.size(), value))
+                << number;
+        const double expected = std::strtod(number.c_str(), nullptr);
+        if (std::isnan(expected)) {
+            EXPECT_TRUE(std::isnan(value));
+        } else {
+            EXPECT_EQ(value, expected) << number;
+        }
+        EXPECT_EQ(std::string(pos), " tail") << number;
+    }
+
+    const std::vector<std::string> invalid = {"", "  ", "-", ".", "abc", "e5"};
+    for (const std::string &text : invalid) {
+        const char *pos = text.c_str();
+        double value = 0;
+        EXPECT_FALSE(io::ParseNumber(pos, text.c_str() + text.size(), value))
+                << text;
+    }
+
+    // The end of the range is respected.
+    const std::string text = "1234";
+    const char *pos = text.c_str();
+    double value = 0;
+    EXPECT_TRUE(io::ParseNumber(pos, text.c_str() + 2, value));
+    EXPECT_EQ(value, 12);
+}
+
+TEST(ParallelTextParser, ParseLinesInParallel) {
+    // Enough lines to be split into several ranges, with skipped lines.
+    std::string text;
+    const int num_lines = 200000;
+    for (int i = 0; i < num_lines; ++i) {
+        text += i % 7 == 0 ? "skip\r\n" : std::to_string(i) + " 0.5\r\n";
+    }
+    text += "200000 0.5";
+
+    const std::vector<double> rows = io::ParseLinesInParallel<double>(
+            text.c_str(), text.c_str() + text.size(),
+            [](const char *pos, const char *end, double &row) {
+                double half;
+                return io::ParseNumber(pos, end, row) &&
+                       io::ParseNumber(pos, end, half) && half == 0.5 &&
+                       !io::SkipToken(pos, end);
+            });
+    std::vector<double> expected;
+    for (int i = 0; i <= num_lines; ++i) {
+        if (i % 7 != 0) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(rows, expected);
+}
+
+TEST(ParallelTextParser, SplitTextAtLines) {
+    const std::string text = "aaaa\nbbbb\ncccc\ndd";
+    const char *begin = text.c_str();
+    const char *end = begin + text.size();
+    const std::vector<const char *> bounds =
+            io::SplitTextAtLines(begin, end, 6);
+    ASSERT_EQ(bounds.size(), 3u);
+    EXPECT_EQ(bounds[0], begin);
+    EXPECT_EQ(bounds[1], begin + 10);
+    EXPECT_EQ(bounds[2], end);
+
+    EXPECT_EQ(io::SplitTextAtLines(begin, begin, 6).size(), 2u);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Feature.h"
+
+#include "open3d/geometry/NeighborhoodCache.h"
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -37,6 +41,25 @@ TEST(Feature, DISABLED_Num) { NotImplemented(); }
 
 TEST(Feature, DISABLED_ComputeFPFHFeature) { NotImplemented(); }
 
+TEST(Feature, ComputeFPFHFeatureFromCache) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(300);
+    Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    const geometry::KDTreeSearchParamHybrid search_param(2.5, 30);
+    geometry::NeighborhoodCache neighborhoods(pcd, search_param);
+    pcd.EstimateNormals(neighborhoods);
+
+    auto feature =
+            pipelines::registration::ComputeFPFHFeature(pcd, search_param);
+    auto feature_cached =
+            pipelines::registration::ComputeFPFHFeature(pcd, neighborhoods);
+    EXPECT_EQ(feature_cached->Dimension(), 33u);
+    EXPECT_EQ(feature_cached->Num(), pcd.points_.size());
+    EXPECT_TRUE(feature_cached->data_ == feature->data_);
+    EXPECT_GT(feature_cached->data_.norm(), 0.0);
+}
+
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { NotImplemented(); }
 
 }  // namespace tests
@@ -646,5 +646,101 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, VoxelDownSampleReductions) {
+    core::Device device = GetParam();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        t::geometry::PointCloud pcd(
+                core::Tensor::Init<float>({{0.5, 0.5, 0.5}}, device));
+        EXPECT_ANY_THROW(
+                pcd.VoxelDownSample(1, geometry::VoxelReduction::Mean));
+        return;
+    }
+
+    // voxel_{0, 0, 0}: points 0, 2, 4; voxel_{1, 0, 0}: points 1, 3
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<float>({{0.9, 0.9, 0.9},
+                                       {1.9, 0.6, 0.5},
+                                       {0.5, 0.5, 0.5},
+                                       {1.4, 0.6, 0.6},
+                                       {0.6, 0.8, 0.7}},
+                                      device));
+    pcd.SetPointAttr("labels",
+                     core::Tensor::Init<int32_t>({1, 2, 3, 4, 6}, device));
+
+    auto pcd_first = pcd.VoxelDownSample(1, geometry::VoxelReduction::First);
+    EXPECT_TRUE(pcd_first.GetPoints().AllClose(core::Tensor::Init<float>(
+            {{0.9, 0.9, 0.9}, {1.9, 0.6, 0.5}}, device)));
+    EXPECT_EQ(pcd_first.GetPointAttr("labels").ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2}));
+
+    auto pcd_closest = pcd.VoxelDownSample(
+            1, geometry::VoxelReduction::ClosestToCenter);
+    EXPECT_TRUE(pcd_closest.GetPoints().AllClose(core::Tensor::Init<float>(
+            {{0.5, 0.5, 0.5}, {1.4, 0.6, 0.6}}, device)));
+    EXPECT_EQ(pcd_closest.GetPointAttr("labels").ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 4}));
+
+    auto pcd_median = pcd.VoxelDownSample(1, geometry::VoxelReduction::Median);
+    EXPECT_TRUE(pcd_median.GetPoints().AllClose(core::Tensor::Init<float>(
+            {{0.6, 0.8, 0.7}, {1.65, 0.6, 0.55}}, device)));
+    EXPECT_EQ(pcd_median.GetPointAttr("labels").ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 3}));
+
+    // Integer means are rounded.
+    auto pcd_mean = pcd.VoxelDownSample(1, geometry::VoxelReduction::Mean);
+    EXPECT_EQ(pcd_mean.GetPointAttr("labels").ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 3}));
+}
+
+TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
+    core::Device device = GetParam();
+
+    // Two clusters with one and two core points, their border points and a
+    // noise point.
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0.0, 0.0, 0.0},
+                                                           {5.0, 0.0, 0.0},
+                                                           {0.2, 0.0, 0.0},
+                                                           {5.2, 0.0, 0.0},
+                                                           {0.4, 0.0, 0.0},
+                                                           {5.4, 0.0, 0.0},
+                                                           {5.6, 0.0, 0.0},
+                                                           {9.0, 0.0, 0.0}},
+                                                          device));
+    core::Tensor labels = pcd.ClusterDBSCAN(0.25, 3);
+    EXPECT_EQ(labels.GetDtype(), core::Dtype::Int32);
+    EXPECT_EQ(labels.GetDevice(), device);
+    EXPECT_EQ(labels.ToFlatVector<int>(),
+              std::vector<int>({0, 1, 0, 1, 0, 1, 1, -1}));
+}
+
+TEST_P(PointCloudPermuteDevices, EstimateNormals) {
+    core::Device device = GetParam();
+
+    // A 4 x 4 grid on the plane z = 0.
+    std::vector<float> points;
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            points.insert(points.end(), {float(x), float(y), 0.0f});
+        }
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {16, 3}, core::Dtype::Float32, device));
+
+    pcd.EstimateNormals(8);
+    EXPECT_EQ(pcd.GetPointNormals().GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(pcd.GetPointNormals().GetDevice(), device);
+    EXPECT_TRUE(pcd.GetPointNormals().Abs().AllClose(
+            core::Tensor::Init<float>({{0, 0, 1}}, device).Expand({16, 3})));
+
+    // Existing normals orient the new ones.
+    pcd.SetPointNormals(core::Tensor::Init<double>({{0, 0, -1}}, device)
+                                .Expand({16, 3})
+                                .Contiguous());
+    pcd.EstimateNormals(30, 1.5);
+    EXPECT_EQ(pcd.GetPointNormals().GetDtype(), core::Dtype::Float64);
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(
+            core::Tensor::Init<double>({{0, 0, -1}}, device).Expand({16, 3})));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -53,6 +53,7 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -123,6 +124,7 @@ TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     for (auto backend : backends) {
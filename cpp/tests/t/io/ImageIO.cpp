@@ -260,6 +260,76 @@ TEST(ImageIO, DifferentDtype) {
     RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio_dtype.png");
 }
 
+TEST(ImageIO, ReadImageReuseStorage) {
+    WriteTestImage(CreateTestImage());
+    const std::string png_file =
+            std::string(TEST_DATA_DIR) + "/test_imageio.png";
+    const std::string jpg_file =
+            std::string(TEST_DATA_DIR) + "/test_imageio.jpg";
+
+    // Matching shape and dtype: decoded into the existing storage.
+    t::geometry::Image img(150, 100, 3, core::Dtype::UInt8);
+    const void *data_ptr = img.GetDataPtr();
+    EXPECT_TRUE(t::io::ReadImage(png_file, img, /*reuse_storage=*/true));
+    EXPECT_EQ(img.GetDataPtr(), data_ptr);
+    EXPECT_TRUE(img.AsTensor().AllClose(CreateTestImage().AsTensor()));
+    EXPECT_TRUE(t::io::ReadImage(jpg_file, img, /*reuse_storage=*/true));
+    EXPECT_EQ(img.GetDataPtr(), data_ptr);
+
+    // Without reuse_storage, the image is reallocated.
+    t::geometry::Image shared = img;
+    EXPECT_TRUE(t::io::ReadImage(png_file, img, /*reuse_storage=*/false));
+    EXPECT_NE(img.GetDataPtr(), data_ptr);
+    EXPECT_EQ(shared.GetDataPtr(), data_ptr);
+
+    // Mismatching shape: reallocated.
+    t::geometry::Image small(10, 100, 3, core::Dtype::UInt8);
+    EXPECT_TRUE(t::io::ReadImage(png_file, small, /*reuse_storage=*/true));
+    EXPECT_EQ(small.GetRows(), 150);
+
+    RemoveTestImage(jpg_file);
+    RemoveTestImage(png_file);
+}
+
+TEST(ImageIO, ReadImages) {
+    std::vector<std::string> filenames;
+    for (int i = 0; i < 5; ++i) {
+        filenames.push_back(fmt::format("{}/test_imageio_batch_{}.png",
+                                        TEST_DATA_DIR, i));
+        t::io::WriteImage(filenames.back(),
+                          t::geometry::Image(core::Tensor::Full(
+                                  {30, 20, 1}, uint16_t(1000 * i),
+                                  core::Dtype::UInt16)));
+    }
+
+    core::Tensor images;
+    EXPECT_TRUE(t::io::ReadImages(filenames, images));
+    EXPECT_EQ(images.GetShape(), core::SizeVector({5, 30, 20, 1}));
+    EXPECT_EQ(images.GetDtype(), core::Dtype::UInt16);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(images[i].AllClose(core::Tensor::Full(
+                {30, 20, 1}, uint16_t(1000 * i), core::Dtype::UInt16)));
+    }
+
+    // The output storage is reused for a batch of the same shape.
+    const void *data_ptr = images.GetDataPtr();
+    std::reverse(filenames.begin(), filenames.end());
+    EXPECT_TRUE(t::io::ReadImages(filenames, images));
+    EXPECT_EQ(images.GetDataPtr(), data_ptr);
+    EXPECT_EQ(images[0][0][0][0].Item<uint16_t>(), 4000);
+
+    // Images of different sizes cannot be stacked.
+    t::io::WriteImage(filenames[2],
+                      t::geometry::Image(core::Tensor::Zeros(
+                              {31, 20, 1}, core::Dtype::UInt16)));
+    EXPECT_FALSE(t::io::ReadImages(filenames, images));
+    EXPECT_FALSE(t::io::ReadImages({}, images));
+
+    for (const std::string &filename : filenames) {
+        RemoveTestImage(filename);
+    }
+}
+
 TEST(ImageIO, CornerCases) {
     EXPECT_ANY_THROW(t::io::WriteImage(
             std::string(TEST_DATA_DIR) + "/test_imageio_dtype.jpg",
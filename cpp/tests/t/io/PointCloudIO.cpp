@@ -28,6 +28,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
@@ -35,6 +38,7 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -82,6 +86,26 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"points", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test.ply",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 2
+        {"test.o3dt",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 3
+        {"test.pcd",
+         IsAscii::ASCII,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 4
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 5
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"points", 0}, {"intensities", 0}}},  // 6
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -192,6 +216,119 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// Writes a PLY file with the given header and binary body.
+static void WritePLYFile(const std::string &file_name,
+                         const std::string &header,
+                         const std::vector<uint8_t> &body) {
+    FILE *file = fopen(file_name.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(header.data(), 1, header.size(), file);
+    fwrite(body.data(), 1, body.size(), file);
+    fclose(file);
+}
+
+// Appends the bytes of value to body, in big-endian byte order.
+template <typename T>
+static void AppendBigEndian(std::vector<uint8_t> &body, T value) {
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    const uint16_t one = 1;
+    if (*reinterpret_cast<const uint8_t *>(&one) == 1) {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+    body.insert(body.end(), bytes, bytes + sizeof(T));
+}
+
+// Reading binary_big_endian with an element before the vertices and an
+// unsupported property in between the attributes.
+TEST(TPointCloudIO, ReadPointCloudFromBinaryPLY) {
+    const std::string file_name = "test_big_endian.ply";
+    const std::string header =
+            "ply\n"
+            "format binary_big_endian 1.0\n"
+            "comment Created for testing\n"
+            "element camera 1\n"
+            "property float view_px\n"
+            "property double view_py\n"
+            "element vertex 3\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "property short skipped\n"
+            "property uchar red\n"
+            "property uchar green\n"
+            "property uchar blue\n"
+            "property double quality\n"
+            "end_header\n";
+    std::vector<uint8_t> body;
+    AppendBigEndian<float>(body, 100);
+    AppendBigEndian<double>(body, 200);
+    for (int i = 0; i < 3; ++i) {
+        AppendBigEndian<float>(body, i);
+        AppendBigEndian<float>(body, i + 0.5f);
+        AppendBigEndian<float>(body, -i);
+        AppendBigEndian<int16_t>(body, 7);
+        AppendBigEndian<uint8_t>(body, 10 * i);
+        AppendBigEndian<uint8_t>(body, 10 * i + 1);
+        AppendBigEndian<uint8_t>(body, 10 * i + 2);
+        AppendBigEndian<double>(body, 0.25 * i);
+    }
+    WritePLYFile(file_name, header, body);
+
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, true}));
+    EXPECT_EQ(pcd.GetPoints().GetShape(), core::SizeVector({3, 3}));
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<float>(),
+              std::vector<float>({0, 0.5, 0, 1, 1.5, -1, 2, 2.5, -2}));
+    EXPECT_EQ(pcd.GetPointColors().GetDtype(), core::Dtype::UInt8);
+    EXPECT_EQ(pcd.GetPointColors().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({0, 1, 2, 10, 11, 12, 20, 21, 22}));
+    EXPECT_EQ(pcd.GetPointAttr("quality").GetShape(),
+              core::SizeVector({3, 1}));
+    EXPECT_EQ(pcd.GetPointAttr("quality").ToFlatVector<double>(),
+              std::vector<double>({0, 0.25, 0.5}));
+    EXPECT_FALSE(pcd.HasPointAttr("skipped"));
+    EXPECT_FALSE(pcd.HasPointAttr("red"));
+    std::remove(file_name.c_str());
+}
+
+// Reading binary PLY with a list property in the vertices, which is read
+// through rply. Its properties get the same dtypes as without the list.
+TEST(TPointCloudIO, ReadPointCloudFromBinaryPLYWithList) {
+    const std::string file_name = "test_binary_list.ply";
+    const std::string header =
+            "ply\n"
+            "format binary_big_endian 1.0\n"
+            "element vertex 2\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "property ushort intensity\n"
+            "property list uchar int ids\n"
+            "end_header\n";
+    std::vector<uint8_t> body;
+    for (int i = 0; i < 2; ++i) {
+        AppendBigEndian<float>(body, i);
+        AppendBigEndian<float>(body, 2 * i);
+        AppendBigEndian<float>(body, 3 * i);
+        AppendBigEndian<uint16_t>(body, 1000 + i);
+        AppendBigEndian<uint8_t>(body, 1);
+        AppendBigEndian<int32_t>(body, i);
+    }
+    WritePLYFile(file_name, header, body);
+
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, true}));
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 0, 1, 2, 3}));
+    EXPECT_EQ(pcd.GetPointAttr("intensity").GetDtype(), core::Dtype::UInt16);
+    EXPECT_EQ(pcd.GetPointAttr("intensity").ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({1000, 1001}));
+    std::remove(file_name.c_str());
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
@@ -313,6 +450,256 @@ TEST(TPointCloudIO, WritePTSColorConversion2) {
     std::remove(file_name.c_str());
 }
 
+TEST(TPointCloudIO, ReadWriteO3DT) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_read_write.o3dt";
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor::Init<float>({{0, 0, 0}, {1, 2, 3}, {4, 5, 6}}));
+    pcd.SetPointColors(core::Tensor::Init<uint8_t>(
+            {{255, 0, 0}, {0, 255, 0}, {0, 0, 255}}));
+    pcd.SetPointAttr("labels", core::Tensor::Init<int32_t>({7, 8, 9}));
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+    for (const std::string &key : {"points", "colors", "labels"}) {
+        SCOPED_TRACE(key);
+        const core::Tensor &expected = pcd.GetPointAttr(key);
+        const core::Tensor &actual = pcd_read.GetPointAttr(key);
+        EXPECT_EQ(actual.GetDtype(), expected.GetDtype());
+        EXPECT_EQ(actual.GetShape(), expected.GetShape());
+        EXPECT_TRUE(actual.AllClose(expected, 0, 0));
+        EXPECT_TRUE(actual.IsContiguous());
+    }
+
+    // The tensors view a private mapping: writing to them does not change the
+    // file, and they outlive the reader.
+    pcd_read.GetPoints()[0][0] = 10.0f;
+    t::geometry::PointCloud pcd_reread;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_reread,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pcd_read.GetPoints()[0][0].Item<float>(), 10.0f);
+    EXPECT_EQ(pcd_reread.GetPoints()[0][0].Item<float>(), 0.0f);
+    std::remove(file_name.c_str());
+}
+
+TEST(TPointCloudIO, WriteO3DTWhileMapped) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_write_mapped.o3dt";
+    t::geometry::PointCloud pcd(
+            core::Tensor::Ones({1000, 3}, core::Dtype::Float32));
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+
+    // Rewriting the file that the tensors map replaces it, so the mapped
+    // tensors keep their values.
+    t::geometry::PointCloud pcd_new(
+            core::Tensor::Zeros({10, 3}, core::Dtype::Float32));
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd_new));
+    EXPECT_TRUE(pcd_read.GetPoints().AllClose(pcd.GetPoints(), 0, 0));
+    t::geometry::PointCloud pcd_reread;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_reread,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pcd_reread.GetPoints().AllClose(pcd_new.GetPoints(), 0, 0));
+
+    // Writing the mapped geometry back to its own file works too.
+    pcd_reread.GetPoints()[0][0] = 5.0f;
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd_reread));
+    t::geometry::PointCloud pcd_last;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_last,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pcd_last.GetPoints().AllClose(pcd_reread.GetPoints(), 0, 0));
+    std::remove(file_name.c_str());
+}
+
+TEST(TPointCloudIO, WritePointCloudsToO3DT) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_write_parts.o3dt";
+    std::vector<t::geometry::PointCloud> parts(2);
+    parts[0].SetPoints(core::Tensor::Init<float>({{0, 0, 0}, {1, 2, 3}}));
+    parts[0].SetPointAttr("labels", core::Tensor::Init<int32_t>({7, 8}));
+    parts[1].SetPoints(core::Tensor::Init<float>({{4, 5, 6}}));
+    parts[1].SetPointAttr("labels", core::Tensor::Init<int32_t>({9}));
+    EXPECT_TRUE(t::io::WritePointCloudsToO3DT(file_name, parts, {}));
+
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pcd_read.GetPoints().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {1, 2, 3}, {4, 5, 6}}), 0,
+            0));
+    EXPECT_EQ(pcd_read.GetPointAttr("labels").ToFlatVector<int32_t>(),
+              std::vector<int32_t>({7, 8, 9}));
+
+    // Parts with different attributes are rejected.
+    parts[1].SetPointAttr("labels", core::Tensor::Init<int64_t>({9}));
+    EXPECT_FALSE(t::io::WritePointCloudsToO3DT(file_name, parts, {}));
+    std::remove(file_name.c_str());
+}
+
+TEST(TPointCloudIO, ReadO3DTInvalid) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_invalid.o3dt";
+    t::geometry::PointCloud pcd(
+            core::Tensor::Ones({100, 3}, core::Dtype::Float64));
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+
+    // Truncate the blob of the points.
+    std::vector<char> bytes;
+    EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, bytes, nullptr));
+    FILE *fp = fopen(file_name.c_str(), "wb");
+    fwrite(bytes.data(), 1, bytes.size() / 2, fp);
+    fclose(fp);
+    t::geometry::PointCloud pcd_read;
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd_read,
+                                       {"auto", false, false, false}));
+
+    // Corrupt the dtype size of the first attribute record, which follows
+    // the 32-byte file header and the attribute map, padding, key and dtype
+    // code of the record.
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+    bytes.clear();
+    EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, bytes, nullptr));
+    const int64_t byte_size = 3;
+    std::memcpy(bytes.data() + 32 + 4 + 4 + 64 + 8, &byte_size,
+                sizeof(byte_size));
+    fp = fopen(file_name.c_str(), "wb");
+    fwrite(bytes.data(), 1, bytes.size(), fp);
+    fclose(fp);
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd_read,
+                                       {"auto", false, false, false}));
+
+    // A first dimension whose byte size wraps around to that of the points.
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+    bytes.clear();
+    EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, bytes, nullptr));
+    const int64_t wrapping_dim = (int64_t(1) << 61) + 100;
+    std::memcpy(bytes.data() + 32 + 4 + 4 + 64 + 32 + 8, &wrapping_dim,
+                sizeof(wrapping_dim));
+    fp = fopen(file_name.c_str(), "wb");
+    fwrite(bytes.data(), 1, bytes.size(), fp);
+    fclose(fp);
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd_read,
+                                       {"auto", false, false, false}));
+
+    // Not an O3DT file at all.
+    fp = fopen(file_name.c_str(), "wb");
+    fputs("0 0 0\n", fp);
+    fclose(fp);
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd_read,
+                                       {"auto", false, false, false}));
+    std::remove(file_name.c_str());
+}
+
+TEST(TPointCloudIO, ReadWritePCD) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_read_write.pcd";
+    // Enough points for several compressed chunks.
+    const int64_t num_points = 100000;
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor::Arange(0, num_points * 3, 1,
+                                       core::Dtype::Float32)
+                          .Reshape({num_points, 3}));
+    pcd.SetPointNormals(core::Tensor::Ones({num_points, 3},
+                                           core::Dtype::Float64));
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1,
+                                            core::Dtype::Int64)
+                               .To(core::Dtype::UInt8)
+                               .Reshape({num_points, 3}));
+    pcd.SetPointAttr("labels", core::Tensor::Arange(0, num_points, 1,
+                                                    core::Dtype::Int32)
+                                       .Reshape({num_points, 1}));
+    pcd.SetPointAttr("features",
+                     core::Tensor::Arange(0, num_points * 5, 1,
+                                          core::Dtype::UInt32)
+                             .Reshape({num_points, 5}));
+
+    for (bool ascii : {true, false}) {
+        for (bool compressed : {false, true}) {
+            SCOPED_TRACE(ascii ? "ascii"
+                               : compressed ? "compressed" : "binary");
+            EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd,
+                                               {ascii, compressed, false}));
+            t::geometry::PointCloud pcd_read;
+            EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                              {"auto", false, false, false}));
+            for (const std::string &key :
+                 {"points", "normals", "colors", "labels", "features"}) {
+                SCOPED_TRACE(key);
+                const core::Tensor &expected = pcd.GetPointAttr(key);
+                const core::Tensor &actual = pcd_read.GetPointAttr(key);
+                EXPECT_EQ(actual.GetDtype(), expected.GetDtype());
+                EXPECT_EQ(actual.GetShape(), expected.GetShape());
+                EXPECT_TRUE(actual.AllClose(expected, 0, 0));
+            }
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+TEST(TPointCloudIO, ReadPointCloudFromASCIIPCD) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_read_ascii.pcd";
+    FILE *fp = fopen(file_name.c_str(), "w");
+    // Incomplete lines are skipped, integers may be hexadecimal and unknown
+    // types are skipped.
+    fputs("# .PCD v0.7\n"
+          "VERSION 0.7\n"
+          "FIELDS x y z rgb label _ strange\n"
+          "SIZE 8 8 8 4 4 1 3\n"
+          "TYPE F F F U I U U\n"
+          "COUNT 1 1 1 1 1 1 1\n"
+          "WIDTH 3\n"
+          "HEIGHT 1\n"
+          "POINTS 3\n"
+          "DATA ascii\n"
+          "1.5 2 3 0xFF0000 -1 0 0\n"
+          "4 5\n"
+          "7 8 9e-1 255 0x10 0 0\r\n"
+          "10 11 12 65280 3 0 0\n",
+          fp);
+    fclose(fp);
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, false}));
+    EXPECT_TRUE(pcd.GetPoints().AllClose(core::Tensor::Init<double>(
+            {{1.5, 2, 3}, {7, 8, 0.9}, {10, 11, 12}})));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(core::Tensor::Init<uint8_t>(
+            {{255, 0, 0}, {0, 0, 255}, {0, 255, 0}})));
+    EXPECT_TRUE(pcd.GetPointAttr("label").AllClose(
+            core::Tensor::Init<int32_t>({{-1}, {16}, {3}})));
+    EXPECT_FALSE(pcd.HasPointAttr("_"));
+    EXPECT_FALSE(pcd.HasPointAttr("strange"));
+    std::remove(file_name.c_str());
+}
+
+TEST(TPointCloudIO, ReadPCDInvalidPointCount) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_invalid_count.pcd";
+    FILE *fp = fopen(file_name.c_str(), "wb");
+    // 12-byte records; the number of points times 12 wraps around to 8.
+    fputs("VERSION 0.7\n"
+          "FIELDS x y z\n"
+          "SIZE 4 4 4\n"
+          "TYPE F F F\n"
+          "COUNT 1 1 1\n"
+          "WIDTH 1\n"
+          "HEIGHT 1\n"
+          "POINTS 1537228672809129302\n"
+          "DATA binary\n",
+          fp);
+    const float record[3] = {1, 2, 3};
+    fwrite(record, sizeof(float), 3, fp);
+    fclose(fp);
+    t::geometry::PointCloud pcd;
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd,
+                                       {"auto", false, false, false}));
+    std::remove(file_name.c_str());
+}
+
 TEST_P(PointCloudIOPermuteDevices, WriteDeviceTestPLY) {
     core::Device device = GetParam();
     std::string filename = std::string(TEST_DATA_DIR) + "/test_write.ply";
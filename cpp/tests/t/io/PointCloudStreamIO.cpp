@@ -0,0 +1,232 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/t/io/PointCloudStreamIO.h"
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorKey.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+struct StreamArgs {
+    std::string extension;
+    bool write_ascii;
+    std::vector<std::string> attributes;
+    double atol;
+};
+
+const std::vector<StreamArgs> stream_args({
+        {"ply", false, {"points", "normals", "colors", "labels"}, 0},
+        {"ply", true, {"points", "normals", "colors", "labels"}, 0},
+        {"pcd", false, {"points", "normals", "colors", "labels"}, 0},
+        {"pcd", true, {"points", "normals", "colors", "labels"}, 0},
+        {"xyz", true, {"points"}, 1e-9},
+        {"pts", true, {"points", "intensities", "colors"}, 1e-9},
+});
+
+t::geometry::PointCloud CreatePointCloud(int64_t num_points) {
+    t::geometry::PointCloud pcd(core::Tensor::Arange(
+            0, num_points * 3, 1, core::Dtype::Float64, core::Device("CPU:0"))
+                                        .Reshape({num_points, 3}) /
+                                3.0);
+    pcd.SetPointNormals(pcd.GetPoints().To(core::Dtype::Float32) * 0.5);
+    // Casting to UInt8 wraps the values to [0, 255].
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1,
+                                            core::Dtype::Int64,
+                                            core::Device("CPU:0"))
+                               .To(core::Dtype::UInt8)
+                               .Reshape({num_points, 3}));
+    pcd.SetPointAttr("intensities", pcd.GetPoints().Slice(1, 0, 1) * 2.0);
+    pcd.SetPointAttr("labels", core::Tensor::Arange(0, num_points, 1,
+                                                    core::Dtype::Int32,
+                                                    core::Device("CPU:0"))
+                                       .Reshape({num_points, 1}));
+    return pcd;
+}
+
+/// Reads all chunks of \p filename into one point cloud.
+t::geometry::PointCloud ReadInChunks(const std::string &filename,
+                                     int64_t max_points,
+                                     int64_t &num_chunks) {
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(filename));
+    std::vector<t::geometry::PointCloud> chunks;
+    while (!reader.IsEOF()) {
+        chunks.push_back(reader.Next(max_points));
+        EXPECT_LE(chunks.back().GetPoints().GetLength(), max_points);
+    }
+    num_chunks = static_cast<int64_t>(chunks.size());
+
+    t::geometry::PointCloud pcd;
+    int64_t num_points = 0;
+    for (const auto &chunk : chunks) {
+        num_points += chunk.GetPoints().GetLength();
+    }
+    for (const auto &kv : chunks[0].GetPointAttr()) {
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = num_points;
+        core::Tensor attr = core::Tensor::Empty(shape, kv.second.GetDtype());
+        int64_t offset = 0;
+        for (const auto &chunk : chunks) {
+            const core::Tensor &value = chunk.GetPointAttr(kv.first);
+            attr.SetItem(core::TensorKey::Slice(offset,
+                                                offset + value.GetLength(), 1),
+                         value);
+            offset += value.GetLength();
+        }
+        pcd.SetPointAttr(kv.first, attr);
+    }
+    return pcd;
+}
+
+}  // namespace
+
+class PointCloudStreamIO : public testing::TestWithParam<StreamArgs> {};
+INSTANTIATE_TEST_SUITE_P(PointCloudStreamIO,
+                         PointCloudStreamIO,
+                         testing::ValuesIn(stream_args));
+
+TEST_P(PointCloudStreamIO, WriteReadChunks) {
+    const StreamArgs args = GetParam();
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_stream." + args.extension;
+    const int64_t num_points = 1000;
+    t::geometry::PointCloud pcd_all = CreatePointCloud(num_points);
+    t::geometry::PointCloud pcd;
+    for (const std::string &key : args.attributes) {
+        pcd.SetPointAttr(key, pcd_all.GetPointAttr(key));
+    }
+
+    t::io::PointCloudWriter writer;
+    EXPECT_TRUE(writer.Open(filename, {args.write_ascii, false, false}));
+    for (int64_t begin = 0; begin < num_points; begin += 300) {
+        const int64_t end = std::min(begin + 300, num_points);
+        t::geometry::PointCloud chunk;
+        for (const auto &kv : pcd.GetPointAttr()) {
+            chunk.SetPointAttr(kv.first, kv.second.Slice(0, begin, end));
+        }
+        EXPECT_TRUE(writer.Write(chunk));
+    }
+    EXPECT_EQ(writer.GetNumPoints(), num_points);
+    EXPECT_TRUE(writer.Close());
+
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(filename));
+    EXPECT_EQ(reader.GetNumPoints(), args.extension == "xyz" ? -1 : num_points);
+    reader.Close();
+
+    int64_t num_chunks = 0;
+    t::geometry::PointCloud pcd_read = ReadInChunks(filename, 128, num_chunks);
+    EXPECT_GE(num_chunks, 8);
+    EXPECT_EQ(pcd_read.GetPointAttr().size(), args.attributes.size());
+    for (const std::string &key : args.attributes) {
+        SCOPED_TRACE(key);
+        core::Tensor expected = pcd.GetPointAttr(key);
+        core::Tensor actual = pcd_read.GetPointAttr(key);
+        EXPECT_EQ(actual.GetShape(), expected.GetShape());
+        EXPECT_TRUE(actual.To(core::Dtype::Float64)
+                            .AllClose(expected.To(core::Dtype::Float64), 0,
+                                      args.atol));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(PointCloudStreamIO, ReadMatchesReadPointCloud) {
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_stream_read.ply";
+    t::geometry::PointCloud pcd = CreatePointCloud(500);
+    EXPECT_TRUE(t::io::WritePointCloud(filename, pcd));
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read,
+                                      {"auto", false, false, false}));
+
+    int64_t num_chunks = 0;
+    t::geometry::PointCloud pcd_stream = ReadInChunks(filename, 64, num_chunks);
+    EXPECT_EQ(num_chunks, 8);
+    EXPECT_EQ(pcd_stream.GetPointAttr().size(),
+              pcd_read.GetPointAttr().size());
+    for (const auto &kv : pcd_read.GetPointAttr()) {
+        SCOPED_TRACE(kv.first);
+        EXPECT_EQ(pcd_stream.GetPointAttr(kv.first).GetDtype(),
+                  kv.second.GetDtype());
+        EXPECT_TRUE(
+                pcd_stream.GetPointAttr(kv.first).AllClose(kv.second, 0, 0));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(PointCloudStreamIO, StreamedPLYIsReadable) {
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_stream_write.ply";
+    t::geometry::PointCloud pcd = CreatePointCloud(100);
+    t::io::PointCloudWriter writer;
+    EXPECT_TRUE(writer.Open(filename));
+    EXPECT_TRUE(writer.Write(pcd));
+    EXPECT_TRUE(writer.Write(pcd));
+    EXPECT_TRUE(writer.Close());
+
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read,
+                                      {"auto", false, false, false}));
+    EXPECT_EQ(pcd_read.GetPoints().GetLength(), 200);
+    EXPECT_TRUE(pcd_read.GetPoints()
+                        .Slice(0, 100, 200)
+                        .AllClose(pcd.GetPoints(), 0, 0));
+    std::remove(filename.c_str());
+}
+
+TEST(PointCloudStreamIO, WriteMismatchedChunk) {
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_stream_mismatch.ply";
+    t::geometry::PointCloud pcd = CreatePointCloud(10);
+    t::io::PointCloudWriter writer;
+    EXPECT_TRUE(writer.Open(filename));
+    EXPECT_TRUE(writer.Write(pcd));
+
+    t::geometry::PointCloud missing_colors = pcd.Clone();
+    missing_colors.RemovePointAttr("colors");
+    EXPECT_FALSE(writer.Write(missing_colors));
+
+    t::geometry::PointCloud other_dtype = pcd.Clone();
+    other_dtype.SetPointNormals(
+            other_dtype.GetPointNormals().To(core::Dtype::Float64));
+    EXPECT_FALSE(writer.Write(other_dtype));
+
+    EXPECT_EQ(writer.GetNumPoints(), 10);
+    EXPECT_TRUE(writer.Close());
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,249 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TiledPointCloudStore.h"
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Writes num_points random points in [0, 10]^3 to a binary PLY file. Point i
+// has label i.
+static std::vector<Eigen::Vector3d> WriteRandomPointCloud(
+        const std::string &filename, int64_t num_points) {
+    std::vector<Eigen::Vector3d> points(num_points);
+    Rand(points, Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(10.0), 0);
+    std::vector<double> values;
+    for (const Eigen::Vector3d &point : points) {
+        values.insert(values.end(), point.data(), point.data() + 3);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(values, {num_points, 3}, core::Dtype::Float64));
+    pcd.SetPointAttr("labels",
+                     core::Tensor::Arange(0, num_points, 1, core::Dtype::Int32)
+                             .Reshape({num_points, 1}));
+    EXPECT_TRUE(t::io::WritePointCloud(filename, pcd));
+    return points;
+}
+
+static void DeleteStore(const std::string &path, int max_level) {
+    for (int level = 0; level <= max_level; ++level) {
+        std::string level_path = fmt::format("{}/{}", path, level);
+        std::vector<std::string> filenames;
+        utility::filesystem::ListFilesInDirectory(level_path, filenames);
+        for (const std::string &filename : filenames) {
+            utility::filesystem::RemoveFile(filename);
+        }
+        utility::filesystem::DeleteDirectory(level_path);
+    }
+    utility::filesystem::RemoveFile(path + "/index.json");
+    utility::filesystem::DeleteDirectory(path);
+}
+
+static std::vector<int32_t> GetSortedLabels(
+        const t::geometry::PointCloud &pcd) {
+    if (pcd.IsEmpty()) return {};
+    std::vector<int32_t> labels =
+            pcd.GetPointAttr("labels").ToFlatVector<int32_t>();
+    std::sort(labels.begin(), labels.end());
+    return labels;
+}
+
+class TiledPointCloudStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        input_ = std::string(TEST_DATA_DIR) + "/test_tiled_input.ply";
+        store_path_ = std::string(TEST_DATA_DIR) + "/test_tiled_store";
+        points_ = WriteRandomPointCloud(input_, 20000);
+        option_.max_level = 3;
+        option_.grid_size = 8;
+        option_.chunk_size = 3000;
+        // Forces tiles to be written in several parts.
+        option_.max_buffered_points = 5000;
+        ASSERT_TRUE(t::io::BuildTiledPointCloudStore(input_, store_path_,
+                                                     option_));
+        ASSERT_TRUE(store_.Open(store_path_));
+    }
+
+    void TearDown() override {
+        store_.Close();
+        DeleteStore(store_path_, option_.max_level);
+        utility::filesystem::RemoveFile(input_);
+    }
+
+    std::string input_;
+    std::string store_path_;
+    std::vector<Eigen::Vector3d> points_;
+    t::io::TiledPointCloudStoreOption option_;
+    t::io::TiledPointCloudStore store_;
+};
+
+TEST_F(TiledPointCloudStoreTest, Build) {
+    EXPECT_EQ(store_.GetNumPoints(), 20000);
+    EXPECT_EQ(store_.GetMaxLevel(), 3);
+    int64_t num_points = 0;
+    for (const auto &kv : store_.GetTiles()) {
+        EXPECT_TRUE(utility::filesystem::FileExists(
+                store_.GetTilePath(kv.first)));
+        t::geometry::PointCloud tile;
+        EXPECT_TRUE(t::io::ReadPointCloud(store_.GetTilePath(kv.first), tile,
+                                          {"auto", false, false, false}));
+        EXPECT_EQ(tile.GetPoints().GetLength(), kv.second);
+        num_points += kv.second;
+    }
+    EXPECT_EQ(num_points, 20000);
+
+    // Only the merged tiles remain.
+    int64_t num_files = 0;
+    for (int level = 0; level <= option_.max_level; ++level) {
+        std::vector<std::string> filenames;
+        utility::filesystem::ListFilesInDirectory(
+                fmt::format("{}/{}", store_path_, level), filenames);
+        num_files += int64_t(filenames.size());
+    }
+    EXPECT_EQ(num_files, int64_t(store_.GetTiles().size()));
+    EXPECT_FALSE(utility::filesystem::DirectoryExists(store_path_ +
+                                                      "/staging"));
+
+    // Level 0 has a single tile, sampled with one point per cell.
+    EXPECT_EQ(store_.GetTiles().count({0, 0, 0, 0}), 1u);
+    EXPECT_LE(store_.GetTiles().at({0, 0, 0, 0}), 8 * 8 * 8);
+}
+
+TEST_F(TiledPointCloudStoreTest, QueryFullDensity) {
+    t::geometry::PointCloud all = store_.Query(store_.GetBoundingBox());
+    std::vector<int32_t> labels = GetSortedLabels(all);
+    ASSERT_EQ(labels.size(), 20000u);
+    for (int32_t i = 0; i < 20000; ++i) {
+        EXPECT_EQ(labels[i], i);
+    }
+
+    geometry::AxisAlignedBoundingBox box(Eigen::Vector3d(1.0, 2.0, 3.0),
+                                         Eigen::Vector3d(3.5, 4.0, 4.5));
+    int64_t num_tiles_read = store_.GetNumTilesRead();
+    t::geometry::PointCloud block = store_.Query(box);
+    std::vector<int32_t> expected;
+    for (int32_t i = 0; i < int32_t(points_.size()); ++i) {
+        if ((points_[i].array() >= box.min_bound_.array()).all() &&
+            (points_[i].array() <= box.max_bound_.array()).all()) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(GetSortedLabels(block), expected);
+    EXPECT_LT(store_.GetNumTilesRead() - num_tiles_read,
+              int64_t(store_.GetTiles().size()));
+}
+
+TEST_F(TiledPointCloudStoreTest, QueryLevelOfDetail) {
+    double spacing = store_.GetLevelSpacing(1);
+    EXPECT_EQ(store_.GetLevelForSpacing(spacing), 1);
+    EXPECT_EQ(store_.GetLevelForSpacing(spacing * 1.5), 1);
+    EXPECT_EQ(store_.GetLevelForSpacing(spacing * 0.9), 2);
+    EXPECT_EQ(store_.GetLevelForSpacing(0.0), 3);
+
+    // Levels 0 and 1 keep at most one point per cell of level 1.
+    t::geometry::PointCloud coarse =
+            store_.Query(store_.GetBoundingBox(), spacing);
+    int64_t num_points = coarse.GetPoints().GetLength();
+    EXPECT_GT(num_points, 0);
+    EXPECT_LT(num_points, 20000);
+    std::set<std::tuple<int, int, int>> cells;
+    Eigen::Vector3d origin = store_.GetBoundingBox().min_bound_;
+    std::vector<double> values = coarse.GetPoints().ToFlatVector<double>();
+    for (int64_t i = 0; i < num_points; ++i) {
+        Eigen::Vector3d cell =
+                (Eigen::Map<Eigen::Vector3d>(&values[3 * i]) - origin) /
+                spacing;
+        EXPECT_TRUE(cells.emplace(int(cell(0)), int(cell(1)), int(cell(2)))
+                            .second);
+    }
+
+    // Finer levels add points.
+    t::geometry::PointCloud fine =
+            store_.Query(store_.GetBoundingBox(), spacing * 0.9);
+    EXPECT_GT(fine.GetPoints().GetLength(), num_points);
+
+    // Boxes outside the store read nothing.
+    int64_t num_tiles_read = store_.GetNumTilesRead();
+    EXPECT_TRUE(store_
+                        .Query(geometry::AxisAlignedBoundingBox(
+                                Eigen::Vector3d::Constant(20.0),
+                                Eigen::Vector3d::Constant(30.0)))
+                        .IsEmpty());
+    EXPECT_EQ(store_.GetNumTilesRead(), num_tiles_read);
+}
+
+TEST_F(TiledPointCloudStoreTest, OpenInvalidIndex) {
+    store_.Query(store_.GetBoundingBox());
+    store_.Close();
+    EXPECT_EQ(store_.GetNumTilesRead(), 0);
+
+    const std::string index_path = store_path_ + "/index.json";
+    for (const std::string &layout :
+         {"\"max_level\": 63, \"grid_size\": 8",
+          "\"max_level\": 3, \"grid_size\": 0",
+          "\"max_level\": 3, \"grid_size\": 1048576"}) {
+        std::ofstream(index_path)
+                << "{\"version\": 1, \"origin\": [0, 0, 0], \"size\": 1, "
+                << layout << ", \"num_points\": 0, \"tiles\": []}";
+        EXPECT_FALSE(store_.Open(store_path_)) << layout;
+        EXPECT_FALSE(store_.IsOpened());
+    }
+    std::ofstream(index_path)
+            << "{\"version\": 1, \"origin\": [0, 0, 0], \"size\": 1, "
+               "\"max_level\": 3, \"grid_size\": 8, \"num_points\": 1, "
+               "\"tiles\": [[1, 2, 0, 0, 1]]}";
+    EXPECT_FALSE(store_.Open(store_path_));
+}
+
+TEST(TiledPointCloudStore, InvalidInput) {
+    t::io::TiledPointCloudStore store;
+    EXPECT_FALSE(store.Open(std::string(TEST_DATA_DIR) + "/missing_store"));
+    EXPECT_FALSE(store.IsOpened());
+    EXPECT_FALSE(t::io::BuildTiledPointCloudStore(
+            std::string(TEST_DATA_DIR) + "/missing.ply",
+            std::string(TEST_DATA_DIR) + "/missing_store"));
+
+    t::io::TiledPointCloudStoreOption option;
+    option.max_level = 20;
+    option.grid_size = 4;
+    EXPECT_FALSE(t::io::BuildTiledPointCloudStore(
+            std::string(TEST_DATA_DIR) + "/missing.ply",
+            std::string(TEST_DATA_DIR) + "/missing_store", option));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -28,6 +28,8 @@
 
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -91,6 +93,52 @@ TEST(TriangleMeshIO, ReadWriteTriangleMeshOBJ) {
     std::remove(file_name.c_str());
 }
 
+TEST(TriangleMeshIO, ReadWriteTriangleMeshO3DT) {
+    t::geometry::TriangleMesh mesh, mesh_read;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(TEST_DATA_DIR "/knot.ply", mesh));
+    mesh.SetTriangleAttr(
+            "labels", core::Tensor::Ones({mesh.GetTriangles().GetLength()},
+                                         core::Dtype::Int32));
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_mesh.o3dt";
+    EXPECT_TRUE(t::io::WriteTriangleMesh(file_name, mesh));
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read));
+    EXPECT_TRUE(
+            mesh.GetTriangles().AllClose(mesh_read.GetTriangles(), 0, 0));
+    EXPECT_TRUE(mesh.GetVertices().AllClose(mesh_read.GetVertices(), 0, 0));
+    EXPECT_TRUE(mesh.GetTriangleAttr("labels").AllClose(
+            mesh_read.GetTriangleAttr("labels"), 0, 0));
+    EXPECT_EQ(mesh_read.GetVertexAttr().size(), mesh.GetVertexAttr().size());
+
+    // Point clouds and meshes are not interchangeable.
+    t::geometry::PointCloud pcd;
+    EXPECT_FALSE(t::io::ReadPointCloud(file_name, pcd));
+    std::remove(file_name.c_str());
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshO3DTInvalid) {
+    t::geometry::TriangleMesh mesh, mesh_read;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(TEST_DATA_DIR "/knot.ply", mesh));
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_invalid.o3dt";
+    EXPECT_TRUE(t::io::WriteTriangleMesh(file_name, mesh));
+
+    // Truncated files fail to read instead of throwing.
+    std::vector<char> bytes;
+    EXPECT_TRUE(utility::filesystem::FReadToBuffer(file_name, bytes, nullptr));
+    FILE *fp = fopen(file_name.c_str(), "wb");
+    fwrite(bytes.data(), 1, bytes.size() / 2, fp);
+    fclose(fp);
+    EXPECT_FALSE(t::io::ReadTriangleMesh(file_name, mesh_read));
+
+    // A mesh without triangles is read as it is.
+    t::geometry::TriangleMesh vertex_only;
+    vertex_only.SetVertices(mesh.GetVertices());
+    EXPECT_TRUE(t::io::WriteTriangleMesh(file_name, vertex_only));
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read));
+    EXPECT_FALSE(mesh_read.HasTriangles());
+    EXPECT_TRUE(mesh_read.GetVertices().AllClose(mesh.GetVertices(), 0, 0));
+    std::remove(file_name.c_str());
+}
+
 // TODO: Add tests for triangle_uvs, materials, triangle_material_ids and
 // textures once these are supported.
 TEST(TriangleMeshIO, TriangleMeshLegecyCompatibility) {
@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/AsyncRGBDVideoReader.h"
+
+#include <chrono>
+#include <thread>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Synthetic reader returning num_frames frames. Frame i has depth value i and
+// timestamp 1000 * i.
+class SyntheticRGBDVideoReader : public t::io::RGBDVideoReader {
+public:
+    explicit SyntheticRGBDVideoReader(int num_frames, int fail_at = -1)
+        : num_frames_(num_frames), fail_at_(fail_at) {
+        metadata_.depth_scale_ = 1000.0;
+        metadata_.stream_length_usec_ = 1000 * num_frames;
+    }
+    bool IsOpened() const override { return is_opened_; }
+    bool IsEOF() const override { return next_ > num_frames_; }
+    bool Open(const std::string &filename) override {
+        is_opened_ = true;
+        next_ = 0;
+        return true;
+    }
+    void Close() override { is_opened_ = false; }
+    t::io::RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+    const t::io::RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+    bool SeekTimestamp(uint64_t timestamp) override {
+        next_ = static_cast<int>(timestamp / 1000);
+        return true;
+    }
+    uint64_t GetTimestamp() const override { return 1000 * (next_ - 1); }
+    t::geometry::RGBDImage NextFrame() override {
+        if (next_ == fail_at_) {
+            utility::LogError("Synthetic failure at frame {}.", next_);
+        }
+        if (next_ >= num_frames_) {
+            next_ = num_frames_ + 1;
+            return t::geometry::RGBDImage();
+        }
+        core::Tensor color = core::Tensor::Zeros({2, 3, 3}, core::Dtype::UInt8);
+        core::Tensor depth = core::Tensor::Full({2, 3, 1}, uint16_t(next_),
+                                                core::Dtype::UInt16);
+        ++next_;
+        return t::geometry::RGBDImage(t::geometry::Image(color),
+                                      t::geometry::Image(depth));
+    }
+    std::string GetFilename() const override { return "synthetic"; }
+
+private:
+    t::io::RGBDVideoMetadata metadata_;
+    int num_frames_;
+    int fail_at_;
+    int next_ = 0;
+    bool is_opened_ = false;
+};
+
+static std::unique_ptr<t::io::RGBDVideoReader> OpenSynthetic(
+        int num_frames, int fail_at = -1) {
+    auto reader = std::make_unique<SyntheticRGBDVideoReader>(num_frames,
+                                                             fail_at);
+    reader->Open("synthetic");
+    return reader;
+}
+
+TEST(AsyncRGBDVideoReader, ReadAllFrames) {
+    t::io::AsyncRGBDVideoReader reader(OpenSynthetic(20), 4);
+    EXPECT_TRUE(reader.IsOpened());
+    for (int i = 0; i < 20; ++i) {
+        if (i % 5 == 0) {
+            // Let the prefetch thread fill the buffer.
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            EXPECT_LE(reader.GetQueueDepth(), 4u);
+        }
+        t::geometry::RGBDImage frame = reader.NextFrame();
+        ASSERT_FALSE(frame.IsEmpty());
+        EXPECT_EQ(frame.depth_.AsTensor()[0][0][0].Item<uint16_t>(), i);
+        EXPECT_EQ(reader.GetTimestamp(), uint64_t(1000 * i));
+    }
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_EQ(reader.GetNumDroppedFrames(), 0u);
+}
+
+TEST(AsyncRGBDVideoReader, SeekTimestamp) {
+    t::io::AsyncRGBDVideoReader reader(OpenSynthetic(10), 3);
+    reader.NextFrame();
+    EXPECT_TRUE(reader.SeekTimestamp(7000));
+    t::geometry::RGBDImage frame = reader.NextFrame();
+    EXPECT_EQ(frame.depth_.AsTensor()[0][0][0].Item<uint16_t>(), 7);
+    EXPECT_EQ(reader.GetTimestamp(), 7000u);
+}
+
+TEST(AsyncRGBDVideoReader, ConvertDepthToFloat) {
+    t::io::AsyncRGBDVideoReader reader(OpenSynthetic(5), 2,
+                                       /*drop_frames=*/false,
+                                       /*convert_depth_to_float=*/true);
+    reader.NextFrame();
+    t::geometry::RGBDImage frame = reader.NextFrame();
+    EXPECT_EQ(frame.depth_.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(frame.color_.GetDtype(), core::Dtype::UInt8);
+    EXPECT_FLOAT_EQ(frame.depth_.AsTensor()[1][2][0].Item<float>(), 0.001f);
+}
+
+TEST(AsyncRGBDVideoReader, DropFrames) {
+    t::io::AsyncRGBDVideoReader reader(OpenSynthetic(50), 2,
+                                       /*drop_frames=*/true);
+    // The prefetch thread reaches the end of the stream while no frame is
+    // taken, keeping only the last two frames.
+    while (!reader.IsEOF() && reader.GetNumDroppedFrames() < 48) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(reader.GetNumDroppedFrames(), 48u);
+    EXPECT_EQ(reader.NextFrame().depth_.AsTensor()[0][0][0].Item<uint16_t>(),
+              48);
+    EXPECT_EQ(reader.NextFrame().depth_.AsTensor()[0][0][0].Item<uint16_t>(),
+              49);
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+}
+
+TEST(AsyncRGBDVideoReader, PropagateException) {
+    t::io::AsyncRGBDVideoReader reader(OpenSynthetic(10, 3), 8);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_FALSE(reader.NextFrame().IsEmpty());
+    }
+    EXPECT_ANY_THROW(reader.NextFrame());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,209 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDSequenceReader.h"
+
+#include <fstream>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/sensor/AsyncRGBDVideoReader.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+// Writes num_frames 4x6 frames to <path>/color and <path>/depth. Frame i has
+// color value i and depth value 100 * i.
+static void WriteSequence(const std::string &path, int num_frames) {
+    utility::filesystem::MakeDirectoryHierarchy(path + "/color");
+    utility::filesystem::MakeDirectoryHierarchy(path + "/depth");
+    for (int i = 0; i < num_frames; ++i) {
+        t::geometry::Image color(core::Tensor::Full({4, 6, 3}, uint8_t(i),
+                                                    core::Dtype::UInt8));
+        t::geometry::Image depth(core::Tensor::Full(
+                {4, 6, 1}, uint16_t(100 * i), core::Dtype::UInt16));
+        EXPECT_TRUE(t::io::WriteImage(
+                fmt::format("{}/color/{:05d}.png", path, i), color));
+        EXPECT_TRUE(t::io::WriteImage(
+                fmt::format("{}/depth/{:05d}.png", path, i), depth));
+    }
+}
+
+static void DeleteSequence(const std::string &path) {
+    for (const std::string subdir : {"/color", "/depth"}) {
+        std::vector<std::string> filenames;
+        utility::filesystem::ListFilesInDirectory(path + subdir, filenames);
+        for (const std::string &filename : filenames) {
+            utility::filesystem::RemoveFile(filename);
+        }
+        utility::filesystem::DeleteDirectory(path + subdir);
+    }
+    std::vector<std::string> filenames;
+    utility::filesystem::ListFilesInDirectory(path, filenames);
+    for (const std::string &filename : filenames) {
+        utility::filesystem::RemoveFile(filename);
+    }
+    utility::filesystem::DeleteDirectory(path);
+}
+
+static void ExpectFrame(const t::geometry::RGBDImage &frame, int i) {
+    ASSERT_FALSE(frame.IsEmpty());
+    EXPECT_EQ(frame.color_.AsTensor()[3][5][2].Item<uint8_t>(), i);
+    EXPECT_EQ(frame.depth_.AsTensor()[3][5][0].Item<uint16_t>(), 100 * i);
+}
+
+TEST(RGBDSequenceReader, ReadDirectory) {
+    const std::string path =
+            std::string(TEST_DATA_DIR) + "/temp_rgbd_sequence";
+    WriteSequence(path, 7);
+
+    t::io::RGBDSequenceReader reader(1000.0, 30.0, /*batch_size=*/3);
+    ASSERT_TRUE(reader.Open(path));
+    EXPECT_EQ(reader.GetNumFrames(), 7u);
+    EXPECT_EQ(reader.GetMetadata().width_, 6);
+    EXPECT_EQ(reader.GetMetadata().height_, 4);
+    EXPECT_EQ(reader.GetMetadata().depth_dt_, core::Dtype::UInt16);
+    EXPECT_EQ(reader.GetMetadata().depth_scale_, 1000.0);
+    for (int i = 0; i < 7; ++i) {
+        ExpectFrame(reader.NextFrame(), i);
+        EXPECT_FALSE(reader.IsEOF());
+        EXPECT_EQ(reader.GetTimestamp(), uint64_t(std::llround(i * 1e6 / 30)));
+    }
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+    EXPECT_TRUE(reader.IsEOF());
+
+    // Seek backwards into an already decoded batch.
+    EXPECT_TRUE(reader.SeekTimestamp(uint64_t(5 * 1e6 / 30)));
+    EXPECT_FALSE(reader.IsEOF());
+    ExpectFrame(reader.NextFrame(), 5);
+    EXPECT_TRUE(reader.SeekTimestamp(1));
+    ExpectFrame(reader.NextFrame(), 1);
+    EXPECT_FALSE(reader.SeekTimestamp(uint64_t(1e7)));
+
+    // The factory function recognizes directories.
+    auto created = t::io::RGBDVideoReader::Create(path);
+    EXPECT_TRUE(created->IsOpened());
+    ExpectFrame(created->NextFrame(), 0);
+
+    DeleteSequence(path);
+}
+
+TEST(RGBDSequenceReader, ReadAssociations) {
+    const std::string path =
+            std::string(TEST_DATA_DIR) + "/temp_rgbd_associations";
+    WriteSequence(path, 4);
+
+    // TUM layout with timestamps in seconds.
+    {
+        std::ofstream file(path + "/associations.txt");
+        file << "# TUM associations\n";
+        for (int i = 0; i < 4; ++i) {
+            file << fmt::format(
+                    "1305031102.{0:d}5 color/{1:05d}.png "
+                    "1305031102.{0:d}6 depth/{1:05d}.png\n",
+                    2 * i, i);
+        }
+    }
+    t::io::RGBDSequenceReader reader(5000.0);
+    ASSERT_TRUE(reader.Open(path));
+    EXPECT_EQ(reader.GetNumFrames(), 4u);
+    EXPECT_EQ(reader.GetMetadata().depth_scale_, 5000.0);
+    EXPECT_NEAR(reader.GetMetadata().fps_, 5.0, 1e-6);
+    for (int i = 0; i < 4; ++i) {
+        ExpectFrame(reader.NextFrame(), i);
+        EXPECT_EQ(reader.GetTimestamp(), uint64_t(200000 * i));
+    }
+
+    // ICL-NUIM layout with depth first and frame numbers.
+    {
+        std::ofstream file(path + "/icl.txt");
+        for (int i = 0; i < 4; ++i) {
+            file << fmt::format("{0} depth/{0:05d}.png {0} color/{0:05d}.png\n",
+                                i);
+        }
+    }
+    ASSERT_TRUE(reader.Open(path + "/icl.txt"));
+    EXPECT_EQ(reader.GetNumFrames(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        ExpectFrame(reader.NextFrame(), i);
+        EXPECT_EQ(reader.GetTimestamp(), uint64_t(std::llround(i * 1e6 / 30)));
+    }
+
+    DeleteSequence(path);
+}
+
+TEST(RGBDSequenceReader, ReuseBuffers) {
+    const std::string path = std::string(TEST_DATA_DIR) + "/temp_rgbd_reuse";
+    WriteSequence(path, 6);
+
+    t::io::RGBDSequenceReader reader(1000.0, 30.0, /*batch_size=*/2);
+    ASSERT_TRUE(reader.Open(path));
+    const void *color_ptr = reader.NextFrame().color_.GetDataPtr();
+    t::geometry::RGBDImage kept = reader.NextFrame();
+
+    // Frame 0 was released and its buffers are reused for frame 2. Frame 1 is
+    // still held, so frame 3 gets new buffers.
+    t::geometry::RGBDImage frame = reader.NextFrame();
+    ExpectFrame(frame, 2);
+    EXPECT_EQ(frame.color_.GetDataPtr(), color_ptr);
+    ExpectFrame(reader.NextFrame(), 3);
+    ExpectFrame(kept, 1);
+
+    DeleteSequence(path);
+}
+
+TEST(RGBDSequenceReader, AsyncPrefetch) {
+    const std::string path = std::string(TEST_DATA_DIR) + "/temp_rgbd_async";
+    WriteSequence(path, 10);
+
+    auto sequence = std::make_unique<t::io::RGBDSequenceReader>(1000.0, 30.0,
+                                                                 4);
+    ASSERT_TRUE(sequence->Open(path));
+    t::io::AsyncRGBDVideoReader reader(std::move(sequence), 3,
+                                       /*drop_frames=*/false,
+                                       /*convert_depth_to_float=*/true);
+    for (int i = 0; i < 10; ++i) {
+        t::geometry::RGBDImage frame = reader.NextFrame();
+        ASSERT_FALSE(frame.IsEmpty());
+        EXPECT_FLOAT_EQ(frame.depth_.AsTensor()[0][0][0].Item<float>(),
+                        0.1f * i);
+    }
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+    EXPECT_TRUE(reader.IsEOF());
+
+    DeleteSequence(path);
+}
+
+TEST(RGBDSequenceReader, OpenInvalid) {
+    t::io::RGBDSequenceReader reader;
+    EXPECT_FALSE(reader.Open(std::string(TEST_DATA_DIR) + "/does_not_exist"));
+    EXPECT_FALSE(reader.IsOpened());
+    EXPECT_FALSE(reader.Open(std::string(TEST_DATA_DIR)));
+}
+
+}  // namespace tests
+}  // namespace open3d